@@ -0,0 +1,237 @@
+// 스레드 간 큐 처리량 비교.
+//
+// 기준은 기존에 쓰던 std::mutex + std::deque이며, 같은 생산자/소비자 구성에서
+// MpmcQueue, SpscRing, MpscQueue가 초당 몇 개의 항목을 넘기는지 출력합니다.
+// 사용법: axis-bench-queues [항목 수(백만 단위, 기본 4)] [최대 스레드 수(기본 16)]
+//
+// 이 파일 하나가 axis-bench-queues 실행 파일입니다. main이 있으므로 axis-bench(src/)와 섞지 않습니다.
+
+#include "axis/core/MpmcQueue.h"
+#include "axis/core/MpscQueue.h"
+#include "axis/core/SpscRing.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr uint32_t kQueueCapacity = 1u << 14;
+
+    // 모든 스레드가 준비된 뒤 동시에 출발시켜 스레드 생성 비용을 측정에서 뺍니다.
+    class StartGate
+    {
+    public:
+        explicit StartGate(uint32_t threads)
+            : m_waiting(threads)
+        {
+        }
+
+        void arriveAndWait()
+        {
+            m_waiting.fetch_sub(1, std::memory_order_acq_rel);
+            while (m_waiting.load(std::memory_order_acquire) != 0)
+            {
+                axis::cpuRelax();
+            }
+        }
+
+    private:
+        std::atomic<uint32_t> m_waiting;
+    };
+
+    struct Result
+    {
+        double millionPerSecond;
+        uint64_t checksum;
+    };
+
+    // producers개의 스레드가 각각 itemsPerProducer개를 넣고 consumers개의 스레드가 모두 꺼냅니다.
+    // push(producer, index, value)/pop(out)은 실패하면 false를 반환하는 비차단 연산이어야 합니다.
+    template <typename Push, typename Pop>
+    Result runChannel(uint32_t producers, uint32_t consumers, uint64_t itemsPerProducer, Push push, Pop pop)
+    {
+        const uint64_t total = itemsPerProducer * producers;
+        std::atomic<uint64_t> consumed{0};
+        std::atomic<uint64_t> checksum{0};
+        StartGate gate(producers + consumers + 1);
+
+        std::vector<std::thread> threads;
+        for (uint32_t p = 0; p < producers; ++p)
+        {
+            threads.emplace_back([&, p] {
+                gate.arriveAndWait();
+                for (uint64_t i = 0; i < itemsPerProducer; ++i)
+                {
+                    const uint64_t value = (uint64_t(p) << 40) | (i + 1);
+                    while (!push(p, i, value))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (uint32_t c = 0; c < consumers; ++c)
+        {
+            threads.emplace_back([&] {
+                gate.arriveAndWait();
+                uint64_t localSum = 0;
+                uint64_t localCount = 0;
+                while (consumed.load(std::memory_order_relaxed) < total)
+                {
+                    uint64_t value;
+                    if (pop(value))
+                    {
+                        localSum += value;
+                        if (++localCount == 256)
+                        {
+                            consumed.fetch_add(localCount, std::memory_order_relaxed);
+                            localCount = 0;
+                        }
+                    }
+                    else
+                    {
+                        consumed.fetch_add(localCount, std::memory_order_relaxed);
+                        localCount = 0;
+                        std::this_thread::yield();
+                    }
+                }
+                consumed.fetch_add(localCount, std::memory_order_relaxed);
+                checksum.fetch_add(localSum, std::memory_order_relaxed);
+            });
+        }
+
+        gate.arriveAndWait();
+        const Clock::time_point begin = Clock::now();
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        const double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+        return Result{double(total) / seconds / 1e6, checksum.load()};
+    }
+
+    uint64_t expectedChecksum(uint32_t producers, uint64_t itemsPerProducer)
+    {
+        uint64_t sum = 0;
+        for (uint32_t p = 0; p < producers; ++p)
+        {
+            sum += (uint64_t(p) << 40) * itemsPerProducer + itemsPerProducer * (itemsPerProducer + 1) / 2;
+        }
+        return sum;
+    }
+
+    void report(const char* name, uint32_t producers, uint32_t consumers, uint64_t itemsPerProducer,
+                const Result& result)
+    {
+        const bool valid = result.checksum == expectedChecksum(producers, itemsPerProducer);
+        std::printf("%-14s %3up/%3uc  %9.2f M/s%s\n", name, producers, consumers, result.millionPerSecond,
+                    valid ? "" : "  [checksum mismatch]");
+    }
+
+    Result runMutexDeque(uint32_t producers, uint32_t consumers, uint64_t items)
+    {
+        std::mutex mutex;
+        std::deque<uint64_t> queue;
+        return runChannel(
+            producers, consumers, items,
+            [&](uint32_t, uint64_t, uint64_t value) {
+                std::lock_guard<std::mutex> lock(mutex);
+                queue.push_back(value);
+                return true;
+            },
+            [&](uint64_t& out) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (queue.empty())
+                {
+                    return false;
+                }
+                out = queue.front();
+                queue.pop_front();
+                return true;
+            });
+    }
+
+    Result runMpmc(uint32_t producers, uint32_t consumers, uint64_t items)
+    {
+        axis::MpmcQueue<uint64_t> queue(kQueueCapacity);
+        return runChannel(
+            producers, consumers, items, [&](uint32_t, uint64_t, uint64_t value) { return queue.tryPush(value); },
+            [&](uint64_t& out) { return queue.tryPop(out); });
+    }
+
+    Result runSpsc(uint64_t items)
+    {
+        axis::SpscRing<uint64_t> ring(kQueueCapacity);
+        return runChannel(
+            1, 1, items, [&](uint32_t, uint64_t, uint64_t value) { return ring.tryPush(value); },
+            [&](uint64_t& out) { return ring.tryPop(out); });
+    }
+
+    struct Message : axis::MpscNode
+    {
+        uint64_t value = 0;
+    };
+
+    // 침입형 큐는 노드를 미리 만들어 두고 생산자마다 자기 몫의 노드를 넣습니다.
+    Result runMpsc(uint32_t producers, uint64_t items)
+    {
+        axis::MpscQueue<Message> queue;
+        std::vector<Message> messages(items * producers);
+        return runChannel(
+            producers, 1, items,
+            [&](uint32_t producer, uint64_t index, uint64_t value) {
+                Message& message = messages[producer * items + index];
+                message.value = value;
+                queue.push(message);
+                return true;
+            },
+            [&](uint64_t& out) {
+                Message* message = queue.tryPop();
+                if (message == nullptr)
+                {
+                    return false;
+                }
+                out = message->value;
+                return true;
+            });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint64_t totalItems = uint64_t(argc > 1 ? std::atoi(argv[1]) : 4) * 1000000ull;
+    const uint32_t maxThreads = argc > 2 ? uint32_t(std::atoi(argv[2])) : 16;
+
+    std::printf("hardware threads: %u, items per run: %llu\n\n", std::thread::hardware_concurrency(),
+                static_cast<unsigned long long>(totalItems));
+
+    report("spsc ring", 1, 1, totalItems, runSpsc(totalItems));
+    report("mutex+deque", 1, 1, totalItems, runMutexDeque(1, 1, totalItems));
+    std::printf("\n");
+
+    for (uint32_t threads = 2; threads <= maxThreads; threads *= 2)
+    {
+        const uint32_t producers = threads / 2;
+        const uint64_t items = totalItems / producers;
+        report("mpmc queue", producers, producers, items, runMpmc(producers, producers, items));
+        report("mutex+deque", producers, producers, items, runMutexDeque(producers, producers, items));
+    }
+    std::printf("\n");
+
+    for (uint32_t producers = 1; producers <= maxThreads; producers *= 2)
+    {
+        const uint64_t items = totalItems / producers;
+        report("mpsc queue", producers, 1, items, runMpsc(producers, items));
+        report("mutex+deque", producers, 1, items, runMutexDeque(producers, 1, items));
+    }
+    return 0;
+}
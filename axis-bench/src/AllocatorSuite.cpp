@@ -0,0 +1,131 @@
+// 할당자 측정. 연산 하나는 할당 한 번과 그에 짝지은 해제(또는 되감기)입니다.
+
+#include "Benchmark.h"
+
+#include "axis/utils/Allocator.h"
+#include "axis/utils/LinearArena.h"
+#include "axis/utils/PoolAllocator.h"
+#include "axis/utils/TlsfAllocator.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    using namespace axis;
+    using namespace axis::bench;
+
+    constexpr uint32_t kBatch = 1024;
+
+    BudgetTag benchTag()
+    {
+        static const BudgetTag s_tag = MemoryBudget::registerTag("bench.allocators", MemoryAxis::Data);
+        return s_tag;
+    }
+
+    // 크기가 섞인 요청. 같은 실행에서 항상 같은 순서가 되도록 고정된 난수열을 씁니다.
+    std::vector<uint32_t> mixedSizes()
+    {
+        std::vector<uint32_t> sizes(kBatch);
+        uint32_t state = 0x12345678u;
+        for (uint32_t& size : sizes)
+        {
+            state = state * 1664525u + 1013904223u;
+            size = 16u + (state >> 16) % 2032u;
+        }
+        return sizes;
+    }
+
+    void systemAllocate(BenchmarkState& state)
+    {
+        SystemAllocator allocator(benchTag());
+        std::vector<void*> blocks(kBatch);
+        state.measure(kBatch, [&] {
+            for (void*& block : blocks)
+            {
+                block = allocator.allocate(64);
+            }
+            for (void* block : blocks)
+            {
+                allocator.deallocate(block, 64);
+            }
+        });
+    }
+
+    void poolAllocate(BenchmarkState& state)
+    {
+        PoolAllocator pool(64, 16, kBatch, benchTag());
+        std::vector<void*> blocks(kBatch);
+        state.measure(kBatch, [&] {
+            for (void*& block : blocks)
+            {
+                block = pool.allocateBlock();
+            }
+            for (void* block : blocks)
+            {
+                pool.deallocateBlock(block);
+            }
+        });
+    }
+
+    void tlsfMixed(BenchmarkState& state)
+    {
+        TlsfAllocator tlsf(8 * 1024 * 1024, benchTag());
+        const std::vector<uint32_t> sizes = mixedSizes();
+        std::vector<void*> blocks(kBatch);
+        state.measure(kBatch, [&] {
+            for (uint32_t i = 0; i < kBatch; ++i)
+            {
+                blocks[i] = tlsf.allocate(sizes[i]);
+            }
+            // 절반을 건너뛰며 해제해 병합 경로도 지나게 합니다.
+            for (uint32_t i = 0; i < kBatch; i += 2)
+            {
+                tlsf.deallocate(blocks[i], sizes[i]);
+            }
+            for (uint32_t i = 1; i < kBatch; i += 2)
+            {
+                tlsf.deallocate(blocks[i], sizes[i]);
+            }
+        });
+    }
+
+    void systemMixed(BenchmarkState& state)
+    {
+        SystemAllocator allocator(benchTag());
+        const std::vector<uint32_t> sizes = mixedSizes();
+        std::vector<void*> blocks(kBatch);
+        state.measure(kBatch, [&] {
+            for (uint32_t i = 0; i < kBatch; ++i)
+            {
+                blocks[i] = allocator.allocate(sizes[i]);
+            }
+            for (uint32_t i = 0; i < kBatch; i += 2)
+            {
+                allocator.deallocate(blocks[i], sizes[i]);
+            }
+            for (uint32_t i = 1; i < kBatch; i += 2)
+            {
+                allocator.deallocate(blocks[i], sizes[i]);
+            }
+        });
+    }
+
+    void linearAllocate(BenchmarkState& state)
+    {
+        LinearArena arena(kBatch * 64, benchTag());
+        state.measure(kBatch, [&] {
+            for (uint32_t i = 0; i < kBatch; ++i)
+            {
+                doNotOptimize(arena.allocate(48, 16));
+            }
+            arena.reset();
+        });
+    }
+
+    AXIS_BENCHMARK("alloc.system.fixed64", systemAllocate);
+    AXIS_BENCHMARK("alloc.pool.fixed64", poolAllocate);
+    AXIS_BENCHMARK("alloc.system.mixed", systemMixed);
+    AXIS_BENCHMARK("alloc.tlsf.mixed", tlsfMixed);
+    AXIS_BENCHMARK("alloc.linear.bump48", linearAllocate);
+}
@@ -0,0 +1,155 @@
+// 에셋 아카이브 읽기. 측정 전에 임시 디렉터리에 아카이브를 만들고, 끝나면 지웁니다.
+// 파일은 측정 중에 페이지 캐시에 올라와 있으므로 디스크가 아니라 매핑/조회/복사/압축 해제 비용을 잽니다.
+
+#include "Benchmark.h"
+
+#include "axis/utils/AssetArchive.h"
+#include "axis/utils/AssetArchiveWriter.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace
+{
+    using namespace axis;
+    using namespace axis::bench;
+
+    constexpr uint32_t kEntryCount = 256;
+    constexpr uint32_t kEntrySize = 16 * 1024;
+
+    std::string entryName(uint32_t index)
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "bench/asset%04u", index);
+        return name;
+    }
+
+    // 압축률이 실제 텍스처/메시와 비슷하도록 반복 구간과 잡음을 섞습니다.
+    std::vector<uint8_t> entryData(uint32_t index)
+    {
+        std::vector<uint8_t> data(kEntrySize);
+        uint32_t state = 0x9E3779B9u ^ index;
+        for (uint32_t i = 0; i < kEntrySize; ++i)
+        {
+            state = state * 1664525u + 1013904223u;
+            data[i] = (i & 64) != 0 ? static_cast<uint8_t>(i >> 3) : static_cast<uint8_t>(state >> 24);
+        }
+        return data;
+    }
+
+    class TempArchive
+    {
+    public:
+        TempArchive(const char* fileName, ArchiveCompression compression)
+        {
+            std::error_code error;
+            // AssetArchive는 UTF-8 경로를 받으므로 시스템 코드 페이지를 거치지 않고 변환합니다.
+            const std::u8string path = (std::filesystem::temp_directory_path(error) / fileName).u8string();
+            m_path.assign(reinterpret_cast<const char*>(path.data()), path.size());
+
+            AssetArchiveWriter writer;
+            for (uint32_t i = 0; i < kEntryCount; ++i)
+            {
+                const std::vector<uint8_t> data = entryData(i);
+                writer.add(entryName(i).c_str(), data.data(), data.size(), compression);
+            }
+            m_written = writer.write(m_path.c_str());
+        }
+
+        ~TempArchive()
+        {
+            std::error_code error;
+            std::filesystem::remove(m_path, error);
+        }
+
+        bool isValid() const { return m_written; }
+        const char* path() const { return m_path.c_str(); }
+
+    private:
+        std::string m_path;
+        bool m_written = false;
+    };
+
+    void archiveOpen(BenchmarkState& state)
+    {
+        TempArchive temp("axis-bench-open.axar", ArchiveCompression::None);
+        if (!temp.isValid())
+        {
+            return;
+        }
+        state.measure(1, [&] {
+            AssetArchive archive;
+            archive.open(temp.path());
+            doNotOptimize(archive.entryCount());
+        });
+    }
+
+    void archiveFind(BenchmarkState& state)
+    {
+        TempArchive temp("axis-bench-find.axar", ArchiveCompression::None);
+        AssetArchive archive;
+        if (!temp.isValid() || !archive.open(temp.path()))
+        {
+            return;
+        }
+        std::vector<StringId> names;
+        for (uint32_t i = 0; i < kEntryCount; ++i)
+        {
+            names.push_back(StringId(entryName(i).c_str()));
+        }
+        state.measure(kEntryCount, [&] {
+            for (StringId name : names)
+            {
+                doNotOptimize(archive.find(name));
+            }
+        });
+    }
+
+    // 연산 하나는 16KB 항목 하나를 읽는 것입니다.
+    void archiveRead(BenchmarkState& state, const char* fileName, ArchiveCompression compression)
+    {
+        if (!isArchiveCompressionAvailable(compression))
+        {
+            return;
+        }
+        TempArchive temp(fileName, compression);
+        AssetArchive archive;
+        if (!temp.isValid() || !archive.open(temp.path()))
+        {
+            return;
+        }
+        std::vector<uint8_t> buffer(kEntrySize);
+        state.measure(kEntryCount, [&] {
+            for (uint32_t i = 0; i < archive.entryCount(); ++i)
+            {
+                archive.read(archive.entry(i), buffer.data(), buffer.size());
+            }
+            doNotOptimize(buffer[0]);
+        });
+    }
+
+    void archiveReadRaw(BenchmarkState& state)
+    {
+        archiveRead(state, "axis-bench-raw.axar", ArchiveCompression::None);
+    }
+
+    void archiveReadLz4(BenchmarkState& state)
+    {
+        archiveRead(state, "axis-bench-lz4.axar", ArchiveCompression::Lz4);
+    }
+
+    void archiveReadZstd(BenchmarkState& state)
+    {
+        archiveRead(state, "axis-bench-zstd.axar", ArchiveCompression::Zstd);
+    }
+
+    AXIS_BENCHMARK("asset.archive.open", archiveOpen);
+    AXIS_BENCHMARK("asset.archive.find", archiveFind);
+    AXIS_BENCHMARK("asset.archive.readRaw", archiveReadRaw);
+    AXIS_BENCHMARK("asset.archive.readLz4", archiveReadLz4);
+    AXIS_BENCHMARK("asset.archive.readZstd", archiveReadZstd);
+}
@@ -0,0 +1,227 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace axis::bench
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+        constexpr bool kHasTsc = true;
+
+        uint64_t readTsc() { return __rdtsc(); }
+#else
+        constexpr bool kHasTsc = false;
+
+        uint64_t readTsc() { return 0; }
+#endif
+
+#if defined(__linux__)
+        // 현재 스레드의 사용자 모드 이벤트 하나를 엽니다. 권한(perf_event_paranoid)이나 가상화 때문에
+        // 하드웨어 카운터가 없으면 -1을 반환하고, 그 값은 결과에서 빠집니다.
+        int openEvent(uint32_t type, uint64_t config)
+        {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = type;
+            attr.config = config;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+            if (fd < 0)
+            {
+                return -1;
+            }
+            ioctl(static_cast<int>(fd), PERF_EVENT_IOC_RESET, 0);
+            ioctl(static_cast<int>(fd), PERF_EVENT_IOC_ENABLE, 0);
+            return static_cast<int>(fd);
+        }
+
+        uint64_t readEvent(int fd)
+        {
+            uint64_t value = 0;
+            if (fd < 0 || ::read(fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value)))
+            {
+                return 0;
+            }
+            return value;
+        }
+#endif
+
+        struct Sample
+        {
+            double ns;
+            double cycles;
+            double cacheMisses;
+        };
+
+        double median(std::vector<double> values)
+        {
+            std::sort(values.begin(), values.end());
+            const size_t middle = values.size() / 2;
+            return (values.size() & 1) != 0 ? values[middle] : (values[middle - 1] + values[middle]) * 0.5;
+        }
+    }
+
+    Counters::Counters()
+    {
+#if defined(__linux__)
+        m_cycleFd = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        m_cacheMissFd = openEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+#endif
+        if (m_cycleFd >= 0)
+        {
+            m_cycleSource = CycleSource::Core;
+        }
+        else if (kHasTsc)
+        {
+            m_cycleSource = CycleSource::Tsc;
+        }
+    }
+
+    Counters::~Counters()
+    {
+#if defined(__linux__)
+        if (m_cycleFd >= 0)
+        {
+            close(m_cycleFd);
+        }
+        if (m_cacheMissFd >= 0)
+        {
+            close(m_cacheMissFd);
+        }
+#endif
+    }
+
+    CounterSample Counters::read() const
+    {
+        CounterSample sample;
+#if defined(__linux__)
+        sample.cacheMisses = readEvent(m_cacheMissFd);
+        if (m_cycleSource == CycleSource::Core)
+        {
+            sample.cycles = readEvent(m_cycleFd);
+        }
+#endif
+        if (m_cycleSource == CycleSource::Tsc)
+        {
+            sample.cycles = readTsc();
+        }
+        sample.ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+        return sample;
+    }
+
+    const char* Counters::cycleSourceName() const
+    {
+        switch (m_cycleSource)
+        {
+        case CycleSource::Core:
+            return "core";
+        case CycleSource::Tsc:
+            return "tsc";
+        default:
+            return "none";
+        }
+    }
+
+    std::vector<BenchmarkEntry>& registry()
+    {
+        static std::vector<BenchmarkEntry> s_entries;
+        return s_entries;
+    }
+
+    uint64_t BenchmarkState::calibrate(void (*call)(void*), void* body)
+    {
+        // 첫 호출은 캐시와 지연 초기화를 데우는 용도로 버립니다.
+        call(body);
+
+        const auto target = m_config->minSampleTime;
+        uint64_t calls = 1;
+        for (;;)
+        {
+            const Clock::time_point begin = Clock::now();
+            for (uint64_t i = 0; i < calls; ++i)
+            {
+                call(body);
+            }
+            const auto elapsed = Clock::now() - begin;
+            if (elapsed >= target || calls >= (uint64_t{1} << 40))
+            {
+                return calls;
+            }
+
+            // 목표 시간에 맞춰 늘리되, 한 번에 10배를 넘지 않게 해 측정 잡음에 덜 흔들리게 합니다.
+            const double ratio = elapsed.count() > 0 ? double(target.count()) / double(elapsed.count()) : 10.0;
+            const double grow = std::clamp(ratio * 1.2, 1.5, 10.0);
+            calls = static_cast<uint64_t>(std::ceil(double(calls) * grow));
+        }
+    }
+
+    void BenchmarkState::record(void (*call)(void*), void* body, uint64_t calls, uint64_t opsPerCall)
+    {
+        const uint32_t sampleCount = std::max(m_config->samples, 1u);
+        const double ops = double(calls) * double(std::max<uint64_t>(opsPerCall, 1));
+
+        std::vector<Sample> samples;
+        samples.reserve(sampleCount);
+        for (uint32_t s = 0; s < sampleCount; ++s)
+        {
+            const CounterSample begin = m_counters->read();
+            for (uint64_t i = 0; i < calls; ++i)
+            {
+                call(body);
+            }
+            const CounterSample end = m_counters->read();
+            samples.push_back(Sample{double(end.ns - begin.ns) / ops, double(end.cycles - begin.cycles) / ops,
+                                     double(end.cacheMisses - begin.cacheMisses) / ops});
+        }
+
+        std::vector<double> ns;
+        std::vector<double> cycles;
+        std::vector<double> misses;
+        double sum = 0.0;
+        for (const Sample& sample : samples)
+        {
+            ns.push_back(sample.ns);
+            cycles.push_back(sample.cycles);
+            misses.push_back(sample.cacheMisses);
+            sum += sample.ns;
+        }
+
+        const double mean = sum / double(samples.size());
+        double variance = 0.0;
+        for (double value : ns)
+        {
+            variance += (value - mean) * (value - mean);
+        }
+        variance /= double(samples.size());
+
+        BenchmarkResult& result = *m_result;
+        result.opsPerSample = static_cast<uint64_t>(ops);
+        result.samples = sampleCount;
+        result.nsPerOp = median(ns);
+        result.nsMin = *std::min_element(ns.begin(), ns.end());
+        result.variation = mean > 0.0 ? std::sqrt(variance) / mean : 0.0;
+        result.hasCycles = m_counters->cycleSource() != CycleSource::None;
+        result.cyclesPerOp = result.hasCycles ? median(cycles) : 0.0;
+        result.hasCacheMisses = m_counters->hasCacheMisses();
+        result.cacheMissesPerOp = result.hasCacheMisses ? median(misses) : 0.0;
+    }
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+// axis-bench 실행 파일의 측정 도구.
+//
+// 각 *Suite.cpp가 AXIS_BENCHMARK로 측정 함수를 등록하고, BenchmarkMain.cpp가 실행과 JSON 출력,
+// 기준선 비교를 맡습니다. (queues/QueueBenchmark.cpp는 스레드 수별 처리량을 보는 별도 도구 axis-bench-queues입니다.)
+//
+// 측정 함수는 준비를 마친 뒤 BenchmarkState::measure에 측정할 본문을 넘깁니다. measure는 본문 호출 횟수를
+// 표본 하나가 최소 시간을 넘도록 맞춘 뒤 여러 표본을 재고, 연산 하나당 중앙값을 기록합니다.
+// 중앙값과 최솟값, 변동 계수를 함께 남기므로 같은 구조가 실행마다 비슷한 특성을 보이는지 확인할 수 있습니다.
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace axis::bench
+{
+    // 측정 시작부터의 누적 카운터. 쓸 수 없는 카운터는 0으로 남습니다.
+    struct CounterSample
+    {
+        uint64_t ns = 0;
+        uint64_t cycles = 0;
+        uint64_t cacheMisses = 0;
+    };
+
+    enum class CycleSource : uint8_t
+    {
+        None,
+        // 코어 클럭 사이클(perf 이벤트).
+        Core,
+        // 타임스탬프 카운터. 주파수가 고정된 기준 사이클로, 터보/절전 상태와 무관하게 일정하게 증가합니다.
+        Tsc,
+    };
+
+    // 프로세스 하나의 하드웨어 카운터. 현재 스레드만 셉니다.
+    class Counters
+    {
+    public:
+        Counters();
+        ~Counters();
+
+        Counters(const Counters&) = delete;
+        Counters& operator=(const Counters&) = delete;
+
+        CounterSample read() const;
+
+        CycleSource cycleSource() const { return m_cycleSource; }
+        bool hasCacheMisses() const { return m_cacheMissFd >= 0; }
+        const char* cycleSourceName() const;
+
+    private:
+        CycleSource m_cycleSource = CycleSource::None;
+        int m_cycleFd = -1;
+        int m_cacheMissFd = -1;
+    };
+
+    struct BenchmarkConfig
+    {
+        uint32_t samples = 15;
+        // 표본 하나가 최소로 걸려야 하는 시간. 짧으면 타이머 해상도와 인터럽트가 결과를 흔듭니다.
+        std::chrono::nanoseconds minSampleTime = std::chrono::milliseconds(5);
+    };
+
+    struct BenchmarkResult
+    {
+        std::string name;
+        uint64_t opsPerSample = 0;
+        uint32_t samples = 0;
+
+        // 연산 하나당 값. 표본별 값의 중앙값이고, nsMin은 가장 빠른 표본입니다.
+        double nsPerOp = 0.0;
+        double nsMin = 0.0;
+        // 표본 간 표준편차 / 평균. 0.05를 넘으면 측정 환경이 흔들렸거나 구조가 입력에 민감한 것입니다.
+        double variation = 0.0;
+        double cyclesPerOp = 0.0;
+        double cacheMissesPerOp = 0.0;
+        bool hasCycles = false;
+        bool hasCacheMisses = false;
+    };
+
+    class BenchmarkState
+    {
+    public:
+        BenchmarkState(const BenchmarkConfig& config, const Counters& counters, BenchmarkResult& result)
+            : m_config(&config)
+            , m_counters(&counters)
+            , m_result(&result)
+        {
+        }
+
+        // body를 반복해서 재고 결과를 기록합니다. 본문 한 번이 opsPerCall개의 연산을 처리한다고 봅니다.
+        // 같은 측정 함수 안에서 한 번만 호출해야 합니다.
+        template <typename Fn>
+        void measure(uint64_t opsPerCall, Fn&& body);
+
+    private:
+        uint64_t calibrate(void (*call)(void*), void* body);
+        void record(void (*call)(void*), void* body, uint64_t calls, uint64_t opsPerCall);
+
+        const BenchmarkConfig* m_config;
+        const Counters* m_counters;
+        BenchmarkResult* m_result;
+    };
+
+    using BenchmarkFunction = void (*)(BenchmarkState& state);
+
+    struct BenchmarkEntry
+    {
+        const char* name;
+        BenchmarkFunction function;
+    };
+
+    // 등록된 측정 함수 목록. 정적 초기화 순서와 무관하도록 함수 안의 정적 변수로 둡니다.
+    std::vector<BenchmarkEntry>& registry();
+
+    struct Registrar
+    {
+        Registrar(const char* name, BenchmarkFunction function) { registry().push_back({name, function}); }
+    };
+
+    // 최적화가 결과를 쓰지 않는 계산을 지우지 못하게 합니다.
+    template <typename T>
+    inline void doNotOptimize(const T& value)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        const volatile char* sink = reinterpret_cast<const volatile char*>(&value);
+        (void)*sink;
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    template <typename Fn>
+    void BenchmarkState::measure(uint64_t opsPerCall, Fn&& body)
+    {
+        // 본문을 함수 포인터 하나로 감싸 측정 루프를 템플릿 밖(.cpp)에 둡니다. 간접 호출 비용은 본문 안의
+        // 연산 opsPerCall개에 나누어지므로, 본문은 최소한 수십 ns 이상이 되도록 묶어야 합니다.
+        void (*call)(void*) = [](void* context) { (*static_cast<std::remove_reference_t<Fn>*>(context))(); };
+        void* context = const_cast<void*>(static_cast<const void*>(&body));
+        record(call, context, calibrate(call, context), opsPerCall);
+    }
+}
+
+#define AXIS_BENCHMARK_CONCAT_INNER(a, b) a##b
+#define AXIS_BENCHMARK_CONCAT(a, b) AXIS_BENCHMARK_CONCAT_INNER(a, b)
+
+// 이름은 "분류.대상.연산" 형태로 짓습니다. --filter는 이름의 부분 문자열로 고릅니다.
+#define AXIS_BENCHMARK(name, function) \
+    static const ::axis::bench::Registrar AXIS_BENCHMARK_CONCAT(s_benchmark, __LINE__)(name, function)
@@ -0,0 +1,527 @@
+// axis-bench: 핵심 구조들의 마이크로벤치마크.
+//
+// 결과는 JSON으로 표준 출력(또는 --out 파일)에 쓰고, 사람이 읽는 표는 표준 오류에 씁니다.
+// --baseline으로 이전 결과 파일을 주면 항목마다 비교하고, 느려진 항목이 있으면 종료 코드 1을 반환합니다.
+//
+// 사용법: axis-bench [--filter 문자열] [--out 파일] [--baseline 파일] [--threshold 0.10]
+//                    [--samples 15] [--min-time-ms 5] [--list]
+//
+// 실행 파일은 src/의 모든 .cpp(이 파일, Benchmark.cpp, *Suite.cpp)로 만듭니다.
+// 스레드 수별 큐 처리량은 별도 실행 파일 axis-bench-queues(queues/QueueBenchmark.cpp)가 잽니다.
+
+#include "Benchmark.h"
+
+#include "axis/utils/MathBatch.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using namespace axis::bench;
+
+    struct Options
+    {
+        const char* filter = nullptr;
+        const char* outPath = nullptr;
+        const char* baselinePath = nullptr;
+        double threshold = 0.10;
+        BenchmarkConfig config;
+        bool list = false;
+    };
+
+    struct Baseline
+    {
+        double nsPerOp = 0.0;
+        double nsMin = 0.0;
+    };
+
+    enum class Change
+    {
+        None,
+        Same,
+        Faster,
+        Slower,
+    };
+
+    const char* changeName(Change change)
+    {
+        switch (change)
+        {
+        case Change::Same:
+            return "same";
+        case Change::Faster:
+            return "faster";
+        case Change::Slower:
+            return "slower";
+        default:
+            return "new";
+        }
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const char* arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+            if (std::strcmp(arg, "--list") == 0)
+            {
+                options.list = true;
+            }
+            else if (std::strcmp(arg, "--filter") == 0 && hasValue)
+            {
+                options.filter = argv[++i];
+            }
+            else if (std::strcmp(arg, "--out") == 0 && hasValue)
+            {
+                options.outPath = argv[++i];
+            }
+            else if (std::strcmp(arg, "--baseline") == 0 && hasValue)
+            {
+                options.baselinePath = argv[++i];
+            }
+            else if (std::strcmp(arg, "--threshold") == 0 && hasValue)
+            {
+                options.threshold = std::atof(argv[++i]);
+            }
+            else if (std::strcmp(arg, "--samples") == 0 && hasValue)
+            {
+                options.config.samples = static_cast<uint32_t>(std::atoi(argv[++i]));
+            }
+            else if (std::strcmp(arg, "--min-time-ms") == 0 && hasValue)
+            {
+                options.config.minSampleTime = std::chrono::milliseconds(std::atoi(argv[++i]));
+            }
+            else
+            {
+                std::fprintf(stderr, "알 수 없는 인자: %s\n", arg);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 기준선 파일을 읽는 최소한의 JSON 파서. axis-bench가 쓴 형식만 다루면 되므로
+    // 값은 숫자/문자열/불/널과 중첩 객체·배열만 받고, "benchmarks" 배열의 name/nsPerOp/nsMin만 꺼냅니다.
+    class BaselineReader
+    {
+    public:
+        explicit BaselineReader(const std::string& text)
+            : m_text(text)
+        {
+        }
+
+        bool read(std::unordered_map<std::string, Baseline>& out)
+        {
+            m_out = &out;
+            skipSpace();
+            return parseValue(Context::Root) && (skipSpace(), m_pos == m_text.size());
+        }
+
+    private:
+        enum class Context
+        {
+            Root,
+            Benchmarks,
+            Entry,
+            Other,
+        };
+
+        void skipSpace()
+        {
+            while (m_pos < m_text.size() && std::strchr(" \t\r\n", m_text[m_pos]) != nullptr)
+            {
+                ++m_pos;
+            }
+        }
+
+        bool consume(char c)
+        {
+            skipSpace();
+            if (m_pos < m_text.size() && m_text[m_pos] == c)
+            {
+                ++m_pos;
+                return true;
+            }
+            return false;
+        }
+
+        bool parseString(std::string& out)
+        {
+            if (!consume('"'))
+            {
+                return false;
+            }
+            out.clear();
+            while (m_pos < m_text.size() && m_text[m_pos] != '"')
+            {
+                char c = m_text[m_pos++];
+                if (c == '\\' && m_pos < m_text.size())
+                {
+                    c = m_text[m_pos++];
+                    c = c == 'n' ? '\n' : (c == 't' ? '\t' : c);
+                }
+                out.push_back(c);
+            }
+            return consume('"');
+        }
+
+        bool parseNumber(double& out)
+        {
+            skipSpace();
+            const char* begin = m_text.c_str() + m_pos;
+            char* end = nullptr;
+            out = std::strtod(begin, &end);
+            if (end == begin)
+            {
+                return false;
+            }
+            m_pos += static_cast<size_t>(end - begin);
+            return true;
+        }
+
+        bool parseLiteral(const char* word)
+        {
+            skipSpace();
+            const size_t length = std::strlen(word);
+            if (m_text.compare(m_pos, length, word) != 0)
+            {
+                return false;
+            }
+            m_pos += length;
+            return true;
+        }
+
+        bool parseObject(Context context)
+        {
+            Baseline entry;
+            std::string name;
+            if (!consume('{'))
+            {
+                return false;
+            }
+            if (!consume('}'))
+            {
+                do
+                {
+                    std::string key;
+                    if (!parseString(key) || !consume(':'))
+                    {
+                        return false;
+                    }
+
+                    skipSpace();
+                    if (context == Context::Entry && key == "name")
+                    {
+                        if (!parseString(name))
+                        {
+                            return false;
+                        }
+                    }
+                    else if (context == Context::Entry && (key == "nsPerOp" || key == "nsMin"))
+                    {
+                        if (!parseNumber(key == "nsPerOp" ? entry.nsPerOp : entry.nsMin))
+                        {
+                            return false;
+                        }
+                    }
+                    else
+                    {
+                        const Context child =
+                            context == Context::Root && key == "benchmarks" ? Context::Benchmarks : Context::Other;
+                        if (!parseValue(child))
+                        {
+                            return false;
+                        }
+                    }
+                } while (consume(','));
+
+                if (!consume('}'))
+                {
+                    return false;
+                }
+            }
+
+            if (context == Context::Entry && !name.empty())
+            {
+                (*m_out)[name] = entry;
+            }
+            return true;
+        }
+
+        bool parseArray(Context context)
+        {
+            if (!consume('['))
+            {
+                return false;
+            }
+            if (consume(']'))
+            {
+                return true;
+            }
+            do
+            {
+                if (!parseValue(context == Context::Benchmarks ? Context::Entry : Context::Other))
+                {
+                    return false;
+                }
+            } while (consume(','));
+            return consume(']');
+        }
+
+        bool parseValue(Context context)
+        {
+            skipSpace();
+            if (m_pos >= m_text.size())
+            {
+                return false;
+            }
+
+            const char c = m_text[m_pos];
+            if (c == '{')
+            {
+                return parseObject(context == Context::Benchmarks ? Context::Other : context);
+            }
+            if (c == '[')
+            {
+                return parseArray(context);
+            }
+            if (c == '"')
+            {
+                std::string ignored;
+                return parseString(ignored);
+            }
+            if (c == 't' || c == 'f' || c == 'n')
+            {
+                return parseLiteral("true") || parseLiteral("false") || parseLiteral("null");
+            }
+            double ignored;
+            return parseNumber(ignored);
+        }
+
+        const std::string& m_text;
+        size_t m_pos = 0;
+        std::unordered_map<std::string, Baseline>* m_out = nullptr;
+    };
+
+    bool loadBaseline(const char* path, std::unordered_map<std::string, Baseline>& out)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            return false;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        const std::string text = buffer.str();
+        return BaselineReader(text).read(out);
+    }
+
+    // 중앙값과 최솟값이 모두 문턱을 넘어야 바뀐 것으로 봅니다. 한쪽만 넘으면 잡음일 가능성이 큽니다.
+    Change compare(const BenchmarkResult& result, const Baseline& baseline, double threshold)
+    {
+        if (baseline.nsPerOp <= 0.0)
+        {
+            return Change::None;
+        }
+        const double baseMin = baseline.nsMin > 0.0 ? baseline.nsMin : baseline.nsPerOp;
+        if (result.nsPerOp > baseline.nsPerOp * (1.0 + threshold) && result.nsMin > baseMin * (1.0 + threshold))
+        {
+            return Change::Slower;
+        }
+        if (result.nsPerOp < baseline.nsPerOp * (1.0 - threshold) && result.nsMin < baseMin * (1.0 - threshold))
+        {
+            return Change::Faster;
+        }
+        return Change::Same;
+    }
+
+    void writeString(std::string& out, const char* text)
+    {
+        out.push_back('"');
+        for (const char* p = text; *p != '\0'; ++p)
+        {
+            if (*p == '"' || *p == '\\')
+            {
+                out.push_back('\\');
+            }
+            out.push_back(*p);
+        }
+        out.push_back('"');
+    }
+
+    void writeNumber(std::string& out, double value)
+    {
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), "%.4f", value);
+        out += buffer;
+    }
+
+    // 측정하지 못한 카운터는 0 대신 null로 써서 기준선 비교 도구가 값과 구분할 수 있게 합니다.
+    void writeOptional(std::string& out, bool available, double value)
+    {
+        if (available)
+        {
+            writeNumber(out, value);
+        }
+        else
+        {
+            out += "null";
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return 2;
+    }
+
+    if (options.list)
+    {
+        for (const BenchmarkEntry& entry : registry())
+        {
+            std::printf("%s\n", entry.name);
+        }
+        return 0;
+    }
+
+    std::unordered_map<std::string, Baseline> baseline;
+    if (options.baselinePath != nullptr && !loadBaseline(options.baselinePath, baseline))
+    {
+        std::fprintf(stderr, "기준선 파일을 읽지 못했습니다: %s\n", options.baselinePath);
+        return 2;
+    }
+
+    Counters counters;
+    std::fprintf(stderr, "threads %u, simd %s, cycles %s, cache misses %s\n\n", std::thread::hardware_concurrency(),
+                 axis::simdLevelName(axis::activeSimdLevel()), counters.cycleSourceName(),
+                 counters.hasCacheMisses() ? "yes" : "no");
+    std::fprintf(stderr, "%-40s %12s %12s %8s %10s %10s\n", "benchmark", "ns/op", "min", "cv", "cycles/op",
+                 "miss/op");
+
+    std::string json = "{\n  \"version\": 1,\n  \"machine\": {";
+    json += "\"threads\": " + std::to_string(std::thread::hardware_concurrency());
+    json += ", \"simd\": ";
+    writeString(json, axis::simdLevelName(axis::activeSimdLevel()));
+    json += ", \"cycleSource\": ";
+    writeString(json, counters.cycleSourceName());
+    json += ", \"cacheMisses\": ";
+    json += counters.hasCacheMisses() ? "true" : "false";
+#if defined(NDEBUG)
+    json += ", \"build\": \"release\"},\n";
+#else
+    json += ", \"build\": \"debug\"},\n";
+#endif
+    json += "  \"benchmarks\": [";
+
+    uint32_t ran = 0;
+    uint32_t slower = 0;
+    uint32_t faster = 0;
+    for (const BenchmarkEntry& entry : registry())
+    {
+        if (options.filter != nullptr && std::strstr(entry.name, options.filter) == nullptr)
+        {
+            continue;
+        }
+
+        BenchmarkResult result;
+        result.name = entry.name;
+        BenchmarkState state(options.config, counters, result);
+        entry.function(state);
+        if (result.samples == 0)
+        {
+            std::fprintf(stderr, "%-40s (건너뜀)\n", entry.name);
+            continue;
+        }
+
+        const auto found = baseline.find(result.name);
+        const Change change = found != baseline.end() ? compare(result, found->second, options.threshold)
+                                                      : Change::None;
+        slower += change == Change::Slower ? 1 : 0;
+        faster += change == Change::Faster ? 1 : 0;
+
+        char cycles[32] = "-";
+        char misses[32] = "-";
+        if (result.hasCycles)
+        {
+            std::snprintf(cycles, sizeof(cycles), "%.2f", result.cyclesPerOp);
+        }
+        if (result.hasCacheMisses)
+        {
+            std::snprintf(misses, sizeof(misses), "%.4f", result.cacheMissesPerOp);
+        }
+        std::fprintf(stderr, "%-40s %12.3f %12.3f %7.1f%% %10s %10s", entry.name, result.nsPerOp, result.nsMin,
+                     result.variation * 100.0, cycles, misses);
+        if (found != baseline.end() && change != Change::None)
+        {
+            std::fprintf(stderr, "  %+6.1f%% %s", (result.nsPerOp / found->second.nsPerOp - 1.0) * 100.0,
+                         change == Change::Same ? "" : changeName(change));
+        }
+        std::fprintf(stderr, "\n");
+
+        json += ran++ == 0 ? "\n    {" : ",\n    {";
+        json += "\"name\": ";
+        writeString(json, entry.name);
+        json += ", \"ops\": " + std::to_string(result.opsPerSample);
+        json += ", \"samples\": " + std::to_string(result.samples);
+        json += ", \"nsPerOp\": ";
+        writeNumber(json, result.nsPerOp);
+        json += ", \"nsMin\": ";
+        writeNumber(json, result.nsMin);
+        json += ", \"variation\": ";
+        writeNumber(json, result.variation);
+        json += ", \"cyclesPerOp\": ";
+        writeOptional(json, result.hasCycles, result.cyclesPerOp);
+        json += ", \"cacheMissesPerOp\": ";
+        writeOptional(json, result.hasCacheMisses, result.cacheMissesPerOp);
+        if (found != baseline.end())
+        {
+            json += ", \"baselineNsPerOp\": ";
+            writeNumber(json, found->second.nsPerOp);
+            json += ", \"change\": ";
+            writeString(json, changeName(change));
+        }
+        json += "}";
+    }
+    json += "\n  ]";
+    if (options.baselinePath != nullptr)
+    {
+        json += ",\n  \"comparison\": {\"threshold\": ";
+        writeNumber(json, options.threshold);
+        json += ", \"slower\": " + std::to_string(slower) + ", \"faster\": " + std::to_string(faster) + "}";
+    }
+    json += "\n}\n";
+
+    if (options.outPath != nullptr)
+    {
+        std::ofstream file(options.outPath, std::ios::binary);
+        file << json;
+        if (!file)
+        {
+            std::fprintf(stderr, "결과 파일을 쓰지 못했습니다: %s\n", options.outPath);
+            return 2;
+        }
+    }
+    else
+    {
+        std::fwrite(json.data(), 1, json.size(), stdout);
+    }
+
+    if (options.baselinePath != nullptr)
+    {
+        std::fprintf(stderr, "\n기준선 대비: 느려짐 %u, 빨라짐 %u (문턱 %.0f%%)\n", slower, faster,
+                     options.threshold * 100.0);
+    }
+    return slower != 0 ? 1 : 0;
+}
@@ -0,0 +1,195 @@
+// 컨테이너 측정. 표준 컨테이너를 같은 조건으로 함께 재어 상대 비교가 가능하게 합니다.
+
+#include "Benchmark.h"
+
+#include "axis/utils/FlatHashMap.h"
+#include "axis/utils/RadixSort.h"
+#include "axis/utils/SlotMap.h"
+#include "axis/utils/SmallVector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using namespace axis;
+    using namespace axis::bench;
+
+    constexpr uint32_t kKeyCount = 1u << 16;
+
+    std::vector<uint64_t> randomKeys(uint32_t count, uint64_t seed)
+    {
+        std::vector<uint64_t> keys(count);
+        uint64_t state = seed;
+        for (uint64_t& key : keys)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            key = state;
+        }
+        return keys;
+    }
+
+    void flatMapInsert(BenchmarkState& state)
+    {
+        const std::vector<uint64_t> keys = randomKeys(kKeyCount, 1);
+        state.measure(kKeyCount, [&] {
+            FlatHashMap<uint64_t, uint32_t> map;
+            for (uint32_t i = 0; i < kKeyCount; ++i)
+            {
+                map.emplace(keys[i], i);
+            }
+            doNotOptimize(map.size());
+        });
+    }
+
+    void stdMapInsert(BenchmarkState& state)
+    {
+        const std::vector<uint64_t> keys = randomKeys(kKeyCount, 1);
+        state.measure(kKeyCount, [&] {
+            std::unordered_map<uint64_t, uint32_t> map;
+            for (uint32_t i = 0; i < kKeyCount; ++i)
+            {
+                map.emplace(keys[i], i);
+            }
+            doNotOptimize(map.size());
+        });
+    }
+
+    // 찾는 키의 절반은 없는 키입니다.
+    void flatMapFind(BenchmarkState& state)
+    {
+        const std::vector<uint64_t> keys = randomKeys(kKeyCount, 1);
+        const std::vector<uint64_t> misses = randomKeys(kKeyCount, 2);
+        FlatHashMap<uint64_t, uint32_t> map;
+        for (uint32_t i = 0; i < kKeyCount; ++i)
+        {
+            map.emplace(keys[i], i);
+        }
+        state.measure(kKeyCount * 2, [&] {
+            uint32_t found = 0;
+            for (uint32_t i = 0; i < kKeyCount; ++i)
+            {
+                found += map.contains(keys[i]) ? 1u : 0u;
+                found += map.contains(misses[i]) ? 1u : 0u;
+            }
+            doNotOptimize(found);
+        });
+    }
+
+    void stdMapFind(BenchmarkState& state)
+    {
+        const std::vector<uint64_t> keys = randomKeys(kKeyCount, 1);
+        const std::vector<uint64_t> misses = randomKeys(kKeyCount, 2);
+        std::unordered_map<uint64_t, uint32_t> map;
+        for (uint32_t i = 0; i < kKeyCount; ++i)
+        {
+            map.emplace(keys[i], i);
+        }
+        state.measure(kKeyCount * 2, [&] {
+            uint32_t found = 0;
+            for (uint32_t i = 0; i < kKeyCount; ++i)
+            {
+                found += map.count(keys[i]) != 0 ? 1u : 0u;
+                found += map.count(misses[i]) != 0 ? 1u : 0u;
+            }
+            doNotOptimize(found);
+        });
+    }
+
+    void smallVectorInline(BenchmarkState& state)
+    {
+        state.measure(1024 * 8, [&] {
+            for (uint32_t i = 0; i < 1024; ++i)
+            {
+                SmallVector<uint32_t, 8> values;
+                for (uint32_t j = 0; j < 8; ++j)
+                {
+                    values.pushBack(i + j);
+                }
+                doNotOptimize(values.data());
+            }
+        });
+    }
+
+    void slotMapChurn(BenchmarkState& state)
+    {
+        SlotMap<uint64_t> map;
+        std::vector<SlotHandle> handles;
+        for (uint32_t i = 0; i < kKeyCount; ++i)
+        {
+            handles.push_back(map.insert(i));
+        }
+        // 매 호출에서 1024개를 지우고 다시 넣어 빈 슬롯 재사용 경로를 잽니다.
+        uint32_t cursor = 0;
+        state.measure(1024, [&] {
+            for (uint32_t i = 0; i < 1024; ++i)
+            {
+                SlotHandle& handle = handles[(cursor + i * 61) & (kKeyCount - 1)];
+                map.erase(handle);
+                handle = map.insert(i);
+            }
+            cursor += 1024;
+        });
+    }
+
+    void slotMapIterate(BenchmarkState& state)
+    {
+        SlotMap<uint64_t> map;
+        for (uint32_t i = 0; i < kKeyCount; ++i)
+        {
+            map.insert(i);
+        }
+        state.measure(kKeyCount, [&] {
+            uint64_t sum = 0;
+            for (uint64_t value : map)
+            {
+                sum += value;
+            }
+            doNotOptimize(sum);
+        });
+    }
+
+    void radixSortKeys(BenchmarkState& state)
+    {
+        const std::vector<uint64_t> keys = randomKeys(kKeyCount, 3);
+        std::vector<SortItem> items(kKeyCount);
+        std::vector<SortItem> scratch(kKeyCount);
+        state.measure(kKeyCount, [&] {
+            for (uint32_t i = 0; i < kKeyCount; ++i)
+            {
+                items[i] = SortItem{keys[i], i};
+            }
+            radixSort(items.data(), scratch.data(), kKeyCount);
+            doNotOptimize(items.front());
+        });
+    }
+
+    void stdSortKeys(BenchmarkState& state)
+    {
+        const std::vector<uint64_t> keys = randomKeys(kKeyCount, 3);
+        std::vector<SortItem> items(kKeyCount);
+        state.measure(kKeyCount, [&] {
+            for (uint32_t i = 0; i < kKeyCount; ++i)
+            {
+                items[i] = SortItem{keys[i], i};
+            }
+            std::stable_sort(items.begin(), items.end(),
+                             [](const SortItem& a, const SortItem& b) { return a.key < b.key; });
+            doNotOptimize(items.front());
+        });
+    }
+
+    AXIS_BENCHMARK("container.flatMap.insert", flatMapInsert);
+    AXIS_BENCHMARK("container.stdMap.insert", stdMapInsert);
+    AXIS_BENCHMARK("container.flatMap.find", flatMapFind);
+    AXIS_BENCHMARK("container.stdMap.find", stdMapFind);
+    AXIS_BENCHMARK("container.smallVector.inlinePush", smallVectorInline);
+    AXIS_BENCHMARK("container.slotMap.churn", slotMapChurn);
+    AXIS_BENCHMARK("container.slotMap.iterate", slotMapIterate);
+    AXIS_BENCHMARK("container.radixSort.64k", radixSortKeys);
+    AXIS_BENCHMARK("container.stdStableSort.64k", stdSortKeys);
+}
@@ -0,0 +1,180 @@
+// ECS 순회와 구조 변경. 순회는 엔티티 하나, 구조 변경은 엔티티 하나의 생성/이동이 연산 하나입니다.
+
+#include "Benchmark.h"
+
+#include "axis/core/JobSystem.h"
+#include "axis/core/Query.h"
+#include "axis/core/TransformHierarchy.h"
+#include "axis/core/World.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    using namespace axis;
+    using namespace axis::bench;
+
+    constexpr uint32_t kEntities = 1u << 16;
+
+    struct Position
+    {
+        float x, y, z;
+    };
+
+    struct Velocity
+    {
+        float x, y, z;
+    };
+
+    struct Health
+    {
+        float value;
+    };
+
+    // 위치/속도를 가진 엔티티를 두 아키타입(Health 유무)에 나눠 만듭니다.
+    void populate(World& world)
+    {
+        for (uint32_t i = 0; i < kEntities; ++i)
+        {
+            const Entity entity = world.createEntity();
+            world.addComponent<Position>(entity, Position{float(i), 0.0f, 0.0f});
+            world.addComponent<Velocity>(entity, Velocity{1.0f, 0.5f, 0.25f});
+            if ((i & 3) == 0)
+            {
+                world.addComponent<Health>(entity, Health{100.0f});
+            }
+        }
+    }
+
+    void integrateEach(BenchmarkState& state)
+    {
+        World world;
+        populate(world);
+        state.measure(kEntities, [&] {
+            world.each<Position, Velocity>([](Position& p, Velocity& v) {
+                p.x += v.x;
+                p.y += v.y;
+                p.z += v.z;
+            });
+        });
+    }
+
+    void integrateQueryChunks(BenchmarkState& state)
+    {
+        World world;
+        populate(world);
+        Query<Position, const Velocity> query(world);
+        state.measure(kEntities, [&] {
+            query.forEachChunk([](const Query<Position, const Velocity>::Span& span) {
+                Position* p = span.column<Position>();
+                const Velocity* v = span.column<const Velocity>();
+                for (uint32_t i = 0; i < span.count; ++i)
+                {
+                    p[i].x += v[i].x;
+                    p[i].y += v[i].y;
+                    p[i].z += v[i].z;
+                }
+            });
+        });
+    }
+
+    void integrateQueryParallel(BenchmarkState& state)
+    {
+        JobSystem jobs;
+        World world;
+        populate(world);
+        Query<Position, const Velocity> query(world);
+        state.measure(kEntities, [&] {
+            query.parallelForEach(jobs, [](Position& p, const Velocity& v) {
+                p.x += v.x;
+                p.y += v.y;
+                p.z += v.z;
+            });
+        });
+    }
+
+    // 컴포넌트 추가/제거로 두 아키타입 사이를 오갑니다.
+    void addRemoveComponent(BenchmarkState& state)
+    {
+        World world;
+        std::vector<Entity> entities;
+        for (uint32_t i = 0; i < 1024; ++i)
+        {
+            const Entity entity = world.createEntity();
+            world.addComponent<Position>(entity, Position{});
+            world.addComponent<Velocity>(entity, Velocity{});
+            entities.push_back(entity);
+        }
+        state.measure(1024 * 2, [&] {
+            for (Entity entity : entities)
+            {
+                world.addComponent<Health>(entity, Health{1.0f});
+            }
+            for (Entity entity : entities)
+            {
+                world.removeComponent<Health>(entity);
+            }
+        });
+    }
+
+    void createDestroy(BenchmarkState& state)
+    {
+        World world;
+        std::vector<Entity> entities(1024);
+        state.measure(1024, [&] {
+            for (Entity& entity : entities)
+            {
+                entity = world.createEntity();
+                world.addComponent<Position>(entity, Position{});
+            }
+            for (Entity entity : entities)
+            {
+                world.destroyEntity(entity);
+            }
+        });
+    }
+
+    // 4단계 깊이의 계층(루트 16개, 노드마다 자식 8개)에서 잎 노드 1/16이 움직인 프레임.
+    void hierarchyPartial(BenchmarkState& state)
+    {
+        TransformHierarchy hierarchy;
+        std::vector<TransformHandle> leaves;
+        for (uint32_t r = 0; r < 16; ++r)
+        {
+            const TransformHandle root = hierarchy.create();
+            for (uint32_t a = 0; a < 8; ++a)
+            {
+                const TransformHandle mid = hierarchy.create(root);
+                for (uint32_t b = 0; b < 8; ++b)
+                {
+                    const TransformHandle parent = hierarchy.create(mid);
+                    for (uint32_t c = 0; c < 8; ++c)
+                    {
+                        leaves.push_back(hierarchy.create(parent));
+                    }
+                }
+            }
+        }
+        hierarchy.update(nullptr);
+
+        uint32_t frame = 0;
+        state.measure(leaves.size() / 16, [&] {
+            TransformState local;
+            local.position = Vec3{float(frame), 0.0f, 0.0f};
+            for (size_t i = frame & 15; i < leaves.size(); i += 16)
+            {
+                hierarchy.setLocal(leaves[i], local);
+            }
+            hierarchy.update(nullptr);
+            ++frame;
+        });
+    }
+
+    AXIS_BENCHMARK("ecs.each.integrate", integrateEach);
+    AXIS_BENCHMARK("ecs.query.chunks", integrateQueryChunks);
+    AXIS_BENCHMARK("ecs.query.parallel", integrateQueryParallel);
+    AXIS_BENCHMARK("ecs.structure.addRemove", addRemoveComponent);
+    AXIS_BENCHMARK("ecs.structure.createDestroy", createDestroy);
+    AXIS_BENCHMARK("ecs.hierarchy.partialUpdate", hierarchyPartial);
+}
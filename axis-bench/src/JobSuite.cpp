@@ -0,0 +1,87 @@
+// 작업 시스템과 스케줄러의 고정 비용. 본문이 거의 없는 작업으로 제출/대기/분배 비용만 드러냅니다.
+
+#include "Benchmark.h"
+
+#include "axis/core/JobSystem.h"
+#include "axis/core/Scheduler.h"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    using namespace axis;
+    using namespace axis::bench;
+
+    constexpr uint32_t kJobs = 1024;
+
+    JobSystem& jobSystem()
+    {
+        static JobSystem s_jobs;
+        return s_jobs;
+    }
+
+    void submitWait(BenchmarkState& state)
+    {
+        JobSystem& jobs = jobSystem();
+        std::atomic<uint32_t> executed{0};
+        std::vector<Job> batch(kJobs);
+        JobCounter counter;
+        for (Job& job : batch)
+        {
+            job.function = [](void* data) {
+                static_cast<std::atomic<uint32_t>*>(data)->fetch_add(1, std::memory_order_relaxed);
+            };
+            job.data = &executed;
+            job.counter = &counter;
+        }
+        state.measure(kJobs, [&] {
+            jobs.submit(batch.data(), kJobs);
+            jobs.wait(counter);
+        });
+        doNotOptimize(executed.load());
+    }
+
+    // 100만 항목을 배치 4096개 단위로 나눕니다. 연산 하나는 항목 하나입니다.
+    void parallelForSum(BenchmarkState& state)
+    {
+        constexpr uint32_t kCount = 1u << 20;
+        JobSystem& jobs = jobSystem();
+        std::vector<float> values(kCount, 1.0f);
+        state.measure(kCount, [&] {
+            jobs.parallelFor(kCount, 4096, [&](uint32_t begin, uint32_t end) {
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    values[i] = values[i] * 0.5f + 0.5f;
+                }
+            });
+            doNotOptimize(values[0]);
+        });
+    }
+
+    // 서로 충돌하지 않는 시스템 64개를 한 단계에서 실행합니다. 연산 하나는 시스템 하나입니다.
+    void schedulerFrame(BenchmarkState& state)
+    {
+        constexpr uint32_t kSystems = 64;
+        Scheduler scheduler(jobSystem());
+        const PhaseId phase = scheduler.addPhase("bench");
+        std::vector<uint64_t> counters(kSystems);
+        for (uint32_t i = 0; i < kSystems; ++i)
+        {
+            SystemDesc desc;
+            desc.name = "bench.system";
+            desc.phase = phase;
+            desc.writes.push_back(i);
+            desc.function = [](const SystemContext& context) { ++*static_cast<uint64_t*>(context.userData); };
+            desc.userData = &counters[i];
+            scheduler.addSystem(desc);
+        }
+        state.measure(kSystems, [&] { scheduler.runFrame(); });
+        doNotOptimize(counters[0]);
+    }
+
+    AXIS_BENCHMARK("jobs.submitWait.empty", submitWait);
+    AXIS_BENCHMARK("jobs.parallelFor.1m", parallelForSum);
+    AXIS_BENCHMARK("jobs.scheduler.frame64", schedulerFrame);
+}
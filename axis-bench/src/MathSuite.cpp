@@ -0,0 +1,93 @@
+// 배치 수학 커널. 연산 하나는 항목(벡터, 구, 행렬) 하나이며, 고른 SIMD 수준은 결과의 machine.simd에 남습니다.
+
+#include "Benchmark.h"
+
+#include "axis/utils/MathBatch.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    using namespace axis;
+    using namespace axis::bench;
+
+    // 4096개 항목. 입력과 출력이 L1을 넘고 L2에는 들어가는 크기입니다.
+    constexpr uint32_t kGroups = 512;
+    constexpr uint32_t kItems = kGroups * 8;
+
+    std::vector<Vec3x8> makePoints()
+    {
+        std::vector<Vec3x8> points(kGroups);
+        for (uint32_t g = 0; g < kGroups; ++g)
+        {
+            for (uint32_t lane = 0; lane < 8; ++lane)
+            {
+                const float value = float(g * 8 + lane);
+                points[g].x[lane] = value * 0.25f;
+                points[g].y[lane] = value * -0.5f + 3.0f;
+                points[g].z[lane] = 100.0f - value * 0.125f;
+            }
+        }
+        return points;
+    }
+
+    Mat4 makeMatrix()
+    {
+        return Mat4::fromTrs(Vec3{1.0f, 2.0f, 3.0f}, Quat::fromAxisAngle(Vec3{0.0f, 1.0f, 0.0f}, 0.75f),
+                             Vec3{1.5f, 1.5f, 1.5f});
+    }
+
+    void transformPointsKernel(BenchmarkState& state)
+    {
+        const std::vector<Vec3x8> input = makePoints();
+        std::vector<Vec3x8> output(kGroups);
+        const Mat4 m = makeMatrix();
+        state.measure(kItems, [&] {
+            transformPoints(m, input.data(), output.data(), kGroups);
+            doNotOptimize(output[0]);
+        });
+    }
+
+    void normalizeKernel(BenchmarkState& state)
+    {
+        const std::vector<Vec3x8> input = makePoints();
+        std::vector<Vec3x8> output(kGroups);
+        state.measure(kItems, [&] {
+            normalize(input.data(), output.data(), kGroups);
+            doNotOptimize(output[0]);
+        });
+    }
+
+    void cullSpheresKernel(BenchmarkState& state)
+    {
+        const std::vector<Vec3x8> centers = makePoints();
+        const std::vector<float> radii(kItems, 2.0f);
+        std::vector<uint8_t> visible(kGroups);
+        const float planes[6][4] = {
+            {1.0f, 0.0f, 0.0f, 50.0f},  {-1.0f, 0.0f, 0.0f, 50.0f}, {0.0f, 1.0f, 0.0f, 50.0f},
+            {0.0f, -1.0f, 0.0f, 50.0f}, {0.0f, 0.0f, 1.0f, 0.0f},   {0.0f, 0.0f, -1.0f, 100.0f},
+        };
+        state.measure(kItems, [&] {
+            cullSpheres(planes, centers.data(), radii.data(), kGroups, visible.data());
+            doNotOptimize(visible[0]);
+        });
+    }
+
+    void multiplyMatricesKernel(BenchmarkState& state)
+    {
+        constexpr uint32_t kMatrices = 1024;
+        const std::vector<Mat4> a(kMatrices, makeMatrix());
+        const std::vector<Mat4> b(kMatrices, makeMatrix());
+        std::vector<Mat4> out(kMatrices);
+        state.measure(kMatrices, [&] {
+            multiplyMatrices(a.data(), b.data(), out.data(), kMatrices);
+            doNotOptimize(out[0]);
+        });
+    }
+
+    AXIS_BENCHMARK("math.transformPoints", transformPointsKernel);
+    AXIS_BENCHMARK("math.normalize", normalizeKernel);
+    AXIS_BENCHMARK("math.cullSpheres", cullSpheresKernel);
+    AXIS_BENCHMARK("math.multiplyMatrices", multiplyMatricesKernel);
+}
@@ -0,0 +1,81 @@
+// 큐의 경합 없는 단일 스레드 비용. 스레드 수별 처리량은 axis-bench-queues(queues/QueueBenchmark.cpp)가 잽니다.
+
+#include "Benchmark.h"
+
+#include "axis/core/MpmcQueue.h"
+#include "axis/core/MpscQueue.h"
+#include "axis/core/SpscRing.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    using namespace axis;
+    using namespace axis::bench;
+
+    constexpr uint32_t kBatch = 1024;
+
+    struct Message : MpscNode
+    {
+        uint64_t value = 0;
+    };
+
+    void mpmcPushPop(BenchmarkState& state)
+    {
+        MpmcQueue<uint64_t> queue(kBatch);
+        state.measure(kBatch, [&] {
+            for (uint64_t i = 0; i < kBatch; ++i)
+            {
+                queue.tryPush(i);
+            }
+            uint64_t sum = 0;
+            uint64_t value;
+            while (queue.tryPop(value))
+            {
+                sum += value;
+            }
+            doNotOptimize(sum);
+        });
+    }
+
+    void spscPushPop(BenchmarkState& state)
+    {
+        SpscRing<uint64_t> ring(kBatch);
+        state.measure(kBatch, [&] {
+            for (uint64_t i = 0; i < kBatch; ++i)
+            {
+                ring.tryPush(i);
+            }
+            uint64_t sum = 0;
+            uint64_t value;
+            while (ring.tryPop(value))
+            {
+                sum += value;
+            }
+            doNotOptimize(sum);
+        });
+    }
+
+    void mpscPushPop(BenchmarkState& state)
+    {
+        MpscQueue<Message> queue;
+        std::vector<Message> messages(kBatch);
+        state.measure(kBatch, [&] {
+            for (Message& message : messages)
+            {
+                queue.push(message);
+            }
+            uint64_t sum = 0;
+            while (Message* message = queue.tryPop())
+            {
+                sum += message->value;
+            }
+            doNotOptimize(sum);
+        });
+    }
+
+    AXIS_BENCHMARK("queue.mpmc.pushPop", mpmcPushPop);
+    AXIS_BENCHMARK("queue.spsc.pushPop", spscPushPop);
+    AXIS_BENCHMARK("queue.mpsc.pushPop", mpscPushPop);
+}
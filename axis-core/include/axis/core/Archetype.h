@@ -0,0 +1,141 @@
+#pragma once
+
+#include "axis/core/Component.h"
+#include "axis/core/Entity.h"
+#include "axis/utils/FlatHashMap.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace axis
+{
+    // 청크 하나의 크기. 모든 아키타입이 같은 크기의 청크를 사용합니다.
+    constexpr uint32_t kChunkSize = 16 * 1024;
+
+    // 청크 헤더 크기. 첫 배열이 캐시 라인 경계에서 시작하도록 64바이트로 맞춥니다.
+    constexpr uint32_t kChunkHeaderSize = 64;
+
+    class ComponentMask
+    {
+    public:
+        void set(ComponentId id) { m_bits[id >> 6] |= (uint64_t{1} << (id & 63)); }
+        void reset(ComponentId id) { m_bits[id >> 6] &= ~(uint64_t{1} << (id & 63)); }
+        bool test(ComponentId id) const { return (m_bits[id >> 6] >> (id & 63)) & 1u; }
+
+        bool containsAll(const ComponentMask& other) const
+        {
+            for (uint32_t i = 0; i < kWordCount; ++i)
+            {
+                if ((m_bits[i] & other.m_bits[i]) != other.m_bits[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool intersects(const ComponentMask& other) const
+        {
+            for (uint32_t i = 0; i < kWordCount; ++i)
+            {
+                if ((m_bits[i] & other.m_bits[i]) != 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        size_t hash() const
+        {
+            uint64_t h = 0xCBF29CE484222325ull;
+            for (uint32_t i = 0; i < kWordCount; ++i)
+            {
+                h = (h ^ m_bits[i]) * 0x100000001B3ull;
+            }
+            return static_cast<size_t>(h);
+        }
+
+        friend bool operator==(const ComponentMask& a, const ComponentMask& b)
+        {
+            for (uint32_t i = 0; i < kWordCount; ++i)
+            {
+                if (a.m_bits[i] != b.m_bits[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        static constexpr uint32_t kWordCount = kMaxComponentTypes / 64;
+        uint64_t m_bits[kWordCount] = {};
+    };
+
+    struct ComponentMaskHash
+    {
+        size_t operator()(const ComponentMask& mask) const { return mask.hash(); }
+    };
+
+    // 고정 크기 메모리 블록. 헤더 뒤에 Entity 배열과 컴포넌트별 배열(SoA)이 이어집니다.
+    //
+    //   [header 64B][Entity x capacity][A x capacity][B x capacity]...
+    //
+    // 아키타입의 모든 청크는 같은 배치를 공유하고, 마지막 청크를 제외하면 항상 가득 차 있습니다.
+    struct Chunk
+    {
+        uint32_t count = 0;
+        uint32_t archetype = 0;
+
+        uint8_t* bytes() { return reinterpret_cast<uint8_t*>(this); }
+        const uint8_t* bytes() const { return reinterpret_cast<const uint8_t*>(this); }
+    };
+
+    static_assert(sizeof(Chunk) <= kChunkHeaderSize);
+
+    // 같은 컴포넌트 조합을 가진 엔티티들의 저장소.
+    struct Archetype
+    {
+        static constexpr uint16_t kNoColumn = 0xFFFF;
+
+        uint32_t index = 0;
+        ComponentMask mask;
+
+        // 정렬된 컴포넌트 목록과 열(column)별 청크 내 오프셋/크기.
+        std::vector<ComponentId> components;
+        std::vector<uint32_t> columnOffsets;
+        std::vector<uint32_t> columnSizes;
+        uint16_t columnLookup[kMaxComponentTypes];
+
+        uint32_t entityOffset = kChunkHeaderSize;
+        uint32_t chunkCapacity = 0;
+        uint32_t entityCount = 0;
+        std::vector<Chunk*> chunks;
+
+        // 컴포넌트 추가/제거 시 이동할 아키타입 캐시.
+        FlatHashMap<ComponentId, uint32_t> addEdges;
+        FlatHashMap<ComponentId, uint32_t> removeEdges;
+
+        uint32_t column(ComponentId id) const
+        {
+            return id < kMaxComponentTypes ? columnLookup[id] : kNoColumn;
+        }
+
+        Entity* entities(Chunk* chunk) const
+        {
+            return reinterpret_cast<Entity*>(chunk->bytes() + entityOffset);
+        }
+
+        void* columnData(Chunk* chunk, uint32_t column) const
+        {
+            return chunk->bytes() + columnOffsets[column];
+        }
+
+        void* element(Chunk* chunk, uint32_t column, uint32_t row) const
+        {
+            return chunk->bytes() + columnOffsets[column] + static_cast<size_t>(row) * columnSizes[column];
+        }
+    };
+}
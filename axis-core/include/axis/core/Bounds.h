@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+
+namespace axis
+{
+    struct Aabb
+    {
+        float min[3] = {0.0f, 0.0f, 0.0f};
+        float max[3] = {0.0f, 0.0f, 0.0f};
+
+        float center(uint32_t axis) const { return (min[axis] + max[axis]) * 0.5f; }
+        float halfExtent(uint32_t axis) const { return (max[axis] - min[axis]) * 0.5f; }
+
+        // 세 축 중 가장 큰 절반 크기.
+        float maxHalfExtent() const
+        {
+            const float x = halfExtent(0);
+            const float y = halfExtent(1);
+            const float z = halfExtent(2);
+            const float xy = x > y ? x : y;
+            return xy > z ? xy : z;
+        }
+
+        bool overlaps(const Aabb& other) const
+        {
+            return min[0] <= other.max[0] && max[0] >= other.min[0] && min[1] <= other.max[1] &&
+                   max[1] >= other.min[1] && min[2] <= other.max[2] && max[2] >= other.min[2];
+        }
+    };
+
+    struct Sphere
+    {
+        float center[3] = {0.0f, 0.0f, 0.0f};
+        float radius = 0.0f;
+    };
+
+    // 6개 평면(left, right, bottom, top, near, far). 평면은 (nx, ny, nz, d)이며
+    // nx*x + ny*y + nz*z + d >= 0인 쪽이 안쪽입니다.
+    struct Frustum
+    {
+        float planes[6][4] = {};
+
+        // 열 우선(column-major) view-projection 행렬에서 평면을 추출합니다(Gribb-Hartmann).
+        // 클립 공간 깊이는 [0, 1](D3D/Vulkan 규약)을 가정합니다.
+        static Frustum fromViewProjection(const float m[16]);
+
+        // AABB가 완전히 바깥이면 false. 보수적 판정이므로 바깥인데 true가 나올 수 있습니다.
+        bool intersects(const Aabb& box) const
+        {
+            for (const float* plane : planes)
+            {
+                const float x = plane[0] >= 0.0f ? box.max[0] : box.min[0];
+                const float y = plane[1] >= 0.0f ? box.max[1] : box.min[1];
+                const float z = plane[2] >= 0.0f ? box.max[2] : box.min[2];
+                if (plane[0] * x + plane[1] * y + plane[2] * z + plane[3] < 0.0f)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    inline bool intersects(const Sphere& sphere, const Aabb& box)
+    {
+        float distanceSq = 0.0f;
+        for (uint32_t axis = 0; axis < 3; ++axis)
+        {
+            const float c = sphere.center[axis];
+            const float d = c < box.min[axis] ? box.min[axis] - c : (c > box.max[axis] ? c - box.max[axis] : 0.0f);
+            distanceSq += d * d;
+        }
+        return distanceSq <= sphere.radius * sphere.radius;
+    }
+
+    inline Frustum Frustum::fromViewProjection(const float m[16])
+    {
+        // m[column * 4 + row]. 행 i는 (m[i], m[4 + i], m[8 + i], m[12 + i]).
+        auto row = [m](uint32_t i, float out[4]) {
+            out[0] = m[i];
+            out[1] = m[4 + i];
+            out[2] = m[8 + i];
+            out[3] = m[12 + i];
+        };
+
+        float r0[4];
+        float r1[4];
+        float r2[4];
+        float r3[4];
+        row(0, r0);
+        row(1, r1);
+        row(2, r2);
+        row(3, r3);
+
+        Frustum frustum;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            frustum.planes[0][i] = r3[i] + r0[i];
+            frustum.planes[1][i] = r3[i] - r0[i];
+            frustum.planes[2][i] = r3[i] + r1[i];
+            frustum.planes[3][i] = r3[i] - r1[i];
+            frustum.planes[4][i] = r2[i];
+            frustum.planes[5][i] = r3[i] - r2[i];
+        }
+        return frustum;
+    }
+}
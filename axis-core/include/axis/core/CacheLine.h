@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <thread>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+#endif
+
+namespace axis
+{
+    // 거짓 공유를 피하기 위한 정렬 단위.
+    // std::hardware_destructive_interference_size는 컴파일러마다 값과 경고가 달라 고정값을 씁니다.
+    constexpr size_t kCacheLineSize = 64;
+
+    // 스핀 대기 한 번. x86에서는 pause로 파이프라인과 하이퍼스레드 짝을 양보합니다.
+    inline void cpuRelax()
+    {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#else
+        std::this_thread::yield();
+#endif
+    }
+}
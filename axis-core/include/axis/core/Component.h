@@ -0,0 +1,101 @@
+#pragma once
+
+#include "axis/core/Export.h"
+#include "axis/utils/StringId.h"
+
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace axis
+{
+    class ModuleLoader;
+    using ModuleId = uint32_t;
+
+    // 컴포넌트 타입 식별자. Scheduler의 AccessId로 그대로 사용할 수 있습니다.
+    using ComponentId = uint32_t;
+
+    constexpr uint32_t kMaxComponentTypes = 256;
+    constexpr ComponentId kInvalidComponent = 0xFFFFFFFFu;
+
+    // 청크 안에서 컴포넌트 배열을 다루기 위한 타입 정보.
+    // 크기가 0인 컴포넌트(태그)는 저장 공간을 차지하지 않습니다.
+    struct ComponentInfo
+    {
+        const char* name = nullptr;
+        // 비워 두면 registerType이 name에서 계산합니다.
+        StringId nameId;
+        uint32_t size = 0;
+        uint32_t alignment = 1;
+        bool trivial = false;
+
+        void (*construct)(void* dst) = nullptr;
+        void (*destruct)(void* dst) = nullptr;
+        // dst에 src를 이동 생성한 뒤 src를 파괴합니다.
+        void (*relocate)(void* dst, void* src) = nullptr;
+    };
+
+    // 프로세스 전역 컴포넌트 타입 목록.
+    // 타입 이름으로 등록하므로 여러 DLL에서 같은 타입을 등록해도 같은 ID를 받습니다.
+    // 이름은 등록부가 복사해 두므로 등록한 DLL이 내려가도 남습니다. 함수 포인터는 detachModule로 떼어 냅니다.
+    class AXIS_CORE_API ComponentRegistry
+    {
+    public:
+        // 떼어 낸 타입을 같은 이름으로 다시 등록하면 ID는 그대로 두고 함수 포인터만 새 코드로 바꿉니다.
+        static ComponentId registerType(const ComponentInfo& info);
+
+        // 함수 포인터가 모듈 안에 있는 타입을 떼어 내고 그 수를 반환합니다. ModuleDesc::beforeUnload에서 부릅니다.
+        // 떼어 낸 타입의 생성/파괴/이동은 다시 등록될 때까지 assert로 막히므로, 새 모듈은 create에서
+        // registerType(makeComponentInfo<T>())로 자기 타입을 다시 등록해야 합니다. componentId<T>()는 ID를 정적 변수에
+        // 캐시해 (GCC의 gnu_unique 정적 변수처럼 이전 복사본과 공유되면) 다시 등록하지 않을 수 있습니다.
+        // 자명한 타입은 memcpy로 옮기므로 떼어 낸 동안에도 그대로 쓸 수 있습니다.
+        static uint32_t detachModule(const ModuleLoader& loader, ModuleId module);
+        // 다시 등록되지 않은 타입 수. afterLoad에서 0인지 확인합니다.
+        static uint32_t detachedCount();
+
+        // 등록된 타입 중 이름 ID가 같은 것. 없으면 kInvalidComponent.
+        static ComponentId find(StringId nameId);
+        static const ComponentInfo& info(ComponentId id);
+        static uint32_t count();
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        const char* componentTypeName()
+        {
+#if defined(_MSC_VER)
+            return __FUNCSIG__;
+#else
+            return __PRETTY_FUNCTION__;
+#endif
+        }
+    }
+
+    template <typename T>
+    ComponentInfo makeComponentInfo()
+    {
+        static_assert(alignof(T) <= 64, "컴포넌트 정렬은 캐시 라인(64바이트)을 넘을 수 없습니다");
+
+        ComponentInfo info;
+        info.name = detail::componentTypeName<T>();
+        info.size = std::is_empty_v<T> ? 0u : static_cast<uint32_t>(sizeof(T));
+        info.alignment = static_cast<uint32_t>(alignof(T));
+        info.trivial = std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>;
+        info.construct = [](void* dst) { new (dst) T(); };
+        info.destruct = [](void* dst) { static_cast<T*>(dst)->~T(); };
+        info.relocate = [](void* dst, void* src) {
+            new (dst) T(std::move(*static_cast<T*>(src)));
+            static_cast<T*>(src)->~T();
+        };
+        return info;
+    }
+
+    template <typename T>
+    ComponentId componentId()
+    {
+        static const ComponentId id = ComponentRegistry::registerType(makeComponentInfo<std::remove_cv_t<T>>());
+        return id;
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+namespace axis
+{
+    // 엔티티 핸들. index는 World 내부 레코드 위치, generation은 재사용 검출용입니다.
+    struct Entity
+    {
+        static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+        uint32_t index = kInvalidIndex;
+        uint32_t generation = 0;
+
+        bool isValid() const { return index != kInvalidIndex; }
+
+        friend bool operator==(const Entity& a, const Entity& b)
+        {
+            return a.index == b.index && a.generation == b.generation;
+        }
+        friend bool operator!=(const Entity& a, const Entity& b) { return !(a == b); }
+    };
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "axis/core/CacheLine.h"
+#include "axis/core/Component.h"
+#include "axis/core/Export.h"
+#include "axis/core/JobSystem.h"
+#include "axis/core/Scheduler.h"
+#include "axis/utils/Allocator.h"
+#include "axis/utils/SpinLock.h"
+#include "axis/utils/StringId.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace axis
+{
+    // 이벤트 타입 식별자. 등록 순서대로 붙으며, dispatch는 이 순서대로 타입별 묶음을 넘깁니다.
+    using EventTypeId = uint32_t;
+    using SubscriptionId = uint32_t;
+
+    constexpr uint32_t kMaxEventTypes = 256;
+    constexpr EventTypeId kInvalidEventType = 0xFFFFFFFFu;
+    constexpr SubscriptionId kInvalidSubscription = 0xFFFFFFFFu;
+
+    // 이벤트는 memcpy로 버퍼에 쌓이므로 자명하게 복사 가능한 타입이어야 합니다.
+    struct EventTypeInfo
+    {
+        const char* name = nullptr;
+        // 비워 두면 registerType이 name에서 계산합니다.
+        StringId nameId;
+        uint32_t size = 0;
+        uint32_t alignment = 1;
+    };
+
+    // 프로세스 전역 이벤트 타입 목록. ComponentRegistry처럼 이름으로 등록하므로 DLL 사이에서도 ID가 같습니다.
+    // 이름은 등록부가 복사해 두므로 모듈을 다시 불러와도 남습니다. 구독 함수는 모듈이 destroy에서 unsubscribe합니다.
+    class AXIS_CORE_API EventTypeRegistry
+    {
+    public:
+        static EventTypeId registerType(const EventTypeInfo& info);
+        // 등록된 타입 중 이름 ID가 같은 것. 없으면 kInvalidEventType.
+        static EventTypeId find(StringId nameId);
+        static const EventTypeInfo& info(EventTypeId id);
+        static uint32_t count();
+    };
+
+    template <typename T>
+    EventTypeId eventTypeId()
+    {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                      "이벤트는 자명하게 복사/파괴 가능한 타입이어야 합니다");
+        static_assert(alignof(T) <= 16, "이벤트 정렬은 16바이트를 넘을 수 없습니다");
+
+        using Type = std::remove_cv_t<T>;
+        static const EventTypeId id = EventTypeRegistry::registerType(
+            EventTypeInfo{detail::componentTypeName<Type>(), StringId(), static_cast<uint32_t>(sizeof(Type)),
+                          static_cast<uint32_t>(alignof(Type))});
+        return id;
+    }
+
+    // 한 타입의 이번 묶음 전체를 받는 구독 함수. events는 EventTypeInfo::size 간격의 연속 배열입니다.
+    using EventHandler = void (*)(const void* events, uint32_t count, void* userData);
+
+    struct EventBusDesc
+    {
+        // 스레드별 버퍼를 늘리는 단위. 이벤트 하나(머리글 포함)는 이보다 작아야 합니다.
+        uint32_t chunkSize = 64 * 1024;
+    };
+
+    struct EventBusStats
+    {
+        // 마지막 dispatch가 넘긴 이벤트 수와 타입 수.
+        uint32_t events = 0;
+        uint32_t types = 0;
+        // 마지막 dispatch에서 구독자가 없어 버려진 이벤트 수.
+        uint32_t undelivered = 0;
+        // 청크를 할당하지 못해 버린 누적 이벤트 수. 0이 아니면 메모리 예산을 확인해야 합니다.
+        uint32_t dropped = 0;
+        uint32_t chunks = 0;
+    };
+
+    // 프레임 단위로 모아서 보내는 타입별 이벤트 버스.
+    //
+    // publish는 호출한 스레드의 전용 버퍼 끝에 이벤트를 복사하기만 하므로 잠금도, 구독자 호출도 없습니다.
+    // JobSystem에 속하지 않은 스레드는 스핀 락으로 보호되는 공용 버퍼 하나를 함께 씁니다.
+    //
+    // dispatch는 모인 이벤트를 타입별 연속 배열로 모은 뒤, 타입 ID 순으로 각 구독자에게 배열 전체를 한 번에 넘깁니다.
+    // 같은 타입 안에서는 스레드 인덱스 순, 한 스레드 안에서는 publish 순서를 지킵니다.
+    // 구독자 안에서 publish한 이벤트(구독자가 제출한 작업 포함)는 다음 dispatch로 넘어가므로,
+    // 이벤트 처리 중에 같은 이벤트가 다시 들어와 재진입하는 일이 없습니다.
+    //
+    // dispatch는 단계 경계처럼 다른 스레드가 publish하지 않는 지점에서 호출해야 합니다.
+    // Scheduler에서는 dispatchSystem만 둔 단계를 이벤트를 보낼 자리에 추가하면 됩니다.
+    // subscribe/unsubscribe/dispatch는 한 스레드에서 호출하며, 구독자 안에서 호출해도 됩니다.
+    class AXIS_CORE_API EventBus
+    {
+    public:
+        // allocator가 없으면 "core.events" 태그로 할당합니다.
+        explicit EventBus(JobSystem& jobs, const EventBusDesc& desc = {}, Allocator* allocator = nullptr);
+        ~EventBus();
+
+        EventBus(const EventBus&) = delete;
+        EventBus& operator=(const EventBus&) = delete;
+
+        // 어느 스레드에서든 호출할 수 있습니다. 버퍼를 늘리지 못하면 이벤트를 버리고 false.
+        template <typename T>
+        bool publish(const T& event)
+        {
+            return publish(eventTypeId<T>(), &event, static_cast<uint32_t>(sizeof(T)),
+                           static_cast<uint32_t>(alignof(T)));
+        }
+        // size와 alignment는 등록된 EventTypeInfo와 같아야 합니다.
+        bool publish(EventTypeId type, const void* data, uint32_t size, uint32_t alignment);
+
+        // 구독자는 등록 순서대로 호출됩니다. 구독자 안에서 등록하면 다음 dispatch부터 받습니다.
+        template <typename T>
+        SubscriptionId subscribe(void (*handler)(const T* events, uint32_t count, void* userData),
+                                 void* userData = nullptr)
+        {
+            return addSubscriber(eventTypeId<T>(), reinterpret_cast<GenericHandler>(handler), &invokeTyped<T>,
+                                 userData);
+        }
+        SubscriptionId subscribe(EventTypeId type, EventHandler handler, void* userData = nullptr);
+
+        // 구독자 안에서 해제하면 이번 dispatch의 남은 묶음부터 받지 않습니다.
+        void unsubscribe(SubscriptionId id);
+
+        // 지금까지 모인 이벤트를 보냅니다. 넘긴 이벤트 수를 반환합니다.
+        uint32_t dispatch();
+
+        // SystemFunction 형태의 dispatch. userData에 EventBus를 넣어 단독 단계에 등록합니다.
+        static void dispatchSystem(const SystemContext& context);
+
+        const EventBusStats& stats() const { return m_stats; }
+
+    private:
+        using GenericHandler = void (*)();
+        using Invoker = void (*)(GenericHandler handler, const void* events, uint32_t count, void* userData);
+
+        struct Chunk;
+
+        // 스레드 하나의 이벤트 버퍼. 세대마다 청크 목록을 따로 두어, 보내는 동안 쌓이는 이벤트를 분리합니다.
+        struct alignas(kCacheLineSize) ThreadBuffer
+        {
+            Chunk* head[2] = {};
+            Chunk* tail[2] = {};
+        };
+
+        struct Subscriber
+        {
+            EventTypeId type = kInvalidEventType;
+            SubscriptionId id = kInvalidSubscription;
+            GenericHandler handler = nullptr;
+            Invoker invoke = nullptr;
+            void* userData = nullptr;
+            bool active = true;
+        };
+
+        template <typename T>
+        static void invokeTyped(GenericHandler handler, const void* events, uint32_t count, void* userData)
+        {
+            using Handler = void (*)(const T*, uint32_t, void*);
+            reinterpret_cast<Handler>(handler)(static_cast<const T*>(events), count, userData);
+        }
+
+        SubscriptionId addSubscriber(EventTypeId type, GenericHandler handler, Invoker invoke, void* userData);
+        void insertSubscriber(const Subscriber& subscriber);
+        void applySubscriberChanges();
+
+        bool append(ThreadBuffer& buffer, uint32_t generation, EventTypeId type, const void* data, uint32_t size,
+                    uint32_t alignment);
+        Chunk* acquireChunk();
+        void releaseChunks(Chunk* head);
+        bool reserveScratch(size_t bytes);
+
+        JobSystem& m_jobs;
+        EventBusDesc m_desc;
+        SystemAllocator m_systemAllocator;
+        Allocator& m_allocator;
+
+        // [0, threadCount)는 JobSystem 스레드, 마지막 하나는 외부 스레드용입니다.
+        std::unique_ptr<ThreadBuffer[]> m_buffers;
+        uint32_t m_bufferCount = 0;
+        SpinLock m_externalLock;
+        // publish가 쓰는 세대. dispatch가 외부 잠금 안에서 뒤집습니다.
+        std::atomic<uint32_t> m_generation{0};
+
+        SpinLock m_chunkLock;
+        Chunk* m_freeChunks = nullptr;
+        uint32_t m_chunkCount = 0;
+        std::atomic<uint32_t> m_dropped{0};
+
+        // 타입 순으로 정렬된 구독자. 같은 타입 안에서는 등록 순서입니다.
+        std::vector<Subscriber> m_subscribers;
+        std::vector<Subscriber> m_pendingSubscribers;
+        uint8_t m_subscribed[kMaxEventTypes] = {};
+        SubscriptionId m_nextSubscription = 0;
+        bool m_dispatching = false;
+        bool m_subscribersDirty = false;
+
+        // dispatch 중 타입별 개수와 배열 위치.
+        uint32_t m_typeCounts[kMaxEventTypes] = {};
+        size_t m_typeOffsets[kMaxEventTypes] = {};
+        uint8_t* m_scratch = nullptr;
+        size_t m_scratchCapacity = 0;
+
+        EventBusStats m_stats;
+    };
+}
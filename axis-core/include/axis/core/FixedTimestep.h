@@ -0,0 +1,89 @@
+#pragma once
+
+#include "axis/core/Export.h"
+#include "axis/core/Scheduler.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace axis
+{
+    struct FixedTimestepDesc
+    {
+        uint32_t tickRate = 60;
+        // 한 프레임에 따라잡을 최대 틱 수. 넘는 시간은 버려 시뮬레이션이 느려지는 쪽을 택합니다.
+        uint32_t maxTicksPerFrame = 5;
+    };
+
+    struct FixedTimestepFrame
+    {
+        // 이번 프레임에 실행할 틱 수와 그 첫 틱의 번호.
+        uint32_t ticks = 0;
+        uint64_t firstTick = 0;
+        // 마지막 틱 이후 남은 시간 / 틱 길이. 렌더러는 직전 틱과 마지막 틱 사이를 이 비율로 보간합니다.
+        float alpha = 0.0f;
+        // 따라잡기 한도를 넘어 버린 시간(ns). 0이 아니면 시뮬레이션이 실시간보다 느려진 것입니다.
+        uint64_t droppedNs = 0;
+    };
+
+    // 누산기 기반 고정 틱 계산기.
+    //
+    // 경과 시간을 정수 나노초로 누적하므로 오래 실행해도 부동소수 오차로 틱이 밀리지 않고,
+    // 같은 경과 시간 열을 넣으면 항상 같은 틱 열이 나옵니다.
+    class AXIS_CORE_API FixedTimestep
+    {
+    public:
+        explicit FixedTimestep(const FixedTimestepDesc& desc = {});
+
+        FixedTimestepFrame advance(uint64_t elapsedNs);
+        void reset();
+
+        uint64_t tickDurationNs() const { return m_tickNs; }
+        double tickSeconds() const { return static_cast<double>(m_tickNs) * 1e-9; }
+        // 지금까지 실행한 틱 수. 다음 틱의 번호이기도 합니다.
+        uint64_t tickIndex() const { return m_tickIndex; }
+        uint64_t accumulatedNs() const { return m_accumulatorNs; }
+        float alpha() const { return static_cast<float>(m_accumulatorNs) / static_cast<float>(m_tickNs); }
+
+    private:
+        FixedTimestepDesc m_desc;
+        uint64_t m_tickNs;
+        uint64_t m_accumulatorNs = 0;
+        uint64_t m_tickIndex = 0;
+    };
+
+    // 고정 틱 시뮬레이션과 가변 프레임 표시를 묶은 메인 루프.
+    //
+    // 프레임마다 필요한 만큼 simulation 스케줄러를 틱 길이로 실행하고(deltaTime = 틱 길이, alpha = 1),
+    // 이어서 presentation 스케줄러를 실제 경과 시간과 보간 계수로 한 번 실행합니다.
+    // 렌더를 별도 스레드에서 돌린다면 presentation을 nullptr로 두고 alphaNow()로 그 순간의 보간 계수를 얻습니다.
+    // 변환 데이터는 SnapshotBuffer로 넘겨 렌더 스레드가 잠금 없이 읽게 합니다.
+    class AXIS_CORE_API SimulationLoop
+    {
+    public:
+        SimulationLoop(Scheduler& simulation, Scheduler* presentation, const FixedTimestepDesc& desc = {});
+
+        SimulationLoop(const SimulationLoop&) = delete;
+        SimulationLoop& operator=(const SimulationLoop&) = delete;
+
+        // 직전 호출 이후의 실제 경과 시간으로 한 프레임을 진행합니다. 첫 호출은 틱을 실행하지 않습니다.
+        FixedTimestepFrame runFrame();
+        // 결정적 재생과 테스트용. 주어진 경과 시간으로 진행합니다.
+        FixedTimestepFrame runFrame(uint64_t elapsedNs);
+
+        // 어느 스레드에서나 호출할 수 있습니다. 마지막 틱 이후 흐른 실제 시간으로 계산한 보간 계수(0..1).
+        float alphaNow() const;
+
+        const FixedTimestep& timestep() const { return m_timestep; }
+
+    private:
+        Scheduler& m_simulation;
+        Scheduler* m_presentation;
+        FixedTimestep m_timestep;
+        uint64_t m_lastFrameNs = 0;
+        bool m_started = false;
+
+        // alphaNow용. 현재 시각에서 누산기에 남은 시간을 뺀, 마지막 틱이 끝난 것으로 치는 시각.
+        std::atomic<uint64_t> m_lastTickNs{0};
+    };
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "axis/core/Export.h"
+#include "axis/core/SpscRing.h"
+#include "axis/platform/RawInput.h"
+#include "axis/utils/Allocator.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace axis
+{
+    // RawInput 스레드에서 게임 스레드로 입력 이벤트를 넘기는 SPSC 큐.
+    //
+    // 입력 스레드가 유일한 생산자이고 drain을 부르는 스레드 하나가 유일한 소비자입니다.
+    // 큐가 가득 차면 입력 스레드는 기다리지 않고 이벤트를 버리며 droppedCount로 셉니다.
+    // drain에 시각을 주면 그 뒤의 이벤트는 남겨 두므로, 프레임 시작에 한 번, FramePacer의 늦은 샘플 시각에
+    // 한 번 비우면 두 번째 호출이 샘플 시각까지의 입력만 정확히 가져옵니다.
+    class AXIS_CORE_API InputQueue
+    {
+    public:
+        // capacity는 2의 거듭제곱이어야 합니다.
+        explicit InputQueue(uint32_t capacity = 4096, Allocator& allocator = defaultAllocator());
+
+        InputQueue(const InputQueue&) = delete;
+        InputQueue& operator=(const InputQueue&) = delete;
+
+        // RawInput을 만들기 전에 desc에 sink를 연결합니다. 큐는 RawInput보다 오래 살아야 합니다.
+        void attach(RawInputDesc& desc);
+
+        // timestampNs가 upToNs 이하인 이벤트를 받은 순서대로 최대 capacity개 꺼내고 개수를 반환합니다.
+        uint32_t drain(InputEvent* out, uint32_t capacity, uint64_t upToNs = ~0ull);
+
+        uint64_t droppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+    private:
+        static void push(const InputEvent* events, uint32_t count, void* context);
+
+        SpscRing<InputEvent> m_ring;
+        std::atomic<uint64_t> m_dropped{0};
+
+        // 소비자 전용: upToNs보다 늦어 꺼내 놓고 돌려주지 않은 이벤트.
+        InputEvent m_pending;
+        bool m_hasPending = false;
+    };
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "axis/core/Export.h"
+#include "axis/core/JobSystem.h"
+#include "axis/platform/AsyncIo.h"
+#include "axis/utils/PoolAllocator.h"
+
+#include <cstdint>
+
+namespace axis
+{
+    // AsyncIo 완료 콜백을 JobSystem 작업으로 실행합니다.
+    //
+    // I/O 스레드는 완료를 받자마자 작업 하나를 제출하고 다음 완료로 넘어가므로,
+    // 콜백이 무거운 후처리(압축 해제, 업로드 준비 등)를 해도 I/O 제출이 밀리지 않습니다.
+    // 작업 객체는 내부 풀에서 꺼내며 콜백이 끝나면 돌려놓습니다.
+    class AXIS_CORE_API IoJobBridge
+    {
+    public:
+        explicit IoJobBridge(JobSystem& jobs, uint32_t jobsPerPage = 256);
+        ~IoJobBridge();
+
+        IoJobBridge(const IoJobBridge&) = delete;
+        IoJobBridge& operator=(const IoJobBridge&) = delete;
+
+        // AsyncIo를 만들기 전에 desc에 실행기를 연결합니다. 브리지는 AsyncIo보다 오래 살아야 합니다.
+        void attach(AsyncIoDesc& desc);
+
+        // 제출된 콜백 작업이 모두 끝날 때까지 기다립니다. 기다리는 동안 작업을 실행합니다.
+        void wait();
+
+        // 실행 대기 중이거나 실행 중인 콜백 작업 수를 셉니다.
+        const JobCounter& counter() const { return m_counter; }
+
+    private:
+        struct CompletionJob
+        {
+            Job job;
+            IoRequest* request;
+            IoJobBridge* owner;
+        };
+
+        static void execute(IoRequest& request, void* context);
+        static void run(void* data);
+
+        JobSystem& m_jobs;
+        ObjectPool<CompletionJob> m_pool;
+        JobCounter m_counter;
+    };
+}
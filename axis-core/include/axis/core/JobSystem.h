@@ -0,0 +1,218 @@
+#pragma once
+
+#include "axis/core/Export.h"
+#include "axis/core/MpmcQueue.h"
+#include "axis/platform/CpuTopology.h"
+#include "axis/platform/Thread.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace axis
+{
+    // 작업 함수. data는 Job을 제출한 쪽이 소유합니다.
+    using JobFunction = void (*)(void* data);
+
+    struct Job;
+
+    // 완료 대기용 카운터.
+    // submit 시 증가하고 작업이 끝나면 감소합니다. 0이 되면 해당 작업 묶음이 모두 끝난 것입니다.
+    struct JobCounter
+    {
+        // pending의 최상위 비트는 태스크가 이 카운터를 기다리며 중단되어 있음을 나타냅니다(Task.h의 waitFor).
+        static constexpr uint32_t kContinuationBit = 0x80000000u;
+
+        std::atomic<uint32_t> pending{0};
+        // 마지막 작업이 끝나면 제출할 작업. kContinuationBit가 설정된 동안만 유효합니다.
+        Job* continuation = nullptr;
+
+        bool isDone() const { return pending.load(std::memory_order_acquire) == 0; }
+    };
+
+    // 작업 단위.
+    // Job 메모리는 제출한 쪽이 소유하며, 연결된 카운터가 0이 될 때까지 유지되어야 합니다.
+    // JobSystem은 Job을 복사하거나 할당하지 않습니다.
+    struct Job
+    {
+        JobFunction function = nullptr;
+        void* data = nullptr;
+        JobCounter* counter = nullptr;
+    };
+
+    struct JobSystemDesc
+    {
+        // 백그라운드 워커 수. 0이면 (하드웨어 스레드 수 - 1)을 사용합니다.
+        // 소유 스레드(JobSystem을 생성한 스레드)도 wait 중에는 작업을 실행하므로
+        // 기본값에서 코어 하나당 실행 스레드 하나가 됩니다.
+        uint32_t workerCount = 0;
+
+        // 스레드별 작업 덱 용량. 2의 거듭제곱이어야 하며, 가득 차면 공용 큐로 넘어갑니다.
+        uint32_t dequeCapacity = 4096;
+
+        // 워커가 아닌 스레드에서 제출한 작업과 덱이 넘친 작업이 거치는 공용 큐 용량. 2의 거듭제곱이어야 합니다.
+        // 가득 차면 제출한 스레드가 자리가 날 때까지 작업을 대신 실행합니다.
+        uint32_t injectCapacity = 4096;
+
+        // 워커가 돌 CPU. 비어 있으면 모든 CPU입니다. 렌더/오디오 스레드용 코어를 빼 둘 때 씁니다.
+        CpuMask workerCpus;
+
+        // true면 워커마다 CPU 하나에 고정합니다. cpuTopology().spreadOrder 순서(P코어, E코어, SMT 짝)로
+        // 배정하며, 첫 CPU는 소유 스레드 몫으로 비워 둡니다. 소유 스레드 자체의 고정은 호출한 쪽이 합니다.
+        // false면 workerCpus 안에서 OS가 자유롭게 옮깁니다.
+        bool pinWorkers = false;
+
+        ThreadPriority workerPriority = ThreadPriority::Normal;
+    };
+
+    namespace detail
+    {
+        class WorkStealingDeque;
+    }
+
+    // 작업 훔치기(work-stealing) 기반 스레드 풀.
+    //
+    // 스레드마다 고유한 덱을 가지며, 자신의 덱에서는 LIFO로 꺼내고
+    // 다른 스레드의 덱에서는 FIFO로 훔칩니다.
+    // 워커가 아닌 외부 스레드에서 제출한 작업은 공용 큐를 거칩니다.
+    class AXIS_CORE_API JobSystem
+    {
+    public:
+        static constexpr uint32_t kInvalidThreadIndex = 0xFFFFFFFFu;
+
+        explicit JobSystem(const JobSystemDesc& desc = {});
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        // 작업을 제출합니다. job.counter가 있으면 제출 시점에 1 증가합니다.
+        void submit(Job& job);
+        void submit(Job* jobs, uint32_t count);
+
+        // 카운터가 0이 될 때까지 대기합니다. 대기 중인 스레드도 작업을 실행합니다.
+        void wait(const JobCounter& counter);
+
+        // Job 하나로 표현되지 않는 작업(코루틴 등)의 완료를 카운터에 묶습니다.
+        // addPending으로 올린 만큼 completePending을 호출해야 하며, 마지막 호출이 기다리던 태스크를 깨웁니다.
+        void addPending(JobCounter& counter) { counter.pending.fetch_add(1, std::memory_order_relaxed); }
+        void completePending(JobCounter& counter);
+
+        // 큐에서 작업 하나를 꺼내 실행합니다. 실행했다면 true.
+        bool runOne();
+
+        // [0, count) 범위를 batchSize 단위로 나누어 병렬 실행합니다.
+        // fn(begin, end) 형태로 호출되며, 호출한 스레드도 함께 실행에 참여합니다.
+        // 반환 시점에는 모든 범위가 처리되어 있습니다.
+        template <typename Fn>
+        void parallelFor(uint32_t count, uint32_t batchSize, Fn&& fn);
+
+        // 소유 스레드를 포함한 실행 스레드 수.
+        uint32_t threadCount() const { return static_cast<uint32_t>(m_deques.size()); }
+
+        // 현재 스레드의 인덱스. 0은 소유 스레드, 1 이상은 워커,
+        // 이 JobSystem에 속하지 않은 스레드는 kInvalidThreadIndex입니다.
+        uint32_t currentThreadIndex() const;
+
+    private:
+        static constexpr uint32_t kMaxParallelHelpers = 63;
+
+        bool findJob(Job*& outJob, uint32_t threadIndex);
+        void execute(Job& job);
+        void workerMain(uint32_t threadIndex);
+        void notifyWorkers(uint32_t count);
+
+        std::vector<std::unique_ptr<detail::WorkStealingDeque>> m_deques;
+        std::vector<std::thread> m_workers;
+        // 워커별 친화도. 비어 있는 항목은 OS 기본값을 그대로 둡니다.
+        std::vector<CpuMask> m_workerAffinity;
+        ThreadPriority m_workerPriority = ThreadPriority::Normal;
+
+        MpmcQueue<Job*> m_injectQueue;
+
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wakeCondition;
+        std::atomic<uint32_t> m_sleepingWorkers{0};
+        std::atomic<int64_t> m_queuedJobs{0};
+        std::atomic<bool> m_running{true};
+    };
+
+    template <typename Fn>
+    void JobSystem::parallelFor(uint32_t count, uint32_t batchSize, Fn&& fn)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        if (batchSize == 0)
+        {
+            batchSize = 1;
+        }
+
+        const uint32_t batchCount = (count + batchSize - 1) / batchSize;
+        if (batchCount == 1)
+        {
+            fn(0u, count);
+            return;
+        }
+
+        // 배치를 미리 나누지 않고 공유 인덱스에서 하나씩 가져가므로
+        // 늦게 깨어난 스레드에 작업이 몰리지 않습니다.
+        struct Shared
+        {
+            Fn* fn;
+            uint32_t count;
+            uint32_t batchSize;
+            uint32_t batchCount;
+            std::atomic<uint32_t> next{0};
+
+            void drain()
+            {
+                for (;;)
+                {
+                    const uint32_t batch = next.fetch_add(1, std::memory_order_relaxed);
+                    if (batch >= batchCount)
+                    {
+                        return;
+                    }
+                    const uint32_t begin = batch * batchSize;
+                    const uint32_t end = (begin + batchSize < count) ? begin + batchSize : count;
+                    (*fn)(begin, end);
+                }
+            }
+        };
+
+        Shared shared;
+        shared.fn = &fn;
+        shared.count = count;
+        shared.batchSize = batchSize;
+        shared.batchCount = batchCount;
+
+        uint32_t helperCount = threadCount() - 1;
+        if (helperCount > batchCount - 1)
+        {
+            helperCount = batchCount - 1;
+        }
+        if (helperCount > kMaxParallelHelpers)
+        {
+            helperCount = kMaxParallelHelpers;
+        }
+
+        JobCounter counter;
+        Job helpers[kMaxParallelHelpers];
+        for (uint32_t i = 0; i < helperCount; ++i)
+        {
+            helpers[i].function = [](void* data) { static_cast<Shared*>(data)->drain(); };
+            helpers[i].data = &shared;
+            helpers[i].counter = &counter;
+        }
+        submit(helpers, helperCount);
+
+        shared.drain();
+        wait(counter);
+    }
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "axis/core/CacheLine.h"
+#include "axis/utils/Allocator.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace axis
+{
+    // 용량이 고정된 잠금 없는 다중 생산자/다중 소비자 큐 (Vyukov bounded MPMC).
+    //
+    // 칸마다 순번을 두어 생산자와 소비자가 서로 다른 칸에서는 경쟁하지 않으며,
+    // 같은 위치를 노린 스레드끼리만 CAS 한 번으로 겨룹니다.
+    // 가득 차면 tryPush가, 비어 있으면 tryPop이 즉시 false를 반환합니다.
+    template <typename T>
+    class MpmcQueue
+    {
+    public:
+        // capacity는 2 이상의 2의 거듭제곱이어야 합니다.
+        explicit MpmcQueue(uint32_t capacity, Allocator& allocator = defaultAllocator())
+            : m_allocator(allocator)
+            , m_mask(capacity - 1)
+        {
+            assert(capacity >= 2 && (capacity & (capacity - 1)) == 0 && "용량은 2의 거듭제곱이어야 합니다");
+            m_cells = static_cast<Cell*>(m_allocator.allocate(sizeof(Cell) * capacity, alignof(Cell)));
+            assert(m_cells != nullptr);
+            for (uint32_t i = 0; i < capacity; ++i)
+            {
+                new (&m_cells[i]) Cell();
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        // 파괴 시점에는 다른 스레드가 큐를 쓰고 있지 않아야 합니다. 남은 값은 여기서 파괴됩니다.
+        ~MpmcQueue()
+        {
+            const size_t end = m_enqueuePos.load(std::memory_order_relaxed);
+            for (size_t position = m_dequeuePos.load(std::memory_order_relaxed); position != end; ++position)
+            {
+                std::launder(reinterpret_cast<T*>(m_cells[position & m_mask].storage))->~T();
+            }
+            for (size_t i = 0; i <= m_mask; ++i)
+            {
+                m_cells[i].~Cell();
+            }
+            m_allocator.deallocate(m_cells, sizeof(Cell) * (m_mask + 1));
+        }
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        template <typename U>
+        bool tryPush(U&& value)
+        {
+            Cell* cell;
+            size_t position = m_enqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &m_cells[position & m_mask];
+                const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+                if (diff == 0)
+                {
+                    if (m_enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            new (cell->storage) T(std::forward<U>(value));
+            cell->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool tryPop(T& out)
+        {
+            Cell* cell;
+            size_t position = m_dequeuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &m_cells[position & m_mask];
+                const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+                if (diff == 0)
+                {
+                    if (m_dequeuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = m_dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            T* value = std::launder(reinterpret_cast<T*>(cell->storage));
+            out = std::move(*value);
+            value->~T();
+            // 칸을 한 바퀴 뒤의 생산자에게 넘깁니다.
+            cell->sequence.store(position + m_mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        uint32_t capacity() const { return static_cast<uint32_t>(m_mask + 1); }
+
+        // 다른 스레드가 동시에 쓰는 동안에는 근삿값입니다.
+        uint32_t sizeApprox() const
+        {
+            const size_t enqueued = m_enqueuePos.load(std::memory_order_relaxed);
+            const size_t dequeued = m_dequeuePos.load(std::memory_order_relaxed);
+            return enqueued > dequeued ? static_cast<uint32_t>(enqueued - dequeued) : 0;
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence{0};
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        Allocator& m_allocator;
+        Cell* m_cells = nullptr;
+        const size_t m_mask;
+
+        // 생산자 위치와 소비자 위치는 서로 다른 스레드 집합이 갱신하므로 캐시 라인을 분리합니다.
+        alignas(kCacheLineSize) std::atomic<size_t> m_enqueuePos{0};
+        alignas(kCacheLineSize) std::atomic<size_t> m_dequeuePos{0};
+    };
+}
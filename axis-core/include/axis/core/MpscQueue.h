@@ -0,0 +1,97 @@
+#pragma once
+
+#include "axis/core/CacheLine.h"
+
+#include <atomic>
+#include <type_traits>
+
+namespace axis
+{
+    // 침입형 큐에 넣을 객체가 상속하는 연결 노드.
+    struct MpscNode
+    {
+        std::atomic<MpscNode*> mpscNext{nullptr};
+    };
+
+    // 침입형 다중 생산자/단일 소비자 큐 (Vyukov intrusive MPSC).
+    //
+    // 노드는 호출자 소유이며 큐는 메모리를 할당하지 않으므로 용량 제한도 없습니다.
+    // push는 exchange 한 번으로 끝나는 대기 없는 연산이고, 어느 스레드에서든 호출할 수 있습니다.
+    // tryPop은 소비자 스레드 하나만 호출해야 합니다. 생산자가 push 도중에 멈춰 있으면
+    // 그 뒤의 노드는 잠시 보이지 않을 수 있으며, 이때 tryPop은 nullptr을 반환합니다.
+    // 노드는 tryPop으로 꺼내진 뒤에야 해제하거나 다시 넣을 수 있습니다.
+    template <typename T>
+    class MpscQueue
+    {
+        static_assert(std::is_base_of_v<MpscNode, T>, "T는 MpscNode를 상속해야 합니다");
+
+    public:
+        MpscQueue()
+            : m_head(&m_stub)
+            , m_tail(&m_stub)
+        {
+        }
+
+        MpscQueue(const MpscQueue&) = delete;
+        MpscQueue& operator=(const MpscQueue&) = delete;
+
+        void push(T& item) { pushNode(&item); }
+
+        T* tryPop()
+        {
+            MpscNode* tail = m_tail;
+            MpscNode* next = tail->mpscNext.load(std::memory_order_acquire);
+            if (tail == &m_stub)
+            {
+                if (next == nullptr)
+                {
+                    return nullptr;
+                }
+                m_tail = next;
+                tail = next;
+                next = next->mpscNext.load(std::memory_order_acquire);
+            }
+
+            if (next != nullptr)
+            {
+                m_tail = next;
+                return static_cast<T*>(tail);
+            }
+
+            // tail이 마지막으로 보입니다. 생산자가 head를 옮겼지만 아직 연결하지 않았다면 기다리지 않고 물러납니다.
+            if (tail != m_head.load(std::memory_order_acquire))
+            {
+                return nullptr;
+            }
+
+            // 마지막 노드를 꺼내려면 stub을 뒤에 다시 붙여 큐가 비지 않게 합니다.
+            pushNode(&m_stub);
+            next = tail->mpscNext.load(std::memory_order_acquire);
+            if (next != nullptr)
+            {
+                m_tail = next;
+                return static_cast<T*>(tail);
+            }
+            return nullptr;
+        }
+
+        // 소비자 스레드에서만 의미가 있습니다.
+        bool emptyApprox() const
+        {
+            return m_tail == &m_stub && m_stub.mpscNext.load(std::memory_order_acquire) == nullptr;
+        }
+
+    private:
+        void pushNode(MpscNode* node)
+        {
+            node->mpscNext.store(nullptr, std::memory_order_relaxed);
+            MpscNode* previous = m_head.exchange(node, std::memory_order_acq_rel);
+            previous->mpscNext.store(node, std::memory_order_release);
+        }
+
+        // 생산자들이 두드리는 head와 소비자 전용 tail은 캐시 라인을 분리합니다.
+        alignas(kCacheLineSize) std::atomic<MpscNode*> m_head;
+        alignas(kCacheLineSize) MpscNode* m_tail;
+        MpscNode m_stub;
+    };
+}
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "axis/core/JobSystem.h"
+#include "axis/core/World.h"
+#include "axis/utils/Allocator.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace axis
+{
+    // 청크 하나에 있는 Ts 배열들. 각 배열은 count개의 연속된 원소이며 서로 겹치지 않습니다.
+    // 시스템은 이 포인터로 평범한 for 루프를 돌면 되므로 컴파일러가 루프를 벡터화할 수 있습니다.
+    template <typename... Ts>
+    struct ChunkSpan
+    {
+        uint32_t count = 0;
+        const Entity* entities = nullptr;
+        const Archetype* archetype = nullptr;
+        std::tuple<Ts*...> columns;
+
+        template <typename T>
+        T* column() const
+        {
+            return std::get<T*>(columns);
+        }
+    };
+
+    // Ts를 모두 가진 아키타입을 기억해 두는 쿼리.
+    //
+    // 아키타입은 생기기만 하고 사라지지 않으므로, 캐시는 마지막으로 본 뒤 새로 생긴 아키타입만 검사해 갱신합니다.
+    // 엔티티가 추가/제거되어도 캐시는 그대로이고, 청크 목록은 순회할 때 아키타입에서 읽습니다.
+    // Ts에 const T를 주면 해당 열을 읽기 전용 포인터로 받습니다.
+    // 한 Query 객체는 한 스레드에서만 사용해야 하며, 순회 중에는 World 구조를 바꿀 수 없습니다.
+    template <typename... Ts>
+    class Query
+    {
+        static_assert(sizeof...(Ts) > 0, "쿼리에는 컴포넌트가 하나 이상 필요합니다");
+
+    public:
+        using Span = ChunkSpan<Ts...>;
+
+        explicit Query(World& world, Allocator& allocator = defaultAllocator())
+            : m_world(&world)
+            , m_entries(allocator)
+            , m_spans(allocator)
+        {
+            (m_include.set(componentId<Ts>()), ...);
+        }
+
+        // Excluded 중 하나라도 가진 아키타입을 뺍니다.
+        template <typename... Excluded>
+        Query& without()
+        {
+            (m_exclude.set(componentId<Excluded>()), ...);
+            invalidate();
+            return *this;
+        }
+
+        // 캐시를 비웁니다. 다음 순회에서 모든 아키타입을 다시 검사합니다.
+        void invalidate()
+        {
+            m_entries.clear();
+            m_scanned = 0;
+        }
+
+        uint32_t archetypeCount()
+        {
+            refresh();
+            return static_cast<uint32_t>(m_entries.size());
+        }
+
+        uint32_t entityCount()
+        {
+            refresh();
+            uint32_t count = 0;
+            for (const Entry& entry : m_entries)
+            {
+                count += m_world->archetype(entry.archetype).entityCount;
+            }
+            return count;
+        }
+
+        // 청크마다 fn(const Span&)를 호출합니다.
+        template <typename Fn>
+        void forEachChunk(Fn&& fn)
+        {
+            refresh();
+            ++m_world->m_iterationDepth;
+            for (const Entry& entry : m_entries)
+            {
+                const Archetype& archetype = m_world->archetype(entry.archetype);
+                for (Chunk* chunk : archetype.chunks)
+                {
+                    fn(makeSpan(archetype, entry, *chunk, std::index_sequence_for<Ts...>{}));
+                }
+            }
+            --m_world->m_iterationDepth;
+        }
+
+        // 엔티티마다 fn(Ts&...)를 호출합니다. 청크 단위 루프 안에서 인라인됩니다.
+        template <typename Fn>
+        void forEach(Fn&& fn)
+        {
+            forEachChunk([&fn](const Span& span) { Query::forEachRow(span, fn, std::index_sequence_for<Ts...>{}); });
+        }
+
+        // 청크를 chunksPerJob개씩 묶어 작업 시스템에 나눠 fn(const Span&)를 호출합니다.
+        // 호출한 스레드도 참여하며, 반환 시점에는 모든 청크가 처리되어 있습니다.
+        // fn은 여러 스레드에서 동시에 호출되지만 같은 청크를 두 번 받지는 않습니다.
+        template <typename Fn>
+        void parallelForEachChunk(JobSystem& jobs, Fn&& fn, uint32_t chunksPerJob = 1)
+        {
+            refresh();
+            m_spans.clear();
+            for (const Entry& entry : m_entries)
+            {
+                const Archetype& archetype = m_world->archetype(entry.archetype);
+                for (Chunk* chunk : archetype.chunks)
+                {
+                    m_spans.push_back(makeSpan(archetype, entry, *chunk, std::index_sequence_for<Ts...>{}));
+                }
+            }
+
+            ++m_world->m_iterationDepth;
+            const Span* spans = m_spans.data();
+            jobs.parallelFor(static_cast<uint32_t>(m_spans.size()), chunksPerJob, [spans, &fn](uint32_t begin,
+                                                                                              uint32_t end) {
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    fn(spans[i]);
+                }
+            });
+            --m_world->m_iterationDepth;
+        }
+
+        // 엔티티 단위 병렬 순회. 작업 하나가 청크 chunksPerJob개를 맡습니다.
+        template <typename Fn>
+        void parallelForEach(JobSystem& jobs, Fn&& fn, uint32_t chunksPerJob = 1)
+        {
+            parallelForEachChunk(
+                jobs, [&fn](const Span& span) { Query::forEachRow(span, fn, std::index_sequence_for<Ts...>{}); },
+                chunksPerJob);
+        }
+
+    private:
+        // 일치하는 아키타입과, 그 청크 안에서 Ts 열이 시작하는 오프셋.
+        struct Entry
+        {
+            uint32_t archetype = 0;
+            uint32_t offsets[sizeof...(Ts)] = {};
+        };
+
+        template <typename T>
+        using Array = std::vector<T, StlAllocator<T>>;
+
+        void refresh()
+        {
+            const uint32_t count = m_world->archetypeCount();
+            for (; m_scanned < count; ++m_scanned)
+            {
+                const Archetype& archetype = m_world->archetype(m_scanned);
+                if (!archetype.mask.containsAll(m_include) || archetype.mask.intersects(m_exclude))
+                {
+                    continue;
+                }
+
+                Entry entry;
+                entry.archetype = m_scanned;
+                uint32_t slot = 0;
+                ((entry.offsets[slot++] = archetype.columnOffsets[archetype.column(componentId<Ts>())]), ...);
+                m_entries.push_back(entry);
+            }
+        }
+
+        template <size_t... I>
+        static Span makeSpan(const Archetype& archetype, const Entry& entry, Chunk& chunk, std::index_sequence<I...>)
+        {
+            Span span;
+            span.count = chunk.count;
+            span.entities = archetype.entities(&chunk);
+            span.archetype = &archetype;
+            span.columns = std::tuple<Ts*...>(reinterpret_cast<Ts*>(chunk.bytes() + entry.offsets[I])...);
+            return span;
+        }
+
+        template <typename Fn, size_t... I>
+        static void forEachRow(const Span& span, Fn& fn, std::index_sequence<I...>)
+        {
+            std::tuple<Ts*...> columns = span.columns;
+            const uint32_t count = span.count;
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                fn(std::get<I>(columns)[i]...);
+            }
+        }
+
+        World* m_world;
+        ComponentMask m_include;
+        ComponentMask m_exclude;
+        Array<Entry> m_entries;
+        Array<Span> m_spans;
+        uint32_t m_scanned = 0;
+    };
+}
@@ -0,0 +1,232 @@
+#pragma once
+
+#include "axis/core/Export.h"
+#include "axis/core/JobSystem.h"
+#include "axis/core/Task.h"
+#include "axis/platform/Clock.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace axis
+{
+    class ModuleLoader;
+    using ModuleId = uint32_t;
+
+    using PhaseId = uint32_t;
+    using SystemId = uint32_t;
+
+    // 시스템이 읽거나 쓰는 대상(컴포넌트 타입, 공유 리소스 등)의 식별자.
+    // 같은 AccessId를 쓰는 시스템끼리는 등록 순서대로 직렬화됩니다.
+    using AccessId = uint32_t;
+
+    constexpr PhaseId kInvalidPhase = 0xFFFFFFFFu;
+    constexpr SystemId kInvalidSystem = 0xFFFFFFFFu;
+
+    // SystemDesc::interval의 최댓값이자 SystemContext::recentDeltas의 길이.
+    constexpr uint32_t kMaxUpdateInterval = 64;
+
+    struct SystemContext
+    {
+        uint64_t frameIndex = 0;
+        // 이번 실행이 나타내는 시간(초). 고정 틱이면 틱 길이, 가변 프레임이면 실제 경과 시간입니다.
+        double deltaTime = 0.0;
+        // 표시용 보간 계수. 직전 틱과 마지막 틱 사이의 위치이며, 고정 틱 안에서는 1입니다.
+        float alpha = 1.0f;
+        PhaseId phase = kInvalidPhase;
+        SystemId system = kInvalidSystem;
+        uint32_t threadIndex = JobSystem::kInvalidThreadIndex;
+        JobSystem* jobs = nullptr;
+        void* userData = nullptr;
+
+        // 분산 실행(SystemDesc::staggered)에서 이번 실행이 맡은 조각. 그 밖에는 0/1입니다.
+        uint32_t slice = 0;
+        uint32_t sliceCount = 1;
+        // 예산이 있는 시스템의 마감 시각(Clock::nowNs 기준). 0이면 예산이 없습니다.
+        uint64_t deadlineNs = 0;
+        // 예산을 다 쓴 시스템이 다음 실행에서 이어 갈 위치. 시스템마다 하나씩 있고 프레임 사이에 유지됩니다.
+        uint64_t* cursor = nullptr;
+        // recentDeltas[i]는 i 프레임 전의 프레임 시간입니다(0이 이번 프레임). kMaxUpdateInterval개입니다.
+        const double* recentDeltas = nullptr;
+
+        bool overBudget() const { return deadlineNs != 0 && Clock::nowNs() >= deadlineNs; }
+
+        // 엔티티별 갱신 주기(LOD). key(보통 엔티티 인덱스)마다 다른 프레임에 걸리도록 interval 프레임에 한 번 true입니다.
+        bool isUpdateFrame(uint32_t key, uint32_t interval) const
+        {
+            return interval <= 1 || (frameIndex + key) % interval == 0;
+        }
+
+        // 마지막 interval 프레임 동안 흐른 시간. interval 프레임마다 갱신되는 엔티티가 쓸 deltaTime입니다.
+        double deltaTimeOver(uint32_t interval) const
+        {
+            if (interval <= 1)
+            {
+                return deltaTime;
+            }
+            if (recentDeltas == nullptr)
+            {
+                return deltaTime * interval;
+            }
+            double total = 0.0;
+            for (uint32_t i = 0; i < interval && i < kMaxUpdateInterval; ++i)
+            {
+                total += recentDeltas[i];
+            }
+            return total;
+        }
+    };
+
+    using SystemFunction = void (*)(const SystemContext& context);
+
+    // 단계/시스템 이름은 Scheduler가 인턴 표에 복사해 두므로 프로파일러 이벤트에 그대로 기록해도 됩니다.
+    struct SystemDesc
+    {
+        const char* name = nullptr;
+        PhaseId phase = kInvalidPhase;
+        std::vector<AccessId> reads;
+        std::vector<AccessId> writes;
+        SystemFunction function = nullptr;
+        void* userData = nullptr;
+
+        // interval 프레임에 한 번 실행합니다. 1이면 매 프레임입니다.
+        // staggered가 false면 시스템 전체가 interval 프레임마다 한 번 돌며, 같은 주기의 시스템들은 서로 다른 프레임에
+        // 나뉘어 배치됩니다. deltaTime은 지난 실행 이후 흐른 시간입니다.
+        // staggered가 true면 매 프레임 돌되 SystemContext::slice로 엔티티의 1/interval만 맡기고,
+        // deltaTime은 한 조각이 다시 돌아오기까지의 시간(마지막 interval 프레임)입니다.
+        uint32_t interval = 1;
+        bool staggered = false;
+        // 0이 아니면 한 번 실행할 때의 시간 예산(ns). 시스템은 overBudget()이 true가 되면 멈추고 cursor에 위치를 남겨
+        // 다음 실행에서 이어 갑니다. 예산을 넘긴 실행은 SystemStats와 프로파일러("Scheduler::budgetOverrun")에 남습니다.
+        uint64_t budgetNs = 0;
+    };
+
+    struct SystemStats
+    {
+        uint64_t runs = 0;
+        // 주기 때문에 건너뛴 프레임 수.
+        uint64_t skipped = 0;
+        uint64_t lastNs = 0;
+        uint64_t maxNs = 0;
+        uint64_t totalNs = 0;
+        // budgetNs를 1/8 넘게 초과한 실행 수.
+        uint32_t overruns = 0;
+    };
+
+    // 프레임 단계(phase) 스케줄러.
+    //
+    // 단계는 등록한 순서대로 실행되며, 단계 사이에는 항상 전체 동기화가 있습니다.
+    // 한 단계 안의 시스템은 선언한 읽기/쓰기 집합으로 의존 그래프(DAG)를 만들고,
+    // 충돌이 없는 시스템은 JobSystem 위에서 병렬로 실행됩니다.
+    // 충돌하는 시스템 사이의 순서는 항상 등록 순서를 따르므로 실행 결과는 스레드 수와 무관합니다.
+    //
+    // 주기가 있는 시스템은 쉬는 프레임에도 그래프에 남아 순서 제약을 유지하고, 함수만 건너뜁니다.
+    class AXIS_CORE_API Scheduler
+    {
+    public:
+        explicit Scheduler(JobSystem& jobs);
+
+        Scheduler(const Scheduler&) = delete;
+        Scheduler& operator=(const Scheduler&) = delete;
+
+        PhaseId addPhase(const char* name);
+        // 떼어 낸 시스템과 이름이 같으면 새로 만들지 않고 그 시스템에 desc를 붙여 다시 켭니다.
+        // ID, 통계, cursor, 실행 프레임 배치가 그대로 남습니다.
+        SystemId addSystem(const SystemDesc& desc);
+
+        // 비활성화된 시스템은 그래프에서 빠지며, 그 시스템을 거치던 순서 제약도 사라집니다.
+        void setSystemEnabled(SystemId system, bool enabled);
+
+        // 함수가 모듈 안에 있는 시스템을 끄고 떼어 낸 뒤 그 수를 반환합니다. ModuleDesc::beforeUnload에서 부릅니다.
+        // 새 모듈이 create에서 같은 이름으로 addSystem하면 다시 붙습니다.
+        uint32_t detachModule(const ModuleLoader& loader, ModuleId module);
+
+        // 다음 runFrame부터 SystemContext에 실릴 시간 정보.
+        void setFrameTime(double deltaTime, float alpha);
+
+        // 모든 단계를 순서대로 한 번 실행합니다. 소유 스레드에서 호출해야 합니다.
+        void runFrame();
+
+        // co_await scheduler.nextFrame(): 다음 runFrame의 첫 단계 전에 재개합니다.
+        // co_await scheduler.nextPhase(phase): 다음에 그 단계가 시작될 때 그 단계의 시스템과 함께 재개합니다.
+        // 어느 쪽이든 재개된 태스크가 다음 중단점에 닿을 때까지는 그 단계(프레임 시작) 안에서 끝납니다.
+        TaskSignal::Awaiter nextFrame() { return m_frameSignal.wait(); }
+        TaskSignal::Awaiter nextPhase(PhaseId phase);
+
+        uint32_t phaseCount() const { return static_cast<uint32_t>(m_phases.size()); }
+        uint32_t systemCount() const { return static_cast<uint32_t>(m_systems.size()); }
+        const char* phaseName(PhaseId phase) const;
+        const char* systemName(SystemId system) const;
+        const SystemStats& systemStats(SystemId system) const { return m_systems[system].stats; }
+        uint64_t frameIndex() const { return m_frameIndex; }
+
+        // 단계별 실행 순서와 의존 관계를 사람이 읽을 수 있는 형태로 반환합니다.
+        std::string describe();
+
+    private:
+        struct SystemEntry
+        {
+            SystemDesc desc;
+            bool enabled = true;
+            // detachModule로 함수를 떼어 내 다시 붙기를 기다리는 중.
+            bool detached = false;
+            // 같은 주기의 시스템끼리 실행 프레임(조각)을 어긋나게 하는 값.
+            uint32_t frameOffset = 0;
+            double elapsedTime = 0.0;
+            uint64_t cursor = 0;
+            SystemStats stats;
+        };
+
+        struct Node
+        {
+            SystemId system = kInvalidSystem;
+            uint32_t dependencyCount = 0;
+            uint32_t successorBegin = 0;
+            uint32_t successorCount = 0;
+        };
+
+        // 실행 중 노드별 상태. Job 메모리도 여기서 프레임 동안 유지됩니다.
+        struct NodeRuntime
+        {
+            Scheduler* owner = nullptr;
+            uint32_t node = 0;
+            std::atomic<uint32_t> remaining{0};
+            Job job;
+        };
+
+        struct Phase
+        {
+            const char* name = "";
+            std::vector<SystemId> systems;
+            uint32_t nodeBegin = 0;
+            uint32_t nodeCount = 0;
+            std::unique_ptr<TaskSignal> signal = std::make_unique<TaskSignal>();
+        };
+
+        void rebuildGraph();
+        void runPhase(PhaseId phase);
+        void runNode(uint32_t node);
+
+        static void nodeJob(void* data);
+
+        JobSystem& m_jobs;
+        std::vector<Phase> m_phases;
+        std::vector<SystemEntry> m_systems;
+
+        std::vector<Node> m_nodes;
+        std::vector<uint32_t> m_successors;
+        std::unique_ptr<NodeRuntime[]> m_runtime;
+        JobCounter m_phaseCounter;
+        TaskSignal m_frameSignal;
+
+        PhaseId m_currentPhase = kInvalidPhase;
+        uint64_t m_frameIndex = 0;
+        double m_deltaTime = 0.0;
+        double m_recentDeltas[kMaxUpdateInterval] = {};
+        float m_alpha = 1.0f;
+        bool m_graphDirty = true;
+    };
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "axis/core/CacheLine.h"
+#include "axis/core/TransformHierarchy.h"
+#include "axis/utils/Math.h"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace axis
+{
+    // 잠금 없는 삼중 버퍼. 생산자 스레드 하나가 상태를 쓰고 소비자 스레드 하나가 가장 최근 상태를 읽습니다.
+    //
+    // 생산자는 back, 소비자는 front를 독점하고, 두 쪽은 가운데 슬롯을 원자적 교환으로만 주고받습니다.
+    // 그래서 어느 쪽도 상대를 기다리지 않으며, 소비자가 느리면 중간 상태는 건너뜁니다.
+    // T는 기본 생성과 복사 대입이 가능해야 하며, 슬롯의 메모리(벡터 용량 등)는 재사용됩니다.
+    template <typename T>
+    class SnapshotBuffer
+    {
+    public:
+        SnapshotBuffer() = default;
+
+        SnapshotBuffer(const SnapshotBuffer&) = delete;
+        SnapshotBuffer& operator=(const SnapshotBuffer&) = delete;
+
+        // 생산자 전용. 다음에 공개할 슬롯입니다. 이전 내용은 임의의 옛 상태입니다.
+        T& writeSlot() { return m_slots[m_back]; }
+
+        // 생산자 전용. 마지막으로 공개한 상태. 아직 공개한 적이 없으면 nullptr.
+        const T* lastPublished() const { return m_lastPublished != kNone ? &m_slots[m_lastPublished] : nullptr; }
+
+        // 생산자 전용. writeSlot()을 공개합니다.
+        void publish()
+        {
+            m_lastPublished = m_back;
+            const uint32_t previous = m_middle.exchange(m_back | kFreshBit, std::memory_order_acq_rel);
+            m_back = previous & kIndexMask;
+        }
+
+        // 소비자 전용. 가장 최근에 공개된 상태. 공개된 적이 없으면 nullptr.
+        // 반환한 포인터는 다음 acquire 호출 전까지 유효합니다.
+        const T* acquire()
+        {
+            if ((m_middle.load(std::memory_order_relaxed) & kFreshBit) != 0)
+            {
+                const uint32_t previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+                m_front = previous & kIndexMask;
+                m_hasFront = true;
+            }
+            return m_hasFront ? &m_slots[m_front] : nullptr;
+        }
+
+    private:
+        static constexpr uint32_t kFreshBit = 0x4u;
+        static constexpr uint32_t kIndexMask = 0x3u;
+        static constexpr uint32_t kNone = 0xFFFFFFFFu;
+
+        T m_slots[3];
+
+        // 생산자 쪽 라인.
+        alignas(kCacheLineSize) uint32_t m_back = 0;
+        uint32_t m_lastPublished = kNone;
+
+        alignas(kCacheLineSize) std::atomic<uint32_t> m_middle{1};
+
+        // 소비자 쪽 라인.
+        alignas(kCacheLineSize) uint32_t m_front = 2;
+        bool m_hasFront = false;
+    };
+
+    // 보간에 필요한 두 틱의 변환. previous[i]와 current[i]는 같은 객체입니다.
+    // 한 슬롯에 두 틱을 함께 담으므로 렌더 쪽이 틱을 건너뛰어도 항상 연속된 두 틱 사이를 보간합니다.
+    struct TransformSnapshot
+    {
+        uint64_t tick = 0;
+        std::vector<TransformState> previous;
+        std::vector<TransformState> current;
+
+        // 생산자용. 직전에 공개한 스냅샷의 current를 previous로 옮기고 current 크기를 count로 맞춥니다.
+        // 이전 스냅샷이 없거나 크기가 다르면 새 객체는 previous를 current와 같게 채워야 튀지 않습니다.
+        void beginTick(uint64_t tickIndex, const TransformSnapshot* last, size_t count)
+        {
+            tick = tickIndex;
+            if (last != nullptr)
+            {
+                previous = last->current;
+            }
+            previous.resize(count);
+            current.resize(count);
+        }
+
+        // alpha 0이면 previous, 1이면 current. out은 current.size()개 이상이어야 합니다.
+        void interpolate(float alpha, Mat4* out) const
+        {
+            for (size_t i = 0; i < current.size(); ++i)
+            {
+                const TransformState& a = previous[i];
+                const TransformState& b = current[i];
+                out[i] = Mat4::fromTrs(lerp(a.position, b.position, alpha), slerp(a.rotation, b.rotation, alpha),
+                                       lerp(a.scale, b.scale, alpha));
+            }
+        }
+    };
+
+    using TransformSnapshotBuffer = SnapshotBuffer<TransformSnapshot>;
+}
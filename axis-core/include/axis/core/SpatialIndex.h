@@ -0,0 +1,99 @@
+#pragma once
+
+#include "axis/core/Bounds.h"
+#include "axis/core/Export.h"
+#include "axis/utils/Allocator.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace axis
+{
+    // 공간 색인에 등록된 객체 핸들.
+    using SpatialHandle = uint32_t;
+
+    constexpr SpatialHandle kInvalidSpatialHandle = 0xFFFFFFFFu;
+
+    enum class SpatialBackendType : uint8_t
+    {
+        // 월드 범위가 정해진 장면. 크기가 제각각인 객체에 강합니다.
+        LooseOctree,
+        // 범위가 없는 열린 월드. 크기가 비슷한 객체가 고르게 퍼져 있을 때 유리합니다.
+        HashGrid,
+    };
+
+    struct SpatialIndexDesc
+    {
+        SpatialBackendType backend = SpatialBackendType::LooseOctree;
+
+        // LooseOctree: 루트 노드 범위와 최대 깊이. 범위 밖 객체는 루트에 저장됩니다.
+        Aabb worldBounds = {{-1024.0f, -1024.0f, -1024.0f}, {1024.0f, 1024.0f, 1024.0f}};
+        uint32_t maxDepth = 8;
+
+        // HashGrid: 셀 한 변의 길이. 절반 크기가 cellSize보다 큰 객체는 별도 목록에 둡니다.
+        float cellSize = 32.0f;
+
+        // 노드/셀 배열 할당자. nullptr이면 defaultAllocator().
+        Allocator* allocator = nullptr;
+    };
+
+    struct SpatialUpdate
+    {
+        SpatialHandle handle = kInvalidSpatialHandle;
+        Aabb bounds;
+    };
+
+    struct SpatialIndexStats
+    {
+        uint32_t objectCount = 0;
+        uint32_t bucketCount = 0;
+        uint32_t nonEmptyBuckets = 0;
+        uint32_t relocations = 0;
+    };
+
+    namespace detail
+    {
+        class SpatialBackend;
+    }
+
+    // 증분 갱신되는 공간 색인.
+    //
+    // 객체는 노드(옥트리) 또는 셀(그리드)마다 SoA 배열로 저장되며, 질의는 후보 노드만 방문한 뒤
+    // 노드 안의 경계 상자를 SIMD로 4개씩 검사합니다.
+    // move는 객체가 같은 노드에 머무를 수 있으면 제자리에서 경계만 갱신하고, 아니면 다시 배치합니다.
+    // 갱신은 한 스레드에서만, 질의(const)는 갱신이 없는 동안 여러 스레드에서 동시에 할 수 있습니다.
+    class AXIS_CORE_API SpatialIndex
+    {
+    public:
+        explicit SpatialIndex(const SpatialIndexDesc& desc = {});
+        ~SpatialIndex();
+
+        SpatialIndex(const SpatialIndex&) = delete;
+        SpatialIndex& operator=(const SpatialIndex&) = delete;
+
+        // userData는 질의 결과로 그대로 돌려받는 값입니다(예: Entity를 64비트로 묶은 값).
+        SpatialHandle insert(const Aabb& bounds, uint64_t userData);
+        void move(SpatialHandle handle, const Aabb& bounds);
+        void remove(SpatialHandle handle);
+
+        // 묶음 처리. outHandles는 count개 이상이어야 합니다.
+        void insert(const Aabb* bounds, const uint64_t* userData, uint32_t count, SpatialHandle* outHandles);
+        void move(const SpatialUpdate* updates, uint32_t count);
+        void remove(const SpatialHandle* handles, uint32_t count);
+
+        // 겹치는 객체의 userData를 out 뒤에 덧붙입니다. 추가한 개수를 반환합니다.
+        uint32_t query(const Aabb& bounds, std::vector<uint64_t>& out) const;
+        uint32_t query(const Sphere& sphere, std::vector<uint64_t>& out) const;
+        uint32_t query(const Frustum& frustum, std::vector<uint64_t>& out) const;
+
+        const Aabb& bounds(SpatialHandle handle) const;
+        uint64_t userData(SpatialHandle handle) const;
+        SpatialBackendType backendType() const { return m_backendType; }
+        SpatialIndexStats stats() const;
+
+    private:
+        SpatialBackendType m_backendType;
+        std::unique_ptr<detail::SpatialBackend> m_backend;
+    };
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "axis/core/CacheLine.h"
+#include "axis/utils/Allocator.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace axis
+{
+    // 대기 없는(wait-free) 단일 생산자/단일 소비자 링 버퍼.
+    //
+    // tryPush는 생산자 스레드 하나만, tryPop은 소비자 스레드 하나만 호출해야 합니다.
+    // 두 쪽 모두 CAS나 재시도 없이 고정된 단계 안에 끝납니다.
+    // 상대 인덱스를 각자 캐시해 두므로 링이 가득 차거나 비어 보일 때만 상대의 캐시 라인을 읽습니다.
+    template <typename T>
+    class SpscRing
+    {
+    public:
+        // capacity는 2의 거듭제곱이어야 합니다.
+        explicit SpscRing(uint32_t capacity, Allocator& allocator = defaultAllocator())
+            : m_allocator(allocator)
+            , m_mask(capacity - 1)
+        {
+            assert(capacity != 0 && (capacity & (capacity - 1)) == 0 && "용량은 2의 거듭제곱이어야 합니다");
+            m_slots = static_cast<Slot*>(m_allocator.allocate(sizeof(Slot) * capacity, alignof(Slot)));
+            assert(m_slots != nullptr);
+        }
+
+        // 파괴 시점에는 양쪽 스레드 모두 링을 쓰고 있지 않아야 합니다. 남은 값은 여기서 파괴됩니다.
+        ~SpscRing()
+        {
+            const size_t end = m_tail.load(std::memory_order_relaxed);
+            for (size_t position = m_head.load(std::memory_order_relaxed); position != end; ++position)
+            {
+                std::launder(reinterpret_cast<T*>(m_slots[position & m_mask].storage))->~T();
+            }
+            m_allocator.deallocate(m_slots, sizeof(Slot) * (m_mask + 1));
+        }
+
+        SpscRing(const SpscRing&) = delete;
+        SpscRing& operator=(const SpscRing&) = delete;
+
+        template <typename U>
+        bool tryPush(U&& value)
+        {
+            const size_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_cachedHead > m_mask)
+            {
+                m_cachedHead = m_head.load(std::memory_order_acquire);
+                if (tail - m_cachedHead > m_mask)
+                {
+                    return false;
+                }
+            }
+
+            new (m_slots[tail & m_mask].storage) T(std::forward<U>(value));
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool tryPop(T& out)
+        {
+            const size_t head = m_head.load(std::memory_order_relaxed);
+            if (head == m_cachedTail)
+            {
+                m_cachedTail = m_tail.load(std::memory_order_acquire);
+                if (head == m_cachedTail)
+                {
+                    return false;
+                }
+            }
+
+            T* value = std::launder(reinterpret_cast<T*>(m_slots[head & m_mask].storage));
+            out = std::move(*value);
+            value->~T();
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        uint32_t capacity() const { return static_cast<uint32_t>(m_mask + 1); }
+
+        // 생산자나 소비자 어느 쪽에서 불러도 되지만 그 순간의 근삿값입니다.
+        uint32_t sizeApprox() const
+        {
+            return static_cast<uint32_t>(m_tail.load(std::memory_order_acquire) -
+                                         m_head.load(std::memory_order_acquire));
+        }
+
+    private:
+        struct Slot
+        {
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        Allocator& m_allocator;
+        Slot* m_slots = nullptr;
+        const size_t m_mask;
+
+        // 소비자 쪽 라인: 소비자가 쓰는 head와 소비자만 읽는 tail 캐시.
+        alignas(kCacheLineSize) std::atomic<size_t> m_head{0};
+        size_t m_cachedTail = 0;
+
+        // 생산자 쪽 라인: 생산자가 쓰는 tail과 생산자만 읽는 head 캐시.
+        alignas(kCacheLineSize) std::atomic<size_t> m_tail{0};
+        size_t m_cachedHead = 0;
+    };
+}
@@ -0,0 +1,372 @@
+#pragma once
+
+#include "axis/core/Export.h"
+#include "axis/core/JobSystem.h"
+#include "axis/platform/AsyncIo.h"
+
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace axis
+{
+    template <typename T = void>
+    class Task;
+
+    template <typename T>
+    void spawn(JobSystem& jobs, Task<T>&& task, JobCounter* counter = nullptr);
+
+    namespace detail
+    {
+        // 코루틴 프레임은 크기별 풀에서 꺼냅니다. 풀 크기를 넘는 프레임만 기본 할당자로 갑니다.
+        AXIS_CORE_API void* allocateTaskFrame(size_t size);
+        AXIS_CORE_API void deallocateTaskFrame(void* frame, size_t size);
+
+        // data에 담긴 코루틴 핸들을 재개하는 작업 함수.
+        AXIS_CORE_API void resumeTaskJob(void* data);
+
+        inline Job makeResumeJob(std::coroutine_handle<> handle, JobCounter* counter = nullptr)
+        {
+            Job job;
+            job.function = &resumeTaskJob;
+            job.data = handle.address();
+            job.counter = counter;
+            return job;
+        }
+
+        struct TaskPromiseBase
+        {
+            // 이 태스크를 co_await한 코루틴. 끝나면 바로 그쪽으로 넘어갑니다.
+            std::coroutine_handle<> continuation;
+
+            // start/spawn으로 시작한 최상위 태스크만 사용합니다.
+            JobSystem* jobs = nullptr;
+            JobCounter* counter = nullptr;
+            Job startJob;
+            bool detached = false;
+
+            static void* operator new(size_t size) { return allocateTaskFrame(size); }
+            static void operator delete(void* frame, size_t size) { deallocateTaskFrame(frame, size); }
+
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+                {
+                    TaskPromiseBase& promise = handle.promise();
+                    if (promise.continuation)
+                    {
+                        return promise.continuation;
+                    }
+
+                    // 카운터를 내리는 순간 다른 스레드가 프레임을 파괴할 수 있으므로 필요한 값을 먼저 꺼냅니다.
+                    JobSystem* jobs = promise.jobs;
+                    JobCounter* counter = promise.counter;
+                    if (promise.detached)
+                    {
+                        handle.destroy();
+                    }
+                    if (counter != nullptr)
+                    {
+                        jobs->completePending(*counter);
+                    }
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            // 지연 시작합니다. co_await하거나 start/spawn하기 전에는 본문이 실행되지 않습니다.
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            FinalAwaiter final_suspend() const noexcept { return {}; }
+
+            // 엔진은 예외를 쓰지 않습니다. 태스크 밖으로 예외가 나오면 즉시 종료합니다.
+            void unhandled_exception() const noexcept { std::terminate(); }
+        };
+
+        template <typename T>
+        struct TaskPromise : TaskPromiseBase
+        {
+            ~TaskPromise()
+            {
+                if (hasValue)
+                {
+                    reinterpret_cast<T*>(storage)->~T();
+                }
+            }
+
+            Task<T> get_return_object() noexcept;
+
+            template <typename U>
+            void return_value(U&& value)
+            {
+                new (storage) T(std::forward<U>(value));
+                hasValue = true;
+            }
+
+            T takeResult()
+            {
+                assert(hasValue && "끝나지 않은 태스크의 결과를 읽었습니다");
+                return std::move(*reinterpret_cast<T*>(storage));
+            }
+
+            alignas(T) unsigned char storage[sizeof(T)];
+            bool hasValue = false;
+        };
+
+        template <>
+        struct TaskPromise<void> : TaskPromiseBase
+        {
+            Task<void> get_return_object() noexcept;
+
+            void return_void() const noexcept {}
+            void takeResult() const noexcept {}
+        };
+    }
+
+    // JobSystem 위에서 실행되는 코루틴 태스크.
+    //
+    // 지연 시작이며, 다른 태스크 안에서 co_await하면 스레드를 옮기지 않고 같은 스레드에서 바로 이어 실행하고
+    // 끝나면 기다리던 쪽으로 곧장 돌아갑니다(대칭 전송). 중단점에서 스레드가 바뀌는 것은
+    // 작업 완료, I/O 완료, 다음 프레임/단계처럼 실제로 기다릴 것이 있을 때뿐입니다.
+    // 코루틴 프레임은 크기별 풀에서 할당되므로 콜백 체인처럼 단계마다 힙 할당이 생기지 않습니다.
+    //
+    // 최상위 태스크는 start(카운터로 완료를 기다리고 결과를 읽음)나 spawn(완료 후 스스로 해제)으로 시작합니다.
+    // 태스크 안에서 JobSystem::wait를 호출하면 워커를 붙잡으므로 대신 co_await waitFor(...)를 씁니다.
+    template <typename T>
+    class Task
+    {
+    public:
+        static_assert(!std::is_reference_v<T>, "Task는 참조를 반환할 수 없습니다");
+
+        using promise_type = detail::TaskPromise<T>;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        Task() = default;
+        explicit Task(Handle handle)
+            : m_handle(handle)
+        {
+        }
+
+        ~Task()
+        {
+            if (m_handle)
+            {
+                m_handle.destroy();
+            }
+        }
+
+        Task(Task&& other) noexcept
+            : m_handle(std::exchange(other.m_handle, {}))
+        {
+        }
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (m_handle)
+                {
+                    m_handle.destroy();
+                }
+                m_handle = std::exchange(other.m_handle, {});
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        bool isValid() const { return static_cast<bool>(m_handle); }
+
+        // start로 시작했다면 카운터가 0이 된 뒤에만 의미가 있습니다.
+        bool isDone() const { return !m_handle || m_handle.done(); }
+
+        // 작업 큐를 거쳐 시작합니다. counter는 태스크가 끝나면 0이 되며 그때까지 Task를 유지해야 합니다.
+        void start(JobSystem& jobs, JobCounter& counter)
+        {
+            assert(m_handle && !m_handle.done() && "시작할 수 없는 태스크입니다");
+            promise_type& promise = m_handle.promise();
+            promise.jobs = &jobs;
+            promise.counter = &counter;
+            promise.startJob = detail::makeResumeJob(m_handle);
+            jobs.addPending(counter);
+            jobs.submit(promise.startJob);
+        }
+
+        // 끝난 태스크의 결과를 꺼냅니다. 한 번만 호출할 수 있습니다.
+        T result()
+        {
+            assert(isDone() && m_handle && "끝나지 않은 태스크의 결과를 읽었습니다");
+            return m_handle.promise().takeResult();
+        }
+
+        struct Awaiter
+        {
+            Handle handle;
+
+            bool await_ready() const noexcept { return !handle || handle.done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+
+            T await_resume() { return handle.promise().takeResult(); }
+        };
+
+        // 자식 태스크를 현재 스레드에서 바로 실행하고 끝나면 결과를 돌려받습니다.
+        Awaiter operator co_await() const noexcept { return Awaiter{m_handle}; }
+
+    private:
+        template <typename U>
+        friend void spawn(JobSystem& jobs, Task<U>&& task, JobCounter* counter);
+
+        Handle release() { return std::exchange(m_handle, {}); }
+
+        Handle m_handle;
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        Task<T> TaskPromise<T>::get_return_object() noexcept
+        {
+            return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+        }
+
+        inline Task<void> TaskPromise<void>::get_return_object() noexcept
+        {
+            return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+        }
+    }
+
+    // 소유권을 넘기고 시작합니다. 끝나면 프레임을 스스로 해제하며, counter가 있으면 그때 0이 됩니다.
+    template <typename T>
+    void spawn(JobSystem& jobs, Task<T>&& task, JobCounter* counter)
+    {
+        typename Task<T>::Handle handle = task.release();
+        assert(handle && !handle.done() && "시작할 수 없는 태스크입니다");
+        detail::TaskPromise<T>& promise = handle.promise();
+        promise.jobs = &jobs;
+        promise.counter = counter;
+        promise.detached = true;
+        promise.startJob = detail::makeResumeJob(handle);
+        if (counter != nullptr)
+        {
+            jobs.addPending(*counter);
+        }
+        jobs.submit(promise.startJob);
+    }
+
+    // 태스크를 시작하고 끝날 때까지 기다립니다. 기다리는 동안 이 스레드도 작업을 실행합니다.
+    // 태스크 안에서는 호출하지 않습니다.
+    template <typename T>
+    T syncWait(JobSystem& jobs, Task<T>&& task)
+    {
+        JobCounter counter;
+        task.start(jobs, counter);
+        jobs.wait(counter);
+        return task.result();
+    }
+
+    // co_await switchTo(jobs): 현재 코루틴을 작업 큐로 옮겨 워커에서 이어 실행합니다.
+    struct AXIS_CORE_API JobSwitchAwaiter
+    {
+        JobSystem& jobs;
+        Job job;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle);
+        void await_resume() const noexcept {}
+    };
+
+    inline JobSwitchAwaiter switchTo(JobSystem& jobs)
+    {
+        return JobSwitchAwaiter{jobs, {}};
+    }
+
+    // co_await waitFor(jobs, counter): 카운터가 0이 될 때까지 워커를 붙잡지 않고 중단합니다.
+    // 마지막 작업을 끝낸 스레드가 이어서 실행합니다. 한 카운터는 한 태스크만 기다릴 수 있고,
+    // 기다리는 동안 그 카운터로 새 작업을 제출해서는 안 됩니다.
+    struct AXIS_CORE_API JobCounterAwaiter
+    {
+        JobSystem& jobs;
+        JobCounter& counter;
+        Job job;
+
+        bool await_ready() const noexcept { return counter.isDone(); }
+        bool await_suspend(std::coroutine_handle<> handle);
+        void await_resume() const noexcept {}
+    };
+
+    inline JobCounterAwaiter waitFor(JobSystem& jobs, JobCounter& counter)
+    {
+        return JobCounterAwaiter{jobs, counter, {}};
+    }
+
+    // co_await readAsync(jobs, io, request): 요청을 제출하고 완료되면 작업 큐에서 이어 실행합니다.
+    // request.callback과 userData는 이 awaiter가 사용하므로 비워 둡니다. 결과 상태를 돌려주며,
+    // 재개된 뒤에는 request 메모리를 해제해도 됩니다.
+    struct AXIS_CORE_API IoAwaiter
+    {
+        JobSystem& jobs;
+        AsyncIo& io;
+        IoRequest& request;
+        Job job;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle);
+        IoStatus await_resume() const;
+    };
+
+    inline IoAwaiter readAsync(JobSystem& jobs, AsyncIo& io, IoRequest& request)
+    {
+        return IoAwaiter{jobs, io, request, {}};
+    }
+
+    // 여러 태스크가 다음 notify까지 중단해 두는 지점. 다음 프레임, 다음 단계 같은 시점에 씁니다.
+    //
+    // 기다리는 쪽의 상태는 코루틴 프레임 안의 awaiter에 있으므로 대기열은 할당하지 않습니다.
+    // wait와 notify는 어느 스레드에서든 호출할 수 있습니다.
+    class AXIS_CORE_API TaskSignal
+    {
+    public:
+        struct AXIS_CORE_API Awaiter
+        {
+            TaskSignal& signal;
+            Job job;
+            Awaiter* next = nullptr;
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle);
+            void await_resume() const noexcept {}
+        };
+
+        TaskSignal() = default;
+        ~TaskSignal();
+
+        TaskSignal(const TaskSignal&) = delete;
+        TaskSignal& operator=(const TaskSignal&) = delete;
+
+        Awaiter wait() { return Awaiter{*this, {}, nullptr}; }
+
+        // 지금까지 기다리던 태스크를 기다리기 시작한 순서대로 작업 큐에 넣고 그 수를 돌려줍니다.
+        // counter가 있으면 재개된 태스크가 다음 중단점에 닿을 때까지를 그 카운터로 기다릴 수 있습니다.
+        uint32_t notify(JobSystem& jobs, JobCounter* counter = nullptr);
+
+        bool hasWaiters() const { return m_head.load(std::memory_order_acquire) != nullptr; }
+
+    private:
+        std::atomic<Awaiter*> m_head{nullptr};
+    };
+}
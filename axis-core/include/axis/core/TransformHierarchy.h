@@ -0,0 +1,130 @@
+#pragma once
+
+#include "axis/core/Export.h"
+#include "axis/utils/Allocator.h"
+#include "axis/utils/Math.h"
+#include "axis/utils/SlotMap.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace axis
+{
+    class JobSystem;
+
+    struct TransformState
+    {
+        Vec3 position;
+        Quat rotation;
+        Vec3 scale{1.0f, 1.0f, 1.0f};
+    };
+
+    // 계층 안의 노드 핸들. 노드를 지운 뒤의 핸들은 isValid()가 false가 됩니다.
+    using TransformHandle = SlotHandle;
+
+    struct TransformUpdateStats
+    {
+        uint32_t nodeCount = 0;
+        uint32_t levelCount = 0;
+        // 이번 update에서 월드 행렬을 다시 계산한 노드 수와 건너뛴 단계 수.
+        uint32_t updatedNodes = 0;
+        uint32_t skippedLevels = 0;
+        bool reordered = false;
+    };
+
+    // 변환 계층.
+    //
+    // 노드는 너비 우선(부모가 항상 자식보다 앞) 순서의 SoA 배열에 놓이며, 같은 깊이의 노드가 한 구간에 모입니다.
+    // update()는 깊이 단계마다 구간을 작업 단위로 나누어 병렬로 처리합니다. 한 단계의 모든 부모는
+    // 이전 단계에서 이미 끝났으므로 단계 안에서는 동기화가 필요 없습니다.
+    // 로컬 변환이 바뀐 노드와 그 아래 노드만 다시 계산하고, 바뀐 노드보다 얕은 단계는 통째로 건너뜁니다.
+    // 구조 변경(생성, 삭제, 부모 변경)은 다음 update에서 배열 순서를 한 번 다시 만듭니다.
+    // update 도중에는 다른 호출을 할 수 없습니다.
+    class AXIS_CORE_API TransformHierarchy
+    {
+    public:
+        static constexpr uint32_t kNoNode = 0xFFFFFFFFu;
+
+        explicit TransformHierarchy(Allocator& allocator = defaultAllocator());
+
+        TransformHierarchy(const TransformHierarchy&) = delete;
+        TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+        // parent가 무효 핸들이면 루트 노드를 만듭니다.
+        TransformHandle create(TransformHandle parent = {}, const TransformState& local = {});
+
+        // 자식까지 모두 지웁니다.
+        void destroy(TransformHandle node);
+
+        // parent가 node 자신이거나 그 자손이면 false. 무효 핸들을 주면 루트로 옮깁니다.
+        bool setParent(TransformHandle node, TransformHandle parent);
+        TransformHandle parent(TransformHandle node) const;
+
+        void setLocal(TransformHandle node, const TransformState& local);
+        TransformState local(TransformHandle node) const;
+
+        // 마지막 update 시점의 월드 행렬.
+        const Mat4& world(TransformHandle node) const;
+
+        bool isValid(TransformHandle node) const;
+
+        // jobs가 nullptr이면 호출한 스레드에서만 실행합니다. batchSize는 작업 하나가 맡을 노드 수입니다.
+        void update(JobSystem* jobs, uint32_t batchSize = 256);
+
+        // 너비 우선 순서 배열. 구조 변경 뒤에는 다음 update까지 갱신되지 않습니다.
+        uint32_t nodeCount() const { return static_cast<uint32_t>(m_world.size()); }
+        const Mat4* worldMatrices() const { return m_world.data(); }
+        uint32_t denseIndex(TransformHandle node) const;
+        TransformHandle handleAt(uint32_t denseIndex) const;
+
+        // 마지막 update에서 월드 행렬이 바뀌었는지. 렌더러 업로드처럼 바뀐 것만 옮길 때 씁니다.
+        bool wasUpdated(uint32_t denseIndex) const { return m_updatedStamp[denseIndex] == m_stamp; }
+
+        const TransformUpdateStats& stats() const { return m_stats; }
+
+    private:
+        template <typename T>
+        using Array = std::vector<T, StlAllocator<T>>;
+
+        // 핸들이 가리키는 구조 정보. 부모/형제 연결은 슬롯 번호로 합니다.
+        struct Slot
+        {
+            uint32_t generation = 1;
+            uint32_t dense = kNoNode;
+            uint32_t parent = kNoNode;
+            uint32_t firstChild = kNoNode;
+            uint32_t nextSibling = kNoNode;
+            uint32_t previousSibling = kNoNode;
+            uint32_t depth = 0;
+            bool alive = false;
+        };
+
+        bool resolve(TransformHandle node, uint32_t& slot) const;
+        void link(uint32_t slot, uint32_t parent);
+        void unlink(uint32_t slot);
+        void rebuildOrder();
+        uint32_t updateRange(uint32_t begin, uint32_t end);
+
+        Array<Slot> m_slots;
+        Array<uint32_t> m_freeSlots;
+        uint32_t m_firstRoot = kNoNode;
+
+        // 너비 우선 순서 SoA. 구조 변경 직후에는 새 노드가 끝에 붙어 있고 지운 노드가 남아 있습니다.
+        Array<Vec3> m_position;
+        Array<Quat> m_rotation;
+        Array<Vec3> m_scale;
+        Array<Mat4> m_world;
+        Array<uint32_t> m_parent;
+        Array<uint32_t> m_slotOf;
+        Array<uint8_t> m_dirty;
+        Array<uint32_t> m_updatedStamp;
+
+        // 깊이 d의 노드는 [m_levelBegin[d], m_levelBegin[d + 1]) 구간에 있습니다.
+        Array<uint32_t> m_levelBegin;
+
+        uint32_t m_stamp = 1;
+        uint32_t m_firstDirtyLevel = kNoNode;
+        bool m_orderDirty = false;
+        TransformUpdateStats m_stats;
+    };
+}
@@ -0,0 +1,221 @@
+#pragma once
+
+#include "axis/core/Archetype.h"
+#include "axis/core/Component.h"
+#include "axis/core/Entity.h"
+#include "axis/core/Export.h"
+#include "axis/utils/Allocator.h"
+#include "axis/utils/FlatHashMap.h"
+#include "axis/utils/PoolAllocator.h"
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace axis
+{
+    template <typename... Ts>
+    class Query;
+
+    // 청크 하나에 대한 읽기 전용 창.
+    // column<T>()는 count()개의 연속된 T 배열을 가리킵니다.
+    class ChunkView
+    {
+    public:
+        ChunkView(const Archetype& archetype, Chunk& chunk)
+            : m_archetype(&archetype)
+            , m_chunk(&chunk)
+        {
+        }
+
+        uint32_t count() const { return m_chunk->count; }
+        const Entity* entities() const { return m_archetype->entities(m_chunk); }
+        const Archetype& archetype() const { return *m_archetype; }
+
+        template <typename T>
+        bool has() const
+        {
+            return m_archetype->column(componentId<T>()) != Archetype::kNoColumn;
+        }
+
+        // 아키타입에 T가 없으면 nullptr.
+        template <typename T>
+        T* column() const
+        {
+            const uint32_t column = m_archetype->column(componentId<T>());
+            if (column == Archetype::kNoColumn)
+            {
+                return nullptr;
+            }
+            return static_cast<T*>(m_archetype->columnData(m_chunk, column));
+        }
+
+    private:
+        const Archetype* m_archetype;
+        Chunk* m_chunk;
+    };
+
+    struct WorldDesc
+    {
+        // 청크(kChunkSize) 할당자. nullptr이면 World 전용 풀을 사용합니다.
+        // 직접 지정할 경우 kChunkSize 크기, 64바이트 정렬 요청을 처리할 수 있어야 합니다.
+        Allocator* chunkAllocator = nullptr;
+
+        // 엔티티 레코드 등 보조 배열용 할당자. nullptr이면 defaultAllocator()를 사용합니다.
+        Allocator* allocator = nullptr;
+
+        // 전용 청크 풀에서 한 번에 확보할 청크 수.
+        uint32_t chunksPerPage = 16;
+    };
+
+    // 아키타입/청크 기반 엔티티 저장소.
+    //
+    // 같은 컴포넌트 조합의 엔티티는 같은 아키타입에 모이고, 컴포넌트는 16KB 청크 안에
+    // 타입별 연속 배열로 저장됩니다. 컴포넌트 추가/제거는 엔티티를 다른 아키타입으로
+    // 이동시키므로 비용이 있으며, 반복 중에는 구조 변경을 할 수 없습니다.
+    class AXIS_CORE_API World
+    {
+    public:
+        explicit World(const WorldDesc& desc = {});
+        ~World();
+
+        World(const World&) = delete;
+        World& operator=(const World&) = delete;
+
+        Entity createEntity();
+        void destroyEntity(Entity entity);
+        bool isAlive(Entity entity) const;
+        uint32_t entityCount() const { return m_aliveCount; }
+
+        template <typename T, typename... Args>
+        T& addComponent(Entity entity, Args&&... args);
+
+        template <typename T>
+        void removeComponent(Entity entity) { removeComponent(entity, componentId<T>()); }
+
+        template <typename T>
+        bool hasComponent(Entity entity) const { return getComponent(entity, componentId<T>()) != nullptr; }
+
+        // 없으면 nullptr. 반환된 포인터는 다음 구조 변경 전까지만 유효합니다.
+        template <typename T>
+        T* getComponent(Entity entity) { return static_cast<T*>(getComponent(entity, componentId<T>())); }
+
+        // 타입 ID 기반 비템플릿 인터페이스.
+        // addComponent는 초기화되지 않은 저장 공간을 돌려주며, 호출자가 직접 생성해야 합니다.
+        // 이미 있는 컴포넌트라면 existed가 true이고 기존 값의 위치를 돌려줍니다.
+        void* addComponent(Entity entity, ComponentId id, bool& existed);
+        void removeComponent(Entity entity, ComponentId id);
+        void* getComponent(Entity entity, ComponentId id) const;
+
+        // include를 모두 가지고 exclude를 하나도 가지지 않은 아키타입의 청크를 순회합니다.
+        template <typename Fn>
+        void forEachChunk(const ComponentMask& include, const ComponentMask& exclude, Fn&& fn);
+
+        // Ts를 모두 가진 엔티티마다 fn(Ts&...)를 호출합니다.
+        // 내부적으로 청크 단위 배열을 순회하므로 간접 호출 없이 인라인됩니다.
+        // 매 프레임 같은 조합을 순회한다면 아키타입 검사를 캐시하는 Query를 쓰십시오.
+        template <typename... Ts, typename Fn>
+        void each(Fn&& fn);
+
+        // 아키타입은 제거되지 않으므로 인덱스는 World 수명 동안 유지되고, 새 아키타입은 항상 끝에 붙습니다.
+        uint32_t archetypeCount() const { return static_cast<uint32_t>(m_archetypes.size()); }
+        const Archetype& archetype(uint32_t index) const { return *m_archetypes[index]; }
+
+        // 할당된 청크 수. 메모리 사용량은 chunkCount() * kChunkSize입니다.
+        uint32_t chunkCount() const { return m_chunkCount; }
+
+    private:
+        template <typename... Ts>
+        friend class Query;
+
+        static constexpr uint32_t kDeadArchetype = 0xFFFFFFFFu;
+
+        struct EntityRecord
+        {
+            uint32_t archetype = 0;
+            uint32_t chunk = 0;
+            uint32_t row = 0;
+            uint32_t generation = 0;
+        };
+
+        uint32_t findOrCreateArchetype(const ComponentMask& mask);
+        uint32_t archetypeWith(uint32_t from, ComponentId id);
+        uint32_t archetypeWithout(uint32_t from, ComponentId id);
+
+        void allocateRow(Archetype& archetype, Entity entity, uint32_t& outChunk, uint32_t& outRow);
+        void removeRow(Archetype& archetype, uint32_t chunk, uint32_t row, bool destruct);
+        void moveEntity(Entity entity, uint32_t toArchetype);
+
+        Chunk* allocateChunk(uint32_t archetype);
+        void freeChunk(Chunk* chunk);
+
+        const EntityRecord* record(Entity entity) const;
+
+        std::vector<std::unique_ptr<Archetype>> m_archetypes;
+        FlatHashMap<ComponentMask, uint32_t, ComponentMaskHash> m_archetypeLookup;
+
+        // 외부 할당자가 없을 때만 만드는 전용 청크 풀.
+        std::unique_ptr<PoolAllocator> m_ownedChunkPool;
+        Allocator* m_chunkAllocator;
+
+        std::vector<EntityRecord, StlAllocator<EntityRecord>> m_records;
+        std::vector<uint32_t, StlAllocator<uint32_t>> m_freeRecords;
+        uint32_t m_aliveCount = 0;
+        uint32_t m_chunkCount = 0;
+        uint32_t m_iterationDepth = 0;
+    };
+
+    template <typename T, typename... Args>
+    T& World::addComponent(Entity entity, Args&&... args)
+    {
+        bool existed = false;
+        void* storage = addComponent(entity, componentId<T>(), existed);
+        assert(storage != nullptr);
+        if (existed)
+        {
+            T* value = static_cast<T*>(storage);
+            *value = T(std::forward<Args>(args)...);
+            return *value;
+        }
+        return *new (storage) T(std::forward<Args>(args)...);
+    }
+
+    template <typename Fn>
+    void World::forEachChunk(const ComponentMask& include, const ComponentMask& exclude, Fn&& fn)
+    {
+        ++m_iterationDepth;
+        for (const std::unique_ptr<Archetype>& archetype : m_archetypes)
+        {
+            if (archetype->entityCount == 0 || !archetype->mask.containsAll(include) ||
+                archetype->mask.intersects(exclude))
+            {
+                continue;
+            }
+            for (Chunk* chunk : archetype->chunks)
+            {
+                fn(ChunkView(*archetype, *chunk));
+            }
+        }
+        --m_iterationDepth;
+    }
+
+    template <typename... Ts, typename Fn>
+    void World::each(Fn&& fn)
+    {
+        ComponentMask include;
+        (include.set(componentId<Ts>()), ...);
+
+        forEachChunk(include, ComponentMask{}, [&fn](const ChunkView& view) {
+            std::tuple<Ts*...> columns(view.column<Ts>()...);
+            const uint32_t count = view.count();
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                fn(std::get<Ts*>(columns)[i]...);
+            }
+        });
+    }
+}
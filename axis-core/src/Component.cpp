@@ -0,0 +1,141 @@
+#include "axis/core/Component.h"
+
+#include "axis/platform/ModuleLoader.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <mutex>
+
+namespace axis
+{
+    namespace
+    {
+        // 등록된 항목은 이동하지 않으므로 info()는 잠금 없이 읽을 수 있습니다.
+        ComponentInfo g_infos[kMaxComponentTypes];
+        bool g_detached[kMaxComponentTypes];
+        std::atomic<uint32_t> g_count{0};
+        std::mutex g_registerMutex;
+
+        // 떼어 낸 타입의 함수 자리. 내려간 모듈 코드로 뛰어드는 대신 여기서 멈춥니다.
+        void detachedConstruct(void*)
+        {
+            assert(false && "모듈이 내려가 떼어 낸 컴포넌트 타입입니다");
+        }
+
+        void detachedDestruct(void*)
+        {
+            assert(false && "모듈이 내려가 떼어 낸 컴포넌트 타입입니다");
+        }
+
+        void detachedRelocate(void*, void*)
+        {
+            assert(false && "모듈이 내려가 떼어 낸 컴포넌트 타입입니다");
+        }
+
+        // 이름을 인턴 표에 복사합니다. 표가 가득 차 복사하지 못하면 원래 포인터를 씁니다.
+        const char* ownedName(const char* name)
+        {
+            const char* copy = StringId::intern(name).str();
+            return copy != nullptr ? copy : name;
+        }
+    }
+
+    ComponentId ComponentRegistry::registerType(const ComponentInfo& info)
+    {
+        assert(info.name != nullptr);
+        const StringId nameId = info.nameId.isValid() ? info.nameId : StringId(info.name);
+
+        std::lock_guard<std::mutex> lock(g_registerMutex);
+        const uint32_t count = g_count.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (g_infos[i].nameId == nameId)
+            {
+                assert(std::strcmp(g_infos[i].name, info.name) == 0 && "컴포넌트 이름 해시 충돌입니다");
+                if (g_detached[i])
+                {
+                    // 청크에 남은 값은 이전 배치 그대로이므로 크기와 정렬이 바뀐 타입은 붙일 수 없습니다.
+                    assert(g_infos[i].size == info.size && g_infos[i].alignment == info.alignment &&
+                           "다시 불러온 모듈이 컴포넌트 배치를 바꾸었습니다");
+                    g_infos[i].construct = info.construct;
+                    g_infos[i].destruct = info.destruct;
+                    g_infos[i].relocate = info.relocate;
+                    g_detached[i] = false;
+                }
+                return i;
+            }
+        }
+
+        assert(count < kMaxComponentTypes && "컴포넌트 타입 수가 kMaxComponentTypes를 넘었습니다");
+        if (count >= kMaxComponentTypes)
+        {
+            return kInvalidComponent;
+        }
+
+        g_infos[count] = info;
+        g_infos[count].name = ownedName(info.name);
+        g_infos[count].nameId = nameId;
+        g_count.store(count + 1, std::memory_order_release);
+        return count;
+    }
+
+    uint32_t ComponentRegistry::detachModule(const ModuleLoader& loader, ModuleId module)
+    {
+        std::lock_guard<std::mutex> lock(g_registerMutex);
+        const uint32_t count = g_count.load(std::memory_order_relaxed);
+        uint32_t detached = 0;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            ComponentInfo& info = g_infos[i];
+            if (g_detached[i] || !(loader.ownsAddress(module, reinterpret_cast<const void*>(info.construct)) ||
+                                   loader.ownsAddress(module, reinterpret_cast<const void*>(info.destruct)) ||
+                                   loader.ownsAddress(module, reinterpret_cast<const void*>(info.relocate))))
+            {
+                continue;
+            }
+            info.construct = &detachedConstruct;
+            info.destruct = &detachedDestruct;
+            info.relocate = &detachedRelocate;
+            g_detached[i] = true;
+            ++detached;
+        }
+        return detached;
+    }
+
+    uint32_t ComponentRegistry::detachedCount()
+    {
+        std::lock_guard<std::mutex> lock(g_registerMutex);
+        const uint32_t count = g_count.load(std::memory_order_relaxed);
+        uint32_t detached = 0;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            detached += g_detached[i] ? 1 : 0;
+        }
+        return detached;
+    }
+
+    ComponentId ComponentRegistry::find(StringId nameId)
+    {
+        const uint32_t count = g_count.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (g_infos[i].nameId == nameId)
+            {
+                return i;
+            }
+        }
+        return kInvalidComponent;
+    }
+
+    const ComponentInfo& ComponentRegistry::info(ComponentId id)
+    {
+        assert(id < g_count.load(std::memory_order_acquire));
+        return g_infos[id];
+    }
+
+    uint32_t ComponentRegistry::count()
+    {
+        return g_count.load(std::memory_order_acquire);
+    }
+}
@@ -0,0 +1,487 @@
+#include "axis/core/EventBus.h"
+
+#include "axis/utils/Profiler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <mutex>
+
+namespace axis
+{
+    namespace
+    {
+        // 등록된 항목은 이동하지 않으므로 info()는 잠금 없이 읽을 수 있습니다.
+        EventTypeInfo g_infos[kMaxEventTypes];
+        std::atomic<uint32_t> g_count{0};
+        std::mutex g_registerMutex;
+
+        BudgetTag eventTag()
+        {
+            static const BudgetTag s_tag = MemoryBudget::registerTag("core.events", MemoryAxis::Time);
+            return s_tag;
+        }
+
+        // 청크 안의 이벤트 머리글. 내용은 머리글 바로 뒤, 타입 정렬에 맞춘 위치에 있습니다.
+        struct RecordHeader
+        {
+            EventTypeId type;
+            // 다음 머리글의 청크 내 위치.
+            uint32_t end;
+        };
+
+        constexpr uint32_t kRecordAlignment = alignof(RecordHeader);
+
+        uint32_t payloadOffset(uint32_t recordOffset, uint32_t alignment)
+        {
+            return static_cast<uint32_t>(alignUp(recordOffset + sizeof(RecordHeader), alignment));
+        }
+
+        // 청크 목록의 모든 이벤트를 쌓인 순서대로 방문합니다. fn(type, payload).
+        template <typename ChunkT, typename Fn>
+        void forEachRecord(const ChunkT* chunk, Fn&& fn)
+        {
+            for (; chunk != nullptr; chunk = chunk->next)
+            {
+                const uint8_t* data = chunk->data();
+                uint32_t offset = 0;
+                while (offset < chunk->used)
+                {
+                    RecordHeader header;
+                    std::memcpy(&header, data + offset, sizeof(header));
+                    fn(header.type, data + payloadOffset(offset, g_infos[header.type].alignment));
+                    offset = header.end;
+                }
+            }
+        }
+    }
+
+    struct alignas(16) EventBus::Chunk
+    {
+        Chunk* next = nullptr;
+        uint32_t used = 0;
+        uint32_t capacity = 0;
+
+        uint8_t* data() { return reinterpret_cast<uint8_t*>(this + 1); }
+        const uint8_t* data() const { return reinterpret_cast<const uint8_t*>(this + 1); }
+    };
+
+    EventTypeId EventTypeRegistry::registerType(const EventTypeInfo& info)
+    {
+        assert(info.name != nullptr);
+        const StringId nameId = info.nameId.isValid() ? info.nameId : StringId(info.name);
+
+        std::lock_guard<std::mutex> lock(g_registerMutex);
+        const uint32_t count = g_count.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (g_infos[i].nameId == nameId)
+            {
+                assert(std::strcmp(g_infos[i].name, info.name) == 0 && "이벤트 이름 해시 충돌입니다");
+                assert(g_infos[i].size == info.size && "같은 이름의 이벤트가 다른 크기로 등록되었습니다");
+                return i;
+            }
+        }
+
+        assert(count < kMaxEventTypes && "이벤트 타입 수가 kMaxEventTypes를 넘었습니다");
+        if (count >= kMaxEventTypes)
+        {
+            return kInvalidEventType;
+        }
+
+        // 등록한 DLL이 내려가도 이름이 남도록 인턴 표에 복사해 둡니다.
+        const char* ownedName = StringId::intern(info.name).str();
+        g_infos[count] = info;
+        g_infos[count].name = ownedName != nullptr ? ownedName : info.name;
+        g_infos[count].nameId = nameId;
+        g_count.store(count + 1, std::memory_order_release);
+        return count;
+    }
+
+    EventTypeId EventTypeRegistry::find(StringId nameId)
+    {
+        const uint32_t count = g_count.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (g_infos[i].nameId == nameId)
+            {
+                return i;
+            }
+        }
+        return kInvalidEventType;
+    }
+
+    const EventTypeInfo& EventTypeRegistry::info(EventTypeId id)
+    {
+        assert(id < g_count.load(std::memory_order_acquire));
+        return g_infos[id];
+    }
+
+    uint32_t EventTypeRegistry::count()
+    {
+        return g_count.load(std::memory_order_acquire);
+    }
+
+    EventBus::EventBus(JobSystem& jobs, const EventBusDesc& desc, Allocator* allocator)
+        : m_jobs(jobs)
+        , m_desc(desc)
+        , m_systemAllocator(eventTag())
+        , m_allocator(allocator != nullptr ? *allocator : m_systemAllocator)
+    {
+        assert(m_desc.chunkSize > sizeof(Chunk) + sizeof(RecordHeader) && "chunkSize가 너무 작습니다");
+        m_bufferCount = jobs.threadCount() + 1;
+        m_buffers = std::make_unique<ThreadBuffer[]>(m_bufferCount);
+    }
+
+    EventBus::~EventBus()
+    {
+        for (uint32_t i = 0; i < m_bufferCount; ++i)
+        {
+            releaseChunks(m_buffers[i].head[0]);
+            releaseChunks(m_buffers[i].head[1]);
+        }
+        while (m_freeChunks != nullptr)
+        {
+            Chunk* next = m_freeChunks->next;
+            m_freeChunks->~Chunk();
+            m_allocator.deallocate(m_freeChunks, m_desc.chunkSize);
+            m_freeChunks = next;
+        }
+        if (m_scratch != nullptr)
+        {
+            m_allocator.deallocate(m_scratch, m_scratchCapacity);
+        }
+    }
+
+    bool EventBus::publish(EventTypeId type, const void* data, uint32_t size, uint32_t alignment)
+    {
+        assert(type < EventTypeRegistry::count() && EventTypeRegistry::info(type).size == size);
+        // 레코드를 훑는 쪽은 등록된 정렬로 페이로드를 찾으므로, 넘겨받은 값이 아니라 등록된 값으로 씁니다.
+        assert(EventTypeRegistry::info(type).alignment == alignment && "등록된 정렬과 다릅니다");
+        alignment = EventTypeRegistry::info(type).alignment;
+
+        const uint32_t index = m_jobs.currentThreadIndex();
+        if (index < m_bufferCount - 1)
+        {
+            // 이 스레드만 쓰는 버퍼입니다. 세대는 dispatch와 겹치지 않는 동안만 바뀌므로 느슨하게 읽습니다.
+            const uint32_t generation = m_generation.load(std::memory_order_relaxed);
+            return append(m_buffers[index], generation, type, data, size, alignment);
+        }
+
+        std::lock_guard<SpinLock> lock(m_externalLock);
+        const uint32_t generation = m_generation.load(std::memory_order_relaxed);
+        return append(m_buffers[m_bufferCount - 1], generation, type, data, size, alignment);
+    }
+
+    bool EventBus::append(ThreadBuffer& buffer, uint32_t generation, EventTypeId type, const void* data,
+                          uint32_t size, uint32_t alignment)
+    {
+        Chunk* chunk = buffer.tail[generation];
+        uint32_t offset = chunk != nullptr ? chunk->used : 0;
+        uint32_t payload = payloadOffset(offset, alignment);
+        uint32_t end = static_cast<uint32_t>(alignUp(payload + size, kRecordAlignment));
+
+        if (chunk == nullptr || end > chunk->capacity)
+        {
+            Chunk* fresh = acquireChunk();
+            if (fresh == nullptr)
+            {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            offset = 0;
+            payload = payloadOffset(0, alignment);
+            end = static_cast<uint32_t>(alignUp(payload + size, kRecordAlignment));
+            assert(end <= fresh->capacity && "이벤트가 chunkSize보다 큽니다");
+
+            if (chunk != nullptr)
+            {
+                chunk->next = fresh;
+            }
+            else
+            {
+                buffer.head[generation] = fresh;
+            }
+            buffer.tail[generation] = fresh;
+            chunk = fresh;
+        }
+
+        const RecordHeader header{type, end};
+        std::memcpy(chunk->data() + offset, &header, sizeof(header));
+        std::memcpy(chunk->data() + payload, data, size);
+        chunk->used = end;
+        return true;
+    }
+
+    EventBus::Chunk* EventBus::acquireChunk()
+    {
+        {
+            std::lock_guard<SpinLock> lock(m_chunkLock);
+            if (m_freeChunks != nullptr)
+            {
+                Chunk* chunk = m_freeChunks;
+                m_freeChunks = chunk->next;
+                chunk->next = nullptr;
+                chunk->used = 0;
+                return chunk;
+            }
+        }
+
+        // 새 청크는 첫 몇 프레임에만 필요하므로 잠금 밖에서 할당합니다.
+        void* memory = m_allocator.allocate(m_desc.chunkSize, alignof(Chunk));
+        if (memory == nullptr)
+        {
+            return nullptr;
+        }
+
+        Chunk* chunk = new (memory) Chunk();
+        chunk->capacity = static_cast<uint32_t>(m_desc.chunkSize - sizeof(Chunk));
+
+        std::lock_guard<SpinLock> lock(m_chunkLock);
+        ++m_chunkCount;
+        return chunk;
+    }
+
+    void EventBus::releaseChunks(Chunk* head)
+    {
+        if (head == nullptr)
+        {
+            return;
+        }
+
+        Chunk* tail = head;
+        while (tail->next != nullptr)
+        {
+            tail = tail->next;
+        }
+
+        std::lock_guard<SpinLock> lock(m_chunkLock);
+        tail->next = m_freeChunks;
+        m_freeChunks = head;
+    }
+
+    bool EventBus::reserveScratch(size_t bytes)
+    {
+        if (bytes <= m_scratchCapacity)
+        {
+            return true;
+        }
+
+        const size_t capacity = std::max(bytes, m_scratchCapacity * 2);
+        void* memory = m_allocator.allocate(capacity, kCacheLineSize);
+        if (memory == nullptr)
+        {
+            return false;
+        }
+        if (m_scratch != nullptr)
+        {
+            m_allocator.deallocate(m_scratch, m_scratchCapacity);
+        }
+        m_scratch = static_cast<uint8_t*>(memory);
+        m_scratchCapacity = capacity;
+        return true;
+    }
+
+    uint32_t EventBus::dispatch()
+    {
+        AXIS_PROFILE_SCOPE("EventBus::dispatch");
+        assert(!m_dispatching && "구독자 안에서 dispatch를 다시 호출할 수 없습니다");
+
+        // 이후의 publish는 다른 세대에 쌓입니다. 외부 스레드는 잠금 안에서 세대를 읽으므로 언제든 안전합니다.
+        uint32_t generation = 0;
+        {
+            std::lock_guard<SpinLock> lock(m_externalLock);
+            generation = m_generation.load(std::memory_order_relaxed);
+            m_generation.store(generation ^ 1u, std::memory_order_relaxed);
+        }
+        m_dispatching = true;
+
+        // 1) 타입별 개수를 세고, 구독자가 있는 타입만 연속 배열 자리를 잡습니다.
+        uint32_t total = 0;
+        for (uint32_t i = 0; i < m_bufferCount; ++i)
+        {
+            forEachRecord(m_buffers[i].head[generation], [&](EventTypeId type, const uint8_t*) {
+                ++m_typeCounts[type];
+                ++total;
+            });
+        }
+
+        const uint32_t typeCount = EventTypeRegistry::count();
+        uint32_t deliveredTypes = 0;
+        uint32_t undelivered = 0;
+        size_t bytes = 0;
+        for (EventTypeId type = 0; type < typeCount; ++type)
+        {
+            const uint32_t count = m_typeCounts[type];
+            if (count == 0)
+            {
+                continue;
+            }
+            if (m_subscribed[type] == 0)
+            {
+                undelivered += count;
+                continue;
+            }
+            const EventTypeInfo& info = g_infos[type];
+            bytes = alignUp(bytes, info.alignment);
+            m_typeOffsets[type] = bytes;
+            bytes += static_cast<size_t>(count) * info.size;
+            ++deliveredTypes;
+        }
+
+        // 2) 스레드 버퍼를 순서대로 훑으며 타입별 배열에 복사합니다. 같은 타입 안의 순서는 그대로 남습니다.
+        bool deliver = bytes == 0 || reserveScratch(bytes);
+        if (deliver && bytes != 0)
+        {
+            for (uint32_t i = 0; i < m_bufferCount; ++i)
+            {
+                forEachRecord(m_buffers[i].head[generation], [&](EventTypeId type, const uint8_t* payload) {
+                    if (m_subscribed[type] != 0)
+                    {
+                        const uint32_t size = g_infos[type].size;
+                        std::memcpy(m_scratch + m_typeOffsets[type], payload, size);
+                        m_typeOffsets[type] += size;
+                    }
+                });
+            }
+        }
+        else if (!deliver)
+        {
+            m_dropped.fetch_add(total - undelivered, std::memory_order_relaxed);
+        }
+
+        // 3) 구독자 목록은 타입 순이므로 한 번 훑으며 타입별 배열을 넘깁니다.
+        //    복사가 끝나면 m_typeOffsets는 각 배열의 끝을 가리킵니다.
+        if (deliver)
+        {
+            for (const Subscriber& subscriber : m_subscribers)
+            {
+                const uint32_t count = m_typeCounts[subscriber.type];
+                if (count == 0 || !subscriber.active)
+                {
+                    continue;
+                }
+                const size_t length = static_cast<size_t>(count) * g_infos[subscriber.type].size;
+                const uint8_t* events = m_scratch + (m_typeOffsets[subscriber.type] - length);
+                subscriber.invoke(subscriber.handler, events, count, subscriber.userData);
+            }
+        }
+
+        for (EventTypeId type = 0; type < typeCount; ++type)
+        {
+            m_typeCounts[type] = 0;
+        }
+        for (uint32_t i = 0; i < m_bufferCount; ++i)
+        {
+            releaseChunks(m_buffers[i].head[generation]);
+            m_buffers[i].head[generation] = nullptr;
+            m_buffers[i].tail[generation] = nullptr;
+        }
+
+        m_dispatching = false;
+        applySubscriberChanges();
+
+        m_stats.events = deliver ? total - undelivered : 0;
+        m_stats.types = deliver ? deliveredTypes : 0;
+        m_stats.undelivered = undelivered;
+        m_stats.dropped = m_dropped.load(std::memory_order_relaxed);
+        {
+            std::lock_guard<SpinLock> lock(m_chunkLock);
+            m_stats.chunks = m_chunkCount;
+        }
+        return m_stats.events;
+    }
+
+    void EventBus::dispatchSystem(const SystemContext& context)
+    {
+        static_cast<EventBus*>(context.userData)->dispatch();
+    }
+
+    SubscriptionId EventBus::subscribe(EventTypeId type, EventHandler handler, void* userData)
+    {
+        Invoker invoke = [](GenericHandler generic, const void* events, uint32_t count, void* user) {
+            reinterpret_cast<EventHandler>(generic)(events, count, user);
+        };
+        return addSubscriber(type, reinterpret_cast<GenericHandler>(handler), invoke, userData);
+    }
+
+    SubscriptionId EventBus::addSubscriber(EventTypeId type, GenericHandler handler, Invoker invoke, void* userData)
+    {
+        assert(type < EventTypeRegistry::count() && handler != nullptr);
+
+        Subscriber subscriber;
+        subscriber.type = type;
+        subscriber.id = m_nextSubscription++;
+        subscriber.handler = handler;
+        subscriber.invoke = invoke;
+        subscriber.userData = userData;
+
+        if (m_dispatching)
+        {
+            // 목록을 훑는 도중이므로 dispatch가 끝난 뒤에 넣습니다.
+            m_pendingSubscribers.push_back(subscriber);
+        }
+        else
+        {
+            insertSubscriber(subscriber);
+        }
+        return subscriber.id;
+    }
+
+    void EventBus::insertSubscriber(const Subscriber& subscriber)
+    {
+        auto position = std::upper_bound(m_subscribers.begin(), m_subscribers.end(), subscriber.type,
+                                         [](EventTypeId type, const Subscriber& other) { return type < other.type; });
+        m_subscribers.insert(position, subscriber);
+        m_subscribed[subscriber.type] = 1;
+    }
+
+    void EventBus::unsubscribe(SubscriptionId id)
+    {
+        for (auto it = m_pendingSubscribers.begin(); it != m_pendingSubscribers.end(); ++it)
+        {
+            if (it->id == id)
+            {
+                m_pendingSubscribers.erase(it);
+                return;
+            }
+        }
+
+        for (Subscriber& subscriber : m_subscribers)
+        {
+            if (subscriber.id == id)
+            {
+                subscriber.active = false;
+                m_subscribersDirty = true;
+                break;
+            }
+        }
+        if (!m_dispatching)
+        {
+            applySubscriberChanges();
+        }
+    }
+
+    void EventBus::applySubscriberChanges()
+    {
+        if (m_subscribersDirty)
+        {
+            m_subscribers.erase(std::remove_if(m_subscribers.begin(), m_subscribers.end(),
+                                               [](const Subscriber& subscriber) { return !subscriber.active; }),
+                                m_subscribers.end());
+            std::memset(m_subscribed, 0, sizeof(m_subscribed));
+            for (const Subscriber& subscriber : m_subscribers)
+            {
+                m_subscribed[subscriber.type] = 1;
+            }
+            m_subscribersDirty = false;
+        }
+
+        for (const Subscriber& subscriber : m_pendingSubscribers)
+        {
+            insertSubscriber(subscriber);
+        }
+        m_pendingSubscribers.clear();
+    }
+}
@@ -0,0 +1,96 @@
+#include "axis/core/FixedTimestep.h"
+
+#include "axis/platform/Clock.h"
+#include "axis/utils/Profiler.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace axis
+{
+    FixedTimestep::FixedTimestep(const FixedTimestepDesc& desc)
+        : m_desc(desc)
+    {
+        assert(desc.tickRate > 0 && "tickRate는 0보다 커야 합니다");
+        assert(desc.maxTicksPerFrame > 0 && "maxTicksPerFrame은 0보다 커야 합니다");
+        m_tickNs = (1'000'000'000ull + desc.tickRate / 2) / desc.tickRate;
+    }
+
+    FixedTimestepFrame FixedTimestep::advance(uint64_t elapsedNs)
+    {
+        FixedTimestepFrame frame;
+        frame.firstTick = m_tickIndex;
+
+        m_accumulatorNs += elapsedNs;
+        const uint64_t wanted = m_accumulatorNs / m_tickNs;
+        const uint64_t ticks = std::min<uint64_t>(wanted, m_desc.maxTicksPerFrame);
+        m_accumulatorNs -= ticks * m_tickNs;
+
+        // 한도를 넘었다면 남은 틱 분량은 버리고 틱 미만의 나머지만 남겨 보간이 이어지게 합니다.
+        if (ticks < wanted)
+        {
+            const uint64_t remainder = m_accumulatorNs % m_tickNs;
+            frame.droppedNs = m_accumulatorNs - remainder;
+            m_accumulatorNs = remainder;
+        }
+
+        m_tickIndex += ticks;
+        frame.ticks = static_cast<uint32_t>(ticks);
+        frame.alpha = alpha();
+        return frame;
+    }
+
+    void FixedTimestep::reset()
+    {
+        m_accumulatorNs = 0;
+        m_tickIndex = 0;
+    }
+
+    SimulationLoop::SimulationLoop(Scheduler& simulation, Scheduler* presentation, const FixedTimestepDesc& desc)
+        : m_simulation(simulation)
+        , m_presentation(presentation)
+        , m_timestep(desc)
+    {
+    }
+
+    FixedTimestepFrame SimulationLoop::runFrame()
+    {
+        const uint64_t now = Clock::nowNs();
+        const uint64_t elapsed = m_started ? now - m_lastFrameNs : 0;
+        m_started = true;
+        m_lastFrameNs = now;
+        return runFrame(elapsed);
+    }
+
+    FixedTimestepFrame SimulationLoop::runFrame(uint64_t elapsedNs)
+    {
+        AXIS_PROFILE_SCOPE("SimulationLoop::runFrame");
+
+        const FixedTimestepFrame frame = m_timestep.advance(elapsedNs);
+
+        const double tickSeconds = m_timestep.tickSeconds();
+        for (uint32_t i = 0; i < frame.ticks; ++i)
+        {
+            m_simulation.setFrameTime(tickSeconds, 1.0f);
+            m_simulation.runFrame();
+        }
+
+        m_lastTickNs.store(Clock::nowNs() - m_timestep.accumulatedNs(), std::memory_order_release);
+
+        if (m_presentation != nullptr)
+        {
+            m_presentation->setFrameTime(static_cast<double>(elapsedNs) * 1e-9, frame.alpha);
+            m_presentation->runFrame();
+        }
+        return frame;
+    }
+
+    float SimulationLoop::alphaNow() const
+    {
+        const uint64_t lastTick = m_lastTickNs.load(std::memory_order_acquire);
+        const uint64_t now = Clock::nowNs();
+        const uint64_t since = now > lastTick ? now - lastTick : 0;
+        const float alpha = static_cast<float>(since) / static_cast<float>(m_timestep.tickDurationNs());
+        return std::min(alpha, 1.0f);
+    }
+}
@@ -0,0 +1,53 @@
+#include "axis/core/InputQueue.h"
+
+namespace axis
+{
+    InputQueue::InputQueue(uint32_t capacity, Allocator& allocator)
+        : m_ring(capacity, allocator)
+    {
+    }
+
+    void InputQueue::attach(RawInputDesc& desc)
+    {
+        desc.sink = &InputQueue::push;
+        desc.context = this;
+    }
+
+    uint32_t InputQueue::drain(InputEvent* out, uint32_t capacity, uint64_t upToNs)
+    {
+        uint32_t count = 0;
+        while (count < capacity)
+        {
+            if (!m_hasPending)
+            {
+                if (!m_ring.tryPop(m_pending))
+                {
+                    break;
+                }
+                m_hasPending = true;
+            }
+
+            // 장치마다 시각이 조금씩 어긋날 수 있지만 받은 순서를 지키기 위해 첫 늦은 이벤트에서 멈춥니다.
+            if (m_pending.timestampNs > upToNs)
+            {
+                break;
+            }
+            out[count++] = m_pending;
+            m_hasPending = false;
+        }
+        return count;
+    }
+
+    void InputQueue::push(const InputEvent* events, uint32_t count, void* context)
+    {
+        InputQueue* queue = static_cast<InputQueue*>(context);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (!queue->m_ring.tryPush(events[i]))
+            {
+                queue->m_dropped.fetch_add(count - i, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+}
@@ -0,0 +1,65 @@
+#include "axis/core/IoJobBridge.h"
+
+#include <cassert>
+
+namespace axis
+{
+    namespace
+    {
+        BudgetTag ioTag()
+        {
+            static const BudgetTag s_tag = MemoryBudget::registerTag("core.io", MemoryAxis::Time);
+            return s_tag;
+        }
+    }
+
+    IoJobBridge::IoJobBridge(JobSystem& jobs, uint32_t jobsPerPage)
+        : m_jobs(jobs)
+        , m_pool(jobsPerPage, ioTag())
+    {
+    }
+
+    IoJobBridge::~IoJobBridge()
+    {
+        assert(m_counter.isDone() && "완료 콜백 작업이 남아 있는 상태로 브리지를 파괴했습니다");
+    }
+
+    void IoJobBridge::attach(AsyncIoDesc& desc)
+    {
+        desc.executor = &IoJobBridge::execute;
+        desc.executorContext = this;
+    }
+
+    void IoJobBridge::wait()
+    {
+        m_jobs.wait(m_counter);
+    }
+
+    void IoJobBridge::execute(IoRequest& request, void* context)
+    {
+        IoJobBridge* bridge = static_cast<IoJobBridge*>(context);
+        CompletionJob* completion = bridge->m_pool.create();
+        if (completion == nullptr)
+        {
+            // 풀을 더 늘릴 수 없으면 I/O 스레드에서 바로 처리합니다.
+            completeIoRequest(request);
+            return;
+        }
+
+        completion->job.function = &IoJobBridge::run;
+        completion->job.data = completion;
+        completion->job.counter = &bridge->m_counter;
+        completion->request = &request;
+        completion->owner = bridge;
+        bridge->m_jobs.submit(completion->job);
+    }
+
+    void IoJobBridge::run(void* data)
+    {
+        // JobSystem은 함수 호출 전에 카운터를 읽어 두므로 여기서 작업 객체를 돌려놓아도 됩니다.
+        CompletionJob* completion = static_cast<CompletionJob*>(data);
+        IoRequest& request = *completion->request;
+        completion->owner->m_pool.destroy(completion);
+        completeIoRequest(request);
+    }
+}
@@ -0,0 +1,315 @@
+#include "axis/core/JobSystem.h"
+
+#include "WorkStealingDeque.h"
+
+#include "axis/utils/Profiler.h"
+
+#include <cassert>
+#include <cstdio>
+
+namespace axis
+{
+    namespace
+    {
+        struct ThreadBinding
+        {
+            const JobSystem* system = nullptr;
+            uint32_t index = JobSystem::kInvalidThreadIndex;
+        };
+
+        thread_local ThreadBinding t_binding;
+
+        constexpr uint32_t kSpinCount = 64;
+    }
+
+    JobSystem::JobSystem(const JobSystemDesc& desc)
+        : m_injectQueue(desc.injectCapacity)
+    {
+        assert(desc.dequeCapacity != 0 && (desc.dequeCapacity & (desc.dequeCapacity - 1)) == 0);
+
+        uint32_t workerCount = desc.workerCount;
+        if (workerCount == 0)
+        {
+            const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+            workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+        }
+
+        m_deques.reserve(workerCount + 1);
+        for (uint32_t i = 0; i < workerCount + 1; ++i)
+        {
+            m_deques.push_back(std::make_unique<detail::WorkStealingDeque>(desc.dequeCapacity));
+        }
+
+        t_binding.system = this;
+        t_binding.index = 0;
+
+        const CpuTopology& topology = cpuTopology();
+        const CpuMask allowed = desc.workerCpus.empty() ? topology.all : desc.workerCpus;
+        m_workerAffinity.resize(workerCount);
+        m_workerPriority = desc.workerPriority;
+        if (desc.pinWorkers)
+        {
+            std::vector<uint32_t> order(topology.cpus.size());
+            const uint32_t cpuCount = topology.spreadOrder(allowed, order.data(), static_cast<uint32_t>(order.size()));
+            for (uint32_t i = 0; i < workerCount && cpuCount != 0; ++i)
+            {
+                // CPU보다 워커가 많으면 처음부터 다시 돌며 겹쳐 배정합니다.
+                const uint32_t slot = cpuCount > 1 ? 1 + i % (cpuCount - 1) : 0;
+                m_workerAffinity[i] = CpuMask::single(order[slot]);
+            }
+        }
+        else if (!desc.workerCpus.empty())
+        {
+            for (CpuMask& affinity : m_workerAffinity)
+            {
+                affinity = allowed;
+            }
+        }
+
+        m_workers.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; ++i)
+        {
+            m_workers.emplace_back(&JobSystem::workerMain, this, i + 1);
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        m_running.store(false, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+        }
+        m_wakeCondition.notify_all();
+
+        for (std::thread& worker : m_workers)
+        {
+            worker.join();
+        }
+
+        if (t_binding.system == this)
+        {
+            t_binding = ThreadBinding{};
+        }
+    }
+
+    void JobSystem::submit(Job& job)
+    {
+        submit(&job, 1);
+    }
+
+    void JobSystem::submit(Job* jobs, uint32_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // 깨어난 워커가 큐를 비어 있다고 판단하지 않도록 먼저 개수를 올립니다.
+        m_queuedJobs.fetch_add(count, std::memory_order_seq_cst);
+
+        const uint32_t index = currentThreadIndex();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            Job& job = jobs[i];
+            assert(job.function != nullptr);
+            if (job.counter != nullptr)
+            {
+                job.counter->pending.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            if (index == kInvalidThreadIndex || !m_deques[index]->push(&job))
+            {
+                while (!m_injectQueue.tryPush(&job))
+                {
+                    // 공용 큐가 가득 찼습니다. 워커를 깨우고 자리가 날 때까지 직접 작업을 소화합니다.
+                    notifyWorkers(count);
+                    Job* other = nullptr;
+                    if (findJob(other, index))
+                    {
+                        execute(*other);
+                    }
+                    else
+                    {
+                        cpuRelax();
+                    }
+                }
+            }
+        }
+
+        notifyWorkers(count);
+    }
+
+    void JobSystem::wait(const JobCounter& counter)
+    {
+        const uint32_t index = currentThreadIndex();
+        uint32_t spins = 0;
+        while (!counter.isDone())
+        {
+            Job* job = nullptr;
+            if (findJob(job, index))
+            {
+                execute(*job);
+                spins = 0;
+            }
+            else if (++spins < kSpinCount)
+            {
+                cpuRelax();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    bool JobSystem::runOne()
+    {
+        Job* job = nullptr;
+        if (!findJob(job, currentThreadIndex()))
+        {
+            return false;
+        }
+        execute(*job);
+        return true;
+    }
+
+    uint32_t JobSystem::currentThreadIndex() const
+    {
+        return t_binding.system == this ? t_binding.index : kInvalidThreadIndex;
+    }
+
+    bool JobSystem::findJob(Job*& outJob, uint32_t threadIndex)
+    {
+        const uint32_t dequeCount = static_cast<uint32_t>(m_deques.size());
+
+        Job* job = nullptr;
+        if (threadIndex != kInvalidThreadIndex)
+        {
+            job = m_deques[threadIndex]->pop();
+        }
+
+        if (job == nullptr)
+        {
+            m_injectQueue.tryPop(job);
+        }
+
+        if (job == nullptr)
+        {
+            // 항상 같은 덱부터 훔치지 않도록 자신의 다음 인덱스부터 순회합니다.
+            const uint32_t start = threadIndex != kInvalidThreadIndex ? threadIndex + 1 : 0;
+            for (uint32_t i = 0; i < dequeCount && job == nullptr; ++i)
+            {
+                const uint32_t victim = (start + i) % dequeCount;
+                if (victim != threadIndex)
+                {
+                    job = m_deques[victim]->steal();
+                }
+            }
+        }
+
+        if (job == nullptr)
+        {
+            return false;
+        }
+
+        m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        outJob = job;
+        return true;
+    }
+
+    void JobSystem::execute(Job& job)
+    {
+        // 카운터가 0이 되는 순간 Job 메모리가 해제될 수 있으므로 미리 읽어 둡니다.
+        JobCounter* counter = job.counter;
+        job.function(job.data);
+        if (counter != nullptr)
+        {
+            completePending(*counter);
+        }
+    }
+
+    void JobSystem::completePending(JobCounter& counter)
+    {
+        const uint32_t previous = counter.pending.fetch_sub(1, std::memory_order_acq_rel);
+        assert((previous & ~JobCounter::kContinuationBit) != 0 && "카운터가 0 아래로 내려갔습니다");
+        if (previous == (JobCounter::kContinuationBit | 1u))
+        {
+            // 중단된 태스크가 기다리던 마지막 작업입니다. 0을 공개한 뒤에는 카운터가 해제될 수 있으므로
+            // 이어서 실행할 작업을 먼저 꺼내 둡니다. 이 스레드의 덱에 들어가므로 보통 곧바로 여기서 실행됩니다.
+            Job* continuation = counter.continuation;
+            counter.continuation = nullptr;
+            counter.pending.store(0, std::memory_order_release);
+            submit(*continuation);
+        }
+    }
+
+    void JobSystem::workerMain(uint32_t threadIndex)
+    {
+        t_binding.system = this;
+        t_binding.index = threadIndex;
+
+        char threadName[32];
+        std::snprintf(threadName, sizeof(threadName), "axis.worker %u", threadIndex);
+        setCurrentThreadName(threadName);
+        AXIS_PROFILE_THREAD_NAME(threadName);
+
+        const CpuMask& affinity = m_workerAffinity[threadIndex - 1];
+        if (!affinity.empty())
+        {
+            setCurrentThreadAffinity(affinity);
+        }
+        if (m_workerPriority != ThreadPriority::Normal)
+        {
+            setCurrentThreadPriority(m_workerPriority);
+        }
+
+        uint32_t spins = 0;
+        while (m_running.load(std::memory_order_acquire))
+        {
+            Job* job = nullptr;
+            if (findJob(job, threadIndex))
+            {
+                execute(*job);
+                spins = 0;
+                continue;
+            }
+
+            if (++spins < kSpinCount)
+            {
+                cpuRelax();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+            m_wakeCondition.wait(lock, [this] {
+                return !m_running.load(std::memory_order_acquire) ||
+                       m_queuedJobs.load(std::memory_order_seq_cst) > 0;
+            });
+            m_sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+            spins = 0;
+        }
+    }
+
+    void JobSystem::notifyWorkers(uint32_t count)
+    {
+        if (m_sleepingWorkers.load(std::memory_order_seq_cst) == 0)
+        {
+            return;
+        }
+
+        // 워커가 조건 검사와 대기 사이에 있을 때 알림을 놓치지 않도록 뮤텍스를 한 번 거칩니다.
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+        }
+
+        if (count == 1)
+        {
+            m_wakeCondition.notify_one();
+        }
+        else
+        {
+            m_wakeCondition.notify_all();
+        }
+    }
+}
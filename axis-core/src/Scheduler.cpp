@@ -0,0 +1,460 @@
+#include "axis/core/Scheduler.h"
+
+#include "axis/platform/ModuleLoader.h"
+#include "axis/utils/MemoryTracker.h"
+#include "axis/utils/Profiler.h"
+#include "axis/utils/StringId.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <unordered_map>
+
+namespace axis
+{
+    namespace
+    {
+        // 이름을 등록한 모듈이 내려가도 남도록 인턴 표에 복사합니다. 복사하지 못하면 원래 포인터를 씁니다.
+        const char* ownedName(const char* name)
+        {
+            if (name == nullptr)
+            {
+                return nullptr;
+            }
+            const char* copy = StringId::intern(name).str();
+            return copy != nullptr ? copy : name;
+        }
+    }
+
+    Scheduler::Scheduler(JobSystem& jobs)
+        : m_jobs(jobs)
+    {
+    }
+
+    PhaseId Scheduler::addPhase(const char* name)
+    {
+        assert(m_currentPhase == kInvalidPhase && "runFrame 도중에는 단계를 추가할 수 없습니다");
+
+        Phase phase;
+        phase.name = name != nullptr ? ownedName(name) : "";
+        m_phases.push_back(std::move(phase));
+        m_graphDirty = true;
+        return static_cast<PhaseId>(m_phases.size() - 1);
+    }
+
+    SystemId Scheduler::addSystem(const SystemDesc& desc)
+    {
+        assert(m_currentPhase == kInvalidPhase && "runFrame 도중에는 시스템을 추가할 수 없습니다");
+        assert(desc.function != nullptr);
+        assert(desc.phase < m_phases.size());
+
+        assert(desc.interval >= 1 && desc.interval <= kMaxUpdateInterval);
+
+        if (desc.name != nullptr)
+        {
+            for (SystemId id = 0; id < m_systems.size(); ++id)
+            {
+                SystemEntry& existing = m_systems[id];
+                // 이름 없는 시스템은 다시 묶을 수 없으므로 건너뜁니다.
+                if (!existing.detached || existing.desc.name == nullptr ||
+                    std::strcmp(existing.desc.name, desc.name) != 0)
+                {
+                    continue;
+                }
+
+                if (existing.desc.phase != desc.phase)
+                {
+                    std::vector<SystemId>& systems = m_phases[existing.desc.phase].systems;
+                    systems.erase(std::find(systems.begin(), systems.end(), id));
+                    m_phases[desc.phase].systems.push_back(id);
+                }
+                const char* name = existing.desc.name;
+                existing.desc = desc;
+                existing.desc.name = name;
+                existing.frameOffset %= desc.interval;
+                existing.detached = false;
+                existing.enabled = true;
+                existing.elapsedTime = 0.0;
+                m_graphDirty = true;
+                return id;
+            }
+        }
+
+        // 같은 주기로 먼저 등록된 시스템 수만큼 밀어 배치하므로 주기 시스템들이 한 프레임에 몰리지 않습니다.
+        uint32_t sameInterval = 0;
+        for (const SystemEntry& other : m_systems)
+        {
+            sameInterval += other.desc.interval == desc.interval ? 1 : 0;
+        }
+
+        const SystemId id = static_cast<SystemId>(m_systems.size());
+        SystemEntry entry;
+        entry.desc = desc;
+        entry.desc.name = ownedName(desc.name);
+        entry.frameOffset = sameInterval % desc.interval;
+        m_systems.push_back(std::move(entry));
+        m_phases[desc.phase].systems.push_back(id);
+        m_graphDirty = true;
+        return id;
+    }
+
+    void Scheduler::setSystemEnabled(SystemId system, bool enabled)
+    {
+        assert(system < m_systems.size());
+        assert(!(enabled && m_systems[system].detached) && "떼어 낸 시스템은 다시 붙기 전에 켤 수 없습니다");
+        if (m_systems[system].enabled != enabled)
+        {
+            m_systems[system].enabled = enabled;
+            m_systems[system].elapsedTime = 0.0;
+            m_graphDirty = true;
+        }
+    }
+
+    uint32_t Scheduler::detachModule(const ModuleLoader& loader, ModuleId module)
+    {
+        assert(m_currentPhase == kInvalidPhase && "runFrame 도중에는 시스템을 떼어 낼 수 없습니다");
+
+        uint32_t detached = 0;
+        for (SystemEntry& entry : m_systems)
+        {
+            if (entry.detached || !loader.ownsAddress(module, reinterpret_cast<const void*>(entry.desc.function)))
+            {
+                continue;
+            }
+            entry.desc.function = nullptr;
+            entry.desc.userData = nullptr;
+            entry.detached = true;
+            entry.enabled = false;
+            m_graphDirty = true;
+            ++detached;
+        }
+        return detached;
+    }
+
+    void Scheduler::setFrameTime(double deltaTime, float alpha)
+    {
+        assert(m_currentPhase == kInvalidPhase && "runFrame 도중에는 시간을 바꿀 수 없습니다");
+        m_deltaTime = deltaTime;
+        m_alpha = alpha;
+    }
+
+    const char* Scheduler::phaseName(PhaseId phase) const
+    {
+        return phase < m_phases.size() ? m_phases[phase].name : "";
+    }
+
+    const char* Scheduler::systemName(SystemId system) const
+    {
+        if (system >= m_systems.size() || m_systems[system].desc.name == nullptr)
+        {
+            return "";
+        }
+        return m_systems[system].desc.name;
+    }
+
+    void Scheduler::runFrame()
+    {
+        AXIS_PROFILE_FRAME_MARK();
+        MemoryTracker::markFrame();
+        AXIS_PROFILE_SCOPE("Scheduler::runFrame");
+
+        if (m_graphDirty)
+        {
+            rebuildGraph();
+        }
+
+        std::memmove(m_recentDeltas + 1, m_recentDeltas, sizeof(double) * (kMaxUpdateInterval - 1));
+        m_recentDeltas[0] = m_deltaTime;
+
+        if (m_frameSignal.notify(m_jobs, &m_phaseCounter) != 0)
+        {
+            m_jobs.wait(m_phaseCounter);
+        }
+
+        for (PhaseId phase = 0; phase < m_phases.size(); ++phase)
+        {
+            m_currentPhase = phase;
+            runPhase(phase);
+        }
+
+        m_currentPhase = kInvalidPhase;
+        ++m_frameIndex;
+    }
+
+    void Scheduler::rebuildGraph()
+    {
+        m_nodes.clear();
+        m_successors.clear();
+
+        std::vector<std::vector<uint32_t>> successors;
+        std::vector<uint32_t> dependencies;
+
+        for (Phase& phase : m_phases)
+        {
+            phase.nodeBegin = static_cast<uint32_t>(m_nodes.size());
+
+            // 대상별 마지막 쓰기 노드와, 그 이후에 읽은 노드들.
+            std::unordered_map<AccessId, uint32_t> lastWriter;
+            std::unordered_map<AccessId, std::vector<uint32_t>> readersSinceWrite;
+
+            for (SystemId system : phase.systems)
+            {
+                const SystemEntry& entry = m_systems[system];
+                if (!entry.enabled)
+                {
+                    continue;
+                }
+
+                const uint32_t node = static_cast<uint32_t>(m_nodes.size());
+                m_nodes.push_back(Node{system, 0, 0, 0});
+                successors.emplace_back();
+
+                dependencies.clear();
+                for (AccessId read : entry.desc.reads)
+                {
+                    const auto writer = lastWriter.find(read);
+                    if (writer != lastWriter.end())
+                    {
+                        dependencies.push_back(writer->second);
+                    }
+                }
+                for (AccessId write : entry.desc.writes)
+                {
+                    const auto writer = lastWriter.find(write);
+                    if (writer != lastWriter.end())
+                    {
+                        dependencies.push_back(writer->second);
+                    }
+                    const auto readers = readersSinceWrite.find(write);
+                    if (readers != readersSinceWrite.end())
+                    {
+                        dependencies.insert(dependencies.end(), readers->second.begin(), readers->second.end());
+                    }
+                }
+
+                std::sort(dependencies.begin(), dependencies.end());
+                dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+                for (uint32_t dependency : dependencies)
+                {
+                    if (dependency != node)
+                    {
+                        successors[dependency].push_back(node);
+                        ++m_nodes[node].dependencyCount;
+                    }
+                }
+
+                for (AccessId read : entry.desc.reads)
+                {
+                    readersSinceWrite[read].push_back(node);
+                }
+                for (AccessId write : entry.desc.writes)
+                {
+                    lastWriter[write] = node;
+                    readersSinceWrite[write].clear();
+                }
+            }
+
+            phase.nodeCount = static_cast<uint32_t>(m_nodes.size()) - phase.nodeBegin;
+        }
+
+        for (uint32_t node = 0; node < m_nodes.size(); ++node)
+        {
+            m_nodes[node].successorBegin = static_cast<uint32_t>(m_successors.size());
+            m_nodes[node].successorCount = static_cast<uint32_t>(successors[node].size());
+            m_successors.insert(m_successors.end(), successors[node].begin(), successors[node].end());
+        }
+
+        m_runtime = std::make_unique<NodeRuntime[]>(m_nodes.size());
+        for (uint32_t node = 0; node < m_nodes.size(); ++node)
+        {
+            NodeRuntime& runtime = m_runtime[node];
+            runtime.owner = this;
+            runtime.node = node;
+            runtime.job.function = &Scheduler::nodeJob;
+            runtime.job.data = &runtime;
+            runtime.job.counter = &m_phaseCounter;
+        }
+
+        m_graphDirty = false;
+    }
+
+    TaskSignal::Awaiter Scheduler::nextPhase(PhaseId phase)
+    {
+        assert(phase < m_phases.size());
+        return m_phases[phase].signal->wait();
+    }
+
+    void Scheduler::runPhase(PhaseId phaseId)
+    {
+        const Phase& phase = m_phases[phaseId];
+
+        // 이 단계를 기다리던 태스크도 단계 카운터에 묶어 시스템과 함께 끝나게 합니다.
+        const uint32_t resumed = phase.signal->notify(m_jobs, &m_phaseCounter);
+        if (phase.nodeCount == 0)
+        {
+            if (resumed != 0)
+            {
+                m_jobs.wait(m_phaseCounter);
+            }
+            return;
+        }
+
+        AXIS_PROFILE_SCOPE(phase.name);
+
+        // 시스템이 하나뿐이면 작업 큐를 거칠 이유가 없습니다.
+        if (phase.nodeCount == 1)
+        {
+            runNode(phase.nodeBegin);
+            if (resumed != 0)
+            {
+                m_jobs.wait(m_phaseCounter);
+            }
+            return;
+        }
+
+        const uint32_t nodeEnd = phase.nodeBegin + phase.nodeCount;
+        for (uint32_t node = phase.nodeBegin; node < nodeEnd; ++node)
+        {
+            m_runtime[node].remaining.store(m_nodes[node].dependencyCount, std::memory_order_relaxed);
+        }
+        for (uint32_t node = phase.nodeBegin; node < nodeEnd; ++node)
+        {
+            if (m_nodes[node].dependencyCount == 0)
+            {
+                m_jobs.submit(m_runtime[node].job);
+            }
+        }
+
+        m_jobs.wait(m_phaseCounter);
+    }
+
+    void Scheduler::runNode(uint32_t nodeIndex)
+    {
+        const Node& node = m_nodes[nodeIndex];
+        SystemEntry& entry = m_systems[node.system];
+        const SystemDesc& desc = entry.desc;
+
+        // 노드는 한 프레임에 한 번, 한 스레드에서만 돌므로 항목의 실행 상태를 잠금 없이 고칩니다.
+        entry.elapsedTime += m_deltaTime;
+        const uint32_t step = static_cast<uint32_t>((m_frameIndex + entry.frameOffset) % desc.interval);
+        if (desc.staggered || step == 0)
+        {
+            SystemContext context;
+            context.frameIndex = m_frameIndex;
+            context.deltaTime = entry.elapsedTime;
+            context.alpha = m_alpha;
+            context.phase = desc.phase;
+            context.system = node.system;
+            context.threadIndex = m_jobs.currentThreadIndex();
+            context.jobs = &m_jobs;
+            context.userData = desc.userData;
+            context.cursor = &entry.cursor;
+            context.recentDeltas = m_recentDeltas;
+            if (desc.staggered)
+            {
+                context.deltaTime = context.deltaTimeOver(desc.interval);
+                context.slice = step;
+                context.sliceCount = desc.interval;
+            }
+
+            const uint64_t beginNs = Clock::nowNs();
+            context.deadlineNs = desc.budgetNs != 0 ? beginNs + desc.budgetNs : 0;
+            {
+                AXIS_PROFILE_SCOPE(systemName(node.system));
+                desc.function(context);
+            }
+            const uint64_t durationNs = Clock::nowNs() - beginNs;
+
+            SystemStats& stats = entry.stats;
+            ++stats.runs;
+            stats.lastNs = durationNs;
+            stats.totalNs += durationNs;
+            stats.maxNs = std::max(stats.maxNs, durationNs);
+            // overBudget()을 확인하는 간격만큼은 늘 넘으므로 예산의 1/8까지는 초과로 보지 않습니다.
+            if (desc.budgetNs != 0 && durationNs > desc.budgetNs + desc.budgetNs / 8)
+            {
+                // 이벤트 이름은 내보내기까지 살아 있어야 하므로 고정 문자열을 쓰고, 바로 앞의 시스템 범위로 구분합니다.
+                ++stats.overruns;
+                AXIS_PROFILE_INSTANT("Scheduler::budgetOverrun");
+            }
+            entry.elapsedTime = 0.0;
+        }
+        else
+        {
+            ++entry.stats.skipped;
+        }
+
+        for (uint32_t i = 0; i < node.successorCount; ++i)
+        {
+            const uint32_t successor = m_successors[node.successorBegin + i];
+            if (m_runtime[successor].remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                m_jobs.submit(m_runtime[successor].job);
+            }
+        }
+    }
+
+    void Scheduler::nodeJob(void* data)
+    {
+        NodeRuntime* runtime = static_cast<NodeRuntime*>(data);
+        runtime->owner->runNode(runtime->node);
+    }
+
+    std::string Scheduler::describe()
+    {
+        if (m_graphDirty)
+        {
+            rebuildGraph();
+        }
+
+        std::string text;
+        for (PhaseId phaseId = 0; phaseId < m_phases.size(); ++phaseId)
+        {
+            const Phase& phase = m_phases[phaseId];
+            text += "phase ";
+            text += std::to_string(phaseId);
+            text += " '";
+            text += phase.name;
+            text += "' (";
+            text += std::to_string(phase.nodeCount);
+            text += " systems)\n";
+
+            const uint32_t nodeEnd = phase.nodeBegin + phase.nodeCount;
+            for (uint32_t node = phase.nodeBegin; node < nodeEnd; ++node)
+            {
+                const SystemDesc& desc = m_systems[m_nodes[node].system].desc;
+                text += "  ";
+                text += systemName(m_nodes[node].system);
+                if (desc.interval > 1)
+                {
+                    text += desc.staggered ? "  [1/" : "  [every ";
+                    text += std::to_string(desc.interval);
+                    text += desc.staggered ? " per frame]" : " frames]";
+                }
+                if (desc.budgetNs != 0)
+                {
+                    text += "  [budget ";
+                    text += std::to_string(desc.budgetNs / 1000);
+                    text += " us]";
+                }
+
+                // 선행 노드는 successor 목록을 역으로 찾아 출력합니다. 진단용이므로 비용은 신경 쓰지 않습니다.
+                bool first = true;
+                for (uint32_t other = phase.nodeBegin; other < node; ++other)
+                {
+                    const Node& candidate = m_nodes[other];
+                    const auto begin = m_successors.begin() + candidate.successorBegin;
+                    const auto end = begin + candidate.successorCount;
+                    if (std::find(begin, end, node) != end)
+                    {
+                        text += first ? "  after: " : ", ";
+                        text += systemName(candidate.system);
+                        first = false;
+                    }
+                }
+                text += "\n";
+            }
+        }
+        return text;
+    }
+}
@@ -0,0 +1,420 @@
+#pragma once
+
+#include "axis/core/SpatialIndex.h"
+#include "axis/utils/Allocator.h"
+#include "axis/utils/FlatHashMap.h"
+
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define AXIS_SPATIAL_SSE 1
+    #include <emmintrin.h>
+#else
+    #define AXIS_SPATIAL_SSE 0
+#endif
+
+namespace axis::detail
+{
+    template <typename T>
+    using SpatialVector = std::vector<T, StlAllocator<T>>;
+
+    constexpr uint32_t kNoIndex = 0xFFFFFFFFu;
+
+    struct SpatialQuery
+    {
+        enum class Kind : uint8_t
+        {
+            Aabb,
+            Sphere,
+            Frustum,
+        };
+
+        Kind kind = Kind::Aabb;
+        Aabb aabb;
+        Sphere sphere;
+        const Frustum* frustum = nullptr;
+
+        // 노드/셀 범위 검사(스칼라). 보수적이어야 합니다.
+        bool overlaps(const Aabb& region) const
+        {
+            switch (kind)
+            {
+            case Kind::Aabb:
+                return aabb.overlaps(region);
+            case Kind::Sphere:
+                return intersects(sphere, region);
+            case Kind::Frustum:
+                return frustum->intersects(region);
+            }
+            return false;
+        }
+    };
+
+    // 노드 하나에 속한 객체들의 경계 상자(SoA).
+    // 배열 길이는 4의 배수로 유지해 SIMD 로드가 범위를 넘지 않게 합니다.
+    class SpatialBucket
+    {
+    public:
+        explicit SpatialBucket(Allocator& allocator)
+            : m_minX(allocator)
+            , m_minY(allocator)
+            , m_minZ(allocator)
+            , m_maxX(allocator)
+            , m_maxY(allocator)
+            , m_maxZ(allocator)
+            , m_objects(allocator)
+        {
+        }
+
+        uint32_t size() const { return static_cast<uint32_t>(m_objects.size()); }
+        uint32_t object(uint32_t slot) const { return m_objects[slot]; }
+
+        uint32_t add(uint32_t object, const Aabb& bounds)
+        {
+            const uint32_t slot = size();
+            m_objects.push_back(object);
+            const size_t padded = (m_objects.size() + 3) & ~size_t{3};
+            if (m_minX.size() < padded)
+            {
+                m_minX.resize(padded);
+                m_minY.resize(padded);
+                m_minZ.resize(padded);
+                m_maxX.resize(padded);
+                m_maxY.resize(padded);
+                m_maxZ.resize(padded);
+            }
+            set(slot, bounds);
+            return slot;
+        }
+
+        void set(uint32_t slot, const Aabb& bounds)
+        {
+            m_minX[slot] = bounds.min[0];
+            m_minY[slot] = bounds.min[1];
+            m_minZ[slot] = bounds.min[2];
+            m_maxX[slot] = bounds.max[0];
+            m_maxY[slot] = bounds.max[1];
+            m_maxZ[slot] = bounds.max[2];
+        }
+
+        // 마지막 항목을 slot으로 옮겨 채웁니다. 옮겨진 객체 인덱스를 반환합니다(없으면 kNoIndex).
+        uint32_t removeAt(uint32_t slot)
+        {
+            const uint32_t last = size() - 1;
+            uint32_t moved = kNoIndex;
+            if (slot != last)
+            {
+                moved = m_objects[last];
+                m_objects[slot] = moved;
+                m_minX[slot] = m_minX[last];
+                m_minY[slot] = m_minY[last];
+                m_minZ[slot] = m_minZ[last];
+                m_maxX[slot] = m_maxX[last];
+                m_maxY[slot] = m_maxY[last];
+                m_maxZ[slot] = m_maxZ[last];
+            }
+            m_objects.pop_back();
+            return moved;
+        }
+
+        // 질의와 겹치는 객체마다 emit(objectIndex)를 호출합니다.
+        template <typename Emit>
+        void query(const SpatialQuery& query, Emit&& emit) const
+        {
+            switch (query.kind)
+            {
+            case SpatialQuery::Kind::Aabb:
+                queryAabb(query.aabb, emit);
+                break;
+            case SpatialQuery::Kind::Sphere:
+                querySphere(query.sphere, emit);
+                break;
+            case SpatialQuery::Kind::Frustum:
+                queryFrustum(*query.frustum, emit);
+                break;
+            }
+        }
+
+    private:
+        template <typename Emit>
+        void emitMask(uint32_t base, uint32_t mask, Emit& emit) const
+        {
+            const uint32_t count = size();
+            if (base + 4 > count)
+            {
+                mask &= (1u << (count - base)) - 1u;
+            }
+            while (mask != 0)
+            {
+                emit(m_objects[base + static_cast<uint32_t>(std::countr_zero(mask))]);
+                mask &= mask - 1u;
+            }
+        }
+
+        template <typename Emit>
+        void queryAabb(const Aabb& box, Emit& emit) const
+        {
+            const uint32_t count = size();
+#if AXIS_SPATIAL_SSE
+            const __m128 qMinX = _mm_set1_ps(box.min[0]);
+            const __m128 qMinY = _mm_set1_ps(box.min[1]);
+            const __m128 qMinZ = _mm_set1_ps(box.min[2]);
+            const __m128 qMaxX = _mm_set1_ps(box.max[0]);
+            const __m128 qMaxY = _mm_set1_ps(box.max[1]);
+            const __m128 qMaxZ = _mm_set1_ps(box.max[2]);
+            for (uint32_t i = 0; i < count; i += 4)
+            {
+                __m128 hit = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&m_minX[i]), qMaxX),
+                                        _mm_cmpge_ps(_mm_loadu_ps(&m_maxX[i]), qMinX));
+                hit = _mm_and_ps(hit, _mm_cmple_ps(_mm_loadu_ps(&m_minY[i]), qMaxY));
+                hit = _mm_and_ps(hit, _mm_cmpge_ps(_mm_loadu_ps(&m_maxY[i]), qMinY));
+                hit = _mm_and_ps(hit, _mm_cmple_ps(_mm_loadu_ps(&m_minZ[i]), qMaxZ));
+                hit = _mm_and_ps(hit, _mm_cmpge_ps(_mm_loadu_ps(&m_maxZ[i]), qMinZ));
+                emitMask(i, static_cast<uint32_t>(_mm_movemask_ps(hit)), emit);
+            }
+#else
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                if (m_minX[i] <= box.max[0] && m_maxX[i] >= box.min[0] && m_minY[i] <= box.max[1] &&
+                    m_maxY[i] >= box.min[1] && m_minZ[i] <= box.max[2] && m_maxZ[i] >= box.min[2])
+                {
+                    emit(m_objects[i]);
+                }
+            }
+#endif
+        }
+
+        template <typename Emit>
+        void querySphere(const Sphere& sphere, Emit& emit) const
+        {
+            const uint32_t count = size();
+#if AXIS_SPATIAL_SSE
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 cx = _mm_set1_ps(sphere.center[0]);
+            const __m128 cy = _mm_set1_ps(sphere.center[1]);
+            const __m128 cz = _mm_set1_ps(sphere.center[2]);
+            const __m128 radiusSq = _mm_set1_ps(sphere.radius * sphere.radius);
+            for (uint32_t i = 0; i < count; i += 4)
+            {
+                // 구 중심에서 상자까지의 축별 거리: max(min - c, c - max, 0)
+                const __m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&m_minX[i]), cx),
+                                                        _mm_sub_ps(cx, _mm_loadu_ps(&m_maxX[i]))),
+                                             zero);
+                const __m128 dy = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&m_minY[i]), cy),
+                                                        _mm_sub_ps(cy, _mm_loadu_ps(&m_maxY[i]))),
+                                             zero);
+                const __m128 dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&m_minZ[i]), cz),
+                                                        _mm_sub_ps(cz, _mm_loadu_ps(&m_maxZ[i]))),
+                                             zero);
+                const __m128 distanceSq =
+                    _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+                emitMask(i, static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(distanceSq, radiusSq))), emit);
+            }
+#else
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                Aabb box;
+                box.min[0] = m_minX[i];
+                box.min[1] = m_minY[i];
+                box.min[2] = m_minZ[i];
+                box.max[0] = m_maxX[i];
+                box.max[1] = m_maxY[i];
+                box.max[2] = m_maxZ[i];
+                if (intersects(sphere, box))
+                {
+                    emit(m_objects[i]);
+                }
+            }
+#endif
+        }
+
+        template <typename Emit>
+        void queryFrustum(const Frustum& frustum, Emit& emit) const
+        {
+            const uint32_t count = size();
+#if AXIS_SPATIAL_SSE
+            // 평면마다 법선 부호로 양의 꼭짓점(p-vertex)에 쓸 배열을 미리 고릅니다.
+            const float* xs[6];
+            const float* ys[6];
+            const float* zs[6];
+            __m128 nx[6];
+            __m128 ny[6];
+            __m128 nz[6];
+            __m128 nd[6];
+            for (uint32_t p = 0; p < 6; ++p)
+            {
+                const float* plane = frustum.planes[p];
+                xs[p] = plane[0] >= 0.0f ? m_maxX.data() : m_minX.data();
+                ys[p] = plane[1] >= 0.0f ? m_maxY.data() : m_minY.data();
+                zs[p] = plane[2] >= 0.0f ? m_maxZ.data() : m_minZ.data();
+                nx[p] = _mm_set1_ps(plane[0]);
+                ny[p] = _mm_set1_ps(plane[1]);
+                nz[p] = _mm_set1_ps(plane[2]);
+                nd[p] = _mm_set1_ps(plane[3]);
+            }
+
+            const __m128 zero = _mm_setzero_ps();
+            for (uint32_t i = 0; i < count; i += 4)
+            {
+                __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+                for (uint32_t p = 0; p < 6; ++p)
+                {
+                    const __m128 distance = _mm_add_ps(
+                        _mm_add_ps(_mm_mul_ps(nx[p], _mm_loadu_ps(xs[p] + i)), _mm_mul_ps(ny[p], _mm_loadu_ps(ys[p] + i))),
+                        _mm_add_ps(_mm_mul_ps(nz[p], _mm_loadu_ps(zs[p] + i)), nd[p]));
+                    inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, zero));
+                }
+                emitMask(i, static_cast<uint32_t>(_mm_movemask_ps(inside)), emit);
+            }
+#else
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                Aabb box;
+                box.min[0] = m_minX[i];
+                box.min[1] = m_minY[i];
+                box.min[2] = m_minZ[i];
+                box.max[0] = m_maxX[i];
+                box.max[1] = m_maxY[i];
+                box.max[2] = m_maxZ[i];
+                if (frustum.intersects(box))
+                {
+                    emit(m_objects[i]);
+                }
+            }
+#endif
+        }
+
+        SpatialVector<float> m_minX;
+        SpatialVector<float> m_minY;
+        SpatialVector<float> m_minZ;
+        SpatialVector<float> m_maxX;
+        SpatialVector<float> m_maxY;
+        SpatialVector<float> m_maxZ;
+        SpatialVector<uint32_t> m_objects;
+    };
+
+    // 백엔드 공통부: 객체 테이블과 버킷 관리, 질의 실행.
+    // 파생 클래스는 객체를 어느 버킷에 둘지와 질의 시 어떤 버킷을 방문할지만 정합니다.
+    class SpatialBackend
+    {
+    public:
+        using BucketVisitor = void (*)(uint32_t bucket, void* context);
+
+        explicit SpatialBackend(Allocator& allocator);
+        virtual ~SpatialBackend() = default;
+
+        SpatialHandle insert(const Aabb& bounds, uint64_t userData);
+        void move(SpatialHandle handle, const Aabb& bounds);
+        void remove(SpatialHandle handle);
+        uint32_t query(const SpatialQuery& query, std::vector<uint64_t>& out) const;
+
+        const Aabb& bounds(SpatialHandle handle) const { return m_objects[handle].bounds; }
+        uint64_t userData(SpatialHandle handle) const { return m_objects[handle].userData; }
+        SpatialIndexStats stats() const;
+
+    protected:
+        // 객체를 둘 버킷. 필요하면 노드/셀을 만듭니다.
+        virtual uint32_t place(const Aabb& bounds) = 0;
+        // 새로 배치한다면 current에 그대로 놓일지.
+        virtual bool fits(uint32_t current, const Aabb& bounds) const = 0;
+        virtual void forEachCandidate(const SpatialQuery& query, BucketVisitor visitor, void* context) const = 0;
+        virtual void onAdded(uint32_t) {}
+        virtual void onRemoved(uint32_t) {}
+
+        uint32_t createBucket();
+        uint32_t bucketSize(uint32_t bucket) const { return m_buckets[bucket].size(); }
+
+        Allocator& m_allocator;
+
+    private:
+        struct ObjectRecord
+        {
+            Aabb bounds;
+            uint64_t userData = 0;
+            uint32_t bucket = kNoIndex;
+            uint32_t slot = kNoIndex;
+        };
+
+        void attach(uint32_t object, uint32_t bucket);
+        void detach(uint32_t object);
+        static void visitBucket(uint32_t bucket, void* context);
+
+        SpatialVector<SpatialBucket> m_buckets;
+        SpatialVector<ObjectRecord> m_objects;
+        SpatialVector<uint32_t> m_freeObjects;
+        uint32_t m_objectCount = 0;
+        uint32_t m_relocations = 0;
+    };
+
+    class LooseOctree final : public SpatialBackend
+    {
+    public:
+        LooseOctree(Allocator& allocator, const Aabb& worldBounds, uint32_t maxDepth);
+
+    protected:
+        uint32_t place(const Aabb& bounds) override;
+        bool fits(uint32_t current, const Aabb& bounds) const override;
+        void forEachCandidate(const SpatialQuery& query, BucketVisitor visitor, void* context) const override;
+        void onAdded(uint32_t bucket) override;
+        void onRemoved(uint32_t bucket) override;
+
+    private:
+        static constexpr uint32_t kMaxDepth = 16;
+
+        // 노드 인덱스와 버킷 인덱스는 같습니다.
+        struct Node
+        {
+            float center[3];
+            float halfSize;
+            uint32_t children[8];
+            uint32_t parent;
+            uint32_t depth;
+            uint32_t subtreeCount;
+        };
+
+        // 객체가 놓일 가장 깊은 노드. 아직 없는 자식이 필요하면 kNoIndex를 반환하고 그 부모와 팔분면을 알려 줍니다.
+        uint32_t findNode(const Aabb& bounds, uint32_t* outParent = nullptr, uint32_t* outOctant = nullptr) const;
+        uint32_t createNode(uint32_t parent, uint32_t octant);
+        Aabb looseBounds(const Node& node) const;
+
+        SpatialVector<Node> m_nodes;
+        uint32_t m_maxDepth;
+    };
+
+    class HashGrid final : public SpatialBackend
+    {
+    public:
+        HashGrid(Allocator& allocator, float cellSize);
+
+    protected:
+        uint32_t place(const Aabb& bounds) override;
+        bool fits(uint32_t current, const Aabb& bounds) const override;
+        void forEachCandidate(const SpatialQuery& query, BucketVisitor visitor, void* context) const override;
+        void onRemoved(uint32_t bucket) override;
+
+    private:
+        struct Cell
+        {
+            int32_t coord[3];
+            uint64_t key;
+            bool occupied;
+        };
+
+        // 셀에 넣기에는 너무 큰 객체들이 모이는 버킷. 모든 질의에서 방문합니다.
+        static constexpr uint32_t kOversizedBucket = 0;
+
+        bool isOversized(const Aabb& bounds) const { return bounds.maxHalfExtent() > m_cellSize; }
+        void cellOf(const Aabb& bounds, int32_t coord[3]) const;
+        static uint64_t packKey(const int32_t coord[3]);
+        Aabb cellReach(const Cell& cell) const;
+
+        float m_cellSize;
+        float m_inverseCellSize;
+        SpatialVector<Cell> m_cells; // 버킷 인덱스로 접근. 0번은 사용하지 않습니다.
+        FlatHashMap<uint64_t, uint32_t> m_lookup;
+        std::vector<uint32_t> m_freeCells;
+        uint32_t m_occupiedCells = 0;
+    };
+}
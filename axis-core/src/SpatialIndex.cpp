@@ -0,0 +1,616 @@
+#include "axis/core/SpatialIndex.h"
+
+#include "SpatialBackend.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace axis
+{
+    namespace detail
+    {
+        namespace
+        {
+            struct QueryContext
+            {
+                const SpatialQuery* query;
+                std::vector<uint64_t>* out;
+                const void* backend;
+            };
+
+            bool contains(const Aabb& outer, const Aabb& inner)
+            {
+                return outer.min[0] <= inner.min[0] && outer.min[1] <= inner.min[1] && outer.min[2] <= inner.min[2] &&
+                       outer.max[0] >= inner.max[0] && outer.max[1] >= inner.max[1] && outer.max[2] >= inner.max[2];
+            }
+        }
+
+        // --- SpatialBackend ---
+
+        SpatialBackend::SpatialBackend(Allocator& allocator)
+            : m_allocator(allocator)
+            , m_buckets(allocator)
+            , m_objects(allocator)
+            , m_freeObjects(allocator)
+        {
+        }
+
+        SpatialHandle SpatialBackend::insert(const Aabb& bounds, uint64_t userData)
+        {
+            uint32_t object;
+            if (!m_freeObjects.empty())
+            {
+                object = m_freeObjects.back();
+                m_freeObjects.pop_back();
+            }
+            else
+            {
+                object = static_cast<uint32_t>(m_objects.size());
+                m_objects.emplace_back();
+            }
+
+            ObjectRecord& record = m_objects[object];
+            record.bounds = bounds;
+            record.userData = userData;
+            attach(object, place(bounds));
+            ++m_objectCount;
+            return object;
+        }
+
+        void SpatialBackend::move(SpatialHandle handle, const Aabb& bounds)
+        {
+            assert(handle < m_objects.size() && m_objects[handle].bucket != kNoIndex && "유효하지 않은 공간 핸들입니다");
+
+            ObjectRecord& record = m_objects[handle];
+            record.bounds = bounds;
+            if (fits(record.bucket, bounds))
+            {
+                m_buckets[record.bucket].set(record.slot, bounds);
+                return;
+            }
+
+            detach(handle);
+            attach(handle, place(bounds));
+            ++m_relocations;
+        }
+
+        void SpatialBackend::remove(SpatialHandle handle)
+        {
+            assert(handle < m_objects.size() && m_objects[handle].bucket != kNoIndex && "유효하지 않은 공간 핸들입니다");
+
+            detach(handle);
+            m_freeObjects.push_back(handle);
+            --m_objectCount;
+        }
+
+        uint32_t SpatialBackend::query(const SpatialQuery& query, std::vector<uint64_t>& out) const
+        {
+            const size_t before = out.size();
+            QueryContext context{&query, &out, this};
+            forEachCandidate(query, &SpatialBackend::visitBucket, &context);
+            return static_cast<uint32_t>(out.size() - before);
+        }
+
+        void SpatialBackend::visitBucket(uint32_t bucket, void* context)
+        {
+            QueryContext& query = *static_cast<QueryContext*>(context);
+            const SpatialBackend& backend = *static_cast<const SpatialBackend*>(query.backend);
+            std::vector<uint64_t>& out = *query.out;
+            backend.m_buckets[bucket].query(*query.query,
+                                            [&](uint32_t object) { out.push_back(backend.m_objects[object].userData); });
+        }
+
+        SpatialIndexStats SpatialBackend::stats() const
+        {
+            SpatialIndexStats stats;
+            stats.objectCount = m_objectCount;
+            stats.bucketCount = static_cast<uint32_t>(m_buckets.size());
+            for (const SpatialBucket& bucket : m_buckets)
+            {
+                stats.nonEmptyBuckets += bucket.size() != 0 ? 1u : 0u;
+            }
+            stats.relocations = m_relocations;
+            return stats;
+        }
+
+        uint32_t SpatialBackend::createBucket()
+        {
+            m_buckets.emplace_back(m_allocator);
+            return static_cast<uint32_t>(m_buckets.size() - 1);
+        }
+
+        void SpatialBackend::attach(uint32_t object, uint32_t bucket)
+        {
+            ObjectRecord& record = m_objects[object];
+            record.bucket = bucket;
+            record.slot = m_buckets[bucket].add(object, record.bounds);
+            onAdded(bucket);
+        }
+
+        void SpatialBackend::detach(uint32_t object)
+        {
+            ObjectRecord& record = m_objects[object];
+            const uint32_t bucket = record.bucket;
+            const uint32_t moved = m_buckets[bucket].removeAt(record.slot);
+            if (moved != kNoIndex)
+            {
+                m_objects[moved].slot = record.slot;
+            }
+            record.bucket = kNoIndex;
+            record.slot = kNoIndex;
+            onRemoved(bucket);
+        }
+
+        // --- LooseOctree ---
+
+        LooseOctree::LooseOctree(Allocator& allocator, const Aabb& worldBounds, uint32_t maxDepth)
+            : SpatialBackend(allocator)
+            , m_nodes(allocator)
+            , m_maxDepth(std::min(maxDepth, kMaxDepth))
+        {
+            Node root;
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                root.center[axis] = worldBounds.center(axis);
+            }
+            root.halfSize = worldBounds.maxHalfExtent();
+            std::fill(std::begin(root.children), std::end(root.children), kNoIndex);
+            root.parent = kNoIndex;
+            root.depth = 0;
+            root.subtreeCount = 0;
+            m_nodes.push_back(root);
+
+            const uint32_t bucket = createBucket();
+            assert(bucket == 0);
+            (void)bucket;
+        }
+
+        uint32_t LooseOctree::place(const Aabb& bounds)
+        {
+            // 없는 자식을 만날 때마다 하나씩 만들고 다시 내려갑니다. 깊이가 작아 반복 비용은 무시할 만합니다.
+            uint32_t parent = 0;
+            uint32_t octant = 0;
+            uint32_t node = findNode(bounds, &parent, &octant);
+            while (node == kNoIndex)
+            {
+                createNode(parent, octant);
+                node = findNode(bounds, &parent, &octant);
+            }
+            return node;
+        }
+
+        bool LooseOctree::fits(uint32_t current, const Aabb& bounds) const
+        {
+            // 느슨한 경계 안에 있는 동안은 머무릅니다. 노드 경계 근처에서 오가는 객체의 재배치를 줄입니다.
+            if (current != 0)
+            {
+                return contains(looseBounds(m_nodes[current]), bounds);
+            }
+            return findNode(bounds) == 0;
+        }
+
+        void LooseOctree::onAdded(uint32_t bucket)
+        {
+            for (uint32_t node = bucket; node != kNoIndex; node = m_nodes[node].parent)
+            {
+                ++m_nodes[node].subtreeCount;
+            }
+        }
+
+        void LooseOctree::onRemoved(uint32_t bucket)
+        {
+            for (uint32_t node = bucket; node != kNoIndex; node = m_nodes[node].parent)
+            {
+                --m_nodes[node].subtreeCount;
+            }
+        }
+
+        void LooseOctree::forEachCandidate(const SpatialQuery& query, BucketVisitor visitor, void* context) const
+        {
+            // 깊이마다 형제 7개가 남을 수 있으므로 8 * (깊이 + 1)이면 충분합니다.
+            uint32_t stack[8 * (kMaxDepth + 1)];
+            uint32_t top = 0;
+            stack[top++] = 0;
+
+            while (top != 0)
+            {
+                const uint32_t index = stack[--top];
+                const Node& node = m_nodes[index];
+                if (node.subtreeCount == 0)
+                {
+                    continue;
+                }
+                // 루트는 월드 범위 밖 객체도 담으므로 경계 검사를 하지 않습니다.
+                if (index != 0 && !query.overlaps(looseBounds(node)))
+                {
+                    continue;
+                }
+
+                if (bucketSize(index) != 0)
+                {
+                    visitor(index, context);
+                }
+                for (uint32_t child : node.children)
+                {
+                    if (child != kNoIndex)
+                    {
+                        stack[top++] = child;
+                    }
+                }
+            }
+        }
+
+        uint32_t LooseOctree::findNode(const Aabb& bounds, uint32_t* outParent, uint32_t* outOctant) const
+        {
+            const float extent = bounds.maxHalfExtent();
+            const float center[3] = {bounds.center(0), bounds.center(1), bounds.center(2)};
+
+            uint32_t index = 0;
+            while (m_nodes[index].depth < m_maxDepth)
+            {
+                const Node& node = m_nodes[index];
+                if (extent > node.halfSize * 0.5f)
+                {
+                    break;
+                }
+
+                // 중심이 노드 밖이면 느슨한 자식 경계가 객체를 덮지 못합니다(루트에서만 생깁니다).
+                uint32_t octant = 0;
+                bool inside = true;
+                for (uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    const float offset = center[axis] - node.center[axis];
+                    inside = inside && std::fabs(offset) <= node.halfSize;
+                    octant |= offset >= 0.0f ? (1u << axis) : 0u;
+                }
+                if (!inside)
+                {
+                    break;
+                }
+
+                const uint32_t child = node.children[octant];
+                if (child == kNoIndex)
+                {
+                    if (outParent != nullptr)
+                    {
+                        *outParent = index;
+                        *outOctant = octant;
+                    }
+                    return kNoIndex;
+                }
+                index = child;
+            }
+            return index;
+        }
+
+        uint32_t LooseOctree::createNode(uint32_t parent, uint32_t octant)
+        {
+            const Node& parentNode = m_nodes[parent];
+            Node node;
+            node.halfSize = parentNode.halfSize * 0.5f;
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                const float sign = (octant & (1u << axis)) != 0 ? 1.0f : -1.0f;
+                node.center[axis] = parentNode.center[axis] + sign * node.halfSize;
+            }
+            std::fill(std::begin(node.children), std::end(node.children), kNoIndex);
+            node.parent = parent;
+            node.depth = parentNode.depth + 1;
+            node.subtreeCount = 0;
+
+            const uint32_t index = static_cast<uint32_t>(m_nodes.size());
+            m_nodes.push_back(node);
+            m_nodes[parent].children[octant] = index;
+
+            const uint32_t bucket = createBucket();
+            assert(bucket == index && "노드와 버킷 인덱스가 어긋났습니다");
+            (void)bucket;
+            return index;
+        }
+
+        Aabb LooseOctree::looseBounds(const Node& node) const
+        {
+            // 느슨함 계수 2: 노드 경계를 각 방향으로 halfSize만큼 넓힙니다.
+            const float reach = node.halfSize * 2.0f;
+            Aabb box;
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                box.min[axis] = node.center[axis] - reach;
+                box.max[axis] = node.center[axis] + reach;
+            }
+            return box;
+        }
+
+        // --- HashGrid ---
+
+        HashGrid::HashGrid(Allocator& allocator, float cellSize)
+            : SpatialBackend(allocator)
+            , m_cellSize(cellSize)
+            , m_inverseCellSize(1.0f / cellSize)
+            , m_cells(allocator)
+        {
+            assert(cellSize > 0.0f);
+
+            const uint32_t bucket = createBucket();
+            assert(bucket == kOversizedBucket);
+            (void)bucket;
+            m_cells.push_back(Cell{{0, 0, 0}, 0, false});
+        }
+
+        uint32_t HashGrid::place(const Aabb& bounds)
+        {
+            if (isOversized(bounds))
+            {
+                return kOversizedBucket;
+            }
+
+            int32_t coord[3];
+            cellOf(bounds, coord);
+            const uint64_t key = packKey(coord);
+            const auto found = m_lookup.find(key);
+            if (found != m_lookup.end())
+            {
+                return found->second;
+            }
+
+            uint32_t bucket;
+            if (!m_freeCells.empty())
+            {
+                bucket = m_freeCells.back();
+                m_freeCells.pop_back();
+            }
+            else
+            {
+                bucket = createBucket();
+                m_cells.emplace_back();
+            }
+
+            Cell& cell = m_cells[bucket];
+            cell.coord[0] = coord[0];
+            cell.coord[1] = coord[1];
+            cell.coord[2] = coord[2];
+            cell.key = key;
+            cell.occupied = true;
+            m_lookup.emplace(key, bucket);
+            ++m_occupiedCells;
+            return bucket;
+        }
+
+        bool HashGrid::fits(uint32_t current, const Aabb& bounds) const
+        {
+            if (isOversized(bounds))
+            {
+                return current == kOversizedBucket;
+            }
+            if (current == kOversizedBucket)
+            {
+                return false;
+            }
+
+            int32_t coord[3];
+            cellOf(bounds, coord);
+            const Cell& cell = m_cells[current];
+            return cell.coord[0] == coord[0] && cell.coord[1] == coord[1] && cell.coord[2] == coord[2];
+        }
+
+        void HashGrid::onRemoved(uint32_t bucket)
+        {
+            if (bucket == kOversizedBucket || bucketSize(bucket) != 0)
+            {
+                return;
+            }
+
+            // 빈 셀은 해시에서 빼고 버킷을 재사용합니다. 배열 자체는 용량을 유지합니다.
+            Cell& cell = m_cells[bucket];
+            m_lookup.erase(cell.key);
+            cell.occupied = false;
+            m_freeCells.push_back(bucket);
+            --m_occupiedCells;
+        }
+
+        void HashGrid::forEachCandidate(const SpatialQuery& query, BucketVisitor visitor, void* context) const
+        {
+            if (bucketSize(kOversizedBucket) != 0)
+            {
+                visitor(kOversizedBucket, context);
+            }
+            if (m_occupiedCells == 0)
+            {
+                return;
+            }
+
+            Aabb range;
+            bool bounded = true;
+            switch (query.kind)
+            {
+            case SpatialQuery::Kind::Aabb:
+                range = query.aabb;
+                break;
+            case SpatialQuery::Kind::Sphere:
+                for (uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    range.min[axis] = query.sphere.center[axis] - query.sphere.radius;
+                    range.max[axis] = query.sphere.center[axis] + query.sphere.radius;
+                }
+                break;
+            case SpatialQuery::Kind::Frustum:
+                // 절두체는 범위가 넓고 기울어 있어 점유 셀을 전부 검사하는 편이 낫습니다.
+                bounded = false;
+                break;
+            }
+
+            // 셀 (c)에 속한 객체는 [c - 1, c + 2) * cellSize 안에 있으므로, 찾을 셀 범위를 그만큼 넓힙니다.
+            int32_t begin[3] = {};
+            int32_t end[3] = {};
+            if (bounded)
+            {
+                double cellCount = 1.0;
+                for (uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    const double low = std::floor(static_cast<double>(range.min[axis]) * m_inverseCellSize) - 2.0;
+                    const double high = std::floor(static_cast<double>(range.max[axis]) * m_inverseCellSize) + 1.0;
+                    cellCount *= high - low + 1.0;
+                    begin[axis] = static_cast<int32_t>(std::max(low, -1048576.0));
+                    end[axis] = static_cast<int32_t>(std::min(high, 1048575.0));
+                }
+                bounded = cellCount <= static_cast<double>(m_occupiedCells);
+            }
+
+            if (!bounded)
+            {
+                for (uint32_t bucket = 1; bucket < m_cells.size(); ++bucket)
+                {
+                    const Cell& cell = m_cells[bucket];
+                    if (cell.occupied && query.overlaps(cellReach(cell)))
+                    {
+                        visitor(bucket, context);
+                    }
+                }
+                return;
+            }
+
+            int32_t coord[3];
+            for (coord[2] = begin[2]; coord[2] <= end[2]; ++coord[2])
+            {
+                for (coord[1] = begin[1]; coord[1] <= end[1]; ++coord[1])
+                {
+                    for (coord[0] = begin[0]; coord[0] <= end[0]; ++coord[0])
+                    {
+                        const auto found = m_lookup.find(packKey(coord));
+                        if (found != m_lookup.end())
+                        {
+                            visitor(found->second, context);
+                        }
+                    }
+                }
+            }
+        }
+
+        void HashGrid::cellOf(const Aabb& bounds, int32_t coord[3]) const
+        {
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                coord[axis] = static_cast<int32_t>(std::floor(bounds.center(axis) * m_inverseCellSize));
+            }
+        }
+
+        uint64_t HashGrid::packKey(const int32_t coord[3])
+        {
+            // 축마다 21비트. 좌표는 ±2^20 셀 안에 있다고 가정합니다.
+            constexpr uint64_t kMask = (1ull << 21) - 1;
+            const uint64_t x = static_cast<uint64_t>(coord[0] + (1 << 20)) & kMask;
+            const uint64_t y = static_cast<uint64_t>(coord[1] + (1 << 20)) & kMask;
+            const uint64_t z = static_cast<uint64_t>(coord[2] + (1 << 20)) & kMask;
+            return x | (y << 21) | (z << 42);
+        }
+
+        Aabb HashGrid::cellReach(const Cell& cell) const
+        {
+            Aabb box;
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                box.min[axis] = (static_cast<float>(cell.coord[axis]) - 1.0f) * m_cellSize;
+                box.max[axis] = (static_cast<float>(cell.coord[axis]) + 2.0f) * m_cellSize;
+            }
+            return box;
+        }
+    }
+
+    // --- SpatialIndex ---
+
+    SpatialIndex::SpatialIndex(const SpatialIndexDesc& desc)
+        : m_backendType(desc.backend)
+    {
+        Allocator& allocator = desc.allocator != nullptr ? *desc.allocator : defaultAllocator();
+        switch (desc.backend)
+        {
+        case SpatialBackendType::LooseOctree:
+            m_backend = std::make_unique<detail::LooseOctree>(allocator, desc.worldBounds, desc.maxDepth);
+            break;
+        case SpatialBackendType::HashGrid:
+            m_backend = std::make_unique<detail::HashGrid>(allocator, desc.cellSize);
+            break;
+        }
+    }
+
+    SpatialIndex::~SpatialIndex() = default;
+
+    SpatialHandle SpatialIndex::insert(const Aabb& bounds, uint64_t userData)
+    {
+        return m_backend->insert(bounds, userData);
+    }
+
+    void SpatialIndex::move(SpatialHandle handle, const Aabb& bounds)
+    {
+        m_backend->move(handle, bounds);
+    }
+
+    void SpatialIndex::remove(SpatialHandle handle)
+    {
+        m_backend->remove(handle);
+    }
+
+    void SpatialIndex::insert(const Aabb* bounds, const uint64_t* userData, uint32_t count, SpatialHandle* outHandles)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            outHandles[i] = m_backend->insert(bounds[i], userData[i]);
+        }
+    }
+
+    void SpatialIndex::move(const SpatialUpdate* updates, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            m_backend->move(updates[i].handle, updates[i].bounds);
+        }
+    }
+
+    void SpatialIndex::remove(const SpatialHandle* handles, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            m_backend->remove(handles[i]);
+        }
+    }
+
+    uint32_t SpatialIndex::query(const Aabb& bounds, std::vector<uint64_t>& out) const
+    {
+        detail::SpatialQuery query;
+        query.kind = detail::SpatialQuery::Kind::Aabb;
+        query.aabb = bounds;
+        return m_backend->query(query, out);
+    }
+
+    uint32_t SpatialIndex::query(const Sphere& sphere, std::vector<uint64_t>& out) const
+    {
+        detail::SpatialQuery query;
+        query.kind = detail::SpatialQuery::Kind::Sphere;
+        query.sphere = sphere;
+        return m_backend->query(query, out);
+    }
+
+    uint32_t SpatialIndex::query(const Frustum& frustum, std::vector<uint64_t>& out) const
+    {
+        detail::SpatialQuery query;
+        query.kind = detail::SpatialQuery::Kind::Frustum;
+        query.frustum = &frustum;
+        return m_backend->query(query, out);
+    }
+
+    const Aabb& SpatialIndex::bounds(SpatialHandle handle) const
+    {
+        return m_backend->bounds(handle);
+    }
+
+    uint64_t SpatialIndex::userData(SpatialHandle handle) const
+    {
+        return m_backend->userData(handle);
+    }
+
+    SpatialIndexStats SpatialIndex::stats() const
+    {
+        return m_backend->stats();
+    }
+}
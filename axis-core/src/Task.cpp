@@ -0,0 +1,184 @@
+#include "axis/core/Task.h"
+
+#include "axis/utils/PoolAllocator.h"
+
+#include <thread>
+
+namespace axis
+{
+    namespace
+    {
+        BudgetTag taskTag()
+        {
+            static const BudgetTag s_tag = MemoryBudget::registerTag("core.tasks", MemoryAxis::Time);
+            return s_tag;
+        }
+
+        // 프레임 크기 등급. 대부분의 태스크 프레임은 몇백 바이트이므로 작은 등급을 촘촘히 둡니다.
+        constexpr size_t kFrameClassSizes[] = {128, 256, 512, 1024, 2048, 4096};
+        constexpr uint32_t kFrameClassCount = sizeof(kFrameClassSizes) / sizeof(kFrameClassSizes[0]);
+        constexpr uint32_t kFramesPerPage = 64;
+
+        struct FramePools
+        {
+            FramePools()
+                : pools{{kFrameClassSizes[0], kDefaultAlignment, kFramesPerPage, taskTag()},
+                        {kFrameClassSizes[1], kDefaultAlignment, kFramesPerPage, taskTag()},
+                        {kFrameClassSizes[2], kDefaultAlignment, kFramesPerPage, taskTag()},
+                        {kFrameClassSizes[3], kDefaultAlignment, kFramesPerPage, taskTag()},
+                        {kFrameClassSizes[4], kDefaultAlignment, kFramesPerPage / 2, taskTag()},
+                        {kFrameClassSizes[5], kDefaultAlignment, kFramesPerPage / 4, taskTag()}}
+            {
+            }
+
+            PoolAllocator pools[kFrameClassCount];
+        };
+
+        FramePools& framePools()
+        {
+            static FramePools s_pools;
+            return s_pools;
+        }
+
+        uint32_t frameClass(size_t size)
+        {
+            for (uint32_t i = 0; i < kFrameClassCount; ++i)
+            {
+                if (size <= kFrameClassSizes[i])
+                {
+                    return i;
+                }
+            }
+            return kFrameClassCount;
+        }
+
+        void completeIo(IoRequest& request)
+        {
+            // I/O 스레드(또는 IoJobBridge 작업)에서 불립니다. 사용자 코드는 여기서 실행하지 않고 작업 큐로 넘깁니다.
+            IoAwaiter* awaiter = static_cast<IoAwaiter*>(request.userData);
+            awaiter->jobs.submit(awaiter->job);
+        }
+    }
+
+    namespace detail
+    {
+        void* allocateTaskFrame(size_t size)
+        {
+            const uint32_t index = frameClass(size);
+            void* frame = index < kFrameClassCount ? framePools().pools[index].allocateBlock() : nullptr;
+            if (frame == nullptr)
+            {
+                frame = defaultAllocator().allocate(size);
+            }
+            assert(frame != nullptr && "코루틴 프레임을 할당하지 못했습니다");
+            return frame;
+        }
+
+        void deallocateTaskFrame(void* frame, size_t size)
+        {
+            const uint32_t index = frameClass(size);
+            if (index < kFrameClassCount)
+            {
+                framePools().pools[index].deallocateBlock(frame);
+            }
+            else
+            {
+                defaultAllocator().deallocate(frame, size);
+            }
+        }
+
+        void resumeTaskJob(void* data)
+        {
+            std::coroutine_handle<>::from_address(data).resume();
+        }
+    }
+
+    void JobSwitchAwaiter::await_suspend(std::coroutine_handle<> handle)
+    {
+        job = detail::makeResumeJob(handle);
+        jobs.submit(job);
+    }
+
+    bool JobCounterAwaiter::await_suspend(std::coroutine_handle<> handle)
+    {
+        job = detail::makeResumeJob(handle);
+        counter.continuation = &job;
+
+        // 비트를 세운 뒤 남은 작업이 있으면 마지막 작업을 끝낸 스레드가 continuation을 제출합니다.
+        const uint32_t previous = counter.pending.fetch_add(JobCounter::kContinuationBit, std::memory_order_acq_rel);
+        assert((previous & JobCounter::kContinuationBit) == 0 && "한 카운터를 여러 태스크가 기다리고 있습니다");
+        if (previous == 0)
+        {
+            // 그 사이에 모두 끝났습니다. 비트를 되돌리고 중단하지 않습니다.
+            counter.continuation = nullptr;
+            counter.pending.store(0, std::memory_order_release);
+            return false;
+        }
+        return true;
+    }
+
+    void IoAwaiter::await_suspend(std::coroutine_handle<> handle)
+    {
+        assert(request.callback == nullptr && "readAsync에 넘긴 요청에 이미 콜백이 있습니다");
+        job = detail::makeResumeJob(handle);
+        request.callback = &completeIo;
+        request.userData = this;
+        io.submit(request);
+    }
+
+    IoStatus IoAwaiter::await_resume() const
+    {
+        // completeIoRequest는 콜백 뒤에 status를 공개합니다. 재개한 쪽이 요청 메모리를 바로 해제할 수 있도록
+        // 그 짧은 틈을 기다립니다.
+        while (!request.isDone())
+        {
+            std::this_thread::yield();
+        }
+        request.callback = nullptr;
+        request.userData = nullptr;
+        return request.result;
+    }
+
+    TaskSignal::~TaskSignal()
+    {
+        assert(!hasWaiters() && "태스크가 기다리는 상태로 신호를 파괴했습니다");
+    }
+
+    void TaskSignal::Awaiter::await_suspend(std::coroutine_handle<> handle)
+    {
+        job = detail::makeResumeJob(handle);
+        Awaiter* head = signal.m_head.load(std::memory_order_relaxed);
+        do
+        {
+            next = head;
+        } while (
+            !signal.m_head.compare_exchange_weak(head, this, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    uint32_t TaskSignal::notify(JobSystem& jobs, JobCounter* counter)
+    {
+        Awaiter* waiter = m_head.exchange(nullptr, std::memory_order_acquire);
+
+        // 스택은 마지막에 기다린 태스크부터 쌓여 있으므로 뒤집어 기다린 순서대로 재개합니다.
+        Awaiter* ordered = nullptr;
+        while (waiter != nullptr)
+        {
+            Awaiter* next = waiter->next;
+            waiter->next = ordered;
+            ordered = waiter;
+            waiter = next;
+        }
+
+        uint32_t count = 0;
+        while (ordered != nullptr)
+        {
+            // 제출한 순간 재개되어 awaiter가 사라질 수 있으므로 다음 항목을 먼저 읽습니다.
+            Awaiter* next = ordered->next;
+            ordered->job.counter = counter;
+            jobs.submit(ordered->job);
+            ordered = next;
+            ++count;
+        }
+        return count;
+    }
+}
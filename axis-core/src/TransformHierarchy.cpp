@@ -0,0 +1,395 @@
+#include "axis/core/TransformHierarchy.h"
+
+#include "axis/core/JobSystem.h"
+#include "axis/utils/Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+
+namespace axis
+{
+    TransformHierarchy::TransformHierarchy(Allocator& allocator)
+        : m_slots(allocator)
+        , m_freeSlots(allocator)
+        , m_position(allocator)
+        , m_rotation(allocator)
+        , m_scale(allocator)
+        , m_world(allocator)
+        , m_parent(allocator)
+        , m_slotOf(allocator)
+        , m_dirty(allocator)
+        , m_updatedStamp(allocator)
+        , m_levelBegin(allocator)
+    {
+    }
+
+    bool TransformHierarchy::resolve(TransformHandle node, uint32_t& slot) const
+    {
+        if (node.index >= m_slots.size())
+        {
+            return false;
+        }
+        const Slot& entry = m_slots[node.index];
+        if (!entry.alive || entry.generation != node.generation)
+        {
+            return false;
+        }
+        slot = node.index;
+        return true;
+    }
+
+    bool TransformHierarchy::isValid(TransformHandle node) const
+    {
+        uint32_t slot;
+        return resolve(node, slot);
+    }
+
+    TransformHandle TransformHierarchy::create(TransformHandle parent, const TransformState& local)
+    {
+        uint32_t parentSlot = kNoNode;
+        if (parent.isValid() && !resolve(parent, parentSlot))
+        {
+            assert(false && "지워진 부모 노드입니다");
+            return {};
+        }
+
+        uint32_t slot;
+        if (!m_freeSlots.empty())
+        {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            slot = static_cast<uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        }
+
+        // 새 노드는 배열 끝에 붙이고, 순서는 다음 update에서 바로잡습니다.
+        Slot& entry = m_slots[slot];
+        entry.alive = true;
+        entry.dense = static_cast<uint32_t>(m_world.size());
+        entry.firstChild = kNoNode;
+        link(slot, parentSlot);
+
+        m_position.push_back(local.position);
+        m_rotation.push_back(local.rotation);
+        m_scale.push_back(local.scale);
+        m_world.push_back(Mat4::identity());
+        m_parent.push_back(kNoNode);
+        m_slotOf.push_back(slot);
+        m_dirty.push_back(1);
+        m_updatedStamp.push_back(0);
+        m_orderDirty = true;
+
+        return TransformHandle{slot, entry.generation};
+    }
+
+    void TransformHierarchy::destroy(TransformHandle node)
+    {
+        uint32_t root;
+        if (!resolve(node, root))
+        {
+            return;
+        }
+        unlink(root);
+
+        // 자손을 깊이 우선으로 모두 해제합니다. 배열 항목은 다음 순서 재구성에서 빠집니다.
+        std::vector<uint32_t> stack{root};
+        while (!stack.empty())
+        {
+            const uint32_t slot = stack.back();
+            stack.pop_back();
+
+            Slot& entry = m_slots[slot];
+            for (uint32_t child = entry.firstChild; child != kNoNode; child = m_slots[child].nextSibling)
+            {
+                stack.push_back(child);
+            }
+            entry.alive = false;
+            entry.generation = entry.generation + 1 != 0 ? entry.generation + 1 : 1;
+            entry.firstChild = kNoNode;
+            m_freeSlots.push_back(slot);
+        }
+        m_orderDirty = true;
+    }
+
+    bool TransformHierarchy::setParent(TransformHandle node, TransformHandle parent)
+    {
+        uint32_t slot;
+        if (!resolve(node, slot))
+        {
+            return false;
+        }
+
+        uint32_t parentSlot = kNoNode;
+        if (parent.isValid())
+        {
+            if (!resolve(parent, parentSlot))
+            {
+                return false;
+            }
+            for (uint32_t ancestor = parentSlot; ancestor != kNoNode; ancestor = m_slots[ancestor].parent)
+            {
+                if (ancestor == slot)
+                {
+                    return false;
+                }
+            }
+        }
+
+        if (m_slots[slot].parent == parentSlot)
+        {
+            return true;
+        }
+
+        unlink(slot);
+        link(slot, parentSlot);
+        m_dirty[m_slots[slot].dense] = 1;
+        m_orderDirty = true;
+        return true;
+    }
+
+    TransformHandle TransformHierarchy::parent(TransformHandle node) const
+    {
+        uint32_t slot;
+        if (!resolve(node, slot) || m_slots[slot].parent == kNoNode)
+        {
+            return {};
+        }
+        const uint32_t parentSlot = m_slots[slot].parent;
+        return TransformHandle{parentSlot, m_slots[parentSlot].generation};
+    }
+
+    void TransformHierarchy::setLocal(TransformHandle node, const TransformState& local)
+    {
+        uint32_t slot;
+        if (!resolve(node, slot))
+        {
+            assert(false && "지워진 노드입니다");
+            return;
+        }
+
+        const Slot& entry = m_slots[slot];
+        m_position[entry.dense] = local.position;
+        m_rotation[entry.dense] = local.rotation;
+        m_scale[entry.dense] = local.scale;
+        m_dirty[entry.dense] = 1;
+        m_firstDirtyLevel = std::min(m_firstDirtyLevel, entry.depth);
+    }
+
+    TransformState TransformHierarchy::local(TransformHandle node) const
+    {
+        TransformState state;
+        uint32_t slot;
+        if (!resolve(node, slot))
+        {
+            assert(false && "지워진 노드입니다");
+            return state;
+        }
+
+        const uint32_t dense = m_slots[slot].dense;
+        state.position = m_position[dense];
+        state.rotation = m_rotation[dense];
+        state.scale = m_scale[dense];
+        return state;
+    }
+
+    const Mat4& TransformHierarchy::world(TransformHandle node) const
+    {
+        static const Mat4 s_identity = Mat4::identity();
+
+        uint32_t slot;
+        const bool valid = resolve(node, slot);
+        assert(valid && "지워진 노드입니다");
+        return valid ? m_world[m_slots[slot].dense] : s_identity;
+    }
+
+    uint32_t TransformHierarchy::denseIndex(TransformHandle node) const
+    {
+        uint32_t slot;
+        return resolve(node, slot) && !m_orderDirty ? m_slots[slot].dense : kNoNode;
+    }
+
+    TransformHandle TransformHierarchy::handleAt(uint32_t denseIndex) const
+    {
+        assert(denseIndex < m_slotOf.size() && "TransformHierarchy 범위를 벗어났습니다");
+        const uint32_t slot = m_slotOf[denseIndex];
+        return TransformHandle{slot, m_slots[slot].generation};
+    }
+
+    void TransformHierarchy::link(uint32_t slot, uint32_t parent)
+    {
+        Slot& entry = m_slots[slot];
+        uint32_t& head = parent != kNoNode ? m_slots[parent].firstChild : m_firstRoot;
+        entry.parent = parent;
+        entry.previousSibling = kNoNode;
+        entry.nextSibling = head;
+        if (head != kNoNode)
+        {
+            m_slots[head].previousSibling = slot;
+        }
+        head = slot;
+        entry.depth = parent != kNoNode ? m_slots[parent].depth + 1 : 0;
+    }
+
+    void TransformHierarchy::unlink(uint32_t slot)
+    {
+        Slot& entry = m_slots[slot];
+        if (entry.previousSibling != kNoNode)
+        {
+            m_slots[entry.previousSibling].nextSibling = entry.nextSibling;
+        }
+        else if (entry.parent != kNoNode)
+        {
+            m_slots[entry.parent].firstChild = entry.nextSibling;
+        }
+        else
+        {
+            m_firstRoot = entry.nextSibling;
+        }
+        if (entry.nextSibling != kNoNode)
+        {
+            m_slots[entry.nextSibling].previousSibling = entry.previousSibling;
+        }
+        entry.parent = kNoNode;
+        entry.nextSibling = kNoNode;
+        entry.previousSibling = kNoNode;
+    }
+
+    void TransformHierarchy::rebuildOrder()
+    {
+        AXIS_PROFILE_SCOPE("TransformHierarchy::rebuildOrder");
+
+        // 루트들에서 동시에 너비 우선 탐색하면 방문 순서가 곧 깊이 순서이고, 형제는 이웃하게 놓입니다.
+        Array<uint32_t> order(m_slots.get_allocator());
+        order.reserve(m_slots.size() - m_freeSlots.size());
+        for (uint32_t root = m_firstRoot; root != kNoNode; root = m_slots[root].nextSibling)
+        {
+            order.push_back(root);
+        }
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            for (uint32_t child = m_slots[order[i]].firstChild; child != kNoNode; child = m_slots[child].nextSibling)
+            {
+                order.push_back(child);
+            }
+        }
+
+        const size_t count = order.size();
+        Array<Vec3> position(count, m_position.get_allocator());
+        Array<Quat> rotation(count, m_rotation.get_allocator());
+        Array<Vec3> scale(count, m_scale.get_allocator());
+        Array<Mat4> world(count, m_world.get_allocator());
+        Array<uint32_t> parent(count, m_parent.get_allocator());
+        Array<uint8_t> dirty(count, m_dirty.get_allocator());
+        Array<uint32_t> updatedStamp(count, m_updatedStamp.get_allocator());
+
+        m_levelBegin.clear();
+        m_firstDirtyLevel = kNoNode;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const uint32_t slot = order[i];
+            Slot& entry = m_slots[slot];
+            const uint32_t from = entry.dense;
+
+            entry.depth = entry.parent != kNoNode ? m_slots[entry.parent].depth + 1 : 0;
+            if (entry.depth == m_levelBegin.size())
+            {
+                m_levelBegin.push_back(i);
+            }
+
+            position[i] = m_position[from];
+            rotation[i] = m_rotation[from];
+            scale[i] = m_scale[from];
+            world[i] = m_world[from];
+            dirty[i] = m_dirty[from];
+            updatedStamp[i] = m_updatedStamp[from];
+            // 부모는 이미 앞에서 새 위치를 받았습니다.
+            parent[i] = entry.parent != kNoNode ? m_slots[entry.parent].dense : kNoNode;
+            entry.dense = i;
+
+            if (dirty[i] != 0)
+            {
+                m_firstDirtyLevel = std::min(m_firstDirtyLevel, entry.depth);
+            }
+        }
+        m_levelBegin.push_back(static_cast<uint32_t>(count));
+
+        m_position.swap(position);
+        m_rotation.swap(rotation);
+        m_scale.swap(scale);
+        m_world.swap(world);
+        m_parent.swap(parent);
+        m_slotOf.swap(order);
+        m_dirty.swap(dirty);
+        m_updatedStamp.swap(updatedStamp);
+        m_orderDirty = false;
+    }
+
+    uint32_t TransformHierarchy::updateRange(uint32_t begin, uint32_t end)
+    {
+        uint32_t updated = 0;
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            const uint32_t parent = m_parent[i];
+            const bool parentUpdated = parent != kNoNode && m_updatedStamp[parent] == m_stamp;
+            if (m_dirty[i] == 0 && !parentUpdated)
+            {
+                continue;
+            }
+
+            const Mat4 local = Mat4::fromTrs(m_position[i], m_rotation[i], m_scale[i]);
+            m_world[i] = parent != kNoNode ? m_world[parent] * local : local;
+            m_dirty[i] = 0;
+            m_updatedStamp[i] = m_stamp;
+            ++updated;
+        }
+        return updated;
+    }
+
+    void TransformHierarchy::update(JobSystem* jobs, uint32_t batchSize)
+    {
+        AXIS_PROFILE_SCOPE("TransformHierarchy::update");
+
+        m_stats = {};
+        if (m_orderDirty)
+        {
+            rebuildOrder();
+            m_stats.reordered = true;
+        }
+
+        if (++m_stamp == 0)
+        {
+            std::fill(m_updatedStamp.begin(), m_updatedStamp.end(), 0u);
+            m_stamp = 1;
+        }
+
+        const uint32_t levelCount = static_cast<uint32_t>(m_levelBegin.size()) - (m_levelBegin.empty() ? 0 : 1);
+        const uint32_t firstLevel = std::min(m_firstDirtyLevel, levelCount);
+        m_stats.nodeCount = nodeCount();
+        m_stats.levelCount = levelCount;
+        m_stats.skippedLevels = firstLevel;
+
+        // 바뀐 노드보다 얕은 단계에는 다시 계산할 것이 없습니다.
+        for (uint32_t level = firstLevel; level < levelCount; ++level)
+        {
+            const uint32_t begin = m_levelBegin[level];
+            const uint32_t end = m_levelBegin[level + 1];
+            if (jobs == nullptr || end - begin <= batchSize)
+            {
+                m_stats.updatedNodes += updateRange(begin, end);
+                continue;
+            }
+
+            std::atomic<uint32_t> updated{0};
+            jobs->parallelFor(end - begin, batchSize, [&](uint32_t first, uint32_t last) {
+                const uint32_t count = updateRange(begin + first, begin + last);
+                updated.fetch_add(count, std::memory_order_relaxed);
+            });
+            m_stats.updatedNodes += updated.load(std::memory_order_relaxed);
+        }
+        m_firstDirtyLevel = kNoNode;
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "axis/core/CacheLine.h"
+#include "axis/core/JobSystem.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace axis::detail
+{
+    // Chase-Lev 작업 덱 (Lê et al. 2013, C11 메모리 모델 버전).
+    // push/pop은 소유 스레드만, steal은 모든 스레드가 호출할 수 있습니다.
+    // 용량은 고정이며 가득 차면 push가 false를 반환합니다.
+    class WorkStealingDeque
+    {
+    public:
+        explicit WorkStealingDeque(uint32_t capacity)
+            : m_mask(static_cast<int64_t>(capacity) - 1)
+            , m_buffer(new std::atomic<Job*>[capacity])
+        {
+        }
+
+        bool push(Job* job)
+        {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+            const int64_t top = m_top.load(std::memory_order_acquire);
+            if (bottom - top > m_mask)
+            {
+                return false;
+            }
+
+            m_buffer[bottom & m_mask].store(job, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        Job* pop()
+        {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = m_top.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            Job* job = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+            if (top == bottom)
+            {
+                // 마지막 항목은 steal과 경쟁합니다.
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed))
+                {
+                    job = nullptr;
+                }
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return job;
+        }
+
+        Job* steal()
+        {
+            int64_t top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+            if (top >= bottom)
+            {
+                return nullptr;
+            }
+
+            Job* job = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                               std::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+            return job;
+        }
+
+    private:
+        // top은 도둑 스레드가, bottom은 소유 스레드가 주로 갱신하므로 캐시 라인을 분리합니다.
+        alignas(kCacheLineSize) std::atomic<int64_t> m_top{0};
+        alignas(kCacheLineSize) std::atomic<int64_t> m_bottom{0};
+        alignas(kCacheLineSize) const int64_t m_mask;
+        std::unique_ptr<std::atomic<Job*>[]> m_buffer;
+    };
+}
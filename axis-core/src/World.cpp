@@ -0,0 +1,393 @@
+#include "axis/core/World.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace axis
+{
+    namespace
+    {
+        constexpr uint32_t alignUp(uint32_t value, uint32_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        // capacity개를 담을 때 필요한 청크 크기를 계산하고 열 오프셋을 채웁니다.
+        uint32_t layoutChunk(Archetype& archetype, uint32_t capacity)
+        {
+            uint32_t offset = kChunkHeaderSize;
+            archetype.entityOffset = offset;
+            offset += capacity * static_cast<uint32_t>(sizeof(Entity));
+
+            for (size_t column = 0; column < archetype.components.size(); ++column)
+            {
+                const ComponentInfo& info = ComponentRegistry::info(archetype.components[column]);
+                offset = alignUp(offset, info.alignment);
+                archetype.columnOffsets[column] = offset;
+                offset += capacity * info.size;
+            }
+            return offset;
+        }
+    }
+
+    World::World(const WorldDesc& desc)
+        : m_chunkAllocator(desc.chunkAllocator)
+        , m_records(desc.allocator != nullptr ? *desc.allocator : defaultAllocator())
+        , m_freeRecords(desc.allocator != nullptr ? *desc.allocator : defaultAllocator())
+    {
+        if (m_chunkAllocator == nullptr)
+        {
+            static const BudgetTag s_worldTag = MemoryBudget::registerTag("core.world", MemoryAxis::Data);
+            m_ownedChunkPool = std::make_unique<PoolAllocator>(kChunkSize, 64, desc.chunksPerPage, s_worldTag);
+            m_chunkAllocator = m_ownedChunkPool.get();
+        }
+        findOrCreateArchetype(ComponentMask{});
+    }
+
+    World::~World()
+    {
+        for (const std::unique_ptr<Archetype>& archetype : m_archetypes)
+        {
+            for (Chunk* chunk : archetype->chunks)
+            {
+                for (size_t column = 0; column < archetype->components.size(); ++column)
+                {
+                    const ComponentInfo& info = ComponentRegistry::info(archetype->components[column]);
+                    if (info.trivial)
+                    {
+                        continue;
+                    }
+                    for (uint32_t row = 0; row < chunk->count; ++row)
+                    {
+                        info.destruct(archetype->element(chunk, static_cast<uint32_t>(column), row));
+                    }
+                }
+                freeChunk(chunk);
+            }
+        }
+    }
+
+    Entity World::createEntity()
+    {
+        assert(m_iterationDepth == 0 && "순회 중에는 엔티티를 만들 수 없습니다");
+
+        uint32_t index;
+        if (!m_freeRecords.empty())
+        {
+            index = m_freeRecords.back();
+            m_freeRecords.pop_back();
+        }
+        else
+        {
+            index = static_cast<uint32_t>(m_records.size());
+            m_records.emplace_back();
+        }
+
+        EntityRecord& entry = m_records[index];
+        const Entity entity{index, entry.generation};
+        entry.archetype = 0;
+        allocateRow(*m_archetypes[0], entity, entry.chunk, entry.row);
+        ++m_aliveCount;
+        return entity;
+    }
+
+    void World::destroyEntity(Entity entity)
+    {
+        assert(m_iterationDepth == 0 && "순회 중에는 엔티티를 제거할 수 없습니다");
+        if (!isAlive(entity))
+        {
+            return;
+        }
+
+        EntityRecord& entry = m_records[entity.index];
+        removeRow(*m_archetypes[entry.archetype], entry.chunk, entry.row, true);
+        entry.archetype = kDeadArchetype;
+        ++entry.generation;
+        m_freeRecords.push_back(entity.index);
+        --m_aliveCount;
+    }
+
+    bool World::isAlive(Entity entity) const
+    {
+        return record(entity) != nullptr;
+    }
+
+    void* World::addComponent(Entity entity, ComponentId id, bool& existed)
+    {
+        assert(m_iterationDepth == 0 && "순회 중에는 컴포넌트를 추가할 수 없습니다");
+        existed = false;
+        if (!isAlive(entity) || id >= kMaxComponentTypes)
+        {
+            return nullptr;
+        }
+
+        EntityRecord& entry = m_records[entity.index];
+        if (m_archetypes[entry.archetype]->mask.test(id))
+        {
+            existed = true;
+            return getComponent(entity, id);
+        }
+
+        moveEntity(entity, archetypeWith(entry.archetype, id));
+        return getComponent(entity, id);
+    }
+
+    void World::removeComponent(Entity entity, ComponentId id)
+    {
+        assert(m_iterationDepth == 0 && "순회 중에는 컴포넌트를 제거할 수 없습니다");
+        if (!isAlive(entity) || id >= kMaxComponentTypes)
+        {
+            return;
+        }
+
+        const EntityRecord& entry = m_records[entity.index];
+        if (!m_archetypes[entry.archetype]->mask.test(id))
+        {
+            return;
+        }
+        moveEntity(entity, archetypeWithout(entry.archetype, id));
+    }
+
+    void* World::getComponent(Entity entity, ComponentId id) const
+    {
+        const EntityRecord* entry = record(entity);
+        if (entry == nullptr)
+        {
+            return nullptr;
+        }
+
+        const Archetype& archetype = *m_archetypes[entry->archetype];
+        const uint32_t column = archetype.column(id);
+        if (column == Archetype::kNoColumn)
+        {
+            return nullptr;
+        }
+        return archetype.element(archetype.chunks[entry->chunk], column, entry->row);
+    }
+
+    const World::EntityRecord* World::record(Entity entity) const
+    {
+        if (entity.index >= m_records.size())
+        {
+            return nullptr;
+        }
+        const EntityRecord& entry = m_records[entity.index];
+        if (entry.archetype == kDeadArchetype || entry.generation != entity.generation)
+        {
+            return nullptr;
+        }
+        return &entry;
+    }
+
+    uint32_t World::findOrCreateArchetype(const ComponentMask& mask)
+    {
+        const auto found = m_archetypeLookup.find(mask);
+        if (found != m_archetypeLookup.end())
+        {
+            return found->second;
+        }
+
+        auto archetype = std::make_unique<Archetype>();
+        archetype->index = static_cast<uint32_t>(m_archetypes.size());
+        archetype->mask = mask;
+        std::fill(std::begin(archetype->columnLookup), std::end(archetype->columnLookup), Archetype::kNoColumn);
+
+        const uint32_t registered = ComponentRegistry::count();
+        for (ComponentId id = 0; id < registered; ++id)
+        {
+            if (mask.test(id))
+            {
+                archetype->columnLookup[id] = static_cast<uint16_t>(archetype->components.size());
+                archetype->components.push_back(id);
+                archetype->columnSizes.push_back(ComponentRegistry::info(id).size);
+            }
+        }
+        archetype->columnOffsets.resize(archetype->components.size());
+
+        uint32_t bytesPerEntity = static_cast<uint32_t>(sizeof(Entity));
+        for (uint32_t size : archetype->columnSizes)
+        {
+            bytesPerEntity += size;
+        }
+
+        // 정렬 패딩 때문에 단순 나눗셈 결과가 넘칠 수 있으므로 들어갈 때까지 줄입니다.
+        uint32_t capacity = (kChunkSize - kChunkHeaderSize) / bytesPerEntity;
+        while (capacity > 0 && layoutChunk(*archetype, capacity) > kChunkSize)
+        {
+            --capacity;
+        }
+        assert(capacity > 0 && "컴포넌트 조합이 청크 하나에 들어가지 않습니다");
+        archetype->chunkCapacity = capacity;
+
+        const uint32_t index = archetype->index;
+        m_archetypes.push_back(std::move(archetype));
+        m_archetypeLookup.emplace(mask, index);
+        return index;
+    }
+
+    uint32_t World::archetypeWith(uint32_t from, ComponentId id)
+    {
+        const auto edge = m_archetypes[from]->addEdges.find(id);
+        if (edge != m_archetypes[from]->addEdges.end())
+        {
+            return edge->second;
+        }
+
+        ComponentMask mask = m_archetypes[from]->mask;
+        mask.set(id);
+        const uint32_t to = findOrCreateArchetype(mask);
+        m_archetypes[from]->addEdges.emplace(id, to);
+        m_archetypes[to]->removeEdges.emplace(id, from);
+        return to;
+    }
+
+    uint32_t World::archetypeWithout(uint32_t from, ComponentId id)
+    {
+        const auto edge = m_archetypes[from]->removeEdges.find(id);
+        if (edge != m_archetypes[from]->removeEdges.end())
+        {
+            return edge->second;
+        }
+
+        ComponentMask mask = m_archetypes[from]->mask;
+        mask.reset(id);
+        const uint32_t to = findOrCreateArchetype(mask);
+        m_archetypes[from]->removeEdges.emplace(id, to);
+        m_archetypes[to]->addEdges.emplace(id, from);
+        return to;
+    }
+
+    void World::allocateRow(Archetype& archetype, Entity entity, uint32_t& outChunk, uint32_t& outRow)
+    {
+        if (archetype.chunks.empty() || archetype.chunks.back()->count == archetype.chunkCapacity)
+        {
+            archetype.chunks.push_back(allocateChunk(archetype.index));
+        }
+
+        Chunk* chunk = archetype.chunks.back();
+        outChunk = static_cast<uint32_t>(archetype.chunks.size() - 1);
+        outRow = chunk->count++;
+        archetype.entities(chunk)[outRow] = entity;
+        ++archetype.entityCount;
+    }
+
+    void World::removeRow(Archetype& archetype, uint32_t chunkIndex, uint32_t row, bool destruct)
+    {
+        // 아키타입의 마지막 엔티티를 빈자리로 옮겨 청크를 항상 빽빽하게 유지합니다.
+        Chunk* chunk = archetype.chunks[chunkIndex];
+        Chunk* lastChunk = archetype.chunks.back();
+        const uint32_t lastChunkIndex = static_cast<uint32_t>(archetype.chunks.size() - 1);
+        const uint32_t lastRow = lastChunk->count - 1;
+        const bool isLast = chunkIndex == lastChunkIndex && row == lastRow;
+
+        for (size_t column = 0; column < archetype.components.size(); ++column)
+        {
+            const ComponentInfo& info = ComponentRegistry::info(archetype.components[column]);
+            if (info.size == 0)
+            {
+                continue;
+            }
+
+            void* dst = archetype.element(chunk, static_cast<uint32_t>(column), row);
+            if (destruct && !info.trivial)
+            {
+                info.destruct(dst);
+            }
+            if (!isLast)
+            {
+                void* src = archetype.element(lastChunk, static_cast<uint32_t>(column), lastRow);
+                if (info.trivial)
+                {
+                    std::memcpy(dst, src, info.size);
+                }
+                else
+                {
+                    info.relocate(dst, src);
+                }
+            }
+        }
+
+        if (!isLast)
+        {
+            const Entity moved = archetype.entities(lastChunk)[lastRow];
+            archetype.entities(chunk)[row] = moved;
+            m_records[moved.index].chunk = chunkIndex;
+            m_records[moved.index].row = row;
+        }
+
+        --lastChunk->count;
+        --archetype.entityCount;
+        if (lastChunk->count == 0)
+        {
+            freeChunk(lastChunk);
+            archetype.chunks.pop_back();
+        }
+    }
+
+    void World::moveEntity(Entity entity, uint32_t toArchetype)
+    {
+        EntityRecord& entry = m_records[entity.index];
+        Archetype& from = *m_archetypes[entry.archetype];
+        Archetype& to = *m_archetypes[toArchetype];
+
+        uint32_t toChunk = 0;
+        uint32_t toRow = 0;
+        allocateRow(to, entity, toChunk, toRow);
+
+        // 양쪽에 모두 있는 컴포넌트는 옮기고, 대상에 없는 컴포넌트는 파괴합니다.
+        Chunk* fromChunk = from.chunks[entry.chunk];
+        for (size_t column = 0; column < from.components.size(); ++column)
+        {
+            const ComponentId id = from.components[column];
+            const ComponentInfo& info = ComponentRegistry::info(id);
+            if (info.size == 0)
+            {
+                continue;
+            }
+
+            void* src = from.element(fromChunk, static_cast<uint32_t>(column), entry.row);
+            const uint32_t toColumn = to.column(id);
+            if (toColumn == Archetype::kNoColumn)
+            {
+                if (!info.trivial)
+                {
+                    info.destruct(src);
+                }
+                continue;
+            }
+
+            void* dst = to.element(to.chunks[toChunk], toColumn, toRow);
+            if (info.trivial)
+            {
+                std::memcpy(dst, src, info.size);
+            }
+            else
+            {
+                info.relocate(dst, src);
+            }
+        }
+
+        removeRow(from, entry.chunk, entry.row, false);
+
+        entry.archetype = toArchetype;
+        entry.chunk = toChunk;
+        entry.row = toRow;
+    }
+
+    Chunk* World::allocateChunk(uint32_t archetype)
+    {
+        void* memory = m_chunkAllocator->allocate(kChunkSize, 64);
+        assert(memory != nullptr && "청크 할당에 실패했습니다");
+        Chunk* chunk = new (memory) Chunk();
+        chunk->archetype = archetype;
+        ++m_chunkCount;
+        return chunk;
+    }
+
+    void World::freeChunk(Chunk* chunk)
+    {
+        chunk->~Chunk();
+        m_chunkAllocator->deallocate(chunk, kChunkSize);
+        --m_chunkCount;
+    }
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "axis/platform/Export.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace axis
+{
+    // 값이 작을수록 먼저 커널에 넘어갑니다. 같은 우선순위 안에서는 제출 순서를 따릅니다.
+    enum class IoPriority : uint8_t
+    {
+        Critical,
+        High,
+        Normal,
+        Low,
+    };
+
+    constexpr uint32_t kIoPriorityCount = 4;
+
+    enum class IoStatus : uint8_t
+    {
+        Idle,
+        Pending,
+        Completed,
+        Failed,
+        Cancelled,
+    };
+
+    enum class AsyncIoBackend : uint8_t
+    {
+        Iocp,
+        DirectStorage,
+        IoUring,
+        // 비동기 커널 인터페이스가 없을 때 I/O 스레드가 pread로 처리합니다.
+        Blocking,
+    };
+
+    using AsyncFileId = uint32_t;
+
+    constexpr AsyncFileId kInvalidAsyncFile = 0xFFFFFFFFu;
+
+    struct IoRequest;
+
+    // 완료 콜백. 실행기가 없으면 I/O 스레드에서 바로 호출되므로 짧게 끝나야 합니다.
+    using IoCallback = void (*)(IoRequest& request);
+
+    // 완료된 요청을 어디서 처리할지 정합니다. 실행기는 나중에 반드시 completeIoRequest를 호출해야 합니다.
+    using IoCompletionExecutor = void (*)(IoRequest& request, void* context);
+
+    // 비동기 읽기 요청. 메모리는 호출자 소유이며 status가 Pending이 아닌 값이 될 때까지 유지되어야 합니다.
+    // 데이터는 buffer로 바로 읽히며 중간 복사는 없습니다.
+    struct IoRequest
+    {
+        AsyncFileId file = kInvalidAsyncFile;
+        uint64_t offset = 0;
+        uint32_t size = 0;
+        void* buffer = nullptr;
+        IoPriority priority = IoPriority::Normal;
+        IoCallback callback = nullptr;
+        void* userData = nullptr;
+
+        // 결과. 콜백 안에서는 result를, 다른 스레드에서는 status를 읽습니다.
+        uint32_t bytesRead = 0;
+        int32_t error = 0;
+        IoStatus result = IoStatus::Idle;
+        std::atomic<IoStatus> status{IoStatus::Idle};
+
+        bool isDone() const
+        {
+            const IoStatus current = status.load(std::memory_order_acquire);
+            return current != IoStatus::Pending && current != IoStatus::Idle;
+        }
+
+        // 내부 사용. 백엔드별 요청 상태(OVERLAPPED 등)를 담습니다.
+        IoRequest* next = nullptr;
+        intptr_t nativeFile = 0;
+        alignas(8) unsigned char backendStorage[48] = {};
+    };
+
+    // 콜백을 호출한 뒤 status를 공개합니다. status를 본 스레드는 요청 메모리를 해제해도 됩니다.
+    inline void completeIoRequest(IoRequest& request)
+    {
+        if (request.callback != nullptr)
+        {
+            request.callback(request);
+        }
+        request.status.store(request.result, std::memory_order_release);
+    }
+
+    struct AsyncIoDesc
+    {
+        // 커널에 동시에 넘겨 둘 최대 요청 수. 나머지는 우선순위 큐에서 기다립니다.
+        uint32_t queueDepth = 64;
+
+        // AXIS_PLATFORM_WITH_DIRECTSTORAGE로 빌드한 Windows에서만 의미가 있습니다.
+        bool preferDirectStorage = false;
+
+        // nullptr이면 콜백을 I/O 스레드에서 호출합니다.
+        IoCompletionExecutor executor = nullptr;
+        void* executorContext = nullptr;
+    };
+
+    namespace detail
+    {
+        class IoBackend;
+    }
+
+    // 우선순위 비동기 파일 읽기.
+    //
+    // 제출된 요청은 우선순위 큐에 쌓이고, 전용 I/O 스레드가 queueDepth만큼만 커널에 넘깁니다.
+    // 따라서 늦게 들어온 높은 우선순위 요청이 대기 중인 낮은 요청보다 먼저 처리됩니다.
+    // 백엔드: Windows는 IOCP(선택적으로 DirectStorage), Linux는 io_uring, 그 외에는 Blocking.
+    class AXIS_PLATFORM_API AsyncIo
+    {
+    public:
+        explicit AsyncIo(const AsyncIoDesc& desc = {});
+        ~AsyncIo();
+
+        AsyncIo(const AsyncIo&) = delete;
+        AsyncIo& operator=(const AsyncIo&) = delete;
+
+        // 경로는 UTF-8입니다. unbuffered면 OS 캐시를 거치지 않으며,
+        // 오프셋/크기/버퍼 주소가 모두 unbufferedAlignment()의 배수여야 합니다.
+        AsyncFileId openFile(const char* path, bool unbuffered = false);
+        // 진행 중인 요청이 없는 파일만 닫을 수 있습니다.
+        void closeFile(AsyncFileId file);
+        uint64_t fileSize(AsyncFileId file) const;
+
+        // 여러 요청을 한 번에 넣으면 잠금과 I/O 스레드 깨우기가 한 번으로 줄어듭니다.
+        void submit(IoRequest& request);
+        void submit(IoRequest* requests, uint32_t count);
+
+        AsyncIoBackend backend() const;
+        static uint32_t unbufferedAlignment() { return 4096; }
+
+        // 대기 중 + 진행 중인 요청 수.
+        uint32_t outstanding() const { return m_outstanding.load(std::memory_order_relaxed); }
+
+    private:
+        struct FileEntry
+        {
+            intptr_t handle = 0;
+            uint64_t size = 0;
+            bool open = false;
+        };
+
+        struct PendingList
+        {
+            IoRequest* head = nullptr;
+            IoRequest* tail = nullptr;
+        };
+
+        void ioThreadMain();
+        uint32_t dequeuePending(IoRequest** out, uint32_t maxCount);
+        void finish(IoRequest& request);
+
+        std::unique_ptr<detail::IoBackend> m_backend;
+        IoCompletionExecutor m_executor;
+        void* m_executorContext;
+        uint32_t m_queueDepth;
+
+        mutable std::mutex m_fileMutex;
+        std::vector<FileEntry> m_files;
+        std::vector<AsyncFileId> m_freeFiles;
+
+        std::mutex m_pendingMutex;
+        PendingList m_pending[kIoPriorityCount];
+        std::atomic<bool> m_wakeRequested{false};
+
+        std::atomic<uint32_t> m_outstanding{0};
+        std::atomic<bool> m_running{true};
+        std::thread m_thread;
+    };
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "axis/platform/Export.h"
+
+#include <cstdint>
+
+namespace axis
+{
+    enum class ClockSource : uint8_t
+    {
+        // 불변(invariant) TSC. 코어와 전원 상태에 관계없이 일정한 속도로 올라갑니다.
+        Tsc,
+        // QueryPerformanceCounter (Windows).
+        Qpc,
+        // clock_gettime(CLOCK_MONOTONIC) (POSIX). 눈금이 곧 나노초입니다.
+        Monotonic,
+    };
+
+    // 고해상도 단조 시계.
+    //
+    // x86에서 CPU가 불변 TSC를 지원하면 rdtsc를 그대로 읽으므로 시스템 호출도 vDSO 경유도 없습니다.
+    // TSC 주파수는 처음 사용할 때 OS 시계와 짧게(약 20ms) 비교해 보정하며, 그 결과는 프로세스 동안 유지됩니다.
+    // TSC를 믿을 수 없으면 OS의 단조 시계로 대신합니다. 어느 쪽이든 모든 스레드에서 같은 축의 값을 돌려줍니다.
+    class AXIS_PLATFORM_API Clock
+    {
+    public:
+        // 원시 눈금. 단위는 frequency()이며 시작점은 정해져 있지 않습니다.
+        static uint64_t ticks();
+        // 초당 눈금 수.
+        static uint64_t frequency();
+        static ClockSource source();
+
+        static uint64_t ticksToNs(uint64_t ticks);
+        static double ticksToSeconds(uint64_t ticks) { return static_cast<double>(ticks) / frequency(); }
+
+        static uint64_t nowNs() { return ticksToNs(ticks()); }
+    };
+}
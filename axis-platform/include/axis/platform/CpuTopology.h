@@ -0,0 +1,128 @@
+#pragma once
+
+#include "axis/platform/Export.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace axis
+{
+    constexpr uint32_t kMaxCpus = 256;
+
+    // 논리 CPU 집합. Windows에서는 (프로세서 그룹 × 64 + 그룹 안 번호)를 인덱스로 씁니다.
+    struct CpuMask
+    {
+        uint64_t words[kMaxCpus / 64] = {};
+
+        void set(uint32_t cpu) { words[cpu / 64] |= 1ull << (cpu % 64); }
+        void reset(uint32_t cpu) { words[cpu / 64] &= ~(1ull << (cpu % 64)); }
+        bool test(uint32_t cpu) const { return cpu < kMaxCpus && (words[cpu / 64] & (1ull << (cpu % 64))) != 0; }
+
+        bool empty() const
+        {
+            for (uint64_t word : words)
+            {
+                if (word != 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        uint32_t count() const
+        {
+            uint32_t total = 0;
+            for (uint64_t word : words)
+            {
+                for (; word != 0; word &= word - 1)
+                {
+                    ++total;
+                }
+            }
+            return total;
+        }
+
+        CpuMask& operator&=(const CpuMask& other)
+        {
+            for (uint32_t i = 0; i < kMaxCpus / 64; ++i)
+            {
+                words[i] &= other.words[i];
+            }
+            return *this;
+        }
+
+        CpuMask& operator|=(const CpuMask& other)
+        {
+            for (uint32_t i = 0; i < kMaxCpus / 64; ++i)
+            {
+                words[i] |= other.words[i];
+            }
+            return *this;
+        }
+
+        static CpuMask single(uint32_t cpu)
+        {
+            CpuMask mask;
+            mask.set(cpu);
+            return mask;
+        }
+    };
+
+    enum class CoreKind : uint8_t
+    {
+        Performance,
+        // 하이브리드 CPU의 효율 코어(Intel E코어, ARM LITTLE). 하이브리드가 아니면 모든 코어가 Performance입니다.
+        Efficient,
+    };
+
+    struct LogicalCpu
+    {
+        uint32_t cpu = 0;
+        // 물리 코어 인덱스. SMT 짝은 같은 값을 가집니다.
+        uint32_t core = 0;
+        // L3 캐시를 함께 쓰는 묶음 인덱스. 칩렛 CPU에서는 CCX마다 다릅니다.
+        uint32_t l3Group = 0;
+        // 코어 안에서 몇 번째 하드웨어 스레드인지. 0이 첫 번째입니다.
+        uint32_t smtIndex = 0;
+        CoreKind kind = CoreKind::Performance;
+    };
+
+    // 시스템의 논리 CPU 구성.
+    struct CpuTopology
+    {
+        // CPU 번호 순입니다.
+        std::vector<LogicalCpu> cpus;
+        uint32_t coreCount = 0;
+        uint32_t performanceCoreCount = 0;
+        uint32_t efficientCoreCount = 0;
+        uint32_t l3GroupCount = 0;
+
+        CpuMask all;
+        CpuMask performance;
+        CpuMask efficient;
+
+        bool isHybrid() const { return performanceCoreCount != 0 && efficientCoreCount != 0; }
+
+        CpuMask l3Group(uint32_t group) const
+        {
+            CpuMask mask;
+            for (const LogicalCpu& cpu : cpus)
+            {
+                if (cpu.l3Group == group)
+                {
+                    mask.set(cpu.cpu);
+                }
+            }
+            return mask;
+        }
+
+        // allowed 안의 CPU를 스레드를 하나씩 고정해 나갈 순서로 늘어놓습니다. 늘어놓은 수를 반환합니다.
+        // P코어의 첫 하드웨어 스레드, E코어, 그다음 SMT 짝 순이며, 같은 단계 안에서는 L3 묶음을 번갈아 골라
+        // 앞쪽 몇 개만 써도 캐시와 코어가 고르게 나뉩니다.
+        AXIS_PLATFORM_API uint32_t spreadOrder(const CpuMask& allowed, uint32_t* out, uint32_t capacity) const;
+    };
+
+    // 처음 호출할 때 OS에서 읽어 캐시합니다. 읽지 못한 정보는 CPU마다 별도 코어, L3 묶음 하나로 채웁니다.
+    AXIS_PLATFORM_API const CpuTopology& cpuTopology();
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "axis/platform/Export.h"
+
+#include <cstdint>
+
+namespace axis
+{
+    // 운영체제 동적 라이브러리(DLL/so) 핸들.
+    class AXIS_PLATFORM_API DynamicLibrary
+    {
+    public:
+        DynamicLibrary() = default;
+        ~DynamicLibrary();
+
+        DynamicLibrary(const DynamicLibrary&) = delete;
+        DynamicLibrary& operator=(const DynamicLibrary&) = delete;
+        DynamicLibrary(DynamicLibrary&& other) noexcept;
+        DynamicLibrary& operator=(DynamicLibrary&& other) noexcept;
+
+        // 경로는 UTF-8입니다. 이미 열려 있으면 먼저 닫습니다.
+        bool open(const char* path);
+        void close();
+
+        bool isOpen() const { return m_handle != 0; }
+
+        // 내보낸 심볼의 주소. 없으면 nullptr.
+        void* symbol(const char* name) const;
+
+        template <typename Fn>
+        Fn function(const char* name) const
+        {
+            return reinterpret_cast<Fn>(symbol(name));
+        }
+
+        // address가 이 라이브러리의 이미지(코드, 상수, 정적 데이터) 안에 있는지.
+        bool contains(const void* address) const;
+
+    private:
+        intptr_t m_handle = 0;
+    };
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "axis/platform/Export.h"
+
+#include <cstdint>
+
+namespace axis
+{
+    struct FramePacerDesc
+    {
+        // 디스플레이 주사율. 0이면 대기 가능 객체가 깨우는 간격으로 추정합니다(그 전까지는 60Hz로 봅니다).
+        uint32_t refreshHz = 0;
+        // 스왑체인의 프레임 지연 대기 객체(IDXGISwapChain2::GetFrameLatencyWaitableObject의 HANDLE).
+        // 스왑체인은 렌더러 백엔드가 만들므로 여기서는 핸들만 받습니다. 없으면 주기에 맞춰 잠듭니다.
+        // Windows 전용입니다. 다른 플랫폼에서는 nullptr이어야 하며(디버그에서 검사), 넘겨도 무시하고 주기에 맞춰 잠듭니다.
+        void* latencyWaitable = nullptr;
+        // 늦은 입력 샘플 시각을 제출 예측보다 이만큼 앞당깁니다.
+        uint64_t safetyMarginNs = 1000000;
+    };
+
+    struct FramePacerStats
+    {
+        uint64_t frames = 0;
+        // 마지막 beginFrame이 잠든 시간.
+        uint64_t lastWaitNs = 0;
+        // 늦은 샘플부터 제출(endFrame)까지 걸리는 시간의 이동 평균.
+        uint64_t predictedSubmitNs = 0;
+        uint64_t periodNs = 0;
+        // 제출이 마감(다음 수직 동기) 뒤에 끝난 프레임 수.
+        uint64_t missedDeadlines = 0;
+    };
+
+    // 프레임 페이싱과 늦은 입력 샘플링.
+    //
+    // 지연 대기 스왑체인(최대 지연 1)은 GPU가 이전 프레임을 화면에 올릴 준비가 되면 대기 객체를 깨우므로,
+    // beginFrame에서 그 신호를 기다려 프레임을 시작하면 CPU가 앞서 달려 큐에 프레임이 쌓이는 일이 없습니다.
+    // 그래도 프레임 시작에 읽은 입력은 제출까지 한 프레임 가까이 묵습니다. 그래서 시뮬레이션처럼 입력과 무관한
+    // 일을 먼저 하고, 카메라처럼 입력에 민감한 값은 waitForLateSample 뒤에 InputQueue를 그 시각까지 비워
+    // 다시 계산합니다. 샘플 시각은 마감(시작 + 주기)에서 최근 샘플-제출 시간과 여유를 뺀 값입니다.
+    //
+    // beginFrame/lateSampleTimeNs/waitForLateSample/endFrame은 모두 렌더 제출 스레드 하나에서 부릅니다.
+    class AXIS_PLATFORM_API FramePacer
+    {
+    public:
+        explicit FramePacer(const FramePacerDesc& desc = {});
+
+        // 대기 객체 신호(없으면 이전 시작 + 주기)까지 잠들고 프레임을 시작합니다. 시작 시각을 반환합니다.
+        uint64_t beginFrame();
+
+        // 이번 프레임의 늦은 입력 샘플 시각. 이미 지났을 수 있습니다.
+        uint64_t lateSampleTimeNs() const;
+        // 샘플 시각까지 잠들고 그 시각(지났으면 현재 시각)을 반환합니다. InputQueue::drain의 upToNs로 넘깁니다.
+        uint64_t waitForLateSample();
+
+        // Present 직후에 부릅니다.
+        void endFrame();
+
+        uint64_t frameStartNs() const { return m_frameStartNs; }
+        uint64_t deadlineNs() const { return m_frameStartNs + m_periodNs; }
+        uint64_t periodNs() const { return m_periodNs; }
+
+        const FramePacerStats& stats() const { return m_stats; }
+
+        // 절대 시각(Clock::nowNs 기준)까지 잠듭니다. OS 잠은 타이머 해상도만큼 늦으므로 마지막 구간은 돌며 기다립니다.
+        static void sleepUntilNs(uint64_t targetNs);
+
+    private:
+        FramePacerDesc m_desc;
+        uint64_t m_periodNs = 0;
+        uint64_t m_frameStartNs = 0;
+        uint64_t m_sampleNs = 0;
+        bool m_sampled = false;
+        FramePacerStats m_stats;
+    };
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "axis/platform/Export.h"
+
+#include <cstdint>
+
+namespace axis
+{
+    // 읽기 전용 메모리 매핑 파일.
+    // 페이지는 처음 접근할 때 OS가 읽어 들이므로 열기 자체는 파일 크기와 무관하게 빠릅니다.
+    class AXIS_PLATFORM_API MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        // 경로는 UTF-8입니다. 빈 파일은 열리지만 data()가 nullptr입니다.
+        bool open(const char* path);
+        void close();
+
+        bool isOpen() const { return m_open; }
+        const uint8_t* data() const { return m_data; }
+        uint64_t size() const { return m_size; }
+
+        // 곧 읽을 범위를 OS에 미리 알려 페이지 폴트를 줄입니다. 힌트일 뿐이며 실패해도 무시됩니다.
+        void prefetch(uint64_t offset, uint64_t size) const;
+
+    private:
+        const uint8_t* m_data = nullptr;
+        uint64_t m_size = 0;
+        intptr_t m_file = -1;
+        intptr_t m_mapping = 0;
+        bool m_open = false;
+    };
+
+    // source를 destination으로 옮기고, destination이 있으면 한 번에 바꿉니다(POSIX rename, Windows MoveFileExW).
+    // 중간에 destination이 없는 순간이 생기지 않습니다. destination을 매핑한 MappedFile은 먼저 닫아야 합니다(Windows).
+    AXIS_PLATFORM_API bool replaceFile(const char* source, const char* destination);
+}
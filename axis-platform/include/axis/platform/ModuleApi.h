@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// 다시 불러올 수 있는 모듈 DLL과 호스트 사이의 C ABI 계약.
+//
+// 모듈은 AXIS_MODULE_ENTRY로 진입점 하나를 내보내고, 거기서 정적 ModuleApi를 돌려줍니다.
+// 호스트는 ModuleApi를 통해서만 모듈을 만들고, 상태를 저장/복원하고, 모듈 함수 표를 얻습니다.
+// 모듈 안을 가리키는 포인터(함수, 문자열, 정적 데이터)는 언로드와 함께 무효가 되므로
+// 호스트는 함수 표를 ModuleLoader가 가진 사본을 통해서만 호출해야 합니다.
+
+namespace axis
+{
+    // 구조체 배치나 호출 규약이 바뀌면 올립니다. 버전이 다른 모듈은 불러오지 않습니다.
+    constexpr uint32_t kModuleApiVersion = 1;
+
+    struct ModuleContext
+    {
+        // 호스트가 넘기는 서비스(월드, 스케줄러 등). 플랫폼 계층은 내용을 알지 못합니다.
+        void* hostData;
+        // 1이면 처음 불러온 것이고, 2 이상이면 다시 불러온 것입니다.
+        uint32_t loadCount;
+    };
+
+    // saveState가 상태를 내보내는 출력. write는 여러 번 호출할 수 있으며 바이트는 이어 붙습니다.
+    struct ModuleStateWriter
+    {
+        void* context;
+        void (*write)(void* context, const void* data, size_t size);
+    };
+
+    struct ModuleApi
+    {
+        uint32_t apiVersion;
+        // 모듈 상태 형식의 버전. loadState가 이전 버전의 상태를 받았을 때 변환할지 버릴지 정합니다.
+        uint32_t stateVersion;
+        const char* name;
+
+        void* (*create)(const ModuleContext* context);
+        void (*destroy)(void* instance);
+
+        // 선택. 언로드 직전에 상태를 내보내고, 새 코드가 만든 인스턴스에서 다시 읽습니다.
+        // loadState가 false를 반환하면 새 인스턴스는 초기 상태로 시작합니다.
+        bool (*saveState)(void* instance, ModuleStateWriter* writer);
+        bool (*loadState)(void* instance, const void* data, size_t size, uint32_t stateVersion);
+
+        // 선택. 모듈이 호스트에 제공하는 함수 포인터 구조체와 그 크기.
+        const void* functions;
+        size_t functionsSize;
+    };
+
+    using ModuleEntryFunction = const ModuleApi* (*)(uint32_t hostApiVersion);
+
+    constexpr const char* kModuleEntrySymbol = "axisModuleEntry";
+}
+
+#if defined(_WIN32)
+    #define AXIS_MODULE_EXPORT extern "C" __declspec(dllexport)
+#else
+    #define AXIS_MODULE_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+// 모듈 DLL의 진입점 정의. 본문에서 정적 ModuleApi의 주소를 반환합니다.
+#define AXIS_MODULE_ENTRY AXIS_MODULE_EXPORT const ::axis::ModuleApi* axisModuleEntry(uint32_t hostApiVersion)
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "axis/platform/DynamicLibrary.h"
+#include "axis/platform/Export.h"
+#include "axis/platform/ModuleApi.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace axis
+{
+    using ModuleId = uint32_t;
+
+    constexpr ModuleId kInvalidModule = 0xFFFFFFFFu;
+
+    using ModuleCallback = void (*)(ModuleId module, void* userData);
+
+    struct ModuleDesc
+    {
+        // 빌드가 내놓는 원본 DLL 경로(UTF-8). 로더는 원본을 잠그지 않도록 항상 복사본을 불러옵니다.
+        const char* path = nullptr;
+        // 복사본을 둘 디렉터리. nullptr이면 원본과 같은 디렉터리입니다.
+        const char* shadowDirectory = nullptr;
+
+        // 호스트가 기대하는 함수 표 크기. 0이 아니면 모듈의 functionsSize와 같아야 불러옵니다.
+        size_t functionTableSize = 0;
+
+        void* hostData = nullptr;
+
+        // 교체 직전(모듈 안을 가리키는 포인터를 내려놓을 때)과 직후(다시 등록할 때)에 호출됩니다.
+        ModuleCallback beforeUnload = nullptr;
+        ModuleCallback afterLoad = nullptr;
+        void* userData = nullptr;
+    };
+
+    struct ModuleInfo
+    {
+        const char* name = nullptr;
+        uint32_t loadCount = 0;
+        // 마지막 교체에서 옮긴 상태 크기와 걸린 시간.
+        uint64_t stateBytes = 0;
+        uint64_t reloadNs = 0;
+        // 마지막 실패 이유. 성공하면 nullptr.
+        const char* error = nullptr;
+    };
+
+    // 실행 중에 모듈 DLL을 내리고 다시 불러오는 로더.
+    //
+    // 교체 순서: 새 복사본 열기 → saveState → beforeUnload → destroy → create → loadState
+    //            → 함수 표 갱신 → afterLoad → 이전 복사본 닫기.
+    // 모듈이 core 전역 등록부에 넣은 함수 포인터(컴포넌트 타입, 시스템)는 로더가 알지 못합니다. 호스트는 beforeUnload에서
+    // core의 detachModule로 떼어 내고, 새 인스턴스는 create에서 같은 이름으로 다시 등록해 붙입니다.
+    // 새 복사본이 열리지 않거나 진입점이 맞지 않으면 실행 중인 인스턴스를 건드리지 않습니다.
+    // 새 코드가 인스턴스를 만들지 못하면 이전 복사본으로 다시 만들고 저장한 상태를 돌려 넣습니다.
+    // 함수 표는 로더가 가진 사본이며 주소가 바뀌지 않으므로, 호스트는 functions<T>()가 준 포인터를 계속 써도
+    // 교체 뒤에는 새 코드를 호출합니다. 모든 호출은 한 스레드에서, 모듈 코드가 실행 중이지 않을 때 해야 합니다.
+    class AXIS_PLATFORM_API ModuleLoader
+    {
+    public:
+        ModuleLoader() = default;
+        ~ModuleLoader();
+
+        ModuleLoader(const ModuleLoader&) = delete;
+        ModuleLoader& operator=(const ModuleLoader&) = delete;
+
+        // 실패하면 kInvalidModule.
+        ModuleId load(const ModuleDesc& desc);
+        void unload(ModuleId module);
+
+        // 원본이 바뀌지 않았어도 다시 불러옵니다. 새 코드로 교체했으면 true.
+        // 새 코드가 실패하면 이전 코드로 되돌리며, 그것도 실패하면 모듈을 내립니다(isLoaded가 false).
+        bool reload(ModuleId module);
+
+        // 원본 파일이 바뀐 모듈을 다시 불러오고, 교체한 모듈 수를 반환합니다.
+        // 빌드가 쓰는 도중의 파일을 열지 않도록 두 번 연속 같은 시각/크기로 보인 뒤에 교체합니다.
+        uint32_t pollChanges();
+
+        // unload했거나 교체가 되돌리기까지 실패한 모듈은 false.
+        bool isLoaded(ModuleId module) const;
+        void* instance(ModuleId module) const;
+        const ModuleApi* api(ModuleId module) const;
+        ModuleInfo info(ModuleId module) const;
+
+        // address가 지금 불러온 모듈 복사본 안에 있는지. beforeUnload에서 core 등록부가 모듈 코드를 가리키는 항목을
+        // 찾을 때 씁니다(ComponentRegistry::detachModule, Scheduler::detachModule).
+        bool ownsAddress(ModuleId module, const void* address) const;
+
+        // 호스트 쪽 함수 표 사본. T는 모듈이 functions로 내보내는 구조체와 같아야 합니다.
+        template <typename T>
+        const T* functions(ModuleId module) const
+        {
+            return static_cast<const T*>(functionTable(module));
+        }
+
+    private:
+        struct FileStamp
+        {
+            int64_t time = 0;
+            uint64_t size = 0;
+
+            friend bool operator==(const FileStamp& a, const FileStamp& b)
+            {
+                return a.time == b.time && a.size == b.size;
+            }
+        };
+
+        struct Module
+        {
+            ModuleDesc desc;
+            std::string path;
+            std::string shadowDirectory;
+
+            DynamicLibrary library;
+            std::string libraryPath;
+            const ModuleApi* api = nullptr;
+            void* instance = nullptr;
+
+            // 함수 표 사본. max_align_t 단위로 잡아 어떤 함수 포인터 구조체든 담을 수 있습니다.
+            std::unique_ptr<std::max_align_t[]> functionTable;
+            size_t functionTableSize = 0;
+
+            FileStamp loadedStamp;
+            FileStamp pendingStamp;
+            ModuleInfo info;
+        };
+
+        const void* functionTable(ModuleId module) const;
+        Module* find(ModuleId module) const;
+
+        static FileStamp currentStamp(const std::string& path);
+
+        bool openCopy(Module& module, DynamicLibrary& library, std::string& libraryPath, const ModuleApi*& api);
+        bool startInstance(Module& module, const ModuleApi* api, const std::vector<uint8_t>* state,
+                           uint32_t stateVersion);
+        void publishFunctions(Module& module);
+
+        std::vector<std::unique_ptr<Module>> m_modules;
+    };
+}
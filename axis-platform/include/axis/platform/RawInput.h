@@ -0,0 +1,122 @@
+#pragma once
+
+#include "axis/platform/CpuTopology.h"
+#include "axis/platform/Export.h"
+#include "axis/platform/Thread.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace axis
+{
+    enum class InputEventType : uint8_t
+    {
+        KeyDown,
+        KeyUp,
+        // x, y는 장치 단위(mickey)의 상대 이동량입니다. 가속이나 화면 좌표 변환을 거치지 않습니다.
+        MouseMove,
+        MouseButtonDown,
+        MouseButtonUp,
+        // y는 세로, x는 가로 휠. 한 칸이 120입니다(WHEEL_DELTA).
+        MouseWheel,
+    };
+
+    enum class RawInputBackend : uint8_t
+    {
+        // Windows WM_INPUT (메시지 전용 창에 등록).
+        WmInput,
+        // Linux /dev/input/event*. 읽기 권한(보통 input 그룹)이 필요합니다.
+        Evdev,
+        None,
+    };
+
+    // 마우스 버튼 번호(code).
+    constexpr uint16_t kMouseButtonLeft = 0;
+    constexpr uint16_t kMouseButtonRight = 1;
+    constexpr uint16_t kMouseButtonMiddle = 2;
+    constexpr uint16_t kMouseButtonX1 = 3;
+    constexpr uint16_t kMouseButtonX2 = 4;
+
+    // 확장 키 스캔 코드(오른쪽 Ctrl, 화살표 등)에 붙는 접두. Windows에서만 씁니다.
+    constexpr uint16_t kScanCodeExtended = 0xE000;
+
+    struct InputEvent
+    {
+        // Clock::nowNs 기준. evdev는 커널이 받은 시각을, WM_INPUT은 메시지가 큐에 들어간 시각(ms 정밀도)을 씁니다.
+        uint64_t timestampNs = 0;
+        InputEventType type = InputEventType::KeyDown;
+        // 입력 스레드가 장치마다 붙이는 작은 번호. 여러 마우스/키보드를 구분할 때 씁니다.
+        uint8_t device = 0;
+        // 키는 스캔 코드(Windows는 set 1 + kScanCodeExtended, Linux는 evdev 코드. 기본 키는 둘이 같습니다),
+        // 마우스 버튼은 kMouseButton*.
+        uint16_t code = 0;
+        int32_t x = 0;
+        int32_t y = 0;
+    };
+
+    // 입력 스레드에서 모아 둔 이벤트를 한꺼번에 넘깁니다. 짧게 끝나야 하며 보통 SPSC 큐에 넣기만 합니다.
+    using InputSink = void (*)(const InputEvent* events, uint32_t count, void* context);
+
+    struct RawInputDesc
+    {
+        bool keyboard = true;
+        bool mouse = true;
+        // false면 이 프로세스의 창이 전면에 있을 때만 이벤트를 넘깁니다(Windows).
+        bool background = false;
+        InputSink sink = nullptr;
+        void* context = nullptr;
+        // 입력 스레드는 대부분 잠들어 있으므로 깨어났을 때 바로 돌도록 높은 우선순위를 줍니다.
+        ThreadPriority priority = ThreadPriority::Critical;
+        // 비어 있으면 OS에 맡깁니다.
+        CpuMask affinity;
+    };
+
+    struct RawInputStats
+    {
+        uint64_t events = 0;
+        // sink 호출 수. events / batches가 한 번 깨어날 때 모인 이벤트 수입니다.
+        uint64_t batches = 0;
+        uint32_t devices = 0;
+    };
+
+    // 전용 스레드의 원시 입력.
+    //
+    // 메시지 펌프를 게임 루프에서 돌리면 입력은 다음 펌프까지 기다리고, OS의 가속과 합치기를 거칩니다.
+    // RawInput은 전용 스레드에서 장치 이벤트를 받자마자 시각을 붙여 sink로 넘기므로,
+    // 소비자는 프레임 중 아무 때나(특히 렌더 제출 직전에) 그 시각까지의 입력을 꺼낼 수 있습니다.
+    // Windows는 메시지 전용 창에 WM_INPUT을 받도록 (RIDEV_INPUTSINK) 등록하고, Linux는 evdev 장치를 poll합니다.
+    // 장치는 시작할 때 한 번 찾으며 이후에 연결한 장치는 보이지 않습니다(Linux).
+    // 앱의 창은 평소대로 WM_KEYDOWN 등을 받으므로 텍스트 입력과 UI는 기존 메시지 경로를 쓰면 됩니다.
+    class AXIS_PLATFORM_API RawInput
+    {
+    public:
+        explicit RawInput(const RawInputDesc& desc);
+        ~RawInput();
+
+        RawInput(const RawInput&) = delete;
+        RawInput& operator=(const RawInput&) = delete;
+
+        // 장치를 하나도 열지 못했거나 지원하지 않는 플랫폼이면 false. 그때 sink는 호출되지 않습니다.
+        bool isRunning() const { return m_running.load(std::memory_order_acquire); }
+        RawInputBackend backend() const { return m_backend; }
+
+        RawInputStats stats() const;
+
+    private:
+        void threadMain();
+        void deliver(const InputEvent* events, uint32_t count);
+
+        RawInputDesc m_desc;
+        RawInputBackend m_backend = RawInputBackend::None;
+        std::atomic<bool> m_running{false};
+        std::atomic<bool> m_ready{false};
+        std::atomic<uint64_t> m_events{0};
+        std::atomic<uint64_t> m_batches{0};
+        std::atomic<uint32_t> m_devices{0};
+
+        // 입력 스레드가 만든 창(HWND) 또는 종료 알림 eventfd.
+        std::atomic<intptr_t> m_wakeHandle{-1};
+        std::thread m_thread;
+    };
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "axis/platform/Export.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace axis
+{
+    // 현재 스레드의 반환 주소를 호출한 쪽부터 최대 capacity개 채우고 채운 개수를 돌려줍니다.
+    // skip은 이 함수를 부른 쪽에서부터 건너뛸 프레임 수입니다. 지원하지 않는 플랫폼에서는 0.
+    // 프레임 포인터가 없는 최적화 빌드에서는 일부 프레임이 빠질 수 있습니다.
+    AXIS_PLATFORM_API uint32_t captureStackTrace(void** frames, uint32_t capacity, uint32_t skip = 0);
+
+    // 주소를 "심볼+0x오프셋 (모듈)" 또는 "모듈+0x오프셋" 형태로 out에 씁니다. 알 수 없으면 주소만 쓰고 false.
+    // 심볼을 찾느라 느리므로 보고서를 만들 때만 사용합니다.
+    AXIS_PLATFORM_API bool describeAddress(const void* address, char* out, size_t outSize);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "axis/platform/CpuTopology.h"
+#include "axis/platform/Export.h"
+
+#include <cstdint>
+
+namespace axis
+{
+    enum class ThreadPriority : uint8_t
+    {
+        // 스트리밍, 압축 해제처럼 늦어도 되는 작업.
+        Low,
+        Normal,
+        // 게임 스레드, 작업 워커.
+        High,
+        // 렌더 제출, 오디오 믹싱처럼 한 번 밀리면 눈과 귀에 드러나는 스레드.
+        Critical,
+    };
+
+    // 현재 스레드를 mask 안의 CPU에서만 돌게 합니다.
+    // Windows에서는 스레드가 프로세서 그룹 하나에만 속하므로 mask가 여러 그룹에 걸치면 CPU가 가장 많은 그룹을 씁니다.
+    // 지원하지 않는 OS(macOS)이거나 실패하면 false.
+    AXIS_PLATFORM_API bool setCurrentThreadAffinity(const CpuMask& mask);
+
+    // High 이상은 Windows의 전원 절약(EcoQoS) 스케줄링과 macOS의 낮은 QoS에서 빼므로
+    // 하이브리드 CPU에서 OS가 E코어로 옮기는 일이 줄어듭니다. Low는 반대로 E코어 쪽을 허용합니다.
+    // Linux에서 High 이상은 nice 값을 낮추므로 권한(CAP_SYS_NICE)이 없으면 실패할 수 있습니다.
+    // 실패해도 스레드는 이전 우선순위로 계속 돕니다.
+    AXIS_PLATFORM_API bool setCurrentThreadPriority(ThreadPriority priority);
+
+    // 디버거와 OS 도구에 보이는 이름. Linux는 15바이트에서 자릅니다.
+    AXIS_PLATFORM_API void setCurrentThreadName(const char* name);
+
+    // 현재 스레드가 돌고 있는 CPU. 알 수 없으면 kMaxCpus.
+    AXIS_PLATFORM_API uint32_t currentCpu();
+}
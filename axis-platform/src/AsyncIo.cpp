@@ -0,0 +1,282 @@
+#include "axis/platform/AsyncIo.h"
+
+#include "IoBackend.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace axis
+{
+    namespace
+    {
+        constexpr uint32_t kReapBatch = 64;
+    }
+
+    AsyncIo::AsyncIo(const AsyncIoDesc& desc)
+        : m_backend(detail::createIoBackend(desc))
+        , m_executor(desc.executor)
+        , m_executorContext(desc.executorContext)
+        , m_queueDepth(std::max(desc.queueDepth, 1u))
+    {
+        assert(m_backend != nullptr);
+        m_thread = std::thread(&AsyncIo::ioThreadMain, this);
+    }
+
+    AsyncIo::~AsyncIo()
+    {
+        // 대기 중인 요청은 취소하고, 커널에 넘어간 요청은 버퍼에 쓰기가 끝날 때까지 기다립니다.
+        m_running.store(false, std::memory_order_release);
+        m_backend->wake();
+        m_thread.join();
+
+        for (FileEntry& entry : m_files)
+        {
+            if (entry.open)
+            {
+                m_backend->closeFile(entry.handle);
+            }
+        }
+    }
+
+    AsyncFileId AsyncIo::openFile(const char* path, bool unbuffered)
+    {
+        FileEntry entry;
+        if (path == nullptr || !m_backend->openFile(path, unbuffered, entry.handle, entry.size))
+        {
+            return kInvalidAsyncFile;
+        }
+        entry.open = true;
+
+        std::lock_guard<std::mutex> lock(m_fileMutex);
+        if (!m_freeFiles.empty())
+        {
+            const AsyncFileId id = m_freeFiles.back();
+            m_freeFiles.pop_back();
+            m_files[id] = entry;
+            return id;
+        }
+        m_files.push_back(entry);
+        return static_cast<AsyncFileId>(m_files.size() - 1);
+    }
+
+    void AsyncIo::closeFile(AsyncFileId file)
+    {
+        intptr_t handle = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_fileMutex);
+            if (file >= m_files.size() || !m_files[file].open)
+            {
+                return;
+            }
+            handle = m_files[file].handle;
+            m_files[file] = FileEntry{};
+            m_freeFiles.push_back(file);
+        }
+        m_backend->closeFile(handle);
+    }
+
+    uint64_t AsyncIo::fileSize(AsyncFileId file) const
+    {
+        std::lock_guard<std::mutex> lock(m_fileMutex);
+        return file < m_files.size() && m_files[file].open ? m_files[file].size : 0;
+    }
+
+    AsyncIoBackend AsyncIo::backend() const
+    {
+        return m_backend->type();
+    }
+
+    void AsyncIo::submit(IoRequest& request)
+    {
+        submit(&request, 1);
+    }
+
+    void AsyncIo::submit(IoRequest* requests, uint32_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        assert(m_running.load(std::memory_order_relaxed) && "종료 중인 AsyncIo에 제출했습니다");
+
+        // 파일 핸들은 제출 시점에 풀어 둡니다. I/O 스레드는 파일 뮤텍스를 잡지 않습니다.
+        // 받아들인 요청은 우선순위별 지역 목록에, 거부한 요청은 failed 목록에 next로 엮어 둡니다.
+        PendingList batch[kIoPriorityCount];
+        IoRequest* failed = nullptr;
+        uint32_t accepted = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_fileMutex);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                IoRequest& request = requests[i];
+                assert(request.buffer != nullptr || request.size == 0);
+
+                request.next = nullptr;
+                request.bytesRead = 0;
+                request.error = 0;
+                request.status.store(IoStatus::Pending, std::memory_order_relaxed);
+                if (request.file < m_files.size() && m_files[request.file].open)
+                {
+                    request.nativeFile = m_files[request.file].handle;
+                    request.result = IoStatus::Pending;
+                    PendingList& list = batch[static_cast<uint32_t>(request.priority)];
+                    if (list.tail != nullptr)
+                    {
+                        list.tail->next = &request;
+                    }
+                    else
+                    {
+                        list.head = &request;
+                    }
+                    list.tail = &request;
+                    ++accepted;
+                }
+                else
+                {
+                    request.result = IoStatus::Failed;
+                    request.error = -1;
+                    request.next = failed;
+                    failed = &request;
+                }
+            }
+        }
+
+        // 잘못된 파일을 가리킨 요청은 제출한 스레드에서 바로 완료합니다. 완료 뒤에는 호출한 쪽이 요청을
+        // 해제할 수 있으므로 next를 먼저 읽습니다.
+        while (failed != nullptr)
+        {
+            IoRequest* next = failed->next;
+            failed->next = nullptr;
+            completeIoRequest(*failed);
+            failed = next;
+        }
+
+        // 대기열에 넣는 순간부터 I/O 스레드가 요청을 완료할 수 있으므로, 이 뒤로는 requests를 읽지 않습니다.
+        m_outstanding.fetch_add(accepted, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            for (uint32_t priority = 0; priority < kIoPriorityCount; ++priority)
+            {
+                const PendingList& local = batch[priority];
+                if (local.head == nullptr)
+                {
+                    continue;
+                }
+                PendingList& list = m_pending[priority];
+                if (list.tail != nullptr)
+                {
+                    list.tail->next = local.head;
+                }
+                else
+                {
+                    list.head = local.head;
+                }
+                list.tail = local.tail;
+            }
+        }
+
+        if (accepted != 0 && !m_wakeRequested.exchange(true, std::memory_order_acq_rel))
+        {
+            m_backend->wake();
+        }
+    }
+
+    uint32_t AsyncIo::dequeuePending(IoRequest** out, uint32_t maxCount)
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        uint32_t count = 0;
+        for (PendingList& list : m_pending)
+        {
+            while (count < maxCount && list.head != nullptr)
+            {
+                IoRequest* request = list.head;
+                list.head = request->next;
+                request->next = nullptr;
+                out[count++] = request;
+            }
+            if (list.head == nullptr)
+            {
+                list.tail = nullptr;
+            }
+        }
+        return count;
+    }
+
+    void AsyncIo::finish(IoRequest& request)
+    {
+        m_outstanding.fetch_sub(1, std::memory_order_relaxed);
+        if (m_executor != nullptr)
+        {
+            m_executor(request, m_executorContext);
+        }
+        else
+        {
+            completeIoRequest(request);
+        }
+    }
+
+    void AsyncIo::ioThreadMain()
+    {
+        IoRequest* batch[kReapBatch];
+        uint32_t inFlight = 0;
+
+        for (;;)
+        {
+            // 여기서 플래그를 내린 뒤에 들어온 제출은 다시 wake를 부르므로 놓치지 않습니다.
+            m_wakeRequested.store(false, std::memory_order_seq_cst);
+
+            if (!m_running.load(std::memory_order_acquire))
+            {
+                uint32_t cancelled;
+                while ((cancelled = dequeuePending(batch, kReapBatch)) != 0)
+                {
+                    for (uint32_t i = 0; i < cancelled; ++i)
+                    {
+                        batch[i]->result = IoStatus::Cancelled;
+                        finish(*batch[i]);
+                    }
+                }
+                if (inFlight == 0)
+                {
+                    break;
+                }
+            }
+            else
+            {
+                bool queued = false;
+                while (inFlight < m_queueDepth)
+                {
+                    const uint32_t count = dequeuePending(batch, std::min(m_queueDepth - inFlight, kReapBatch));
+                    if (count == 0)
+                    {
+                        break;
+                    }
+                    for (uint32_t i = 0; i < count; ++i)
+                    {
+                        if (m_backend->enqueue(*batch[i]))
+                        {
+                            ++inFlight;
+                            queued = true;
+                        }
+                        else
+                        {
+                            finish(*batch[i]);
+                        }
+                    }
+                }
+                if (queued)
+                {
+                    m_backend->flush();
+                }
+            }
+
+            const uint32_t completed = m_backend->reap(batch, kReapBatch, true);
+            assert(completed <= inFlight);
+            inFlight -= completed;
+            for (uint32_t i = 0; i < completed; ++i)
+            {
+                finish(*batch[i]);
+            }
+        }
+    }
+}
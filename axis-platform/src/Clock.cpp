@@ -0,0 +1,176 @@
+#include "axis/platform/Clock.h"
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define AXIS_CLOCK_HAS_TSC 1
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+        #include <x86intrin.h>
+    #endif
+#else
+    #define AXIS_CLOCK_HAS_TSC 0
+#endif
+
+namespace axis
+{
+    namespace
+    {
+        constexpr uint64_t kNsPerSecond = 1'000'000'000ull;
+        // TSC 보정 구간. 길수록 정확하지만 첫 호출이 그만큼 멈춥니다. 20ms면 오차가 수 ppm 수준입니다.
+        constexpr uint64_t kCalibrationNs = 20'000'000ull;
+
+        uint64_t osTicks()
+        {
+#if defined(_WIN32)
+            LARGE_INTEGER counter;
+            ::QueryPerformanceCounter(&counter);
+            return static_cast<uint64_t>(counter.QuadPart);
+#else
+            timespec now;
+            ::clock_gettime(CLOCK_MONOTONIC, &now);
+            return static_cast<uint64_t>(now.tv_sec) * kNsPerSecond + static_cast<uint64_t>(now.tv_nsec);
+#endif
+        }
+
+        uint64_t osFrequency()
+        {
+#if defined(_WIN32)
+            LARGE_INTEGER frequency;
+            ::QueryPerformanceFrequency(&frequency);
+            return static_cast<uint64_t>(frequency.QuadPart);
+#else
+            return kNsPerSecond;
+#endif
+        }
+
+#if AXIS_CLOCK_HAS_TSC
+        uint64_t readTsc()
+        {
+            return __rdtsc();
+        }
+
+        // CPUID 0x80000007 EDX 8번 비트: 불변 TSC.
+        bool hasInvariantTsc()
+        {
+#if defined(_MSC_VER)
+            int registers[4] = {};
+            __cpuid(registers, 0x80000000);
+            if (static_cast<unsigned>(registers[0]) < 0x80000007u)
+            {
+                return false;
+            }
+            __cpuid(registers, 0x80000007);
+            return (registers[3] & (1 << 8)) != 0;
+#else
+            unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+            if (__get_cpuid_max(0x80000000u, nullptr) < 0x80000007u)
+            {
+                return false;
+            }
+            __get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx);
+            return (edx & (1u << 8)) != 0;
+#endif
+        }
+
+        // OS 시계 두 번 사이에 TSC를 읽어, 그 구간의 가운데를 TSC 읽은 시점으로 봅니다.
+        void sampleBoth(uint64_t& os, uint64_t& tsc)
+        {
+            const uint64_t before = osTicks();
+            tsc = readTsc();
+            const uint64_t after = osTicks();
+            os = before + (after - before) / 2;
+        }
+#endif
+
+        struct ClockState
+        {
+            ClockState()
+            {
+                osHz = osFrequency();
+                frequency = osHz;
+#if defined(_WIN32)
+                source = ClockSource::Qpc;
+#endif
+
+#if AXIS_CLOCK_HAS_TSC
+                if (hasInvariantTsc())
+                {
+                    uint64_t os0 = 0, tsc0 = 0;
+                    sampleBoth(os0, tsc0);
+                    const uint64_t window = kCalibrationNs * osHz / kNsPerSecond;
+
+                    uint64_t os1 = 0, tsc1 = 0;
+                    do
+                    {
+                        sampleBoth(os1, tsc1);
+                    } while (os1 - os0 < window);
+
+                    // 가상 머신 등에서 TSC가 멈춰 있거나 거꾸로 가면 쓰지 않습니다.
+                    if (tsc1 > tsc0)
+                    {
+                        const double hz = static_cast<double>(tsc1 - tsc0) * static_cast<double>(osHz) /
+                                          static_cast<double>(os1 - os0);
+                        frequency = static_cast<uint64_t>(hz + 0.5);
+                        source = ClockSource::Tsc;
+                    }
+                }
+#endif
+            }
+
+            uint64_t osHz = 0;
+            uint64_t frequency = 0;
+            ClockSource source = ClockSource::Monotonic;
+        };
+
+        const ClockState& state()
+        {
+            static const ClockState s_state;
+            return s_state;
+        }
+    }
+
+    uint64_t Clock::ticks()
+    {
+#if AXIS_CLOCK_HAS_TSC
+        if (state().source == ClockSource::Tsc)
+        {
+            return readTsc();
+        }
+#endif
+        return osTicks();
+    }
+
+    uint64_t Clock::frequency()
+    {
+        return state().frequency;
+    }
+
+    ClockSource Clock::source()
+    {
+        return state().source;
+    }
+
+    uint64_t Clock::ticksToNs(uint64_t ticks)
+    {
+        const uint64_t hz = state().frequency;
+        if (hz == kNsPerSecond)
+        {
+            return ticks;
+        }
+        // 곱셈이 넘치지 않도록 초 단위와 나머지를 나누어 계산합니다.
+        return (ticks / hz) * kNsPerSecond + (ticks % hz) * kNsPerSecond / hz;
+    }
+}
@@ -0,0 +1,381 @@
+#include "axis/platform/CpuTopology.h"
+
+#include <algorithm>
+#include <thread>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#elif defined(__linux__)
+    #include <cstdio>
+    #include <cstdlib>
+#endif
+
+namespace axis
+{
+    namespace
+    {
+        // OS에서 읽은 그대로의 CPU 정보. 키는 같은 코어/L3 묶음을 가려내는 데만 씁니다.
+        struct RawCpu
+        {
+            uint32_t cpu = 0;
+            uint64_t coreKey = 0;
+            uint64_t l3Key = 0;
+            // 클수록 빠른 코어. 모든 CPU가 같으면 하이브리드가 아닙니다.
+            uint32_t performanceRank = 0;
+        };
+
+        uint32_t indexOfKey(std::vector<uint64_t>& keys, uint64_t key)
+        {
+            for (uint32_t i = 0; i < keys.size(); ++i)
+            {
+                if (keys[i] == key)
+                {
+                    return i;
+                }
+            }
+            keys.push_back(key);
+            return static_cast<uint32_t>(keys.size() - 1);
+        }
+
+#if defined(_WIN32)
+        template <typename Fn>
+        void forEachCpu(const GROUP_AFFINITY& affinity, Fn&& fn)
+        {
+            for (uint32_t bit = 0; bit < 64; ++bit)
+            {
+                if ((affinity.Mask >> bit) & 1)
+                {
+                    const uint32_t cpu = affinity.Group * 64u + bit;
+                    if (cpu < kMaxCpus)
+                    {
+                        fn(cpu);
+                    }
+                }
+            }
+        }
+
+        void readCpus(std::vector<RawCpu>& out)
+        {
+            DWORD length = 0;
+            ::GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+            if (::GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+            {
+                return;
+            }
+            std::vector<uint8_t> buffer(length);
+            auto* first = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data());
+            if (!::GetLogicalProcessorInformationEx(RelationAll, first, &length))
+            {
+                return;
+            }
+
+            // 코어 항목으로 CPU를 만든 뒤 L3 항목으로 묶음을 채웁니다. 순서는 OS가 정하므로 두 번 훑습니다.
+            uint64_t coreIndex = 0;
+            for (DWORD offset = 0; offset < length;)
+            {
+                const auto* info =
+                    reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data() + offset);
+                if (info->Relationship == RelationProcessorCore)
+                {
+                    for (WORD g = 0; g < info->Processor.GroupCount; ++g)
+                    {
+                        forEachCpu(info->Processor.GroupMask[g], [&](uint32_t cpu) {
+                            RawCpu raw;
+                            raw.cpu = cpu;
+                            raw.coreKey = coreIndex;
+                            raw.l3Key = ~0ull;
+                            raw.performanceRank = info->Processor.EfficiencyClass;
+                            out.push_back(raw);
+                        });
+                    }
+                    ++coreIndex;
+                }
+                offset += info->Size;
+            }
+
+            uint64_t cacheIndex = 0;
+            for (DWORD offset = 0; offset < length;)
+            {
+                const auto* info =
+                    reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data() + offset);
+                if (info->Relationship == RelationCache && info->Cache.Level == 3)
+                {
+                    forEachCpu(info->Cache.GroupMask, [&](uint32_t cpu) {
+                        for (RawCpu& raw : out)
+                        {
+                            if (raw.cpu == cpu)
+                            {
+                                raw.l3Key = cacheIndex;
+                            }
+                        }
+                    });
+                    ++cacheIndex;
+                }
+                offset += info->Size;
+            }
+        }
+#elif defined(__linux__)
+        bool readSysfs(const char* path, char* text, size_t capacity)
+        {
+            std::FILE* file = std::fopen(path, "r");
+            if (file == nullptr)
+            {
+                return false;
+            }
+            const size_t length = std::fread(text, 1, capacity - 1, file);
+            std::fclose(file);
+            text[length] = '\0';
+            return length != 0;
+        }
+
+        bool readSysfsValue(const char* path, uint64_t& value)
+        {
+            char text[64];
+            if (!readSysfs(path, text, sizeof(text)))
+            {
+                return false;
+            }
+            value = std::strtoull(text, nullptr, 10);
+            return true;
+        }
+
+        // "0-3,8,10-11" 형식의 CPU 목록.
+        CpuMask parseCpuList(const char* text)
+        {
+            CpuMask mask;
+            const char* p = text;
+            while (*p != '\0' && *p != '\n')
+            {
+                char* end = nullptr;
+                const unsigned long first = std::strtoul(p, &end, 10);
+                if (end == p)
+                {
+                    break;
+                }
+                unsigned long last = first;
+                p = end;
+                if (*p == '-')
+                {
+                    last = std::strtoul(p + 1, &end, 10);
+                    p = end;
+                }
+                for (unsigned long cpu = first; cpu <= last && cpu < kMaxCpus; ++cpu)
+                {
+                    mask.set(static_cast<uint32_t>(cpu));
+                }
+                if (*p == ',')
+                {
+                    ++p;
+                }
+            }
+            return mask;
+        }
+
+        uint32_t lowestCpu(const CpuMask& mask)
+        {
+            for (uint32_t cpu = 0; cpu < kMaxCpus; ++cpu)
+            {
+                if (mask.test(cpu))
+                {
+                    return cpu;
+                }
+            }
+            return kMaxCpus;
+        }
+
+        void readCpus(std::vector<RawCpu>& out)
+        {
+            char text[1024];
+            if (!readSysfs("/sys/devices/system/cpu/online", text, sizeof(text)))
+            {
+                return;
+            }
+            const CpuMask online = parseCpuList(text);
+
+            // Intel 하이브리드는 코어 종류마다 PMU가 따로 있어 E코어 목록을 cpu_atom에서 읽을 수 있습니다.
+            CpuMask atom;
+            if (readSysfs("/sys/devices/cpu_atom/cpus", text, sizeof(text)))
+            {
+                atom = parseCpuList(text);
+            }
+
+            char path[160];
+            for (uint32_t cpu = 0; cpu < kMaxCpus; ++cpu)
+            {
+                if (!online.test(cpu))
+                {
+                    continue;
+                }
+
+                RawCpu raw;
+                raw.cpu = cpu;
+
+                uint64_t package = 0;
+                uint64_t coreId = cpu;
+                std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", cpu);
+                readSysfsValue(path, package);
+                std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/core_id", cpu);
+                readSysfsValue(path, coreId);
+                raw.coreKey = (package << 32) | (coreId & 0xFFFFFFFFull);
+
+                // L3를 공유하는 CPU 중 가장 작은 번호를 묶음 키로 씁니다. L3가 없으면 패키지 단위로 묶습니다.
+                raw.l3Key = ~0ull - package;
+                for (uint32_t index = 0; index < 8; ++index)
+                {
+                    uint64_t level = 0;
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", cpu, index);
+                    if (!readSysfsValue(path, level))
+                    {
+                        break;
+                    }
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list",
+                                  cpu, index);
+                    if (level == 3 && readSysfs(path, text, sizeof(text)))
+                    {
+                        raw.l3Key = lowestCpu(parseCpuList(text));
+                        break;
+                    }
+                }
+
+                // ARM big.LITTLE는 코어마다 상대 성능(cpu_capacity)을 알려 줍니다.
+                uint64_t capacity = 0;
+                std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cpu_capacity", cpu);
+                if (atom.test(cpu))
+                {
+                    raw.performanceRank = 0;
+                }
+                else if (readSysfsValue(path, capacity))
+                {
+                    raw.performanceRank = static_cast<uint32_t>(capacity);
+                }
+                else
+                {
+                    raw.performanceRank = 1;
+                }
+                out.push_back(raw);
+            }
+        }
+#else
+        void readCpus(std::vector<RawCpu>&)
+        {
+        }
+#endif
+
+        CpuTopology buildTopology()
+        {
+            std::vector<RawCpu> raw;
+            readCpus(raw);
+            if (raw.empty())
+            {
+                const uint32_t count = std::min<uint32_t>(std::max(std::thread::hardware_concurrency(), 1u), kMaxCpus);
+                for (uint32_t cpu = 0; cpu < count; ++cpu)
+                {
+                    raw.push_back(RawCpu{cpu, cpu, 0, 0});
+                }
+            }
+            std::sort(raw.begin(), raw.end(), [](const RawCpu& a, const RawCpu& b) { return a.cpu < b.cpu; });
+
+            uint32_t bestRank = 0;
+            for (const RawCpu& cpu : raw)
+            {
+                bestRank = std::max(bestRank, cpu.performanceRank);
+            }
+
+            CpuTopology topology;
+            std::vector<uint64_t> coreKeys;
+            std::vector<uint64_t> l3Keys;
+            std::vector<uint32_t> threadsPerCore;
+            for (const RawCpu& source : raw)
+            {
+                LogicalCpu cpu;
+                cpu.cpu = source.cpu;
+                cpu.core = indexOfKey(coreKeys, source.coreKey);
+                cpu.l3Group = indexOfKey(l3Keys, source.l3Key);
+                cpu.kind = source.performanceRank < bestRank ? CoreKind::Efficient : CoreKind::Performance;
+
+                if (cpu.core >= threadsPerCore.size())
+                {
+                    threadsPerCore.push_back(0);
+                    if (cpu.kind == CoreKind::Efficient)
+                    {
+                        ++topology.efficientCoreCount;
+                    }
+                    else
+                    {
+                        ++topology.performanceCoreCount;
+                    }
+                }
+                cpu.smtIndex = threadsPerCore[cpu.core]++;
+
+                topology.all.set(cpu.cpu);
+                if (cpu.kind == CoreKind::Efficient)
+                {
+                    topology.efficient.set(cpu.cpu);
+                }
+                else
+                {
+                    topology.performance.set(cpu.cpu);
+                }
+                topology.cpus.push_back(cpu);
+            }
+            topology.coreCount = static_cast<uint32_t>(coreKeys.size());
+            topology.l3GroupCount = static_cast<uint32_t>(l3Keys.size());
+            return topology;
+        }
+    }
+
+    uint32_t CpuTopology::spreadOrder(const CpuMask& allowed, uint32_t* out, uint32_t capacity) const
+    {
+        struct Candidate
+        {
+            uint32_t tier;
+            uint32_t rankInGroup;
+            uint32_t cpu;
+        };
+
+        std::vector<Candidate> candidates;
+        std::vector<uint32_t> groupRanks(static_cast<size_t>(l3GroupCount) * 3, 0);
+        for (const LogicalCpu& cpu : cpus)
+        {
+            if (!allowed.test(cpu.cpu))
+            {
+                continue;
+            }
+            const uint32_t tier = cpu.smtIndex != 0 ? 2u : (cpu.kind == CoreKind::Efficient ? 1u : 0u);
+            const uint32_t rank = groupRanks[tier * l3GroupCount + cpu.l3Group]++;
+            candidates.push_back(Candidate{tier, rank, cpu.cpu});
+        }
+
+        // 같은 단계 안에서는 묶음마다 하나씩 돌아가며 고릅니다.
+        std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+            if (a.tier != b.tier)
+            {
+                return a.tier < b.tier;
+            }
+            if (a.rankInGroup != b.rankInGroup)
+            {
+                return a.rankInGroup < b.rankInGroup;
+            }
+            return a.cpu < b.cpu;
+        });
+
+        const uint32_t count = std::min(capacity, static_cast<uint32_t>(candidates.size()));
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            out[i] = candidates[i].cpu;
+        }
+        return count;
+    }
+
+    const CpuTopology& cpuTopology()
+    {
+        static const CpuTopology s_topology = buildTopology();
+        return s_topology;
+    }
+}
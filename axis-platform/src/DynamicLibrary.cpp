@@ -0,0 +1,139 @@
+#include "axis/platform/DynamicLibrary.h"
+
+#include <utility>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+
+    #include <string>
+#else
+    #include <dlfcn.h>
+#endif
+
+namespace axis
+{
+    DynamicLibrary::~DynamicLibrary()
+    {
+        close();
+    }
+
+    DynamicLibrary::DynamicLibrary(DynamicLibrary&& other) noexcept
+        : m_handle(std::exchange(other.m_handle, 0))
+    {
+    }
+
+    DynamicLibrary& DynamicLibrary::operator=(DynamicLibrary&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            m_handle = std::exchange(other.m_handle, 0);
+        }
+        return *this;
+    }
+
+#if defined(_WIN32)
+    bool DynamicLibrary::open(const char* path)
+    {
+        close();
+
+        const int length = ::MultiByteToWideChar(CP_UTF8, 0, path, -1, nullptr, 0);
+        if (length <= 0)
+        {
+            return false;
+        }
+        std::wstring wide(static_cast<size_t>(length), L'\0');
+        ::MultiByteToWideChar(CP_UTF8, 0, path, -1, wide.data(), length);
+
+        HMODULE module = ::LoadLibraryW(wide.c_str());
+        m_handle = reinterpret_cast<intptr_t>(module);
+        return module != nullptr;
+    }
+
+    void DynamicLibrary::close()
+    {
+        if (m_handle != 0)
+        {
+            ::FreeLibrary(reinterpret_cast<HMODULE>(m_handle));
+            m_handle = 0;
+        }
+    }
+
+    void* DynamicLibrary::symbol(const char* name) const
+    {
+        if (m_handle == 0)
+        {
+            return nullptr;
+        }
+        return reinterpret_cast<void*>(::GetProcAddress(reinterpret_cast<HMODULE>(m_handle), name));
+    }
+
+    bool DynamicLibrary::contains(const void* address) const
+    {
+        if (m_handle == 0 || address == nullptr)
+        {
+            return false;
+        }
+        HMODULE module = nullptr;
+        const DWORD flags = GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT;
+        return ::GetModuleHandleExW(flags, static_cast<LPCWSTR>(address), &module) &&
+               module == reinterpret_cast<HMODULE>(m_handle);
+    }
+#else
+    bool DynamicLibrary::open(const char* path)
+    {
+        close();
+
+        // RTLD_LOCAL로 열어 모듈끼리, 그리고 같은 모듈의 이전 복사본과 심볼이 섞이지 않게 합니다.
+        void* handle = ::dlopen(path, RTLD_NOW | RTLD_LOCAL);
+        m_handle = reinterpret_cast<intptr_t>(handle);
+        return handle != nullptr;
+    }
+
+    void DynamicLibrary::close()
+    {
+        if (m_handle != 0)
+        {
+            ::dlclose(reinterpret_cast<void*>(m_handle));
+            m_handle = 0;
+        }
+    }
+
+    void* DynamicLibrary::symbol(const char* name) const
+    {
+        if (m_handle == 0)
+        {
+            return nullptr;
+        }
+        return ::dlsym(reinterpret_cast<void*>(m_handle), name);
+    }
+
+    bool DynamicLibrary::contains(const void* address) const
+    {
+        if (m_handle == 0 || address == nullptr)
+        {
+            return false;
+        }
+        Dl_info info;
+        if (::dladdr(address, &info) == 0 || info.dli_fname == nullptr)
+        {
+            return false;
+        }
+        // 주소가 속한 이미지를 새로 열지 않고(RTLD_NOLOAD) 핸들만 얻어 비교합니다.
+        void* owner = ::dlopen(info.dli_fname, RTLD_NOW | RTLD_NOLOAD);
+        if (owner == nullptr)
+        {
+            return false;
+        }
+        const bool same = owner == reinterpret_cast<void*>(m_handle);
+        ::dlclose(owner);
+        return same;
+    }
+#endif
+}
@@ -0,0 +1,202 @@
+#include "axis/platform/FramePacer.h"
+
+#include "axis/platform/Clock.h"
+
+#include <cassert>
+#include <thread>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+    // 오래된 SDK에는 없습니다(Windows 10 1803부터 지원).
+    #ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+        #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+    #endif
+#else
+    #include <time.h>
+#endif
+
+namespace axis
+{
+    namespace
+    {
+        constexpr uint64_t kNsPerSecond = 1'000'000'000ull;
+        constexpr uint64_t kDefaultPeriodNs = kNsPerSecond / 60;
+        // 대기 객체가 신호를 주지 않아도(창 최소화, 장치 제거) 프레임이 멈추지 않도록 기다리는 한도(ms).
+        constexpr uint32_t kWaitableTimeoutMs = 100;
+
+        // OS 잠에서 깨어나는 오차보다 조금 넉넉하게 잡은, 마지막에 돌며 기다리는 구간.
+#if defined(_WIN32)
+        constexpr uint64_t kSpinNs = 500'000ull;
+        // 고해상도 타이머가 없을 때 Sleep은 1ms 단위이므로 더 넓게 돕니다.
+        constexpr uint64_t kCoarseSpinNs = 2'000'000ull;
+
+        struct ThreadTimer
+        {
+            HANDLE handle = nullptr;
+            bool highResolution = false;
+
+            ThreadTimer()
+            {
+                handle = ::CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+                                                  TIMER_ALL_ACCESS);
+                highResolution = handle != nullptr;
+            }
+
+            ~ThreadTimer()
+            {
+                if (handle != nullptr)
+                {
+                    ::CloseHandle(handle);
+                }
+            }
+        };
+
+        thread_local ThreadTimer t_timer;
+#else
+        constexpr uint64_t kSpinNs = 200'000ull;
+#endif
+    }
+
+    FramePacer::FramePacer(const FramePacerDesc& desc)
+        : m_desc(desc)
+        , m_periodNs(desc.refreshHz != 0 ? kNsPerSecond / desc.refreshHz : kDefaultPeriodNs)
+    {
+        m_stats.periodNs = m_periodNs;
+#if !defined(_WIN32)
+        // 대기 객체는 Windows 전용입니다. 다른 플랫폼에서는 받지 않고 주기에 맞춰 잠듭니다.
+        assert(desc.latencyWaitable == nullptr && "latencyWaitable은 Windows에서만 쓸 수 있습니다");
+        m_desc.latencyWaitable = nullptr;
+#endif
+    }
+
+    uint64_t FramePacer::beginFrame()
+    {
+        const uint64_t previousStart = m_frameStartNs;
+        const uint64_t before = Clock::nowNs();
+        uint64_t start = before;
+
+        if (m_desc.latencyWaitable != nullptr)
+        {
+#if defined(_WIN32)
+            ::WaitForSingleObjectEx(static_cast<HANDLE>(m_desc.latencyWaitable), kWaitableTimeoutMs, TRUE);
+#endif
+            start = Clock::nowNs();
+
+            // 신호 간격이 곧 주사율입니다. 놓친 프레임(주기의 1.5배를 넘는 간격)은 추정에서 뺍니다.
+            if (m_desc.refreshHz == 0 && previousStart != 0)
+            {
+                const uint64_t interval = start - previousStart;
+                if (interval < m_periodNs + m_periodNs / 2)
+                {
+                    m_periodNs = m_periodNs - m_periodNs / 8 + interval / 8;
+                }
+            }
+        }
+        else if (previousStart != 0)
+        {
+            // 목표 시각을 이전 시작 + 주기로 두어 잠의 오차가 쌓이지 않게 합니다. 한 주기 넘게 밀렸으면 새로 맞춥니다.
+            const uint64_t target = previousStart + m_periodNs;
+            if (target > before)
+            {
+                sleepUntilNs(target);
+            }
+            start = before < target + m_periodNs ? target : before;
+        }
+
+        m_frameStartNs = start;
+        m_sampled = false;
+        ++m_stats.frames;
+        m_stats.lastWaitNs = Clock::nowNs() - before;
+        m_stats.periodNs = m_periodNs;
+        return start;
+    }
+
+    uint64_t FramePacer::lateSampleTimeNs() const
+    {
+        const uint64_t lead = m_stats.predictedSubmitNs + m_desc.safetyMarginNs;
+        const uint64_t deadline = deadlineNs();
+        return deadline > m_frameStartNs + lead ? deadline - lead : m_frameStartNs;
+    }
+
+    uint64_t FramePacer::waitForLateSample()
+    {
+        uint64_t sample = lateSampleTimeNs();
+        const uint64_t now = Clock::nowNs();
+        if (sample > now)
+        {
+            sleepUntilNs(sample);
+        }
+        else
+        {
+            sample = now;
+        }
+        m_sampleNs = sample;
+        m_sampled = true;
+        return sample;
+    }
+
+    void FramePacer::endFrame()
+    {
+        const uint64_t now = Clock::nowNs();
+        if (m_sampled)
+        {
+            // 늘어날 때는 바로 따라가고 줄어들 때만 천천히 줄여, 한 번 느려진 제출 때문에 마감을 놓치지 않게 합니다.
+            const uint64_t submit = now - m_sampleNs;
+            uint64_t& predicted = m_stats.predictedSubmitNs;
+            predicted = submit > predicted ? submit : predicted - (predicted - submit) / 8;
+        }
+        if (now > deadlineNs())
+        {
+            ++m_stats.missedDeadlines;
+        }
+    }
+
+    void FramePacer::sleepUntilNs(uint64_t targetNs)
+    {
+        uint64_t now = Clock::nowNs();
+#if defined(_WIN32)
+        const uint64_t spinNs = t_timer.highResolution ? kSpinNs : kCoarseSpinNs;
+        if (targetNs > now + spinNs)
+        {
+            const uint64_t sleepNs = targetNs - now - spinNs;
+            if (t_timer.highResolution)
+            {
+                // 음수는 상대 시간이며 단위는 100ns입니다.
+                LARGE_INTEGER due;
+                due.QuadPart = -static_cast<LONGLONG>(sleepNs / 100);
+                if (::SetWaitableTimerEx(t_timer.handle, &due, 0, nullptr, nullptr, nullptr, 0))
+                {
+                    ::WaitForSingleObject(t_timer.handle, INFINITE);
+                }
+            }
+            else
+            {
+                ::Sleep(static_cast<DWORD>(sleepNs / 1'000'000ull));
+            }
+            now = Clock::nowNs();
+        }
+#else
+        // Clock은 TSC일 수 있어 절대 시각 대신 남은 시간만큼 잡니다. 신호로 일찍 깨면 다시 잡니다.
+        while (targetNs > now + kSpinNs)
+        {
+            const uint64_t sleepNs = targetNs - now - kSpinNs;
+            timespec duration;
+            duration.tv_sec = static_cast<time_t>(sleepNs / kNsPerSecond);
+            duration.tv_nsec = static_cast<long>(sleepNs % kNsPerSecond);
+            ::clock_nanosleep(CLOCK_MONOTONIC, 0, &duration, nullptr);
+            now = Clock::nowNs();
+        }
+#endif
+        while (now < targetNs)
+        {
+            std::this_thread::yield();
+            now = Clock::nowNs();
+        }
+    }
+}
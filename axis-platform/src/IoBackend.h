@@ -0,0 +1,36 @@
+#pragma once
+
+#include "axis/platform/AsyncIo.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace axis::detail
+{
+    // 비동기 읽기 백엔드. 모든 메서드는 wake를 제외하고 I/O 스레드에서만 호출됩니다.
+    // 단, openFile/closeFile은 AsyncIo의 파일 뮤텍스 아래에서 임의 스레드가 호출합니다.
+    class IoBackend
+    {
+    public:
+        virtual ~IoBackend() = default;
+
+        virtual AsyncIoBackend type() const = 0;
+
+        virtual bool openFile(const char* path, bool unbuffered, intptr_t& outHandle, uint64_t& outSize) = 0;
+        virtual void closeFile(intptr_t handle) = 0;
+
+        // 요청을 제출 목록에 넣습니다. 즉시 실패하면 result/error를 채우고 false를 반환합니다.
+        virtual bool enqueue(IoRequest& request) = 0;
+        // enqueue한 요청을 한 번에 커널로 넘깁니다.
+        virtual void flush() = 0;
+        // 완료된 요청을 maxCount개까지 out에 담습니다. result/bytesRead/error가 채워져 있습니다.
+        // block이면 완료나 wake가 올 때까지 기다리며, wake로 깨어나면 0을 반환할 수 있습니다.
+        virtual uint32_t reap(IoRequest** out, uint32_t maxCount, bool block) = 0;
+        // 다른 스레드에서 reap 대기를 깨웁니다.
+        virtual void wake() = 0;
+    };
+
+    // 플랫폼별 소스(IoBackendWin32.cpp / IoBackendPosix.cpp)에 있습니다.
+    // 선호 백엔드를 만들 수 없으면 다음으로 좋은 백엔드를 돌려줍니다.
+    std::unique_ptr<IoBackend> createIoBackend(const AsyncIoDesc& desc);
+}
@@ -0,0 +1,500 @@
+#include "IoBackend.h"
+
+#if !defined(_WIN32)
+
+    #include <algorithm>
+    #include <atomic>
+    #include <cerrno>
+    #include <condition_variable>
+    #include <cstring>
+    #include <mutex>
+    #include <vector>
+
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+    #if defined(__linux__)
+        #include <linux/io_uring.h>
+        #include <sys/eventfd.h>
+        #include <sys/mman.h>
+        #include <sys/syscall.h>
+    #endif
+
+namespace axis::detail
+{
+    namespace
+    {
+        bool openPosixFile(const char* path, bool unbuffered, intptr_t& outHandle, uint64_t& outSize)
+        {
+            int flags = O_RDONLY | O_CLOEXEC;
+    #if defined(O_DIRECT)
+            if (unbuffered)
+            {
+                flags |= O_DIRECT;
+            }
+    #endif
+            const int fd = ::open(path, flags);
+            if (fd < 0)
+            {
+                return false;
+            }
+    #if !defined(O_DIRECT) && defined(F_NOCACHE)
+            if (unbuffered)
+            {
+                ::fcntl(fd, F_NOCACHE, 1);
+            }
+    #endif
+
+            struct stat info;
+            if (::fstat(fd, &info) != 0)
+            {
+                ::close(fd);
+                return false;
+            }
+            outHandle = fd;
+            outSize = static_cast<uint64_t>(info.st_size);
+            return true;
+        }
+
+        void readBlocking(IoRequest& request)
+        {
+            const int fd = static_cast<int>(request.nativeFile);
+            uint8_t* buffer = static_cast<uint8_t*>(request.buffer);
+            uint32_t done = 0;
+            while (done < request.size)
+            {
+                const ssize_t result = ::pread(fd, buffer + done, request.size - done,
+                                               static_cast<off_t>(request.offset + done));
+                if (result < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    request.result = IoStatus::Failed;
+                    request.error = errno;
+                    request.bytesRead = done;
+                    return;
+                }
+                if (result == 0)
+                {
+                    break;
+                }
+                done += static_cast<uint32_t>(result);
+            }
+            request.result = IoStatus::Completed;
+            request.bytesRead = done;
+        }
+
+        // 커널 비동기 인터페이스가 없을 때의 대체 구현. I/O 스레드가 직접 pread를 호출합니다.
+        class BlockingBackend final : public IoBackend
+        {
+        public:
+            AsyncIoBackend type() const override { return AsyncIoBackend::Blocking; }
+
+            bool openFile(const char* path, bool unbuffered, intptr_t& outHandle, uint64_t& outSize) override
+            {
+                return openPosixFile(path, unbuffered, outHandle, outSize);
+            }
+
+            void closeFile(intptr_t handle) override { ::close(static_cast<int>(handle)); }
+
+            bool enqueue(IoRequest& request) override
+            {
+                m_queued.push_back(&request);
+                return true;
+            }
+
+            void flush() override {}
+
+            uint32_t reap(IoRequest** out, uint32_t maxCount, bool block) override
+            {
+                if (m_queued.empty())
+                {
+                    if (block)
+                    {
+                        std::unique_lock<std::mutex> lock(m_wakeMutex);
+                        m_wakeCondition.wait(lock, [this] { return m_woken; });
+                        m_woken = false;
+                    }
+                    return 0;
+                }
+
+                const uint32_t count = std::min(maxCount, static_cast<uint32_t>(m_queued.size()));
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    readBlocking(*m_queued[i]);
+                    out[i] = m_queued[i];
+                }
+                m_queued.erase(m_queued.begin(), m_queued.begin() + count);
+                return count;
+            }
+
+            void wake() override
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_wakeMutex);
+                    m_woken = true;
+                }
+                m_wakeCondition.notify_one();
+            }
+
+        private:
+            std::vector<IoRequest*> m_queued;
+            std::mutex m_wakeMutex;
+            std::condition_variable m_wakeCondition;
+            bool m_woken = false;
+        };
+
+    #if defined(__linux__)
+        int ioUringSetup(uint32_t entries, io_uring_params* params)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        int ioUringEnter(int ring, uint32_t toSubmit, uint32_t minComplete, uint32_t flags)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, ring, toSubmit, minComplete, flags, nullptr, 0));
+        }
+
+        template <typename T>
+        T loadAcquire(const T* p)
+        {
+            return std::atomic_ref<const T>(*p).load(std::memory_order_acquire);
+        }
+
+        template <typename T>
+        void storeRelease(T* p, T value)
+        {
+            std::atomic_ref<T>(*p).store(value, std::memory_order_release);
+        }
+
+        // liburing 없이 시스템 콜로 직접 다루는 io_uring.
+        // SQ는 I/O 스레드만 채우고 CQ도 I/O 스레드만 비우므로 링 인덱스는 단일 생산자/소비자 규칙만 지킵니다.
+        // wake용 eventfd 읽기를 항상 하나 걸어 두어, 제출이 들어오면 완료 대기가 풀리게 합니다.
+        class IoUringBackend final : public IoBackend
+        {
+        public:
+            ~IoUringBackend() override
+            {
+                if (m_sqes != nullptr)
+                {
+                    ::munmap(m_sqes, m_sqesSize);
+                }
+                if (m_cqRing != nullptr && m_cqRing != m_sqRing)
+                {
+                    ::munmap(m_cqRing, m_cqRingSize);
+                }
+                if (m_sqRing != nullptr)
+                {
+                    ::munmap(m_sqRing, m_sqRingSize);
+                }
+                if (m_ring >= 0)
+                {
+                    ::close(m_ring);
+                }
+                if (m_wakeFd >= 0)
+                {
+                    ::close(m_wakeFd);
+                }
+            }
+
+            bool initialize(uint32_t queueDepth)
+            {
+                m_wakeFd = ::eventfd(0, EFD_CLOEXEC);
+                if (m_wakeFd < 0)
+                {
+                    return false;
+                }
+
+                io_uring_params params;
+                std::memset(&params, 0, sizeof(params));
+                // wake용 읽기 하나를 위해 한 칸을 더 둡니다.
+                m_ring = ioUringSetup(queueDepth + 1, &params);
+                if (m_ring < 0)
+                {
+                    return false;
+                }
+
+                m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+                m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+                const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+                if (singleMap)
+                {
+                    m_sqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+                    m_cqRingSize = m_sqRingSize;
+                }
+
+                m_sqRing = ::mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring,
+                                  IORING_OFF_SQ_RING);
+                if (m_sqRing == MAP_FAILED)
+                {
+                    m_sqRing = nullptr;
+                    return false;
+                }
+                if (singleMap)
+                {
+                    m_cqRing = m_sqRing;
+                }
+                else
+                {
+                    m_cqRing = ::mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring,
+                                      IORING_OFF_CQ_RING);
+                    if (m_cqRing == MAP_FAILED)
+                    {
+                        m_cqRing = nullptr;
+                        return false;
+                    }
+                }
+
+                m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+                void* sqes = ::mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring,
+                                    IORING_OFF_SQES);
+                if (sqes == MAP_FAILED)
+                {
+                    return false;
+                }
+                m_sqes = static_cast<io_uring_sqe*>(sqes);
+
+                uint8_t* sq = static_cast<uint8_t*>(m_sqRing);
+                m_sqHead = reinterpret_cast<uint32_t*>(sq + params.sq_off.head);
+                m_sqTail = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+                m_sqArray = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+                m_sqMask = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+                m_sqEntries = params.sq_entries;
+                m_sqTailLocal = *m_sqTail;
+
+                uint8_t* cq = static_cast<uint8_t*>(m_cqRing);
+                m_cqHead = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+                m_cqTail = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+                m_cqMask = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+                m_cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+                return true;
+            }
+
+            AsyncIoBackend type() const override { return AsyncIoBackend::IoUring; }
+
+            bool openFile(const char* path, bool unbuffered, intptr_t& outHandle, uint64_t& outSize) override
+            {
+                return openPosixFile(path, unbuffered, outHandle, outSize);
+            }
+
+            void closeFile(intptr_t handle) override { ::close(static_cast<int>(handle)); }
+
+            bool enqueue(IoRequest& request) override
+            {
+                io_uring_sqe* sqe = nextSqe();
+                if (sqe == nullptr)
+                {
+                    request.result = IoStatus::Failed;
+                    request.error = EBUSY;
+                    return false;
+                }
+                prepareRead(*sqe, static_cast<int>(request.nativeFile), request.buffer, request.size, request.offset,
+                            reinterpret_cast<uint64_t>(&request));
+                return true;
+            }
+
+            void flush() override
+            {
+                armWake();
+                submitPending(0, 0);
+            }
+
+            uint32_t reap(IoRequest** out, uint32_t maxCount, bool block) override
+            {
+                uint32_t count = drainCompletions(out, maxCount);
+                if (count == 0 && block)
+                {
+                    armWake();
+                    submitPending(1, IORING_ENTER_GETEVENTS);
+                    count = drainCompletions(out, maxCount);
+                }
+                // drainCompletions가 다시 넘긴 남은 구간을 커널로 보냅니다.
+                if (m_toSubmit != 0)
+                {
+                    submitPending(0, 0);
+                }
+                return count;
+            }
+
+            void wake() override
+            {
+                const uint64_t one = 1;
+                [[maybe_unused]] const ssize_t written = ::write(m_wakeFd, &one, sizeof(one));
+            }
+
+        private:
+            // user_data 0은 wake 읽기입니다. 요청 주소는 0이 될 수 없습니다.
+            static constexpr uint64_t kWakeToken = 0;
+
+            static void prepareRead(io_uring_sqe& sqe, int fd, void* buffer, uint32_t size, uint64_t offset,
+                                    uint64_t userData)
+            {
+                std::memset(&sqe, 0, sizeof(sqe));
+                sqe.opcode = IORING_OP_READ;
+                sqe.fd = fd;
+                sqe.off = offset;
+                sqe.addr = reinterpret_cast<uint64_t>(buffer);
+                sqe.len = size;
+                sqe.user_data = userData;
+            }
+
+            // 완료된 요청은 SQ 칸을 쥐고 있지 않으므로, 큐 깊이 + wake 한 칸으로 만든 링에서는 보통 실패하지 않습니다.
+            bool resubmit(IoRequest& request)
+            {
+                io_uring_sqe* sqe = nextSqe();
+                if (sqe == nullptr)
+                {
+                    return false;
+                }
+                prepareRead(*sqe, static_cast<int>(request.nativeFile),
+                            static_cast<uint8_t*>(request.buffer) + request.bytesRead, request.size - request.bytesRead,
+                            request.offset + request.bytesRead, reinterpret_cast<uint64_t>(&request));
+                return true;
+            }
+
+            io_uring_sqe* nextSqe()
+            {
+                const uint32_t head = loadAcquire(m_sqHead);
+                if (m_sqTailLocal - head >= m_sqEntries)
+                {
+                    return nullptr;
+                }
+                const uint32_t index = m_sqTailLocal & m_sqMask;
+                m_sqArray[index] = index;
+                ++m_sqTailLocal;
+                ++m_toSubmit;
+                return &m_sqes[index];
+            }
+
+            void armWake()
+            {
+                if (m_wakeArmed)
+                {
+                    return;
+                }
+                io_uring_sqe* sqe = nextSqe();
+                if (sqe != nullptr)
+                {
+                    prepareRead(*sqe, m_wakeFd, &m_wakeValue, sizeof(m_wakeValue), 0, kWakeToken);
+                    m_wakeArmed = true;
+                }
+            }
+
+            void submitPending(uint32_t minComplete, uint32_t flags)
+            {
+                storeRelease(m_sqTail, m_sqTailLocal);
+                for (;;)
+                {
+                    const int result = ioUringEnter(m_ring, m_toSubmit, minComplete, flags);
+                    if (result >= 0)
+                    {
+                        m_toSubmit -= std::min(m_toSubmit, static_cast<uint32_t>(result));
+                        if (m_toSubmit == 0 || minComplete != 0)
+                        {
+                            return;
+                        }
+                        continue;
+                    }
+                    // EAGAIN/EBUSY면 남은 항목은 다음 호출에서 다시 넘깁니다.
+                    if (errno != EINTR)
+                    {
+                        return;
+                    }
+                }
+            }
+
+            uint32_t drainCompletions(IoRequest** out, uint32_t maxCount)
+            {
+                uint32_t head = *m_cqHead;
+                const uint32_t tail = loadAcquire(m_cqTail);
+                uint32_t count = 0;
+                while (head != tail && count < maxCount)
+                {
+                    const io_uring_cqe& cqe = m_cqes[head & m_cqMask];
+                    ++head;
+                    if (cqe.user_data == kWakeToken)
+                    {
+                        m_wakeArmed = false;
+                        continue;
+                    }
+
+                    // bytesRead는 지금까지 읽은 양입니다. 짧게 끝났거나 중단된 읽기는 readBlocking처럼 남은 구간을
+                    // 다시 넘기고, EOF(0)나 오류, 요청을 다 채웠을 때만 완료로 돌려줍니다.
+                    IoRequest* request = reinterpret_cast<IoRequest*>(cqe.user_data);
+                    const int res = cqe.res;
+                    if (res > 0)
+                    {
+                        request->bytesRead += static_cast<uint32_t>(res);
+                    }
+                    if ((res > 0 && request->bytesRead < request->size) || res == -EINTR || res == -EAGAIN)
+                    {
+                        if (resubmit(*request))
+                        {
+                            continue;
+                        }
+                        request->result = IoStatus::Failed;
+                        request->error = EBUSY;
+                    }
+                    else if (res < 0)
+                    {
+                        request->result = IoStatus::Failed;
+                        request->error = -res;
+                    }
+                    else
+                    {
+                        request->result = IoStatus::Completed;
+                    }
+                    out[count++] = request;
+                }
+                storeRelease(m_cqHead, head);
+                return count;
+            }
+
+            int m_ring = -1;
+            int m_wakeFd = -1;
+            uint64_t m_wakeValue = 0;
+            bool m_wakeArmed = false;
+
+            void* m_sqRing = nullptr;
+            void* m_cqRing = nullptr;
+            size_t m_sqRingSize = 0;
+            size_t m_cqRingSize = 0;
+            io_uring_sqe* m_sqes = nullptr;
+            size_t m_sqesSize = 0;
+
+            uint32_t* m_sqHead = nullptr;
+            uint32_t* m_sqTail = nullptr;
+            uint32_t* m_sqArray = nullptr;
+            uint32_t m_sqMask = 0;
+            uint32_t m_sqEntries = 0;
+            uint32_t m_sqTailLocal = 0;
+            uint32_t m_toSubmit = 0;
+
+            uint32_t* m_cqHead = nullptr;
+            uint32_t* m_cqTail = nullptr;
+            uint32_t m_cqMask = 0;
+            io_uring_cqe* m_cqes = nullptr;
+        };
+    #endif
+    }
+
+    std::unique_ptr<IoBackend> createIoBackend(const AsyncIoDesc& desc)
+    {
+    #if defined(__linux__)
+        // 컨테이너/seccomp 환경에서는 io_uring이 막혀 있을 수 있습니다.
+        auto ring = std::make_unique<IoUringBackend>();
+        if (ring->initialize(std::max(desc.queueDepth, 1u)))
+        {
+            return ring;
+        }
+    #else
+        (void)desc;
+    #endif
+        return std::make_unique<BlockingBackend>();
+    }
+}
+
+#endif
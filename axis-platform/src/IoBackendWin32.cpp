@@ -0,0 +1,416 @@
+#include "IoBackend.h"
+
+#if defined(_WIN32)
+
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+
+    #if defined(AXIS_PLATFORM_WITH_DIRECTSTORAGE)
+        #include <dstorage.h>
+        #pragma comment(lib, "dstorage.lib")
+    #endif
+
+    #include <algorithm>
+    #include <cstddef>
+    #include <string>
+    #include <vector>
+
+namespace axis::detail
+{
+    namespace
+    {
+        std::wstring widen(const char* path)
+        {
+            const int length = ::MultiByteToWideChar(CP_UTF8, 0, path, -1, nullptr, 0);
+            if (length <= 0)
+            {
+                return {};
+            }
+            std::wstring wide(static_cast<size_t>(length), L'\0');
+            ::MultiByteToWideChar(CP_UTF8, 0, path, -1, wide.data(), length);
+            wide.resize(static_cast<size_t>(length - 1));
+            return wide;
+        }
+
+        // IoRequest::backendStorage에 놓이는 요청별 상태. OVERLAPPED가 첫 멤버여야 합니다.
+        struct OverlappedRecord
+        {
+            OVERLAPPED overlapped;
+            IoRequest* request;
+        };
+
+        static_assert(sizeof(OverlappedRecord) <= sizeof(IoRequest::backendStorage));
+        static_assert(offsetof(OverlappedRecord, overlapped) == 0);
+
+        constexpr ULONG_PTR kFileKey = 1;
+        constexpr ULONG_PTR kWakeKey = 2;
+        constexpr ULONG kReapEntries = 64;
+
+        // 오버랩 ReadFile + I/O 완료 포트.
+        class IocpBackend final : public IoBackend
+        {
+        public:
+            ~IocpBackend() override
+            {
+                if (m_port != nullptr)
+                {
+                    ::CloseHandle(m_port);
+                }
+            }
+
+            bool initialize()
+            {
+                m_port = ::CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+                return m_port != nullptr;
+            }
+
+            AsyncIoBackend type() const override { return AsyncIoBackend::Iocp; }
+
+            bool openFile(const char* path, bool unbuffered, intptr_t& outHandle, uint64_t& outSize) override
+            {
+                const std::wstring wide = widen(path);
+                const DWORD flags = FILE_FLAG_OVERLAPPED | (unbuffered ? FILE_FLAG_NO_BUFFERING : 0);
+                HANDLE file = ::CreateFileW(wide.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags,
+                                            nullptr);
+                if (file == INVALID_HANDLE_VALUE)
+                {
+                    return false;
+                }
+
+                LARGE_INTEGER size;
+                if (!::GetFileSizeEx(file, &size) || ::CreateIoCompletionPort(file, m_port, kFileKey, 0) == nullptr)
+                {
+                    ::CloseHandle(file);
+                    return false;
+                }
+                // 완료는 포트로만 받으므로 파일 핸들의 이벤트 신호는 끕니다.
+                ::SetFileCompletionNotificationModes(file, FILE_SKIP_SET_EVENT_ON_HANDLE);
+
+                outHandle = reinterpret_cast<intptr_t>(file);
+                outSize = static_cast<uint64_t>(size.QuadPart);
+                return true;
+            }
+
+            void closeFile(intptr_t handle) override { ::CloseHandle(reinterpret_cast<HANDLE>(handle)); }
+
+            bool enqueue(IoRequest& request) override
+            {
+                OverlappedRecord* record = reinterpret_cast<OverlappedRecord*>(request.backendStorage);
+                ZeroMemory(&record->overlapped, sizeof(record->overlapped));
+                record->overlapped.Offset = static_cast<DWORD>(request.offset);
+                record->overlapped.OffsetHigh = static_cast<DWORD>(request.offset >> 32);
+                record->request = &request;
+
+                // 동기로 끝나더라도 완료 패킷은 포트로 들어오므로 처리 경로는 하나입니다.
+                if (!::ReadFile(reinterpret_cast<HANDLE>(request.nativeFile), request.buffer, request.size, nullptr,
+                                &record->overlapped))
+                {
+                    const DWORD error = ::GetLastError();
+                    if (error == ERROR_HANDLE_EOF)
+                    {
+                        request.result = IoStatus::Completed;
+                        request.bytesRead = 0;
+                        return false;
+                    }
+                    if (error != ERROR_IO_PENDING)
+                    {
+                        request.result = IoStatus::Failed;
+                        request.error = static_cast<int32_t>(error);
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            void flush() override {}
+
+            uint32_t reap(IoRequest** out, uint32_t maxCount, bool block) override
+            {
+                OVERLAPPED_ENTRY entries[kReapEntries];
+                ULONG removed = 0;
+                const ULONG capacity = std::min<ULONG>(kReapEntries, maxCount);
+                if (!::GetQueuedCompletionStatusEx(m_port, entries, capacity, &removed, block ? INFINITE : 0, FALSE))
+                {
+                    return 0;
+                }
+
+                uint32_t count = 0;
+                for (ULONG i = 0; i < removed; ++i)
+                {
+                    const OVERLAPPED_ENTRY& entry = entries[i];
+                    if (entry.lpCompletionKey == kWakeKey || entry.lpOverlapped == nullptr)
+                    {
+                        continue;
+                    }
+
+                    OverlappedRecord* record = reinterpret_cast<OverlappedRecord*>(entry.lpOverlapped);
+                    IoRequest& request = *record->request;
+                    // Internal은 NTSTATUS입니다. 파일 끝을 넘는 읽기(STATUS_END_OF_FILE)는 짧은 읽기로 봅니다.
+                    const LONG status = static_cast<LONG>(entry.lpOverlapped->Internal);
+                    constexpr LONG kStatusEndOfFile = static_cast<LONG>(0xC0000011L);
+                    if (status == 0 || status == kStatusEndOfFile)
+                    {
+                        request.result = IoStatus::Completed;
+                        request.bytesRead = entry.dwNumberOfBytesTransferred;
+                    }
+                    else
+                    {
+                        request.result = IoStatus::Failed;
+                        request.error = static_cast<int32_t>(status);
+                        request.bytesRead = 0;
+                    }
+                    out[count++] = &request;
+                }
+                return count;
+            }
+
+            void wake() override { ::PostQueuedCompletionStatus(m_port, 0, kWakeKey, nullptr); }
+
+        private:
+            HANDLE m_port = nullptr;
+        };
+
+    #if defined(AXIS_PLATFORM_WITH_DIRECTSTORAGE)
+        // DirectStorage 파일 -> 시스템 메모리 경로.
+        // 우선순위마다 큐를 하나씩 두고, 요청마다 상태 배열 칸을 하나 맡깁니다.
+        // 제출 묶음 끝에 이벤트를 걸어 두고, 이벤트가 오면 진행 중인 칸을 훑어 완료를 거둡니다.
+        // 파일 범위를 넘는 읽기는 짧은 읽기가 아니라 실패로 끝납니다.
+        class DirectStorageBackend final : public IoBackend
+        {
+        public:
+            ~DirectStorageBackend() override
+            {
+                for (IDStorageQueue* queue : m_queues)
+                {
+                    if (queue != nullptr)
+                    {
+                        queue->Close();
+                        queue->Release();
+                    }
+                }
+                if (m_status != nullptr)
+                {
+                    m_status->Release();
+                }
+                if (m_factory != nullptr)
+                {
+                    m_factory->Release();
+                }
+                if (m_completionEvent != nullptr)
+                {
+                    ::CloseHandle(m_completionEvent);
+                }
+                if (m_wakeEvent != nullptr)
+                {
+                    ::CloseHandle(m_wakeEvent);
+                }
+            }
+
+            bool initialize(uint32_t queueDepth)
+            {
+                m_capacity = std::clamp<uint32_t>(queueDepth, DSTORAGE_MIN_QUEUE_CAPACITY, DSTORAGE_MAX_QUEUE_CAPACITY);
+                if (FAILED(DStorageGetFactory(IID_PPV_ARGS(&m_factory))))
+                {
+                    return false;
+                }
+
+                const DSTORAGE_PRIORITY priorities[kIoPriorityCount] = {
+                    DSTORAGE_PRIORITY_REALTIME,
+                    DSTORAGE_PRIORITY_HIGH,
+                    DSTORAGE_PRIORITY_NORMAL,
+                    DSTORAGE_PRIORITY_LOW,
+                };
+                for (uint32_t i = 0; i < kIoPriorityCount; ++i)
+                {
+                    DSTORAGE_QUEUE_DESC desc = {};
+                    desc.SourceType = DSTORAGE_REQUEST_SOURCE_FILE;
+                    desc.Capacity = static_cast<UINT16>(m_capacity);
+                    desc.Priority = priorities[i];
+                    desc.Name = "axis.io";
+                    desc.Device = nullptr;
+                    if (FAILED(m_factory->CreateQueue(&desc, IID_PPV_ARGS(&m_queues[i]))))
+                    {
+                        return false;
+                    }
+                }
+
+                if (FAILED(m_factory->CreateStatusArray(m_capacity, "axis.io", IID_PPV_ARGS(&m_status))))
+                {
+                    return false;
+                }
+
+                m_completionEvent = ::CreateEventW(nullptr, FALSE, FALSE, nullptr);
+                m_wakeEvent = ::CreateEventW(nullptr, FALSE, FALSE, nullptr);
+                if (m_completionEvent == nullptr || m_wakeEvent == nullptr)
+                {
+                    return false;
+                }
+
+                m_slots.assign(m_capacity, nullptr);
+                m_freeSlots.reserve(m_capacity);
+                for (uint32_t slot = m_capacity; slot > 0; --slot)
+                {
+                    m_freeSlots.push_back(slot - 1);
+                }
+                return true;
+            }
+
+            AsyncIoBackend type() const override { return AsyncIoBackend::DirectStorage; }
+
+            bool openFile(const char* path, bool, intptr_t& outHandle, uint64_t& outSize) override
+            {
+                // DirectStorage는 항상 OS 캐시를 거치지 않고 읽으므로 unbuffered 구분이 없습니다.
+                IDStorageFile* file = nullptr;
+                if (FAILED(m_factory->OpenFile(widen(path).c_str(), IID_PPV_ARGS(&file))))
+                {
+                    return false;
+                }
+
+                BY_HANDLE_FILE_INFORMATION info = {};
+                if (FAILED(file->GetFileInformation(&info)))
+                {
+                    file->Close();
+                    file->Release();
+                    return false;
+                }
+                outHandle = reinterpret_cast<intptr_t>(file);
+                outSize = (static_cast<uint64_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+                return true;
+            }
+
+            void closeFile(intptr_t handle) override
+            {
+                IDStorageFile* file = reinterpret_cast<IDStorageFile*>(handle);
+                file->Close();
+                file->Release();
+            }
+
+            bool enqueue(IoRequest& request) override
+            {
+                if (m_freeSlots.empty())
+                {
+                    request.result = IoStatus::Failed;
+                    request.error = static_cast<int32_t>(E_OUTOFMEMORY);
+                    return false;
+                }
+                const uint32_t slot = m_freeSlots.back();
+                m_freeSlots.pop_back();
+                m_slots[slot] = &request;
+                m_inFlight.push_back(slot);
+
+                DSTORAGE_REQUEST entry = {};
+                entry.Options.SourceType = DSTORAGE_REQUEST_SOURCE_FILE;
+                entry.Options.DestinationType = DSTORAGE_REQUEST_DESTINATION_MEMORY;
+                entry.Source.File.Source = reinterpret_cast<IDStorageFile*>(request.nativeFile);
+                entry.Source.File.Offset = request.offset;
+                entry.Source.File.Size = request.size;
+                entry.Destination.Memory.Buffer = request.buffer;
+                entry.Destination.Memory.Size = request.size;
+                entry.UncompressedSize = request.size;
+
+                const uint32_t priority = static_cast<uint32_t>(request.priority);
+                m_queues[priority]->EnqueueRequest(&entry);
+                m_queues[priority]->EnqueueStatus(m_status, slot);
+                m_dirtyQueues |= 1u << priority;
+                return true;
+            }
+
+            void flush() override
+            {
+                for (uint32_t i = 0; i < kIoPriorityCount; ++i)
+                {
+                    if ((m_dirtyQueues & (1u << i)) != 0)
+                    {
+                        m_queues[i]->EnqueueSetEvent(m_completionEvent);
+                        m_queues[i]->Submit();
+                    }
+                }
+                m_dirtyQueues = 0;
+            }
+
+            uint32_t reap(IoRequest** out, uint32_t maxCount, bool block) override
+            {
+                uint32_t count = collect(out, maxCount);
+                if (count == 0 && block)
+                {
+                    const HANDLE events[2] = {m_completionEvent, m_wakeEvent};
+                    ::WaitForMultipleObjects(2, events, FALSE, INFINITE);
+                    count = collect(out, maxCount);
+                }
+                return count;
+            }
+
+            void wake() override { ::SetEvent(m_wakeEvent); }
+
+        private:
+            uint32_t collect(IoRequest** out, uint32_t maxCount)
+            {
+                uint32_t count = 0;
+                for (size_t i = 0; i < m_inFlight.size() && count < maxCount;)
+                {
+                    const uint32_t slot = m_inFlight[i];
+                    if (!m_status->IsComplete(slot))
+                    {
+                        ++i;
+                        continue;
+                    }
+
+                    IoRequest& request = *m_slots[slot];
+                    const HRESULT hr = m_status->GetHResult(slot);
+                    request.result = SUCCEEDED(hr) ? IoStatus::Completed : IoStatus::Failed;
+                    request.bytesRead = SUCCEEDED(hr) ? request.size : 0;
+                    request.error = SUCCEEDED(hr) ? 0 : static_cast<int32_t>(hr);
+                    out[count++] = &request;
+
+                    m_slots[slot] = nullptr;
+                    m_freeSlots.push_back(slot);
+                    m_inFlight[i] = m_inFlight.back();
+                    m_inFlight.pop_back();
+                }
+                return count;
+            }
+
+            IDStorageFactory* m_factory = nullptr;
+            IDStorageQueue* m_queues[kIoPriorityCount] = {};
+            IDStorageStatusArray* m_status = nullptr;
+            HANDLE m_completionEvent = nullptr;
+            HANDLE m_wakeEvent = nullptr;
+            uint32_t m_capacity = 0;
+            uint32_t m_dirtyQueues = 0;
+            std::vector<IoRequest*> m_slots;
+            std::vector<uint32_t> m_freeSlots;
+            std::vector<uint32_t> m_inFlight;
+        };
+    #endif
+    }
+
+    std::unique_ptr<IoBackend> createIoBackend(const AsyncIoDesc& desc)
+    {
+    #if defined(AXIS_PLATFORM_WITH_DIRECTSTORAGE)
+        if (desc.preferDirectStorage)
+        {
+            auto storage = std::make_unique<DirectStorageBackend>();
+            if (storage->initialize(desc.queueDepth))
+            {
+                return storage;
+            }
+        }
+    #else
+        (void)desc;
+    #endif
+
+        auto iocp = std::make_unique<IocpBackend>();
+        if (!iocp->initialize())
+        {
+            return nullptr;
+        }
+        return iocp;
+    }
+}
+
+#endif
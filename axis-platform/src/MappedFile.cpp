@@ -0,0 +1,226 @@
+#include "axis/platform/MappedFile.h"
+
+#include <utility>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+
+    #include <string>
+#else
+    #include <fcntl.h>
+    #include <stdio.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace axis
+{
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr))
+        , m_size(std::exchange(other.m_size, 0))
+        , m_file(std::exchange(other.m_file, -1))
+        , m_mapping(std::exchange(other.m_mapping, 0))
+        , m_open(std::exchange(other.m_open, false))
+    {
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_file = std::exchange(other.m_file, -1);
+            m_mapping = std::exchange(other.m_mapping, 0);
+            m_open = std::exchange(other.m_open, false);
+        }
+        return *this;
+    }
+
+#if defined(_WIN32)
+    bool MappedFile::open(const char* path)
+    {
+        close();
+
+        const int length = ::MultiByteToWideChar(CP_UTF8, 0, path, -1, nullptr, 0);
+        if (length <= 0)
+        {
+            return false;
+        }
+        std::wstring wide(static_cast<size_t>(length), L'\0');
+        ::MultiByteToWideChar(CP_UTF8, 0, path, -1, wide.data(), length);
+
+        HANDLE file = ::CreateFileW(wide.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(file, &size))
+        {
+            ::CloseHandle(file);
+            return false;
+        }
+
+        m_file = reinterpret_cast<intptr_t>(file);
+        m_size = static_cast<uint64_t>(size.QuadPart);
+        m_open = true;
+        if (m_size == 0)
+        {
+            return true;
+        }
+
+        // 크기 0인 매핑은 만들 수 없으므로 빈 파일은 여기까지만 진행합니다.
+        HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            close();
+            return false;
+        }
+        m_mapping = reinterpret_cast<intptr_t>(mapping);
+
+        m_data = static_cast<const uint8_t*>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (m_data == nullptr)
+        {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void MappedFile::close()
+    {
+        if (m_data != nullptr)
+        {
+            ::UnmapViewOfFile(m_data);
+        }
+        if (m_mapping != 0)
+        {
+            ::CloseHandle(reinterpret_cast<HANDLE>(m_mapping));
+        }
+        if (m_file != -1)
+        {
+            ::CloseHandle(reinterpret_cast<HANDLE>(m_file));
+        }
+        m_data = nullptr;
+        m_size = 0;
+        m_file = -1;
+        m_mapping = 0;
+        m_open = false;
+    }
+
+    void MappedFile::prefetch(uint64_t offset, uint64_t size) const
+    {
+        if (m_data == nullptr || offset >= m_size)
+        {
+            return;
+        }
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = const_cast<uint8_t*>(m_data + offset);
+        range.NumberOfBytes = static_cast<SIZE_T>(size < m_size - offset ? size : m_size - offset);
+        ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0);
+    }
+
+    bool replaceFile(const char* source, const char* destination)
+    {
+        const int sourceLength = ::MultiByteToWideChar(CP_UTF8, 0, source, -1, nullptr, 0);
+        const int destinationLength = ::MultiByteToWideChar(CP_UTF8, 0, destination, -1, nullptr, 0);
+        if (sourceLength <= 0 || destinationLength <= 0)
+        {
+            return false;
+        }
+        std::wstring wideSource(static_cast<size_t>(sourceLength), L'\0');
+        std::wstring wideDestination(static_cast<size_t>(destinationLength), L'\0');
+        ::MultiByteToWideChar(CP_UTF8, 0, source, -1, wideSource.data(), sourceLength);
+        ::MultiByteToWideChar(CP_UTF8, 0, destination, -1, wideDestination.data(), destinationLength);
+
+        return ::MoveFileExW(wideSource.c_str(), wideDestination.c_str(),
+                             MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+    }
+#else
+    bool MappedFile::open(const char* path)
+    {
+        close();
+
+        const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        m_file = fd;
+        m_size = static_cast<uint64_t>(info.st_size);
+        m_open = true;
+        if (m_size == 0)
+        {
+            return true;
+        }
+
+        void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close();
+            return false;
+        }
+        m_data = static_cast<const uint8_t*>(data);
+        return true;
+    }
+
+    void MappedFile::close()
+    {
+        if (m_data != nullptr)
+        {
+            ::munmap(const_cast<uint8_t*>(m_data), m_size);
+        }
+        if (m_file != -1)
+        {
+            ::close(static_cast<int>(m_file));
+        }
+        m_data = nullptr;
+        m_size = 0;
+        m_file = -1;
+        m_mapping = 0;
+        m_open = false;
+    }
+
+    void MappedFile::prefetch(uint64_t offset, uint64_t size) const
+    {
+        if (m_data == nullptr || offset >= m_size)
+        {
+            return;
+        }
+        // madvise는 페이지 경계에서 시작해야 합니다.
+        const uint64_t pageSize = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+        const uint64_t begin = offset & ~(pageSize - 1);
+        const uint64_t end = offset + (size < m_size - offset ? size : m_size - offset);
+        ::madvise(const_cast<uint8_t*>(m_data + begin), end - begin, MADV_WILLNEED);
+    }
+
+    bool replaceFile(const char* source, const char* destination)
+    {
+        return ::rename(source, destination) == 0;
+    }
+#endif
+}
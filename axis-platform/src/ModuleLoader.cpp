@@ -0,0 +1,374 @@
+#include "axis/platform/ModuleLoader.h"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+namespace axis
+{
+    namespace
+    {
+        // 경로 문자열은 UTF-8이므로 filesystem::path로 바꿀 때 시스템 코드 페이지를 거치지 않게 합니다.
+        std::filesystem::path toPath(const std::string& utf8)
+        {
+            return std::filesystem::path(std::u8string(reinterpret_cast<const char8_t*>(utf8.data()), utf8.size()));
+        }
+
+        std::string toUtf8(const std::filesystem::path& path)
+        {
+            const std::u8string text = path.u8string();
+            return std::string(reinterpret_cast<const char*>(text.data()), text.size());
+        }
+
+        uint64_t nowNs()
+        {
+            const auto now = std::chrono::steady_clock::now().time_since_epoch();
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+        }
+
+        void appendState(void* context, const void* data, size_t size)
+        {
+            std::vector<uint8_t>& state = *static_cast<std::vector<uint8_t>*>(context);
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            state.insert(state.end(), bytes, bytes + size);
+        }
+
+        void removeCopy(const std::string& path)
+        {
+            // Windows에서는 다른 곳에서 아직 잡고 있으면 지우지 못합니다. 다음 세션에서 덮어쓰므로 무시합니다.
+            std::error_code error;
+            std::filesystem::remove(toPath(path), error);
+        }
+    }
+
+    ModuleLoader::~ModuleLoader()
+    {
+        for (size_t i = m_modules.size(); i > 0; --i)
+        {
+            unload(static_cast<ModuleId>(i - 1));
+        }
+    }
+
+    ModuleLoader::Module* ModuleLoader::find(ModuleId module) const
+    {
+        return module < m_modules.size() ? m_modules[module].get() : nullptr;
+    }
+
+    ModuleId ModuleLoader::load(const ModuleDesc& desc)
+    {
+        if (desc.path == nullptr)
+        {
+            return kInvalidModule;
+        }
+
+        auto module = std::make_unique<Module>();
+        module->desc = desc;
+        module->path = desc.path;
+        module->shadowDirectory = desc.shadowDirectory != nullptr ? std::string(desc.shadowDirectory)
+                                                                   : toUtf8(toPath(desc.path).parent_path());
+        module->functionTableSize = desc.functionTableSize;
+
+        const ModuleId id = static_cast<ModuleId>(m_modules.size());
+        module->loadedStamp = currentStamp(module->path);
+
+        const ModuleApi* api = nullptr;
+        if (!openCopy(*module, module->library, module->libraryPath, api) ||
+            !startInstance(*module, api, nullptr, 0))
+        {
+            // 열린 복사본은 Windows에서 지울 수 없으므로 먼저 닫습니다.
+            module->library.close();
+            removeCopy(module->libraryPath);
+            return kInvalidModule;
+        }
+        publishFunctions(*module);
+
+        m_modules.push_back(std::move(module));
+        if (desc.afterLoad != nullptr)
+        {
+            desc.afterLoad(id, desc.userData);
+        }
+        return id;
+    }
+
+    void ModuleLoader::unload(ModuleId id)
+    {
+        Module* module = find(id);
+        if (module == nullptr)
+        {
+            return;
+        }
+
+        if (module->desc.beforeUnload != nullptr)
+        {
+            module->desc.beforeUnload(id, module->desc.userData);
+        }
+        if (module->instance != nullptr)
+        {
+            module->api->destroy(module->instance);
+        }
+        module->library.close();
+        removeCopy(module->libraryPath);
+        m_modules[id].reset();
+    }
+
+    bool ModuleLoader::reload(ModuleId id)
+    {
+        Module* module = find(id);
+        if (module == nullptr)
+        {
+            return false;
+        }
+
+        const uint64_t start = nowNs();
+        const FileStamp stamp = currentStamp(module->path);
+
+        // 새 복사본을 먼저 열어 검사합니다. 여기서 실패하면 실행 중인 인스턴스는 건드리지 않습니다.
+        DynamicLibrary library;
+        std::string libraryPath;
+        const ModuleApi* api = nullptr;
+        if (!openCopy(*module, library, libraryPath, api))
+        {
+            library.close();
+            removeCopy(libraryPath);
+            return false;
+        }
+
+        const ModuleApi* oldApi = module->api;
+        std::vector<uint8_t> state;
+        if (oldApi->saveState != nullptr)
+        {
+            ModuleStateWriter writer{&state, &appendState};
+            if (!oldApi->saveState(module->instance, &writer))
+            {
+                state.clear();
+            }
+        }
+
+        if (module->desc.beforeUnload != nullptr)
+        {
+            module->desc.beforeUnload(id, module->desc.userData);
+        }
+        oldApi->destroy(module->instance);
+        module->instance = nullptr;
+
+        if (!startInstance(*module, api, &state, oldApi->stateVersion))
+        {
+            // 새 코드가 인스턴스를 만들지 못했습니다. 아직 열려 있는 이전 복사본으로 되돌립니다.
+            const char* error = module->info.error;
+            library.close();
+            removeCopy(libraryPath);
+            if (!startInstance(*module, oldApi, &state, oldApi->stateVersion))
+            {
+                // 이전 코드로도 만들지 못했습니다. 인스턴스 없이 불러온 채로 두지 않고 내린 상태로 둡니다.
+                // beforeUnload는 이미 불렀으므로 unload를 거치지 않습니다.
+                module->library.close();
+                removeCopy(module->libraryPath);
+                m_modules[id].reset();
+                return false;
+            }
+            module->info.error = error;
+            if (module->desc.afterLoad != nullptr)
+            {
+                module->desc.afterLoad(id, module->desc.userData);
+            }
+            module->loadedStamp = stamp;
+            return false;
+        }
+
+        std::swap(module->library, library);
+        std::swap(module->libraryPath, libraryPath);
+        publishFunctions(*module);
+        module->loadedStamp = stamp;
+        module->info.stateBytes = state.size();
+
+        if (module->desc.afterLoad != nullptr)
+        {
+            module->desc.afterLoad(id, module->desc.userData);
+        }
+
+        // 이제 이전 복사본을 가리키는 것이 없습니다.
+        library.close();
+        removeCopy(libraryPath);
+        module->info.reloadNs = nowNs() - start;
+        return true;
+    }
+
+    uint32_t ModuleLoader::pollChanges()
+    {
+        uint32_t reloaded = 0;
+        for (size_t i = 0; i < m_modules.size(); ++i)
+        {
+            Module* module = m_modules[i].get();
+            if (module == nullptr)
+            {
+                continue;
+            }
+
+            // 빌드 도중에는 파일이 잠시 없거나 크기가 0일 수 있습니다.
+            const FileStamp stamp = currentStamp(module->path);
+            if (stamp.size == 0 || stamp == module->loadedStamp)
+            {
+                module->pendingStamp = {};
+                continue;
+            }
+            if (!(stamp == module->pendingStamp))
+            {
+                module->pendingStamp = stamp;
+                continue;
+            }
+
+            module->pendingStamp = {};
+            if (reload(static_cast<ModuleId>(i)))
+            {
+                ++reloaded;
+            }
+            else if (m_modules[i] != nullptr)
+            {
+                // 깨진 빌드를 매번 다시 열지 않도록 이 시각/크기는 처리한 것으로 둡니다. 되돌리기까지 실패했으면 모듈이 없습니다.
+                module->loadedStamp = stamp;
+            }
+        }
+        return reloaded;
+    }
+
+    void* ModuleLoader::instance(ModuleId id) const
+    {
+        const Module* module = find(id);
+        return module != nullptr ? module->instance : nullptr;
+    }
+
+    const ModuleApi* ModuleLoader::api(ModuleId id) const
+    {
+        const Module* module = find(id);
+        return module != nullptr ? module->api : nullptr;
+    }
+
+    bool ModuleLoader::isLoaded(ModuleId id) const
+    {
+        return find(id) != nullptr;
+    }
+
+    ModuleInfo ModuleLoader::info(ModuleId id) const
+    {
+        const Module* module = find(id);
+        return module != nullptr ? module->info : ModuleInfo{};
+    }
+
+    bool ModuleLoader::ownsAddress(ModuleId id, const void* address) const
+    {
+        const Module* module = find(id);
+        return module != nullptr && module->library.contains(address);
+    }
+
+    const void* ModuleLoader::functionTable(ModuleId id) const
+    {
+        const Module* module = find(id);
+        return module != nullptr ? module->functionTable.get() : nullptr;
+    }
+
+    ModuleLoader::FileStamp ModuleLoader::currentStamp(const std::string& path)
+    {
+        std::error_code error;
+        const std::filesystem::path file = toPath(path);
+        const auto time = std::filesystem::last_write_time(file, error);
+        if (error)
+        {
+            return {};
+        }
+        const uint64_t size = std::filesystem::file_size(file, error);
+        if (error)
+        {
+            return {};
+        }
+        return FileStamp{static_cast<int64_t>(time.time_since_epoch().count()), size};
+    }
+
+    bool ModuleLoader::openCopy(Module& module, DynamicLibrary& library, std::string& libraryPath,
+                                const ModuleApi*& api)
+    {
+        // 불러올 때마다 다른 이름으로 복사합니다. 원본이 잠기지 않아 빌드가 덮어쓸 수 있고,
+        // 같은 경로를 다시 열 때 OS가 이전 이미지를 돌려주는 일도 없습니다.
+        const std::filesystem::path source = toPath(module.path);
+        std::filesystem::path copy = toPath(module.shadowDirectory);
+        copy /= source.stem();
+        copy += ".hot" + std::to_string(module.info.loadCount + 1);
+        copy += source.extension();
+        libraryPath = toUtf8(copy);
+
+        std::error_code error;
+        std::filesystem::copy_file(source, copy, std::filesystem::copy_options::overwrite_existing, error);
+        if (error)
+        {
+            module.info.error = "모듈 파일을 복사하지 못했습니다";
+            return false;
+        }
+
+        if (!library.open(libraryPath.c_str()))
+        {
+            module.info.error = "모듈 DLL을 열지 못했습니다";
+            return false;
+        }
+
+        const ModuleEntryFunction entry = library.function<ModuleEntryFunction>(kModuleEntrySymbol);
+        api = entry != nullptr ? entry(kModuleApiVersion) : nullptr;
+        if (api == nullptr)
+        {
+            module.info.error = "모듈 진입점이 없습니다";
+            return false;
+        }
+        if (api->apiVersion != kModuleApiVersion || api->create == nullptr || api->destroy == nullptr)
+        {
+            module.info.error = "모듈 API 버전이 맞지 않습니다";
+            return false;
+        }
+        if (module.functionTableSize != 0 && api->functionsSize != module.functionTableSize)
+        {
+            module.info.error = "모듈 함수 표 크기가 맞지 않습니다";
+            return false;
+        }
+        return true;
+    }
+
+    bool ModuleLoader::startInstance(Module& module, const ModuleApi* api, const std::vector<uint8_t>* state,
+                                     uint32_t stateVersion)
+    {
+        const ModuleContext context{module.desc.hostData, module.info.loadCount + 1};
+        void* instance = api->create(&context);
+        if (instance == nullptr)
+        {
+            module.info.error = "모듈 인스턴스를 만들지 못했습니다";
+            return false;
+        }
+
+        if (state != nullptr && !state->empty() && api->loadState != nullptr)
+        {
+            api->loadState(instance, state->data(), state->size(), stateVersion);
+        }
+
+        module.api = api;
+        module.instance = instance;
+        module.info.name = api->name;
+        module.info.loadCount++;
+        module.info.error = nullptr;
+        return true;
+    }
+
+    void ModuleLoader::publishFunctions(Module& module)
+    {
+        const ModuleApi* api = module.api;
+        if (api->functions == nullptr || api->functionsSize == 0)
+        {
+            return;
+        }
+
+        // 표 크기는 처음 불러온 모듈로 정해지고, 이후 다른 크기의 모듈은 openCopy에서 거절됩니다.
+        if (module.functionTable == nullptr)
+        {
+            module.functionTableSize = api->functionsSize;
+            const size_t words = (api->functionsSize + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+            module.functionTable = std::make_unique<std::max_align_t[]>(words);
+        }
+        std::memcpy(module.functionTable.get(), api->functions, api->functionsSize);
+    }
+}
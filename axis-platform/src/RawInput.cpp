@@ -0,0 +1,573 @@
+#include "axis/platform/RawInput.h"
+
+#include "axis/platform/Clock.h"
+
+#include <cstring>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#elif defined(__linux__)
+    #include <fcntl.h>
+    #include <linux/input.h>
+    #include <poll.h>
+    #include <sys/eventfd.h>
+    #include <sys/ioctl.h>
+    #include <time.h>
+    #include <unistd.h>
+
+    #include <cstdio>
+#endif
+
+namespace axis
+{
+    namespace
+    {
+        // 한 번에 sink로 넘기는 최대 이벤트 수. 넘치면 나눠 넘깁니다.
+        constexpr uint32_t kBatchCapacity = 256;
+        constexpr uint32_t kMaxDevices = 32;
+
+        // 입력 스레드 안에서만 쓰는 이벤트 모음.
+        struct EventBatch
+        {
+            InputEvent events[kBatchCapacity];
+            uint32_t count = 0;
+
+            // 가득 차면 false. 호출한 쪽이 먼저 넘기고 다시 넣습니다.
+            bool push(const InputEvent& event)
+            {
+                if (count == kBatchCapacity)
+                {
+                    return false;
+                }
+                events[count++] = event;
+                return true;
+            }
+        };
+
+        InputEvent makeEvent(uint64_t timestampNs, InputEventType type, uint8_t device, uint16_t code, int32_t x = 0,
+                             int32_t y = 0)
+        {
+            InputEvent event;
+            event.timestampNs = timestampNs;
+            event.type = type;
+            event.device = device;
+            event.code = code;
+            event.x = x;
+            event.y = y;
+            return event;
+        }
+    }
+
+    RawInput::RawInput(const RawInputDesc& desc)
+        : m_desc(desc)
+    {
+#if defined(_WIN32)
+        m_backend = RawInputBackend::WmInput;
+#elif defined(__linux__)
+        m_backend = RawInputBackend::Evdev;
+#endif
+        if (m_backend == RawInputBackend::None || desc.sink == nullptr || (!desc.keyboard && !desc.mouse))
+        {
+            m_backend = RawInputBackend::None;
+            return;
+        }
+
+        // 장치를 열고 등록하는 일은 입력 스레드가 하므로, 그 결과가 나올 때까지 기다려 isRunning을 확정합니다.
+        m_thread = std::thread(&RawInput::threadMain, this);
+        while (!m_ready.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    RawInput::~RawInput()
+    {
+        if (!m_thread.joinable())
+        {
+            return;
+        }
+
+        if (m_running.load(std::memory_order_acquire))
+        {
+            const intptr_t handle = m_wakeHandle.load(std::memory_order_acquire);
+#if defined(_WIN32)
+            ::PostMessageW(reinterpret_cast<HWND>(handle), WM_CLOSE, 0, 0);
+#elif defined(__linux__)
+            const uint64_t one = 1;
+            [[maybe_unused]] const ssize_t written = ::write(static_cast<int>(handle), &one, sizeof(one));
+#endif
+        }
+        m_thread.join();
+    }
+
+    RawInputStats RawInput::stats() const
+    {
+        RawInputStats result;
+        result.events = m_events.load(std::memory_order_relaxed);
+        result.batches = m_batches.load(std::memory_order_relaxed);
+        result.devices = m_devices.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    void RawInput::deliver(const InputEvent* events, uint32_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        m_desc.sink(events, count, m_desc.context);
+        m_events.fetch_add(count, std::memory_order_relaxed);
+        m_batches.fetch_add(1, std::memory_order_relaxed);
+    }
+
+#if defined(_WIN32)
+    namespace
+    {
+        struct WindowsInputState
+        {
+            EventBatch batch;
+            HANDLE devices[kMaxDevices] = {};
+            uint32_t deviceCount = 0;
+            bool background = false;
+        };
+
+        uint8_t deviceIndex(WindowsInputState& state, HANDLE device)
+        {
+            for (uint32_t i = 0; i < state.deviceCount; ++i)
+            {
+                if (state.devices[i] == device)
+                {
+                    return static_cast<uint8_t>(i);
+                }
+            }
+            if (state.deviceCount == kMaxDevices)
+            {
+                return 0;
+            }
+            state.devices[state.deviceCount] = device;
+            return static_cast<uint8_t>(state.deviceCount++);
+        }
+
+        bool isForeground()
+        {
+            DWORD process = 0;
+            const HWND foreground = ::GetForegroundWindow();
+            return foreground != nullptr && ::GetWindowThreadProcessId(foreground, &process) != 0 &&
+                   process == ::GetCurrentProcessId();
+        }
+
+        // RAWINPUT 하나를 InputEvent로 옮깁니다. 모음이 차면 flush로 먼저 넘깁니다.
+        template <typename Flush>
+        void translate(WindowsInputState& state, const RAWINPUT& input, uint64_t timestampNs, Flush&& flush)
+        {
+            auto push = [&](const InputEvent& event) {
+                if (!state.batch.push(event))
+                {
+                    flush();
+                    state.batch.push(event);
+                }
+            };
+
+            const uint8_t device = deviceIndex(state, input.header.hDevice);
+            if (input.header.dwType == RIM_TYPEKEYBOARD)
+            {
+                const RAWKEYBOARD& keyboard = input.data.keyboard;
+                // 255는 일부 키 조합이 만드는 가짜 키입니다.
+                if (keyboard.VKey == 0xFF || keyboard.MakeCode == 0)
+                {
+                    return;
+                }
+                uint16_t code = keyboard.MakeCode;
+                if ((keyboard.Flags & RI_KEY_E0) != 0)
+                {
+                    code |= kScanCodeExtended;
+                }
+                const InputEventType type =
+                    (keyboard.Flags & RI_KEY_BREAK) != 0 ? InputEventType::KeyUp : InputEventType::KeyDown;
+                push(makeEvent(timestampNs, type, device, code));
+                return;
+            }
+
+            if (input.header.dwType != RIM_TYPEMOUSE)
+            {
+                return;
+            }
+
+            const RAWMOUSE& mouse = input.data.mouse;
+            // 원격 데스크톱과 태블릿은 절대 좌표를 보냅니다. 상대 이동만 넘깁니다.
+            if ((mouse.usFlags & MOUSE_MOVE_ABSOLUTE) == 0 && (mouse.lLastX != 0 || mouse.lLastY != 0))
+            {
+                push(makeEvent(timestampNs, InputEventType::MouseMove, device, 0, mouse.lLastX, mouse.lLastY));
+            }
+
+            static const USHORT kButtonFlags[][2] = {
+                {RI_MOUSE_LEFT_BUTTON_DOWN, RI_MOUSE_LEFT_BUTTON_UP},
+                {RI_MOUSE_RIGHT_BUTTON_DOWN, RI_MOUSE_RIGHT_BUTTON_UP},
+                {RI_MOUSE_MIDDLE_BUTTON_DOWN, RI_MOUSE_MIDDLE_BUTTON_UP},
+                {RI_MOUSE_BUTTON_4_DOWN, RI_MOUSE_BUTTON_4_UP},
+                {RI_MOUSE_BUTTON_5_DOWN, RI_MOUSE_BUTTON_5_UP},
+            };
+            const USHORT buttons = mouse.usButtonFlags;
+            for (uint16_t button = 0; button < 5; ++button)
+            {
+                if ((buttons & kButtonFlags[button][0]) != 0)
+                {
+                    push(makeEvent(timestampNs, InputEventType::MouseButtonDown, device, button));
+                }
+                if ((buttons & kButtonFlags[button][1]) != 0)
+                {
+                    push(makeEvent(timestampNs, InputEventType::MouseButtonUp, device, button));
+                }
+            }
+
+            const int32_t wheel = static_cast<SHORT>(mouse.usButtonData);
+            if ((buttons & RI_MOUSE_WHEEL) != 0)
+            {
+                push(makeEvent(timestampNs, InputEventType::MouseWheel, device, 0, 0, wheel));
+            }
+            if ((buttons & RI_MOUSE_HWHEEL) != 0)
+            {
+                push(makeEvent(timestampNs, InputEventType::MouseWheel, device, 0, wheel, 0));
+            }
+        }
+    }
+
+    void RawInput::threadMain()
+    {
+        setCurrentThreadName("axis.input");
+        setCurrentThreadPriority(m_desc.priority);
+        if (!m_desc.affinity.empty())
+        {
+            setCurrentThreadAffinity(m_desc.affinity);
+        }
+
+        const HINSTANCE instance = ::GetModuleHandleW(nullptr);
+        WNDCLASSEXW windowClass = {};
+        windowClass.cbSize = sizeof(windowClass);
+        // 종료(WM_CLOSE)는 메시지 루프가 직접 받아 처리하므로 창 프로시저는 기본 동작만 합니다.
+        windowClass.lpfnWndProc = &::DefWindowProcW;
+        windowClass.hInstance = instance;
+        windowClass.lpszClassName = L"AxisRawInput";
+        ::RegisterClassExW(&windowClass);
+
+        // 메시지 전용 창은 보이지 않고 전면이 될 수도 없으므로 RIDEV_INPUTSINK로 항상 받습니다.
+        HWND window = ::CreateWindowExW(0, windowClass.lpszClassName, L"", 0, 0, 0, 0, 0, HWND_MESSAGE, nullptr,
+                                        instance, nullptr);
+        RAWINPUTDEVICE devices[2] = {};
+        uint32_t deviceCount = 0;
+        if (m_desc.mouse)
+        {
+            devices[deviceCount++] = RAWINPUTDEVICE{0x01, 0x02, RIDEV_INPUTSINK, window};
+        }
+        if (m_desc.keyboard)
+        {
+            devices[deviceCount++] = RAWINPUTDEVICE{0x01, 0x06, RIDEV_INPUTSINK, window};
+        }
+
+        if (window == nullptr || !::RegisterRawInputDevices(devices, deviceCount, sizeof(RAWINPUTDEVICE)))
+        {
+            if (window != nullptr)
+            {
+                ::DestroyWindow(window);
+            }
+            m_ready.store(true, std::memory_order_release);
+            return;
+        }
+
+        m_devices.store(deviceCount, std::memory_order_relaxed);
+        m_wakeHandle.store(reinterpret_cast<intptr_t>(window), std::memory_order_release);
+        m_running.store(true, std::memory_order_release);
+        m_ready.store(true, std::memory_order_release);
+
+        WindowsInputState state;
+        state.background = m_desc.background;
+        auto flush = [&]() {
+            deliver(state.batch.events, state.batch.count);
+            state.batch.count = 0;
+        };
+
+        alignas(8) uint8_t buffer[sizeof(RAWINPUT) + 64];
+        uint64_t lastTimestampNs = 0;
+        bool quit = false;
+        while (!quit)
+        {
+            ::MsgWaitForMultipleObjectsEx(0, nullptr, INFINITE, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+            const bool deliverInput = state.background || isForeground();
+
+            // 깨어난 사이에 쌓인 메시지를 모두 읽고 한 번에 넘깁니다.
+            MSG message;
+            while (::PeekMessageW(&message, nullptr, 0, 0, PM_REMOVE))
+            {
+                if (message.message == WM_QUIT || (message.message == WM_CLOSE && message.hwnd == window))
+                {
+                    quit = true;
+                    break;
+                }
+                if (message.message == WM_INPUT && deliverInput)
+                {
+                    // 메시지가 큐에 들어간 시각(GetTickCount 축, ms)만큼 현재 시각에서 되돌립니다.
+                    // 큐에 쌓인 메시지가 같은 시각을 받지 않게 하되, 앞 메시지보다 이르게는 두지 않습니다.
+                    const uint64_t now = Clock::nowNs();
+                    const uint64_t ageNs = static_cast<uint64_t>(::GetTickCount() - message.time) * 1000000ull;
+                    uint64_t timestampNs = now > ageNs ? now - ageNs : 0;
+                    timestampNs = timestampNs > lastTimestampNs ? timestampNs : lastTimestampNs;
+                    lastTimestampNs = timestampNs;
+
+                    UINT size = sizeof(buffer);
+                    if (::GetRawInputData(reinterpret_cast<HRAWINPUT>(message.lParam), RID_INPUT, buffer, &size,
+                                          sizeof(RAWINPUTHEADER)) != static_cast<UINT>(-1))
+                    {
+                        translate(state, *reinterpret_cast<const RAWINPUT*>(buffer), timestampNs, flush);
+                    }
+                }
+                // WM_INPUT도 DefWindowProc이 내부 버퍼를 정리해야 합니다.
+                ::DispatchMessageW(&message);
+            }
+            flush();
+        }
+
+        // 등록은 프로세스 전체에 걸리므로, 창을 없애기 전에 풀어야 죽은 창을 가리키는 등록이 남지 않습니다.
+        for (uint32_t i = 0; i < deviceCount; ++i)
+        {
+            devices[i].dwFlags = RIDEV_REMOVE;
+            devices[i].hwndTarget = nullptr;
+        }
+        ::RegisterRawInputDevices(devices, deviceCount, sizeof(RAWINPUTDEVICE));
+        ::DestroyWindow(window);
+
+        m_running.store(false, std::memory_order_release);
+    }
+#elif defined(__linux__)
+    namespace
+    {
+        template <size_t Bits>
+        struct BitSet
+        {
+            unsigned long words[(Bits + sizeof(unsigned long) * 8 - 1) / (sizeof(unsigned long) * 8)] = {};
+
+            bool test(uint32_t bit) const
+            {
+                constexpr uint32_t kWordBits = sizeof(unsigned long) * 8;
+                return bit < Bits && (words[bit / kWordBits] >> (bit % kWordBits) & 1ul) != 0;
+            }
+        };
+
+        struct EvdevDevice
+        {
+            int fd = -1;
+            uint8_t index = 0;
+            // SYN_REPORT까지 모은 상대 이동.
+            int32_t dx = 0;
+            int32_t dy = 0;
+        };
+
+        int64_t monotonicNs()
+        {
+            timespec now = {};
+            ::clock_gettime(CLOCK_MONOTONIC, &now);
+            return static_cast<int64_t>(now.tv_sec) * 1000000000ll + now.tv_nsec;
+        }
+
+        // 원하는 종류의 장치면 열린 fd를, 아니면 -1.
+        int openDevice(const char* path, bool keyboard, bool mouse)
+        {
+            const int fd = ::open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+            if (fd < 0)
+            {
+                return -1;
+            }
+
+            BitSet<EV_MAX + 1> types;
+            BitSet<KEY_MAX + 1> keys;
+            BitSet<REL_MAX + 1> relative;
+            ::ioctl(fd, EVIOCGBIT(0, sizeof(types.words)), types.words);
+            ::ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(keys.words)), keys.words);
+            ::ioctl(fd, EVIOCGBIT(EV_REL, sizeof(relative.words)), relative.words);
+
+            const bool isKeyboard = types.test(EV_KEY) && keys.test(KEY_A) && keys.test(KEY_SPACE);
+            const bool isMouse = types.test(EV_REL) && relative.test(REL_X) && relative.test(REL_Y) &&
+                                 keys.test(BTN_LEFT);
+            if (!(keyboard && isKeyboard) && !(mouse && isMouse))
+            {
+                ::close(fd);
+                return -1;
+            }
+
+            // 이벤트 시각을 CLOCK_MONOTONIC으로 받아 Clock 축으로 옮길 수 있게 합니다.
+            int clockId = CLOCK_MONOTONIC;
+            ::ioctl(fd, EVIOCSCLOCKID, &clockId);
+            return fd;
+        }
+    }
+
+    void RawInput::threadMain()
+    {
+        setCurrentThreadName("axis.input");
+        setCurrentThreadPriority(m_desc.priority);
+        if (!m_desc.affinity.empty())
+        {
+            setCurrentThreadAffinity(m_desc.affinity);
+        }
+
+        EvdevDevice devices[kMaxDevices];
+        uint32_t deviceCount = 0;
+        for (uint32_t i = 0; i < 64 && deviceCount < kMaxDevices; ++i)
+        {
+            char path[32];
+            std::snprintf(path, sizeof(path), "/dev/input/event%u", i);
+            const int fd = openDevice(path, m_desc.keyboard, m_desc.mouse);
+            if (fd >= 0)
+            {
+                devices[deviceCount].fd = fd;
+                devices[deviceCount].index = static_cast<uint8_t>(deviceCount);
+                ++deviceCount;
+            }
+        }
+
+        const int wake = ::eventfd(0, EFD_CLOEXEC);
+        if (deviceCount == 0 || wake < 0)
+        {
+            for (uint32_t i = 0; i < deviceCount; ++i)
+            {
+                ::close(devices[i].fd);
+            }
+            if (wake >= 0)
+            {
+                ::close(wake);
+            }
+            m_ready.store(true, std::memory_order_release);
+            return;
+        }
+
+        m_devices.store(deviceCount, std::memory_order_relaxed);
+        m_wakeHandle.store(wake, std::memory_order_release);
+        m_running.store(true, std::memory_order_release);
+        m_ready.store(true, std::memory_order_release);
+
+        pollfd fds[kMaxDevices + 1];
+        for (uint32_t i = 0; i < deviceCount; ++i)
+        {
+            fds[i] = pollfd{devices[i].fd, POLLIN, 0};
+        }
+        fds[deviceCount] = pollfd{wake, POLLIN, 0};
+
+        EventBatch batch;
+        auto push = [&](const InputEvent& event) {
+            if (!batch.push(event))
+            {
+                deliver(batch.events, batch.count);
+                batch.count = 0;
+                batch.push(event);
+            }
+        };
+
+        for (;;)
+        {
+            if (::poll(fds, deviceCount + 1, -1) < 0)
+            {
+                continue;
+            }
+            if ((fds[deviceCount].revents & POLLIN) != 0)
+            {
+                break;
+            }
+
+            // 커널 시각(CLOCK_MONOTONIC)과 Clock의 차이를 깨어날 때마다 한 번 잽니다.
+            const int64_t clockOffset = static_cast<int64_t>(Clock::nowNs()) - monotonicNs();
+
+            for (uint32_t i = 0; i < deviceCount; ++i)
+            {
+                if ((fds[i].revents & (POLLERR | POLLHUP | POLLNVAL)) != 0)
+                {
+                    // 뽑힌 장치는 목록에서 빼지 않고 poll만 멈춥니다.
+                    fds[i].fd = -1;
+                    continue;
+                }
+                if ((fds[i].revents & POLLIN) == 0)
+                {
+                    continue;
+                }
+
+                EvdevDevice& device = devices[i];
+                input_event raw[64];
+                ssize_t bytes;
+                while ((bytes = ::read(device.fd, raw, sizeof(raw))) > 0)
+                {
+                    const size_t count = static_cast<size_t>(bytes) / sizeof(input_event);
+                    for (size_t e = 0; e < count; ++e)
+                    {
+                        const input_event& ev = raw[e];
+                        const int64_t kernelNs =
+                            static_cast<int64_t>(ev.input_event_sec) * 1000000000ll + ev.input_event_usec * 1000ll;
+                        const uint64_t timestampNs = static_cast<uint64_t>(kernelNs + clockOffset);
+
+                        // 키보드와 마우스를 함께 가진 장치도 있으므로, 장치 종류가 아니라 desc가 고른 입력만 넘깁니다.
+                        if (ev.type == EV_REL && m_desc.mouse)
+                        {
+                            if (ev.code == REL_X)
+                            {
+                                device.dx += ev.value;
+                            }
+                            else if (ev.code == REL_Y)
+                            {
+                                device.dy += ev.value;
+                            }
+                            else if (ev.code == REL_WHEEL || ev.code == REL_HWHEEL)
+                            {
+                                const int32_t delta = ev.value * 120;
+                                push(makeEvent(timestampNs, InputEventType::MouseWheel, device.index, 0,
+                                               ev.code == REL_HWHEEL ? delta : 0, ev.code == REL_WHEEL ? delta : 0));
+                            }
+                        }
+                        else if (ev.type == EV_KEY && ev.value != 2)
+                        {
+                            // value 2는 자동 반복입니다. 원시 입력에서는 누름과 뗌만 넘깁니다.
+                            const bool down = ev.value == 1;
+                            if (ev.code >= BTN_LEFT && ev.code <= BTN_EXTRA && m_desc.mouse)
+                            {
+                                push(makeEvent(timestampNs,
+                                               down ? InputEventType::MouseButtonDown : InputEventType::MouseButtonUp,
+                                               device.index, static_cast<uint16_t>(ev.code - BTN_LEFT)));
+                            }
+                            else if (ev.code < BTN_MISC && m_desc.keyboard)
+                            {
+                                push(makeEvent(timestampNs, down ? InputEventType::KeyDown : InputEventType::KeyUp,
+                                               device.index, ev.code));
+                            }
+                        }
+                        else if (ev.type == EV_SYN && ev.code == SYN_REPORT && (device.dx != 0 || device.dy != 0))
+                        {
+                            push(makeEvent(timestampNs, InputEventType::MouseMove, device.index, 0, device.dx,
+                                           device.dy));
+                            device.dx = 0;
+                            device.dy = 0;
+                        }
+                    }
+                }
+            }
+
+            deliver(batch.events, batch.count);
+            batch.count = 0;
+        }
+
+        for (uint32_t i = 0; i < deviceCount; ++i)
+        {
+            ::close(devices[i].fd);
+        }
+        m_running.store(false, std::memory_order_release);
+        m_wakeHandle.store(-1, std::memory_order_release);
+        ::close(wake);
+    }
+#else
+    void RawInput::threadMain()
+    {
+        m_ready.store(true, std::memory_order_release);
+    }
+#endif
+}
@@ -0,0 +1,127 @@
+#include "axis/platform/StackTrace.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <dlfcn.h>
+    #if defined(__has_include)
+        #if __has_include(<execinfo.h>)
+            #include <execinfo.h>
+            #define AXIS_HAS_EXECINFO 1
+        #endif
+    #endif
+    #if defined(__GNUC__)
+        #include <cxxabi.h>
+    #endif
+#endif
+
+namespace axis
+{
+    namespace
+    {
+        // 경로에서 파일 이름만 남깁니다.
+        const char* baseName(const char* path)
+        {
+            const char* name = path;
+            for (const char* c = path; *c != '\0'; ++c)
+            {
+                if (*c == '/' || *c == '\\')
+                {
+                    name = c + 1;
+                }
+            }
+            return name;
+        }
+    }
+
+    uint32_t captureStackTrace(void** frames, uint32_t capacity, uint32_t skip)
+    {
+        if (frames == nullptr || capacity == 0)
+        {
+            return 0;
+        }
+
+        // 이 함수 자신의 프레임도 건너뜁니다.
+        skip += 1;
+#if defined(_WIN32)
+        return ::RtlCaptureStackBackTrace(static_cast<DWORD>(skip), static_cast<DWORD>(capacity), frames, nullptr);
+#elif defined(AXIS_HAS_EXECINFO)
+        constexpr uint32_t kMaxCapture = 64;
+        void* buffer[kMaxCapture];
+        const uint32_t wanted = capacity + skip < kMaxCapture ? capacity + skip : kMaxCapture;
+        const int captured = ::backtrace(buffer, static_cast<int>(wanted));
+        if (captured <= static_cast<int>(skip))
+        {
+            return 0;
+        }
+        const uint32_t count = static_cast<uint32_t>(captured) - skip;
+        std::memcpy(frames, buffer + skip, sizeof(void*) * count);
+        return count;
+#else
+        return 0;
+#endif
+    }
+
+    bool describeAddress(const void* address, char* out, size_t outSize)
+    {
+        if (out == nullptr || outSize == 0)
+        {
+            return false;
+        }
+
+#if defined(_WIN32)
+        // 심볼 파일(PDB) 없이도 쓸 수 있도록 모듈과 오프셋만 남깁니다. 오프셋은 디버거에서 바로 찾을 수 있습니다.
+        HMODULE module = nullptr;
+        char path[MAX_PATH];
+        if (::GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                                 static_cast<LPCSTR>(address), &module) &&
+            ::GetModuleFileNameA(module, path, MAX_PATH) != 0)
+        {
+            const uintptr_t offset = reinterpret_cast<uintptr_t>(address) - reinterpret_cast<uintptr_t>(module);
+            std::snprintf(out, outSize, "%s+0x%llx", baseName(path), static_cast<unsigned long long>(offset));
+            return true;
+        }
+#else
+        Dl_info info = {};
+        if (::dladdr(address, &info) != 0 && info.dli_fname != nullptr)
+        {
+            const uintptr_t target = reinterpret_cast<uintptr_t>(address);
+            if (info.dli_sname != nullptr && info.dli_saddr != nullptr)
+            {
+                const char* symbol = info.dli_sname;
+                char* demangled = nullptr;
+    #if defined(__GNUC__)
+                int status = 0;
+                demangled = abi::__cxa_demangle(symbol, nullptr, nullptr, &status);
+                if (status == 0 && demangled != nullptr)
+                {
+                    symbol = demangled;
+                }
+    #endif
+                std::snprintf(out, outSize, "%s+0x%llx (%s)", symbol,
+                              static_cast<unsigned long long>(target - reinterpret_cast<uintptr_t>(info.dli_saddr)),
+                              baseName(info.dli_fname));
+                std::free(demangled);
+                return true;
+            }
+
+            // 내보내지 않은 심볼은 모듈 기준 오프셋으로 남깁니다. addr2line -e <모듈> <오프셋>으로 찾을 수 있습니다.
+            std::snprintf(out, outSize, "%s+0x%llx", baseName(info.dli_fname),
+                          static_cast<unsigned long long>(target - reinterpret_cast<uintptr_t>(info.dli_fbase)));
+            return true;
+        }
+#endif
+        std::snprintf(out, outSize, "%p", address);
+        return false;
+    }
+}
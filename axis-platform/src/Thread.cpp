@@ -0,0 +1,165 @@
+#include "axis/platform/Thread.h"
+
+#include <cstring>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #if defined(__linux__)
+        #include <sched.h>
+        #include <sys/resource.h>
+        #include <sys/syscall.h>
+        #include <unistd.h>
+    #elif defined(__APPLE__)
+        #include <pthread/qos.h>
+    #endif
+#endif
+
+namespace axis
+{
+#if defined(_WIN32)
+    bool setCurrentThreadAffinity(const CpuMask& mask)
+    {
+        // 그룹 하나의 CPU는 mask의 64비트 단어 하나와 같습니다.
+        uint32_t bestGroup = 0;
+        uint32_t bestCount = 0;
+        for (uint32_t group = 0; group < kMaxCpus / 64; ++group)
+        {
+            CpuMask single;
+            single.words[group] = mask.words[group];
+            const uint32_t count = single.count();
+            if (count > bestCount)
+            {
+                bestGroup = group;
+                bestCount = count;
+            }
+        }
+        if (bestCount == 0)
+        {
+            return false;
+        }
+
+        GROUP_AFFINITY affinity = {};
+        affinity.Mask = static_cast<KAFFINITY>(mask.words[bestGroup]);
+        affinity.Group = static_cast<WORD>(bestGroup);
+        return ::SetThreadGroupAffinity(::GetCurrentThread(), &affinity, nullptr) != 0;
+    }
+
+    bool setCurrentThreadPriority(ThreadPriority priority)
+    {
+        static const int kPriorities[] = {THREAD_PRIORITY_BELOW_NORMAL, THREAD_PRIORITY_NORMAL,
+                                          THREAD_PRIORITY_ABOVE_NORMAL, THREAD_PRIORITY_HIGHEST};
+        const bool applied = ::SetThreadPriority(::GetCurrentThread(), kPriorities[static_cast<int>(priority)]) != 0;
+
+#if defined(THREAD_POWER_THROTTLING_CURRENT_VERSION)
+        // Normal은 OS 판단에 맡기고, Low는 EcoQoS를 켜고, 그 위는 명시적으로 끕니다.
+        THREAD_POWER_THROTTLING_STATE throttling = {};
+        throttling.Version = THREAD_POWER_THROTTLING_CURRENT_VERSION;
+        if (priority != ThreadPriority::Normal)
+        {
+            throttling.ControlMask = THREAD_POWER_THROTTLING_EXECUTION_SPEED;
+            throttling.StateMask = priority == ThreadPriority::Low ? THREAD_POWER_THROTTLING_EXECUTION_SPEED : 0;
+        }
+        ::SetThreadInformation(::GetCurrentThread(), ThreadPowerThrottling, &throttling, sizeof(throttling));
+#endif
+        return applied;
+    }
+
+    void setCurrentThreadName(const char* name)
+    {
+        // SetThreadDescription은 Windows 10 1607부터 있으므로 이름으로 찾아 씁니다.
+        using SetDescriptionFn = HRESULT(WINAPI*)(HANDLE, PCWSTR);
+        static const auto s_setDescription = reinterpret_cast<SetDescriptionFn>(
+            reinterpret_cast<void*>(::GetProcAddress(::GetModuleHandleW(L"kernel32.dll"), "SetThreadDescription")));
+        if (s_setDescription == nullptr || name == nullptr)
+        {
+            return;
+        }
+
+        wchar_t wide[64];
+        if (::MultiByteToWideChar(CP_UTF8, 0, name, -1, wide, 64) <= 0)
+        {
+            return;
+        }
+        s_setDescription(::GetCurrentThread(), wide);
+    }
+
+    uint32_t currentCpu()
+    {
+        PROCESSOR_NUMBER number = {};
+        ::GetCurrentProcessorNumberEx(&number);
+        const uint32_t cpu = number.Group * 64u + number.Number;
+        return cpu < kMaxCpus ? cpu : kMaxCpus;
+    }
+#else
+    bool setCurrentThreadAffinity(const CpuMask& mask)
+    {
+    #if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (uint32_t cpu = 0; cpu < kMaxCpus && cpu < CPU_SETSIZE; ++cpu)
+        {
+            if (mask.test(cpu))
+            {
+                CPU_SET(cpu, &set);
+            }
+        }
+        return !mask.empty() && ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+    #else
+        // macOS는 스레드를 특정 코어에 고정하는 API가 없습니다. 우선순위(QoS)로만 조절합니다.
+        (void)mask;
+        return false;
+    #endif
+    }
+
+    bool setCurrentThreadPriority(ThreadPriority priority)
+    {
+    #if defined(__linux__)
+        // Linux의 nice는 스레드 단위입니다. 실시간 정책은 다른 프로세스를 굶길 수 있어 쓰지 않습니다.
+        static const int kNiceValues[] = {10, 0, -5, -10};
+        const id_t thread = static_cast<id_t>(::syscall(SYS_gettid));
+        return ::setpriority(PRIO_PROCESS, thread, kNiceValues[static_cast<int>(priority)]) == 0;
+    #elif defined(__APPLE__)
+        static const qos_class_t kClasses[] = {QOS_CLASS_UTILITY, QOS_CLASS_DEFAULT, QOS_CLASS_USER_INITIATED,
+                                               QOS_CLASS_USER_INTERACTIVE};
+        return ::pthread_set_qos_class_self_np(kClasses[static_cast<int>(priority)], 0) == 0;
+    #else
+        (void)priority;
+        return false;
+    #endif
+    }
+
+    void setCurrentThreadName(const char* name)
+    {
+        if (name == nullptr)
+        {
+            return;
+        }
+    #if defined(__linux__)
+        char truncated[16];
+        std::strncpy(truncated, name, sizeof(truncated) - 1);
+        truncated[sizeof(truncated) - 1] = '\0';
+        ::pthread_setname_np(::pthread_self(), truncated);
+    #elif defined(__APPLE__)
+        ::pthread_setname_np(name);
+    #endif
+    }
+
+    uint32_t currentCpu()
+    {
+    #if defined(__linux__)
+        const int cpu = ::sched_getcpu();
+        return cpu >= 0 && static_cast<uint32_t>(cpu) < kMaxCpus ? static_cast<uint32_t>(cpu) : kMaxCpus;
+    #else
+        return kMaxCpus;
+    #endif
+    }
+#endif
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "axis/core/JobSystem.h"
+#include "axis/renderer/Export.h"
+#include "axis/renderer/RenderBackend.h"
+#include "axis/renderer/RenderTypes.h"
+#include "axis/utils/Allocator.h"
+#include "axis/utils/RadixSort.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace axis
+{
+    // 드로우 한 번에 필요한 모든 상태. 제출 단계에서 이전 패킷과 비교해 바뀐 상태만 백엔드에 전달합니다.
+    struct DrawPacket
+    {
+        uint64_t key = 0;
+
+        PipelineHandle pipeline;
+        MaterialHandle material;
+        BufferHandle vertexBuffer;
+        BufferHandle indexBuffer;
+        uint32_t vertexBufferOffset = 0;
+        uint32_t indexBufferOffset = 0;
+        IndexFormat indexFormat = IndexFormat::UInt32;
+
+        // indexBuffer가 유효하면 인덱스 수, 아니면 정점 수.
+        uint32_t elementCount = 0;
+        uint32_t instanceCount = 1;
+        uint32_t firstElement = 0;
+        int32_t vertexOffset = 0;
+        uint32_t firstInstance = 0;
+    };
+
+    struct SubmitStats
+    {
+        uint32_t drawCount = 0;
+        uint32_t pipelineChanges = 0;
+        uint32_t materialChanges = 0;
+        uint32_t vertexBufferChanges = 0;
+        uint32_t indexBufferChanges = 0;
+    };
+
+    // 스레드 하나가 기록하는 드로우 패킷 목록.
+    //
+    // 블록 단위로 할당자에서 메모리를 받아 이어 붙이며, 동기화가 없으므로 한 스레드에서만 기록해야 합니다.
+    // 서로 다른 스레드의 버퍼가 같은 캐시 라인을 공유하지 않도록 64바이트로 정렬됩니다.
+    class AXIS_RENDERER_API CommandBuffer
+    {
+    public:
+        explicit CommandBuffer(Allocator& allocator);
+        ~CommandBuffer();
+
+        CommandBuffer(const CommandBuffer&) = delete;
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+        // 실패하면(할당자 고갈) nullptr.
+        DrawPacket* append();
+        bool push(const DrawPacket& packet);
+
+        uint32_t size() const { return m_count; }
+        void reset();
+
+        // 앞의 count개만 남기고 뒤의 패킷을 버립니다. 비게 된 블록은 할당자에 돌려줍니다.
+        void truncate(uint32_t count);
+
+        template <typename Fn>
+        void forEach(Fn&& fn) const
+        {
+            for (const Block* block = m_head; block != nullptr; block = block->next)
+            {
+                for (uint32_t i = 0; i < block->count; ++i)
+                {
+                    fn(block->packets[i]);
+                }
+            }
+        }
+
+    private:
+        static constexpr uint32_t kPacketsPerBlock = 256;
+
+        struct Block
+        {
+            Block* next;
+            uint32_t count;
+            DrawPacket packets[kPacketsPerBlock];
+        };
+
+        // 정렬을 첫 멤버에 둡니다. 클래스 머리의 alignas는 GCC/Clang에서 visibility 속성과 함께 쓸 수 없습니다.
+        alignas(64) Allocator* m_allocator;
+        Block* m_head = nullptr;
+        Block* m_tail = nullptr;
+        uint32_t m_count = 0;
+    };
+
+    // 프레임 하나의 드로우 기록/정렬/제출.
+    //
+    // JobSystem의 실행 스레드마다 CommandBuffer를 하나씩 두어 워커들이 잠금 없이 병렬로 기록합니다.
+    // 기록이 끝나면 sort()가 모든 버퍼를 모아 키로 기수 정렬하고, submit()이 한 스레드에서
+    // 정렬된 순서대로 제출합니다. 프레임마다 reset()으로 비웁니다.
+    // 블록과 정렬 배열은 모두 생성 시 받은 할당자(보통 FrameArena)에서 옵니다.
+    class AXIS_RENDERER_API CommandBufferSet
+    {
+    public:
+        CommandBufferSet(JobSystem& jobs, Allocator& frameAllocator);
+        ~CommandBufferSet();
+
+        CommandBufferSet(const CommandBufferSet&) = delete;
+        CommandBufferSet& operator=(const CommandBufferSet&) = delete;
+
+        // 현재 스레드의 버퍼. JobSystem에 속한 스레드에서만 호출할 수 있습니다.
+        CommandBuffer& current();
+        CommandBuffer& buffer(uint32_t threadIndex) { return m_buffers[threadIndex]; }
+        uint32_t bufferCount() const { return m_bufferCount; }
+
+        // 모든 버퍼를 병합해 정렬합니다. 기록이 모두 끝난 뒤 한 스레드에서 호출합니다.
+        bool sort();
+
+        SubmitStats submit(RenderBackend& backend) const;
+
+        uint32_t sortedCount() const { return m_sortedCount; }
+        const DrawPacket& sorted(uint32_t index) const { return *m_packets[m_items[index].index]; }
+
+        void reset();
+
+    private:
+        void releaseSorted();
+
+        JobSystem& m_jobs;
+        Allocator& m_allocator;
+        uint32_t m_bufferCount;
+        CommandBuffer* m_buffers;
+
+        const DrawPacket** m_packets = nullptr;
+        SortItem* m_items = nullptr;
+        SortItem* m_scratch = nullptr;
+        uint32_t m_sortedCount = 0;
+    };
+}
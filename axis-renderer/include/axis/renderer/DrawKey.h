@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+namespace axis
+{
+    // 64비트 드로우 정렬 키.
+    //
+    //   불투명:  [layer 8][pass 8][pipeline 12][material 20][depth 16]
+    //   반투명:  [layer 8][pass 8][depth 24][material 24]
+    //
+    // 불투명은 가장 비싼 상태 변경인 파이프라인을 머티리얼 위에 두고, 같은 파이프라인/머티리얼 안에서 앞에서 뒤로 그립니다.
+    // 자리보다 큰 번호는 잘려 다른 번호와 섞여 정렬될 수 있으므로 정렬 번호는 작게 유지합니다.
+    // 반투명은 깊이를 앞에 두고 뒤집어 저장해 뒤에서 앞으로 그립니다.
+    // layer와 pass는 두 형식에서 같은 위치이므로 섞어서 정렬해도 layer/pass 순서는 유지됩니다.
+    namespace DrawKey
+    {
+        constexpr uint32_t kLayerBits = 8;
+        constexpr uint32_t kPassBits = 8;
+        constexpr uint32_t kMaterialBits = 24;
+        constexpr uint32_t kDepthBits = 24;
+        constexpr uint32_t kOpaquePipelineBits = 12;
+        constexpr uint32_t kOpaqueMaterialBits = 20;
+        constexpr uint32_t kOpaqueDepthBits = 16;
+
+        constexpr uint64_t kMaterialMask = (uint64_t{1} << kMaterialBits) - 1;
+        constexpr uint64_t kDepthMask = (uint64_t{1} << kDepthBits) - 1;
+        constexpr uint64_t kOpaquePipelineMask = (uint64_t{1} << kOpaquePipelineBits) - 1;
+        constexpr uint64_t kOpaqueMaterialMask = (uint64_t{1} << kOpaqueMaterialBits) - 1;
+        constexpr uint64_t kOpaqueDepthMask = (uint64_t{1} << kOpaqueDepthBits) - 1;
+
+        // [0, 1] 범위의 정규화 깊이를 bits 비트로 양자화합니다. 범위를 벗어나면 잘라 냅니다.
+        // 불투명 키에는 bits에 kOpaqueDepthBits를 넘깁니다.
+        constexpr uint32_t quantizeDepth(float normalizedDepth, uint32_t bits = kDepthBits)
+        {
+            const float clamped = normalizedDepth < 0.0f ? 0.0f : (normalizedDepth > 1.0f ? 1.0f : normalizedDepth);
+            return static_cast<uint32_t>(clamped * static_cast<float>((uint64_t{1} << bits) - 1));
+        }
+
+        constexpr uint64_t opaque(uint8_t layer, uint8_t pass, uint32_t pipeline, uint32_t material, uint32_t depth)
+        {
+            return (uint64_t{layer} << 56) | (uint64_t{pass} << 48) | ((pipeline & kOpaquePipelineMask) << 36) |
+                   ((material & kOpaqueMaterialMask) << 16) | (depth & kOpaqueDepthMask);
+        }
+
+        constexpr uint64_t translucent(uint8_t layer, uint8_t pass, uint32_t depth, uint32_t material)
+        {
+            return (uint64_t{layer} << 56) | (uint64_t{pass} << 48) | ((kDepthMask - (depth & kDepthMask)) << 24) |
+                   (material & kMaterialMask);
+        }
+
+        constexpr uint8_t layer(uint64_t key) { return static_cast<uint8_t>(key >> 56); }
+        constexpr uint8_t pass(uint64_t key) { return static_cast<uint8_t>(key >> 48); }
+    }
+}
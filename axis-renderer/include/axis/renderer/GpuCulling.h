@@ -0,0 +1,214 @@
+#pragma once
+
+#include "axis/core/Bounds.h"
+#include "axis/renderer/Export.h"
+#include "axis/renderer/RenderBackend.h"
+#include "axis/renderer/RenderTypes.h"
+#include "axis/utils/Math.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace axis
+{
+    // GPU 컬링에 등록된 인스턴스 핸들.
+    using GpuInstanceHandle = uint32_t;
+
+    constexpr GpuInstanceHandle kInvalidGpuInstance = 0xFFFFFFFFu;
+    constexpr uint32_t kInvalidGpuIndex = 0xFFFFFFFFu;
+
+    // 셰이더(axis-renderer/shaders/GpuCulling.hlsl)와 공유하는 레이아웃. 바꾸면 양쪽을 함께 고쳐야 합니다.
+    struct GpuInstanceData
+    {
+        Mat4 world;
+        uint32_t mesh;
+        uint32_t reserved[3];
+    };
+
+    struct GpuMeshData
+    {
+        float center[3];
+        float radius;
+        uint32_t indexCount;
+        uint32_t firstIndex;
+        int32_t vertexOffset;
+        uint32_t group;
+        // 이 메시의 보이는 인스턴스가 visibleInstances에서 시작하는 위치.
+        uint32_t instanceBase;
+        uint32_t reserved[3];
+    };
+
+    struct GpuCullConstants
+    {
+        float planes[6][4];
+        Mat4 occlusionViewProj;
+        uint32_t instanceCount;
+        uint32_t meshCount;
+        uint32_t hiZWidth;
+        uint32_t hiZHeight;
+        uint32_t hiZMipCount;
+        uint32_t occlusion;
+        uint32_t countersMeshBase;
+        uint32_t countersGroupBase;
+    };
+
+    static_assert(sizeof(GpuInstanceData) == 80);
+    static_assert(sizeof(GpuMeshData) == 48);
+    static_assert(sizeof(GpuCullConstants) <= 256);
+
+    // 셰이더 스레드 그룹 크기. HLSL의 numthreads와 같아야 합니다.
+    constexpr uint32_t kGpuCullGroupSize = 64;
+    constexpr uint32_t kGpuHiZGroupSize = 8;
+
+    struct GpuCullingDesc
+    {
+        uint32_t maxInstances = 65536;
+        uint32_t maxMeshes = 1024;
+        uint32_t maxGroups = 256;
+
+        // GpuCulling.hlsl의 CullInstances / BuildDrawArgs, HiZDownsample.hlsl의 DownsampleHiZ로 만든 컴퓨트 파이프라인.
+        PipelineHandle cullPipeline;
+        PipelineHandle buildArgsPipeline;
+        PipelineHandle hiZPipeline;
+    };
+
+    // multi-draw-indirect 호출 하나로 묶이는 상태 집합.
+    struct GpuDrawGroupDesc
+    {
+        PipelineHandle pipeline;
+        MaterialHandle material;
+        BufferHandle vertexBuffer;
+        BufferHandle indexBuffer;
+        uint32_t vertexBufferOffset = 0;
+        uint32_t indexBufferOffset = 0;
+        IndexFormat indexFormat = IndexFormat::UInt32;
+    };
+
+    struct GpuMeshDesc
+    {
+        uint32_t group = kInvalidGpuIndex;
+        uint32_t indexCount = 0;
+        uint32_t firstIndex = 0;
+        int32_t vertexOffset = 0;
+        // 메시 로컬 공간 경계 구. 셰이더가 월드 행렬의 최대 축 배율로 반지름을 늘립니다.
+        Sphere bounds;
+    };
+
+    // 한 프레임의 컬링 시점.
+    struct GpuCullView
+    {
+        Frustum frustum;
+
+        // Hi-Z 피라미드와, 그 피라미드를 그릴 때 쓴 view-projection(보통 이전 프레임).
+        // hiZ가 유효하지 않으면 절두체 컬링만 합니다.
+        TextureHandle hiZ;
+        Mat4 occlusionViewProj;
+        uint32_t hiZWidth = 0;
+        uint32_t hiZHeight = 0;
+        uint32_t hiZMipCount = 0;
+    };
+
+    struct GpuCullStats
+    {
+        uint32_t uploadedInstances = 0;
+        uint32_t uploadRanges = 0;
+        uint32_t dispatches = 0;
+        uint32_t indirectDraws = 0;
+    };
+
+    // GPU 구동 컬링과 간접 드로우.
+    //
+    // 인스턴스는 등록할 때 한 번 GPU 버퍼에 올라가며, 이후에는 바뀐 인스턴스만 연속 구간으로 묶어 다시 올립니다.
+    // 매 프레임 cull()이 컴퓨트 패스 두 개를 기록합니다.
+    //   1. CullInstances: 인스턴스마다 절두체와 Hi-Z 가림 검사를 하고, 보이면 메시별 구간에 인덱스를 씁니다.
+    //   2. BuildDrawArgs: 보이는 인스턴스가 있는 메시만 그룹별 간접 인자 버퍼에 빈틈없이 모읍니다.
+    // draw()는 그룹마다 drawIndexedIndirectCount를 한 번 호출합니다.
+    // 따라서 프레임당 CPU 비용은 인스턴스 수가 아니라 그룹 수와 이번 프레임에 바뀐 인스턴스 수에 비례합니다.
+    //
+    // 정점 셰이더는 instanceBuffer()[visibleInstanceBuffer()[firstInstance + instanceId]]로 인스턴스를 읽습니다.
+    // 모든 호출은 제출 스레드 하나에서 이루어져야 합니다.
+    class AXIS_RENDERER_API GpuCulling
+    {
+    public:
+        GpuCulling(GpuDrivenBackend& backend, const GpuCullingDesc& desc);
+        ~GpuCulling();
+
+        GpuCulling(const GpuCulling&) = delete;
+        GpuCulling& operator=(const GpuCulling&) = delete;
+
+        // GPU 버퍼 생성에 실패했으면 false.
+        bool isValid() const { return m_valid; }
+
+        // 그룹과 메시는 추가만 할 수 있습니다. 용량이 차면 kInvalidGpuIndex.
+        uint32_t addDrawGroup(const GpuDrawGroupDesc& desc);
+        uint32_t addMesh(const GpuMeshDesc& desc);
+
+        // 용량이 차면 kInvalidGpuInstance.
+        GpuInstanceHandle addInstance(uint32_t mesh, const Mat4& world);
+        void setTransform(GpuInstanceHandle handle, const Mat4& world);
+        void removeInstance(GpuInstanceHandle handle);
+
+        uint32_t instanceCount() const { return static_cast<uint32_t>(m_instances.size()); }
+        uint32_t meshCount() const { return static_cast<uint32_t>(m_meshes.size()); }
+        uint32_t groupCount() const { return static_cast<uint32_t>(m_groups.size()); }
+
+        // 바뀐 데이터를 올리고 컬링/압축 패스를 기록합니다. draw() 전에 프레임마다 한 번 호출합니다.
+        GpuCullStats cull(const GpuCullView& view);
+        // 그룹마다 간접 드로우 한 번. cull()의 통계에 드로우 수를 더해 돌려줍니다.
+        GpuCullStats draw(const GpuCullStats& cullStats = {});
+
+        // depth(밉 0)를 읽어 hiZ 피라미드의 각 밉을 2x2 최댓값으로 줄입니다. 프레임 끝에 호출합니다.
+        // hiZ 밉 0은 depth와 크기가 같아야 하며, depth는 ShaderRead, hiZ는 모든 밉이 ShaderWrite 상태여야 합니다.
+        // 반환 시 hiZ의 모든 밉은 ShaderRead 상태입니다.
+        void buildHiZ(TextureHandle depth, TextureHandle hiZ, uint32_t width, uint32_t height, uint32_t mipCount);
+
+        BufferHandle instanceBuffer() const { return m_instanceBuffer.handle; }
+        BufferHandle visibleInstanceBuffer() const { return m_visibleBuffer.handle; }
+
+    private:
+        struct TrackedBuffer
+        {
+            BufferHandle handle;
+            ResourceState state = ResourceState::CopyDest;
+        };
+
+        struct Group
+        {
+            GpuDrawGroupDesc desc;
+            uint32_t meshCount = 0;
+            uint32_t argBase = 0;
+        };
+
+        bool createBuffer(TrackedBuffer& buffer, uint64_t size, uint32_t usage, uint32_t stride, const char* name);
+        void transition(TrackedBuffer& buffer, ResourceState state);
+        void markDirty(uint32_t denseIndex);
+        void rebuildLayout();
+        // 올린 구간 수를 반환하고, 올린 인스턴스 수를 uploaded에 씁니다.
+        uint32_t uploadInstances(uint32_t& uploaded);
+
+        GpuDrivenBackend& m_backend;
+        GpuCullingDesc m_desc;
+        bool m_valid = false;
+
+        TrackedBuffer m_instanceBuffer;
+        TrackedBuffer m_meshBuffer;
+        TrackedBuffer m_groupBuffer;
+        TrackedBuffer m_counterBuffer;
+        TrackedBuffer m_visibleBuffer;
+        TrackedBuffer m_argsBuffer;
+
+        // CPU 사본. m_instances는 빈틈없이 채워지며, 핸들은 m_slots를 거쳐 위치를 찾습니다.
+        std::vector<GpuInstanceData> m_instances;
+        std::vector<GpuInstanceHandle> m_denseToHandle;
+        std::vector<uint32_t> m_slots;
+        std::vector<GpuInstanceHandle> m_freeSlots;
+
+        std::vector<GpuMeshData> m_meshes;
+        std::vector<uint32_t> m_meshInstanceCounts;
+        std::vector<Group> m_groups;
+
+        std::vector<uint32_t> m_dirty;
+        std::vector<uint8_t> m_dirtyFlags;
+        bool m_layoutDirty = true;
+    };
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "axis/core/CacheLine.h"
+#include "axis/core/JobSystem.h"
+#include "axis/renderer/CommandBuffer.h"
+#include "axis/renderer/Export.h"
+#include "axis/renderer/RenderTypes.h"
+#include "axis/renderer/UploadRing.h"
+#include "axis/utils/Allocator.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace axis
+{
+    using BatchMeshId = uint32_t;
+
+    constexpr BatchMeshId kInvalidBatchMesh = 0xFFFFFFFFu;
+
+    // 인스턴싱할 수 있는 메시. DrawPacket의 정점/인덱스 상태와 같습니다.
+    struct BatchMeshDesc
+    {
+        BufferHandle vertexBuffer;
+        BufferHandle indexBuffer;
+        uint32_t vertexBufferOffset = 0;
+        uint32_t indexBufferOffset = 0;
+        IndexFormat indexFormat = IndexFormat::UInt32;
+
+        // indexBuffer가 유효하면 인덱스 수, 아니면 정점 수.
+        uint32_t elementCount = 0;
+        uint32_t firstElement = 0;
+        int32_t vertexOffset = 0;
+    };
+
+    // 컬링을 통과한 드로우 하나.
+    struct BatchDraw
+    {
+        PipelineHandle pipeline;
+        MaterialHandle material;
+        BatchMeshId mesh = kInvalidBatchMesh;
+        uint8_t layer = 0;
+        uint8_t pass = 0;
+        // DrawKey의 머티리얼 자리에 들어가는 정렬 번호.
+        uint32_t materialSortId = 0;
+        // [0, 1] 정규화 깊이. 반투명만 씁니다.
+        float depth = 0.0f;
+        bool translucent = false;
+    };
+
+    struct InstanceBatcherDesc
+    {
+        // 인스턴스 데이터 한 개의 크기. 16의 배수여야 합니다(보통 월드 행렬 64바이트).
+        uint32_t instanceStride = 64;
+        // 드로우 하나에 묶을 최대 인스턴스 수. 0이면 제한이 없습니다.
+        uint32_t maxInstancesPerDraw = 0;
+    };
+
+    struct InstanceBatchStats
+    {
+        // 기록된 드로우 수와, 묶은 뒤 실제로 나간 드로우 수.
+        uint32_t inputDraws = 0;
+        uint32_t batches = 0;
+        uint64_t uploadedBytes = 0;
+        // 업로드 링이나 프레임 할당자가 모자라 build가 실패한 횟수.
+        uint32_t failures = 0;
+    };
+
+    // 컬링 뒤의 자동 인스턴싱 단계.
+    //
+    // 워커들이 보이는 드로우를 인스턴스 데이터와 함께 스레드별 버퍼에 잠금 없이 기록하면,
+    // build가 드로우를 키로 기수 정렬해 같은 파이프라인/머티리얼/메시가 이어진 구간을 인스턴스 드로우 하나로 묶습니다.
+    // 불투명은 [layer][pass][pipeline][material][mesh] 키로 정렬하므로 같은 묶음의 드로우가 모두 모이며, 묶음 안의 깊이
+    // 순서는 버립니다. 파이프라인 핸들, materialSortId, 메시 번호가 키 자리보다 크면 잘린 번호끼리 섞여 묶음이 나뉠 수
+    // 있지만 결과는 여전히 맞습니다.
+    // 반투명은 DrawKey와 같은 뒤에서 앞 순서를 지키고, 그 순서에서 바로 이웃한 같은 상태만 묶습니다.
+    //
+    // 모든 인스턴스 데이터는 업로드 링의 한 구간에 정렬 순서대로 올라가며, 그 구간은 instanceStride의 배수
+    // 오프셋에서 시작합니다. 드로우의 firstInstance는 링 버퍼 처음부터 센 인스턴스 번호이므로, 링 버퍼 전체를
+    // instanceStride 간격의 구조화 버퍼로 한 번 묶어 두고 정점 셰이더에서 instances[firstInstance + instanceId]로
+    // 읽습니다. firstInstance는 정점 셰이더에 시작 인스턴스로 전달되어야 합니다.
+    //
+    // 기록 블록과 정렬 배열은 생성 시 받은 할당자(보통 FrameArena)에서 옵니다. 프레임마다 reset()으로 비웁니다.
+    class AXIS_RENDERER_API InstanceBatcher
+    {
+    public:
+        InstanceBatcher(JobSystem& jobs, Allocator& frameAllocator, const InstanceBatcherDesc& desc = {});
+        ~InstanceBatcher();
+
+        InstanceBatcher(const InstanceBatcher&) = delete;
+        InstanceBatcher& operator=(const InstanceBatcher&) = delete;
+
+        // 기록 중에는 호출할 수 없습니다.
+        BatchMeshId addMesh(const BatchMeshDesc& desc);
+        const BatchMeshDesc& mesh(BatchMeshId id) const { return m_meshes[id]; }
+
+        // instanceData는 instanceStride 바이트입니다. JobSystem에 속한 스레드에서만 호출할 수 있습니다.
+        // 실패하면(프레임 할당자 고갈) false.
+        bool add(const BatchDraw& draw, const void* instanceData);
+
+        // 기록이 모두 끝난 뒤 한 스레드에서 호출합니다. 인스턴스 데이터를 ring에 올리고 묶은 드로우를 out에 기록합니다.
+        // 실패하면 아무것도 기록하지 않고 false.
+        bool build(UploadRing& ring, CommandBuffer& out);
+
+        // 마지막 build가 올린 인스턴스 데이터 구간.
+        const UploadAllocation& instanceAllocation() const { return m_allocation; }
+        uint32_t instanceStride() const { return m_desc.instanceStride; }
+        uint32_t recordedCount() const;
+
+        const InstanceBatchStats& stats() const { return m_stats; }
+
+        void reset();
+
+    private:
+        struct Block;
+
+        struct alignas(kCacheLineSize) ThreadRecords
+        {
+            Block* head = nullptr;
+            Block* tail = nullptr;
+            uint32_t count = 0;
+        };
+
+        // 기록 하나의 머리글. 바로 뒤에 instanceStride 바이트의 인스턴스 데이터가 있습니다.
+        struct Record
+        {
+            uint64_t key;
+            PipelineHandle pipeline;
+            MaterialHandle material;
+            BatchMeshId mesh;
+            bool translucent;
+        };
+
+        static constexpr uint32_t kRecordsPerBlock = 128;
+
+        size_t blockBytes() const;
+        bool sameBatch(const Record& a, const Record& b) const;
+        void releaseBlocks(ThreadRecords& records);
+
+        JobSystem& m_jobs;
+        Allocator& m_allocator;
+        InstanceBatcherDesc m_desc;
+        uint32_t m_recordStride = 0;
+
+        std::unique_ptr<ThreadRecords[]> m_threads;
+        uint32_t m_threadCount = 0;
+
+        std::vector<BatchMeshDesc> m_meshes;
+
+        UploadAllocation m_allocation;
+        InstanceBatchStats m_stats;
+    };
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "axis/core/JobSystem.h"
+#include "axis/platform/MappedFile.h"
+#include "axis/renderer/Export.h"
+#include "axis/renderer/RenderBackend.h"
+#include "axis/renderer/RenderTypes.h"
+#include "axis/utils/Allocator.h"
+#include "axis/utils/FlatHashMap.h"
+#include "axis/utils/Hash.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace axis
+{
+    inline uint64_t pipelineKey(const PipelineStateDesc& desc)
+    {
+        return xxHash64(&desc, sizeof(desc));
+    }
+
+    struct PipelineCacheStats
+    {
+        // 캐시된 바이너리로 바로 만든 수.
+        uint32_t hits = 0;
+        // 제출 스레드에서 컴파일해야 했던 수. 0이 아니면 그만큼 프레임이 끊겼습니다.
+        uint32_t misses = 0;
+        // 예열 작업이 컴파일한 수.
+        uint32_t warmed = 0;
+        // 드라이버가 거부했거나 체크섬이 맞지 않아 버린 바이너리 수.
+        uint32_t rejected = 0;
+        uint32_t failures = 0;
+    };
+
+    // 디스크에 남는 파이프라인(PSO)/셰이더 바이너리 캐시.
+    //
+    // 파일은 메모리 매핑으로 열며, 키 순으로 정렬된 항목 표를 이진 탐색해 바이너리를 복사 없이 드라이버에 넘깁니다.
+    // 머리글의 PipelineCacheIdentity(장치, 드라이버, 엔진 버전)가 지금과 다르면 파일 전체를 무시합니다.
+    // 이번 실행에서 새로 컴파일한 바이너리는 메모리에 모아 두었다가 save에서 기존 항목과 합쳐 다시 씁니다.
+    //
+    // 로딩 중에 warm으로 앞으로 쓸 상태를 넘기면 워커에서 미리 컴파일해 두므로,
+    // acquire는 대부분 드라이버 캐시 적중으로 끝나고 첫 사용 시 끊김이 생기지 않습니다.
+    // acquire/save/open은 제출 스레드에서 호출합니다.
+    class AXIS_RENDERER_API PipelineCache
+    {
+    public:
+        enum class BlobKind : uint8_t
+        {
+            Pipeline,
+            Shader,
+        };
+
+        explicit PipelineCache(PipelineCacheBackend& backend, Allocator& allocator = defaultAllocator());
+        ~PipelineCache();
+
+        PipelineCache(const PipelineCache&) = delete;
+        PipelineCache& operator=(const PipelineCache&) = delete;
+
+        // 경로는 UTF-8입니다. 파일이 없거나, 형식이 틀리거나, 다른 드라이버에서 만든 것이면 빈 캐시로 시작하고 false.
+        // 어느 쪽이든 save는 이 경로에 씁니다.
+        bool open(const char* path);
+
+        // 새 바이너리가 있으면 임시 파일에 쓴 뒤 교체합니다. 예열 중에는 호출할 수 없습니다.
+        bool save();
+
+        // 캐시에 없는 상태를 워커에서 컴파일합니다. 같은 상태를 여러 번 넘겨도 한 번만 컴파일합니다.
+        void warm(JobSystem& jobs, const PipelineStateDesc* descs, uint32_t count);
+        bool isWarming() const { return !m_warmCounter.isDone(); }
+        void waitForWarm(JobSystem& jobs);
+
+        // 이미 만든 파이프라인, 캐시된 바이너리, 즉석 컴파일 순으로 찾습니다. 파이프라인은 캐시가 소유합니다.
+        PipelineHandle acquire(const PipelineStateDesc& desc);
+
+        // 셰이더 바이트코드 캐시. 키는 보통 소스와 컴파일 옵션의 해시입니다.
+        // 어느 스레드에서든 호출할 수 있으며, 찾은 포인터는 다음 save까지 유효합니다.
+        bool findShader(uint64_t key, const void*& data, uint64_t& size);
+        void storeShader(uint64_t key, const void* data, uint64_t size);
+
+        uint32_t fileEntryCount() const { return m_entryCount; }
+        uint32_t pendingEntryCount();
+        bool isFileValid() const { return m_entries != nullptr; }
+        const PipelineCacheStats& stats() const { return m_stats; }
+
+    private:
+        struct FileEntry;
+
+        struct WarmItem
+        {
+            PipelineCache* owner;
+            PipelineStateDesc desc;
+        };
+
+        // warm 한 번에 제출한 작업 묶음. 예열이 모두 끝난 뒤 다음 warm이나 save에서 해제합니다.
+        struct WarmBatch
+        {
+            std::unique_ptr<Job[]> jobs;
+            std::unique_ptr<WarmItem[]> items;
+        };
+
+        // 이번 실행에서 새로 얻은 바이너리. 워커가 넣고 제출 스레드가 읽으므로 m_pendingMutex로 보호합니다.
+        using PendingMap = FlatHashMap<uint64_t, std::vector<uint8_t>>;
+
+        static void warmJob(void* data);
+
+        const FileEntry* findFileEntry(uint64_t key, BlobKind kind) const;
+        bool findBlob(uint64_t key, BlobKind kind, const void*& data, uint64_t& size);
+        bool compileAndStore(const PipelineStateDesc& desc, uint64_t key, bool replace);
+        bool mapFile();
+        void releaseWarmBatches();
+
+        PipelineCacheBackend& m_backend;
+        Allocator& m_allocator;
+        PipelineCacheIdentity m_identity;
+        std::string m_path;
+
+        // 매핑과 항목 표. findShader가 다른 스레드에서 읽으므로, 제출 스레드가 바꿀 때(mapFile, save의 교체)만
+        // m_fileMutex를 단독으로 잡고 읽는 쪽은 공유로 잡습니다. 제출 스레드 자신의 읽기는 잠그지 않습니다.
+        std::shared_mutex m_fileMutex;
+        MappedFile m_file;
+        const FileEntry* m_entries = nullptr;
+        uint32_t m_entryCount = 0;
+        // 체크섬을 확인한 항목 표시. 검증은 처음 읽을 때 한 번만 합니다.
+        std::unique_ptr<std::atomic<uint8_t>[]> m_verified;
+
+        std::mutex m_pendingMutex;
+        PendingMap m_pendingPipelines;
+        PendingMap m_pendingShaders;
+        // 예열 중이거나 컴파일이 끝난 키. 같은 키의 중복 컴파일을 막습니다.
+        FlatHashSet<uint64_t> m_warmKeys;
+
+        FlatHashMap<uint64_t, PipelineHandle> m_pipelines;
+
+        JobCounter m_warmCounter;
+        std::vector<WarmBatch> m_warmBatches;
+
+        // warmed/failures는 워커도 갱신하므로 m_pendingMutex 안에서 씁니다.
+        PipelineCacheStats m_stats;
+    };
+}
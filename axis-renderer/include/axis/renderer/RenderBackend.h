@@ -0,0 +1,167 @@
+#pragma once
+
+#include "axis/renderer/Export.h"
+#include "axis/renderer/RenderTypes.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace axis
+{
+    // 그래픽스 API 백엔드 인터페이스.
+    //
+    // axis-renderer는 특정 API에 묶이지 않으며, D3D12/Vulkan 등 실제 구현은 이 인터페이스를 구현합니다.
+    // 모든 호출은 제출 스레드 하나에서만 이루어집니다.
+    class AXIS_RENDERER_API RenderBackend
+    {
+    public:
+        virtual ~RenderBackend() = default;
+
+        virtual void setPipeline(PipelineHandle pipeline) = 0;
+        virtual void setMaterial(MaterialHandle material) = 0;
+        virtual void setVertexBuffer(BufferHandle buffer, uint32_t offset) = 0;
+        virtual void setIndexBuffer(BufferHandle buffer, uint32_t offset, IndexFormat format) = 0;
+
+        virtual void draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
+                          uint32_t firstInstance) = 0;
+        virtual void drawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex,
+                                 int32_t vertexOffset, uint32_t firstInstance) = 0;
+    };
+
+    // GPU 구동 렌더링(컴퓨트 컬링 + 간접 드로우)을 지원하는 백엔드.
+    //
+    // 컴퓨트 디스패치와 개수 버퍼를 받는 multi-draw-indirect가 필요합니다
+    // (D3D12 ExecuteIndirect, Vulkan vkCmdDrawIndexedIndirectCount).
+    // 슬롯 번호는 셰이더의 레지스터 번호이며, writable이면 u 레지스터, 아니면 t 레지스터입니다.
+    class AXIS_RENDERER_API GpuDrivenBackend : public RenderBackend
+    {
+    public:
+        // 실패하면 유효하지 않은 핸들.
+        virtual BufferHandle createBuffer(const BufferDesc& desc) = 0;
+        virtual void destroyBuffer(BufferHandle buffer) = 0;
+
+        // 명령 스트림 순서대로 GPU 버퍼에 복사됩니다. 대상은 CopyDest 상태여야 합니다.
+        virtual void updateBuffer(BufferHandle buffer, uint64_t offset, const void* data, uint64_t size) = 0;
+        // 4바이트 값으로 채웁니다. 대상은 CopyDest 상태여야 합니다.
+        virtual void fillBuffer(BufferHandle buffer, uint64_t offset, uint64_t size, uint32_t value) = 0;
+
+        virtual void bufferBarrier(BufferHandle buffer, ResourceState before, ResourceState after) = 0;
+        virtual void textureBarrier(TextureHandle texture, uint32_t mip, ResourceState before,
+                                    ResourceState after) = 0;
+
+        virtual void setComputePipeline(PipelineHandle pipeline) = 0;
+        virtual void setComputeBuffer(uint32_t slot, BufferHandle buffer, bool writable) = 0;
+        virtual void setComputeTexture(uint32_t slot, TextureHandle texture, uint32_t mip, bool writable) = 0;
+        // b0에 바인딩되는 상수. 크기는 256바이트 이하입니다.
+        virtual void setComputeConstants(const void* data, uint32_t size) = 0;
+        virtual void dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) = 0;
+
+        // args에서 DrawIndexedIndirectArgs를 최대 maxDraws개 읽어 그립니다. 실제 개수는 countBuffer의 uint32입니다.
+        // firstInstance는 정점 셰이더에 시작 인스턴스로 전달되어야 합니다.
+        virtual void drawIndexedIndirectCount(BufferHandle args, uint64_t argsOffset, BufferHandle countBuffer,
+                                              uint64_t countOffset, uint32_t maxDraws) = 0;
+    };
+
+    // 프레임마다 다시 쓰는 업로드 메모리(UploadRing)를 위한 백엔드 인터페이스.
+    //
+    // 업로드 버퍼는 CPU가 쓰고 GPU가 복사 없이 바로 읽는 메모리(D3D12 UPLOAD 힙, Vulkan HOST_VISIBLE)에 만들고
+    // 파괴할 때까지 매핑을 유지합니다. 펜스 값은 제출 순서대로 커지는 64비트 값입니다.
+    class AXIS_RENDERER_API UploadBackend
+    {
+    public:
+        virtual ~UploadBackend() = default;
+
+        // 실패하면 유효하지 않은 핸들을 반환하며 mapped는 바뀌지 않습니다.
+        virtual BufferHandle createUploadBuffer(const BufferDesc& desc, void** mapped) = 0;
+        virtual void destroyUploadBuffer(BufferHandle buffer) = 0;
+
+        // 일관성이 없는(non-coherent) 메모리에서 CPU 쓰기를 GPU에 보이게 합니다. 일관 메모리면 아무것도 하지 않습니다.
+        virtual void flushUploadBuffer(BufferHandle buffer, uint64_t offset, uint64_t size) = 0;
+
+        // GPU가 마친 마지막 펜스 값과, 주어진 값에 도달할 때까지 CPU를 재우는 대기.
+        virtual uint64_t completedFenceValue() = 0;
+        virtual void waitForFence(uint64_t value) = 0;
+    };
+
+    // 디스크 캐시가 같은 드라이버에서 만든 것인지 확인하는 값. 하나라도 다르면 캐시 전체를 버립니다.
+    struct PipelineCacheIdentity
+    {
+        uint32_t vendorId = 0;
+        uint32_t deviceId = 0;
+        uint64_t driverVersion = 0;
+        // 셰이더 컴파일러나 엔진의 셰이더 입력 규약이 바뀌면 올립니다.
+        uint64_t engineVersion = 0;
+    };
+
+    // PipelineCache가 쓰는 백엔드 인터페이스.
+    //
+    // 바이너리는 드라이버가 다시 읽을 수 있는 형태(D3D12 GetCachedBlob, Vulkan 파이프라인 캐시 데이터)입니다.
+    // compilePipeline은 로딩 중 워커 스레드에서 동시에 호출되므로 스레드 안전해야 하며,
+    // 나머지는 제출 스레드에서만 호출됩니다.
+    class AXIS_RENDERER_API PipelineCacheBackend
+    {
+    public:
+        virtual ~PipelineCacheBackend() = default;
+
+        virtual PipelineCacheIdentity cacheIdentity() = 0;
+
+        // 처음부터 컴파일해 드라이버 바이너리를 outBinary에 담습니다. 실패하면 false.
+        virtual bool compilePipeline(const PipelineStateDesc& desc, std::vector<uint8_t>& outBinary) = 0;
+
+        // 캐시된 바이너리로 만듭니다. 드라이버가 바이너리를 거부하면 유효하지 않은 핸들을 반환합니다.
+        virtual PipelineHandle createPipeline(const PipelineStateDesc& desc, const void* binary, uint64_t size) = 0;
+        virtual void destroyPipeline(PipelineHandle pipeline) = 0;
+    };
+
+    enum class BarrierType : uint8_t
+    {
+        Transition,
+        // 같은 메모리를 쓰던 리소스에서 새 리소스로 넘어갑니다. before가 유효하지 않으면 "이전 리소스 불명"입니다.
+        Aliasing,
+        // 같은 리소스의 셰이더 쓰기 사이 순서 보장.
+        Uav,
+    };
+
+    // 텍스처는 texture, 버퍼는 buffer 중 하나만 유효합니다.
+    // Aliasing에서는 aliasBeforeTexture/aliasBeforeBuffer가 이전 리소스입니다.
+    struct ResourceBarrier
+    {
+        BarrierType type = BarrierType::Transition;
+        TextureHandle texture;
+        BufferHandle buffer;
+        TextureHandle aliasBeforeTexture;
+        BufferHandle aliasBeforeBuffer;
+        ResourceState before = ResourceState::Undefined;
+        ResourceState after = ResourceState::Undefined;
+    };
+
+    struct MemoryRequirements
+    {
+        uint64_t size = 0;
+        uint64_t alignment = 0;
+        // 같은 힙에 함께 놓일 수 있는 리소스 분류(예: D3D12 힙 티어 1의 RT/DS 텍스처, 일반 텍스처, 버퍼).
+        uint32_t heapClass = 0;
+    };
+
+    // 렌더 그래프가 임시 리소스를 힙에 겹쳐 배치하고 배리어를 묶어 보내는 데 쓰는 백엔드 인터페이스.
+    class AXIS_RENDERER_API RenderGraphBackend
+    {
+    public:
+        virtual ~RenderGraphBackend() = default;
+
+        virtual MemoryRequirements memoryRequirements(const TextureDesc& desc) = 0;
+        virtual MemoryRequirements memoryRequirements(const BufferDesc& desc) = 0;
+
+        virtual HeapHandle createHeap(uint64_t size, uint32_t heapClass) = 0;
+        virtual void destroyHeap(HeapHandle heap) = 0;
+
+        // offset은 memoryRequirements의 alignment 배수입니다.
+        virtual TextureHandle createPlacedTexture(HeapHandle heap, uint64_t offset, const TextureDesc& desc) = 0;
+        virtual BufferHandle createPlacedBuffer(HeapHandle heap, uint64_t offset, const BufferDesc& desc) = 0;
+        virtual void destroyPlacedTexture(TextureHandle texture) = 0;
+        virtual void destroyPlacedBuffer(BufferHandle buffer) = 0;
+
+        // 배리어 묶음 하나를 한 번의 API 호출(ResourceBarrier / vkCmdPipelineBarrier2)로 기록합니다.
+        virtual void resourceBarriers(const ResourceBarrier* barriers, uint32_t count) = 0;
+    };
+}
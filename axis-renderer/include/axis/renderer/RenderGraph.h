@@ -0,0 +1,288 @@
+#pragma once
+
+#include "axis/renderer/Export.h"
+#include "axis/renderer/RenderBackend.h"
+#include "axis/renderer/RenderTypes.h"
+#include "axis/utils/Allocator.h"
+
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace axis
+{
+    constexpr uint32_t kInvalidRenderGraphResource = 0xFFFFFFFFu;
+
+    // 그래프 안에서만 유효한 리소스 참조. 실제 핸들은 실행 중 RenderGraphContext에서 얻습니다.
+    struct RgTexture
+    {
+        uint32_t index = kInvalidRenderGraphResource;
+
+        bool isValid() const { return index != kInvalidRenderGraphResource; }
+    };
+
+    struct RgBuffer
+    {
+        uint32_t index = kInvalidRenderGraphResource;
+
+        bool isValid() const { return index != kInvalidRenderGraphResource; }
+    };
+
+    struct RenderGraphDesc
+    {
+        // 힙과 배치 리소스를 파괴하기 전에 기다릴 프레임 수. GPU가 앞서 나갈 수 있는 프레임 수와 같게 둡니다.
+        uint32_t framesInFlight = 2;
+    };
+
+    struct RenderGraphStats
+    {
+        uint32_t passCount = 0;
+        uint32_t culledPasses = 0;
+        uint32_t transientResources = 0;
+        uint32_t heapCount = 0;
+        // 임시 리소스를 겹치지 않고 따로 잡았을 때의 크기와 실제 힙 크기.
+        uint64_t unaliasedBytes = 0;
+        uint64_t heapBytes = 0;
+        uint32_t barrierBatches = 0;
+        uint32_t barriers = 0;
+        uint32_t aliasingBarriers = 0;
+    };
+
+    class RenderGraph;
+
+    // 패스 실행 중 그래프 리소스를 실제 핸들로 바꿉니다.
+    class AXIS_RENDERER_API RenderGraphContext
+    {
+    public:
+        TextureHandle texture(RgTexture texture) const;
+        BufferHandle buffer(RgBuffer buffer) const;
+        const char* passName() const;
+
+    private:
+        friend class RenderGraph;
+
+        RenderGraphContext(const RenderGraph& graph, uint32_t pass)
+            : m_graph(graph)
+            , m_pass(pass)
+        {
+        }
+
+        const RenderGraph& m_graph;
+        uint32_t m_pass;
+    };
+
+    // addPass의 설정 함수에 전달됩니다. 패스가 어떤 리소스를 어떤 상태로 읽고 쓰는지 선언합니다.
+    // 읽고 다시 쓰는 리소스는 read와 write를 모두 선언합니다.
+    class AXIS_RENDERER_API RenderPassBuilder
+    {
+    public:
+        RgTexture read(RgTexture texture, ResourceState state = ResourceState::ShaderRead);
+        RgTexture write(RgTexture texture, ResourceState state = ResourceState::RenderTarget);
+        RgBuffer read(RgBuffer buffer, ResourceState state = ResourceState::ShaderRead);
+        RgBuffer write(RgBuffer buffer, ResourceState state = ResourceState::ShaderWrite);
+
+        RgTexture createTexture(const char* name, const TextureDesc& desc);
+        RgBuffer createBuffer(const char* name, const BufferDesc& desc);
+
+        // 출력이 그래프 밖에서 보이지 않아도(예: 읽기 되돌림, 디버그 출력) 패스를 지우지 않습니다.
+        void setSideEffect();
+
+    private:
+        friend class RenderGraph;
+
+        RenderPassBuilder(RenderGraph& graph, uint32_t pass)
+            : m_graph(graph)
+            , m_pass(pass)
+        {
+        }
+
+        RenderGraph& m_graph;
+        uint32_t m_pass;
+    };
+
+    // 프레임 렌더 그래프.
+    //
+    // 프레임마다 리소스와 패스를 선언한 뒤 compile()과 execute()를 호출하고 reset()으로 비웁니다.
+    // compile()은 다음을 순서대로 합니다.
+    //   1. 가져온(import) 리소스나 부수 효과가 있는 패스에 닿지 않는 패스를 지웁니다.
+    //   2. 남은 패스 기준으로 임시 리소스마다 첫 사용/마지막 사용 패스를 구합니다.
+    //   3. 수명이 겹치지 않는 임시 리소스를 힙 분류별로 같은 메모리에 겹쳐 배치합니다.
+    //   4. 패스 경계마다 필요한 전이/별칭/UAV 배리어를 모아 패스당 한 번의 호출로 묶고, 중복 전이는 버립니다.
+    // 힙과 배치 리소스는 프레임 사이에 재사용되며, 배치가 바뀐 것만 framesInFlight 뒤에 파괴됩니다.
+    // 패스 실행 함수는 생성 시 받은 프레임 할당자에 저장되고 reset()에서 파괴됩니다.
+    // 모든 호출은 한 스레드에서 이루어져야 합니다.
+    class AXIS_RENDERER_API RenderGraph
+    {
+    public:
+        RenderGraph(RenderGraphBackend& backend, Allocator& frameAllocator, const RenderGraphDesc& desc = {});
+        // GPU가 그래프 리소스를 더 이상 쓰지 않는 시점에 파괴해야 합니다.
+        ~RenderGraph();
+
+        RenderGraph(const RenderGraph&) = delete;
+        RenderGraph& operator=(const RenderGraph&) = delete;
+
+        RgTexture createTexture(const char* name, const TextureDesc& desc);
+        RgBuffer createBuffer(const char* name, const BufferDesc& desc);
+
+        // 그래프 밖에서 수명을 관리하는 리소스. 프레임 시작 시 initialState이며 끝나면 finalState로 돌려놓습니다.
+        // 가져온 리소스에 쓰는 패스는 그래프의 출력으로 간주되어 지워지지 않습니다.
+        RgTexture importTexture(const char* name, TextureHandle texture, const TextureDesc& desc,
+                                ResourceState initialState, ResourceState finalState);
+        RgBuffer importBuffer(const char* name, BufferHandle buffer, const BufferDesc& desc, ResourceState initialState,
+                              ResourceState finalState);
+
+        // setup(RenderPassBuilder&)은 바로 호출되고, execute(RenderGraphContext&)는 execute()에서 호출됩니다.
+        template <typename Setup, typename Execute>
+        void addPass(const char* name, Setup&& setup, Execute&& execute);
+
+        // 프레임 할당자나 백엔드 리소스 생성이 실패하면 false.
+        bool compile();
+        void execute();
+        void reset();
+
+        bool isCulled(uint32_t pass) const { return m_passes[pass].culled; }
+        uint32_t passCount() const { return static_cast<uint32_t>(m_passes.size()); }
+        const RenderGraphStats& stats() const { return m_stats; }
+
+    private:
+        friend class RenderGraphContext;
+        friend class RenderPassBuilder;
+
+        using ExecuteThunk = void (*)(void* closure, RenderGraphContext& context);
+        using DestroyThunk = void (*)(void* closure);
+
+        struct Resource
+        {
+            const char* name = nullptr;
+            bool isTexture = true;
+            bool imported = false;
+            TextureDesc textureDesc;
+            BufferDesc bufferDesc;
+            ResourceState initialState = ResourceState::Undefined;
+            ResourceState finalState = ResourceState::Undefined;
+
+            // compile 결과.
+            TextureHandle texture;
+            BufferHandle buffer;
+            uint32_t firstPass = kInvalidRenderGraphResource;
+            uint32_t lastPass = 0;
+            MemoryRequirements requirements;
+            uint64_t offset = 0;
+            uint32_t heap = kInvalidRenderGraphResource;
+            uint32_t aliasBefore = kInvalidRenderGraphResource;
+            bool aliased = false;
+
+            // 배리어 계산 중의 현재 상태와 마지막으로 접근한 패스.
+            ResourceState state = ResourceState::Undefined;
+            uint32_t lastAccessPass = kInvalidRenderGraphResource;
+        };
+
+        struct Access
+        {
+            uint32_t resource;
+            ResourceState state;
+            bool write;
+        };
+
+        struct Pass
+        {
+            const char* name = nullptr;
+            uint32_t firstAccess = 0;
+            uint32_t accessCount = 0;
+            bool sideEffect = false;
+            bool culled = false;
+            void* closure = nullptr;
+            size_t closureSize = 0;
+            ExecuteThunk executeThunk = nullptr;
+            DestroyThunk destroyThunk = nullptr;
+            uint32_t firstBarrier = 0;
+            uint32_t barrierCount = 0;
+        };
+
+        struct Heap
+        {
+            HeapHandle handle;
+            uint64_t size = 0;
+            uint32_t heapClass = 0;
+        };
+
+        // 프레임 사이에 재사용하는 배치 리소스.
+        struct PlacedResource
+        {
+            bool isTexture = true;
+            TextureDesc textureDesc;
+            BufferDesc bufferDesc;
+            uint32_t heap = 0;
+            uint64_t offset = 0;
+            TextureHandle texture;
+            BufferHandle buffer;
+            bool usedThisFrame = false;
+        };
+
+        struct Retired
+        {
+            uint64_t frame;
+            TextureHandle texture;
+            BufferHandle buffer;
+            HeapHandle heap;
+        };
+
+        uint32_t addResource(const Resource& resource);
+        uint32_t beginPass(const char* name);
+        void addAccess(uint32_t pass, uint32_t resource, ResourceState state, bool write);
+        void setPassExecute(uint32_t pass, void* closure, size_t size, ExecuteThunk execute, DestroyThunk destroy);
+
+        void cullPasses();
+        void computeLifetimes();
+        bool allocateTransients();
+        bool placeResources();
+        void buildBarriers();
+        void retire(TextureHandle texture, BufferHandle buffer, HeapHandle heap);
+        void collectRetired(bool all);
+
+        RenderGraphBackend& m_backend;
+        Allocator& m_frameAllocator;
+        RenderGraphDesc m_desc;
+
+        std::vector<Resource> m_resources;
+        std::vector<Access> m_accesses;
+        std::vector<Pass> m_passes;
+        std::vector<ResourceBarrier> m_barriers;
+        std::vector<uint8_t> m_needed;
+        std::vector<uint32_t> m_order;
+        uint32_t m_finalBarrier = 0;
+        bool m_compiled = false;
+        bool m_setupFailed = false;
+
+        std::vector<Heap> m_heaps;
+        std::vector<PlacedResource> m_placed;
+        std::vector<Retired> m_retired;
+        uint64_t m_frameIndex = 0;
+
+        RenderGraphStats m_stats;
+    };
+
+    template <typename Setup, typename Execute>
+    void RenderGraph::addPass(const char* name, Setup&& setup, Execute&& execute)
+    {
+        using Closure = std::decay_t<Execute>;
+
+        const uint32_t pass = beginPass(name);
+        RenderPassBuilder builder(*this, pass);
+        setup(builder);
+
+        void* memory = m_frameAllocator.allocate(sizeof(Closure), alignof(Closure));
+        if (memory == nullptr)
+        {
+            m_setupFailed = true;
+            return;
+        }
+        new (memory) Closure(std::forward<Execute>(execute));
+        setPassExecute(
+            pass, memory, sizeof(Closure),
+            [](void* closure, RenderGraphContext& context) { (*static_cast<Closure*>(closure))(context); },
+            [](void* closure) { static_cast<Closure*>(closure)->~Closure(); });
+    }
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstdint>
+
+namespace axis
+{
+    // 백엔드가 발급하는 GPU 객체 핸들. 0은 유효하지 않은 값입니다.
+    template <typename Tag>
+    struct RenderHandle
+    {
+        uint32_t id = 0;
+
+        bool isValid() const { return id != 0; }
+
+        friend bool operator==(RenderHandle a, RenderHandle b) { return a.id == b.id; }
+        friend bool operator!=(RenderHandle a, RenderHandle b) { return a.id != b.id; }
+    };
+
+    struct PipelineTag;
+    struct MaterialTag;
+    struct BufferTag;
+    struct TextureTag;
+    struct HeapTag;
+
+    using PipelineHandle = RenderHandle<PipelineTag>;
+    // 머티리얼 = 한 번에 바인딩되는 리소스 묶음(디스크립터 세트/루트 테이블).
+    using MaterialHandle = RenderHandle<MaterialTag>;
+    using BufferHandle = RenderHandle<BufferTag>;
+    using TextureHandle = RenderHandle<TextureTag>;
+    // 리소스를 배치(placed)할 수 있는 GPU 메모리 힙.
+    using HeapHandle = RenderHandle<HeapTag>;
+
+    enum class IndexFormat : uint8_t
+    {
+        UInt16,
+        UInt32,
+    };
+
+    // 버퍼 용도 비트. 조합해서 씁니다.
+    enum BufferUsage : uint32_t
+    {
+        kBufferUsageVertex = 1u << 0,
+        kBufferUsageIndex = 1u << 1,
+        // 셰이더에서 읽는 구조화 버퍼(SRV).
+        kBufferUsageStorage = 1u << 2,
+        // 셰이더에서 쓰는 구조화 버퍼(UAV).
+        kBufferUsageStorageWrite = 1u << 3,
+        // 간접 드로우 인자/개수 버퍼.
+        kBufferUsageIndirect = 1u << 4,
+        // 상수 버퍼(CBV / uniform buffer).
+        kBufferUsageConstant = 1u << 5,
+    };
+
+    struct BufferDesc
+    {
+        uint64_t size = 0;
+        uint32_t usage = 0;
+        // 구조화 버퍼의 원소 크기. 원시 버퍼면 0.
+        uint32_t stride = 0;
+        const char* debugName = nullptr;
+    };
+
+    enum class TextureFormat : uint8_t
+    {
+        Rgba8Unorm,
+        Rgba8Srgb,
+        Rgba16Float,
+        Rgba32Float,
+        Rg16Float,
+        R11G11B10Float,
+        R32Float,
+        Depth32Float,
+        Depth24Stencil8,
+    };
+
+    // 텍스처 용도 비트. 조합해서 씁니다.
+    enum TextureUsage : uint32_t
+    {
+        kTextureUsageSampled = 1u << 0,
+        kTextureUsageStorage = 1u << 1,
+        kTextureUsageRenderTarget = 1u << 2,
+        kTextureUsageDepthStencil = 1u << 3,
+    };
+
+    struct TextureDesc
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t mipCount = 1;
+        TextureFormat format = TextureFormat::Rgba8Unorm;
+        uint32_t usage = kTextureUsageSampled;
+        const char* debugName = nullptr;
+    };
+
+    // 배리어 전후 상태. 같은 ShaderWrite 사이의 배리어는 UAV 배리어(쓰기 간 순서 보장)를 뜻합니다.
+    enum class ResourceState : uint8_t
+    {
+        CopyDest,
+        ShaderRead,
+        ShaderWrite,
+        IndirectArgument,
+        CopySource,
+        RenderTarget,
+        DepthWrite,
+        DepthRead,
+        Present,
+        // 내용이 의미 없는 상태. 별칭 메모리에 새로 배치된 리소스의 첫 상태로, 이전 내용을 버려도 됩니다.
+        Undefined,
+    };
+
+    // D3D12_DRAW_INDEXED_ARGUMENTS / VkDrawIndexedIndirectCommand와 같은 배치입니다.
+    struct DrawIndexedIndirectArgs
+    {
+        uint32_t indexCount;
+        uint32_t instanceCount;
+        uint32_t firstIndex;
+        int32_t vertexOffset;
+        uint32_t firstInstance;
+    };
+
+    static_assert(sizeof(DrawIndexedIndirectArgs) == 20);
+
+    enum class PrimitiveTopology : uint8_t
+    {
+        TriangleList,
+        TriangleStrip,
+        LineList,
+        PointList,
+    };
+
+    enum class CullMode : uint8_t
+    {
+        None,
+        Back,
+        Front,
+    };
+
+    enum class CompareOp : uint8_t
+    {
+        Never,
+        Less,
+        LessEqual,
+        Equal,
+        GreaterEqual,
+        Greater,
+        Always,
+    };
+
+    enum class BlendMode : uint8_t
+    {
+        Opaque,
+        AlphaBlend,
+        Additive,
+        Premultiplied,
+    };
+
+    constexpr uint32_t kMaxColorTargets = 8;
+
+    // 파이프라인 상태 기술. 바이트 그대로 해시해 캐시 키로 쓰므로 패딩 없는 고정 배치이며,
+    // 쓰지 않는 칸도 기본값(0)으로 둡니다.
+    struct PipelineStateDesc
+    {
+        // 셰이더 바이트코드 해시(xxHash64). 0이면 그 단계가 없습니다. computeShader가 있으면 컴퓨트 파이프라인입니다.
+        uint64_t vertexShader = 0;
+        uint64_t pixelShader = 0;
+        uint64_t computeShader = 0;
+        // 엔진이 정한 정점 입력 레이아웃 번호.
+        uint32_t vertexLayout = 0;
+        // 백엔드별 추가 비트(보수적 래스터화 등).
+        uint32_t flags = 0;
+        TextureFormat colorFormats[kMaxColorTargets] = {};
+        uint8_t colorTargetCount = 0;
+        TextureFormat depthFormat = TextureFormat::Depth32Float;
+        uint8_t depthTest = 0;
+        uint8_t depthWrite = 0;
+        CompareOp depthCompare = CompareOp::LessEqual;
+        PrimitiveTopology topology = PrimitiveTopology::TriangleList;
+        CullMode cullMode = CullMode::Back;
+        BlendMode blendMode = BlendMode::Opaque;
+        uint8_t sampleCount = 1;
+        uint8_t reserved[7] = {};
+    };
+
+    static_assert(sizeof(PipelineStateDesc) == 56, "PipelineStateDesc에 패딩이 생기면 캐시 키가 흔들립니다");
+}
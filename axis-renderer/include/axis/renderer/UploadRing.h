@@ -0,0 +1,142 @@
+#pragma once
+
+#include "axis/renderer/Export.h"
+#include "axis/renderer/RenderBackend.h"
+#include "axis/renderer/RenderTypes.h"
+#include "axis/utils/SpinLock.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+namespace axis
+{
+    // 상수 버퍼 바인딩 오프셋 정렬(D3D12 CBV, 대부분의 Vulkan minUniformBufferOffsetAlignment).
+    constexpr uint32_t kConstantBufferAlignment = 256;
+
+    constexpr uint32_t kMaxUploadFramesInFlight = 4;
+
+    struct UploadRingDesc
+    {
+        // 링 전체 크기. 동시에 진행 중인 모든 프레임의 업로드를 담아야 하므로
+        // 프레임 최대 사용량 x framesInFlight가 적당합니다.
+        uint64_t capacity = 16ull * 1024 * 1024;
+        // CPU가 GPU보다 앞설 수 있는 프레임 수. beginFrame은 이보다 앞서면 가장 오래된 프레임을 기다립니다.
+        uint32_t framesInFlight = 3;
+        const char* debugName = "UploadRing";
+    };
+
+    // 링 안의 한 구간. cpu는 매핑된 주소이고, GPU에서는 buffer의 offset부터 읽습니다.
+    struct UploadAllocation
+    {
+        BufferHandle buffer;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        void* cpu = nullptr;
+
+        bool isValid() const { return cpu != nullptr; }
+    };
+
+    struct UploadRingStats
+    {
+        uint64_t frameBytes = 0;
+        uint64_t peakFrameBytes = 0;
+        // 링 끝에 들어가지 않아 건너뛴 바이트. 큰 할당이 잦으면 늘어납니다.
+        uint64_t wrapWasteBytes = 0;
+        // 자리가 없어 GPU를 기다린 횟수와 시간. 0이 아니면 capacity가 부족한 것입니다.
+        uint32_t stalls = 0;
+        uint64_t stallNs = 0;
+        // 현재 프레임만으로 링이 가득 차 실패한 할당 수.
+        uint32_t failures = 0;
+    };
+
+    // 프레임마다 버리는 업로드 데이터(상수, 동적 정점, 인스턴스)를 위한 지속 매핑 링 버퍼.
+    //
+    // 업로드 버퍼 하나를 만들어 매핑한 채로 두고, 할당은 머리 위치를 원자적으로 밀어 나눠 줍니다.
+    // 위치는 0부터 단조 증가하는 가상 오프셋이며 실제 오프셋은 capacity로 나눈 나머지입니다.
+    // 할당 하나는 링 끝을 넘지 않도록, 넘치면 다음 바퀴의 처음으로 건너뜁니다.
+    // endFrame에서 그 프레임이 쓴 끝 위치와 펜스 값을 기록하고, GPU가 그 펜스를 지나면 구간을 돌려받습니다.
+    // 따라서 드로우마다 버퍼를 만들거나 map/unmap하지 않으며, 기다림은 링이 가득 찼을 때만 생깁니다.
+    //
+    // allocate는 여러 기록 스레드에서 동시에 호출할 수 있습니다. beginFrame/endFrame은 제출 스레드에서만 호출하며,
+    // 그동안 다른 스레드가 allocate를 호출해서는 안 됩니다.
+    class AXIS_RENDERER_API UploadRing
+    {
+    public:
+        UploadRing(UploadBackend& backend, const UploadRingDesc& desc = {});
+        ~UploadRing();
+
+        UploadRing(const UploadRing&) = delete;
+        UploadRing& operator=(const UploadRing&) = delete;
+
+        // 업로드 버퍼를 만들지 못했으면 false.
+        bool isValid() const { return m_base != nullptr; }
+
+        // GPU가 끝낸 프레임의 구간을 돌려받고, framesInFlight만큼 앞서 있으면 가장 오래된 프레임을 기다립니다.
+        void beginFrame();
+        // 이번 프레임의 명령을 제출한 뒤 그 제출이 신호할 펜스 값을 넘깁니다.
+        void endFrame(uint64_t fenceValue);
+
+        // alignment는 2의 거듭제곱이어야 합니다. 자리가 없으면 GPU를 기다리고, 이번 프레임만으로 가득 차거나
+        // size가 capacity의 절반을 넘으면 실패합니다.
+        UploadAllocation allocate(uint64_t size, uint32_t alignment = 16);
+
+        UploadAllocation allocateConstants(uint64_t size) { return allocate(size, kConstantBufferAlignment); }
+
+        // data를 복사한 구간을 돌려줍니다. 실패하면 복사하지 않습니다.
+        UploadAllocation upload(const void* data, uint64_t size, uint32_t alignment = 16)
+        {
+            UploadAllocation allocation = allocate(size, alignment);
+            if (allocation.isValid())
+            {
+                std::memcpy(allocation.cpu, data, size);
+            }
+            return allocation;
+        }
+
+        template <typename T>
+        UploadAllocation uploadConstants(const T& value)
+        {
+            return upload(&value, sizeof(T), kConstantBufferAlignment);
+        }
+
+        BufferHandle buffer() const { return m_buffer; }
+        uint64_t capacity() const { return m_capacity; }
+
+        // frameBytes는 마지막으로 끝낸 프레임의 사용량이고, 나머지는 누적값입니다. endFrame에서 갱신됩니다.
+        const UploadRingStats& stats() const { return m_stats; }
+
+    private:
+        struct InFlightFrame
+        {
+            uint64_t end = 0;
+            uint64_t fence = 0;
+        };
+
+        bool tryBump(uint64_t size, uint64_t alignment, uint64_t& outStart);
+        UploadAllocation makeAllocation(uint64_t start, uint64_t size) const;
+        void reclaim(bool wait);
+
+        UploadBackend& m_backend;
+        UploadRingDesc m_desc;
+        BufferHandle m_buffer;
+        uint8_t* m_base = nullptr;
+        uint64_t m_capacity = 0;
+
+        // 가상 오프셋. [m_tail, m_head)가 아직 GPU가 쓸 수 있는 구간이고, m_limit = m_tail + capacity입니다.
+        std::atomic<uint64_t> m_head{0};
+        std::atomic<uint64_t> m_limit{0};
+        uint64_t m_tail = 0;
+        uint64_t m_frameStart = 0;
+
+        // endFrame 순서대로 쌓인 진행 중 프레임. 원형 배열입니다.
+        InFlightFrame m_frames[kMaxUploadFramesInFlight];
+        uint32_t m_frameFirst = 0;
+        uint32_t m_frameCount = 0;
+
+        // 느린 경로의 회수와 통계 갱신을 보호합니다. allocate는 펜스를 이 잠금 밖에서 기다립니다.
+        SpinLock m_lock;
+        UploadRingStats m_stats;
+        std::atomic<uint64_t> m_wrapWasteBytes{0};
+    };
+}
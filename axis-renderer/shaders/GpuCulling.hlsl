@@ -0,0 +1,175 @@
+// GPU 구동 컬링 셰이더 (axis-renderer GpuCulling).
+//
+// 진입점:
+//   CullInstances  - 인스턴스마다 절두체/Hi-Z 검사 후 보이는 인스턴스 인덱스를 메시별 구간에 씁니다.
+//   BuildDrawArgs  - 보이는 인스턴스가 있는 메시만 그룹별 간접 인자 버퍼에 모읍니다.
+//
+// Hi-Z 피라미드는 HiZDownsample.hlsl이 만듭니다.
+// 구조체 배치는 GpuCulling.h의 GpuInstanceData / GpuMeshData / GpuCullConstants와 같아야 합니다.
+// 깊이는 [0, 1](가까운 쪽이 0)이며 Hi-Z는 각 영역의 가장 먼 깊이를 담습니다.
+
+#define AXIS_CULL_GROUP_SIZE 64
+
+struct GpuInstanceData
+{
+    float4x4 world;
+    uint mesh;
+    uint3 reserved;
+};
+
+struct GpuMeshData
+{
+    float3 center;
+    float radius;
+    uint indexCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint group;
+    uint instanceBase;
+    uint3 reserved;
+};
+
+cbuffer CullConstants : register(b0)
+{
+    float4 g_planes[6];
+    float4x4 g_occlusionViewProj;
+    uint g_instanceCount;
+    uint g_meshCount;
+    uint g_hiZWidth;
+    uint g_hiZHeight;
+    uint g_hiZMipCount;
+    uint g_occlusion;
+    uint g_countersMeshBase;
+    uint g_countersGroupBase;
+};
+
+StructuredBuffer<GpuInstanceData> g_instances : register(t0);
+StructuredBuffer<GpuMeshData> g_meshes : register(t1);
+Texture2D<float> g_hiZ : register(t2);
+StructuredBuffer<uint> g_groupArgBase : register(t3);
+
+// [메시별 보이는 인스턴스 수][그룹별 간접 드로우 수]
+RWByteAddressBuffer g_counters : register(u0);
+RWStructuredBuffer<uint> g_visibleInstances : register(u1);
+// DrawIndexedIndirectArgs 배열 (uint 5개씩).
+RWByteAddressBuffer g_drawArgs : register(u2);
+
+bool frustumVisible(float3 center, float radius)
+{
+    [unroll]
+    for (uint i = 0; i < 6; ++i)
+    {
+        if (dot(g_planes[i].xyz, center) + g_planes[i].w < -radius)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 구를 감싸는 상자를 가림 판정용 시점으로 투영해 Hi-Z와 비교합니다.
+// 상자가 근평면을 가로지르면 판정할 수 없으므로 보이는 것으로 둡니다.
+bool occlusionVisible(float3 center, float radius)
+{
+    float2 ndcMin = float2(1.0f, 1.0f);
+    float2 ndcMax = float2(-1.0f, -1.0f);
+    float nearestDepth = 1.0f;
+
+    [unroll]
+    for (uint corner = 0; corner < 8; ++corner)
+    {
+        const float3 offset = float3((corner & 1) ? radius : -radius, (corner & 2) ? radius : -radius,
+                                     (corner & 4) ? radius : -radius);
+        const float4 clip = mul(g_occlusionViewProj, float4(center + offset, 1.0f));
+        if (clip.w <= 1e-5f)
+        {
+            return true;
+        }
+        const float3 ndc = clip.xyz / clip.w;
+        ndcMin = min(ndcMin, ndc.xy);
+        ndcMax = max(ndcMax, ndc.xy);
+        nearestDepth = min(nearestDepth, ndc.z);
+    }
+
+    ndcMin = clamp(ndcMin, -1.0f, 1.0f);
+    ndcMax = clamp(ndcMax, -1.0f, 1.0f);
+    if (any(ndcMin >= ndcMax))
+    {
+        return false;
+    }
+
+    // 텍스처 좌표는 위쪽이 0입니다.
+    const float2 uvMin = float2(ndcMin.x * 0.5f + 0.5f, 0.5f - ndcMax.y * 0.5f);
+    const float2 uvMax = float2(ndcMax.x * 0.5f + 0.5f, 0.5f - ndcMin.y * 0.5f);
+
+    // 화면 영역이 텍셀 하나를 넘지 않는 밉을 고르면 네 텍셀만 읽어도 영역 전체를 덮습니다.
+    const float2 extent = (uvMax - uvMin) * float2(g_hiZWidth, g_hiZHeight);
+    const uint mip = min((uint)ceil(log2(max(max(extent.x, extent.y), 1.0f))), g_hiZMipCount - 1);
+    const uint2 mipSize = uint2(max(g_hiZWidth >> mip, 1u), max(g_hiZHeight >> mip, 1u));
+
+    const uint2 texelMin = min((uint2)(uvMin * mipSize), mipSize - 1);
+    const uint2 texelMax = min((uint2)(uvMax * mipSize), mipSize - 1);
+    const float farthest = max(max(g_hiZ.Load(int3(texelMin.x, texelMin.y, mip)),
+                                   g_hiZ.Load(int3(texelMax.x, texelMin.y, mip))),
+                               max(g_hiZ.Load(int3(texelMin.x, texelMax.y, mip)),
+                                   g_hiZ.Load(int3(texelMax.x, texelMax.y, mip))));
+    return nearestDepth <= farthest;
+}
+
+[numthreads(AXIS_CULL_GROUP_SIZE, 1, 1)]
+void CullInstances(uint3 id : SV_DispatchThreadID)
+{
+    const uint index = id.x;
+    if (index >= g_instanceCount)
+    {
+        return;
+    }
+
+    const GpuInstanceData instance = g_instances[index];
+    const GpuMeshData mesh = g_meshes[instance.mesh];
+
+    const float3 center = mul(instance.world, float4(mesh.center, 1.0f)).xyz;
+    // mul(world, v)로 적용하므로 축별 배율은 열의 길이입니다. 회전이 섞이면 행의 길이는 배율보다 작아집니다.
+    const float3 axisX = float3(instance.world._m00, instance.world._m10, instance.world._m20);
+    const float3 axisY = float3(instance.world._m01, instance.world._m11, instance.world._m21);
+    const float3 axisZ = float3(instance.world._m02, instance.world._m12, instance.world._m22);
+    const float3 scaleSq = float3(dot(axisX, axisX), dot(axisY, axisY), dot(axisZ, axisZ));
+    const float radius = mesh.radius * sqrt(max(scaleSq.x, max(scaleSq.y, scaleSq.z)));
+
+    if (!frustumVisible(center, radius))
+    {
+        return;
+    }
+    if (g_occlusion != 0 && !occlusionVisible(center, radius))
+    {
+        return;
+    }
+
+    uint slot;
+    g_counters.InterlockedAdd((g_countersMeshBase + instance.mesh) * 4, 1, slot);
+    g_visibleInstances[mesh.instanceBase + slot] = index;
+}
+
+[numthreads(AXIS_CULL_GROUP_SIZE, 1, 1)]
+void BuildDrawArgs(uint3 id : SV_DispatchThreadID)
+{
+    const uint meshIndex = id.x;
+    if (meshIndex >= g_meshCount)
+    {
+        return;
+    }
+
+    const uint visibleCount = g_counters.Load((g_countersMeshBase + meshIndex) * 4);
+    if (visibleCount == 0)
+    {
+        return;
+    }
+
+    const GpuMeshData mesh = g_meshes[meshIndex];
+    uint slot;
+    g_counters.InterlockedAdd((g_countersGroupBase + mesh.group) * 4, 1, slot);
+
+    const uint address = (g_groupArgBase[mesh.group] + slot) * 20;
+    g_drawArgs.Store4(address, uint4(mesh.indexCount, visibleCount, mesh.firstIndex, asuint(mesh.vertexOffset)));
+    g_drawArgs.Store(address + 16, mesh.instanceBase);
+}
@@ -0,0 +1,45 @@
+// Hi-Z 피라미드 한 밉을 만듭니다 (axis-renderer GpuCulling::buildHiZ).
+//
+// 원본과 대상 크기가 같으면 깊이를 그대로 복사하고, 아니면 대상 텍셀이 덮는 원본 영역의 최댓값(가장 먼 깊이)을 씁니다.
+
+#define AXIS_HIZ_GROUP_SIZE 8
+
+cbuffer HiZConstants : register(b0)
+{
+    uint g_sourceWidth;
+    uint g_sourceHeight;
+    uint g_targetWidth;
+    uint g_targetHeight;
+};
+
+Texture2D<float> g_hiZSource : register(t0);
+RWTexture2D<float> g_hiZTarget : register(u0);
+
+[numthreads(AXIS_HIZ_GROUP_SIZE, AXIS_HIZ_GROUP_SIZE, 1)]
+void DownsampleHiZ(uint3 id : SV_DispatchThreadID)
+{
+    if (id.x >= g_targetWidth || id.y >= g_targetHeight)
+    {
+        return;
+    }
+
+    if (g_sourceWidth == g_targetWidth && g_sourceHeight == g_targetHeight)
+    {
+        g_hiZTarget[id.xy] = g_hiZSource.Load(int3(id.xy, 0));
+        return;
+    }
+
+    // 홀수 크기에서 마지막 행/열이 빠지지 않도록 원본 범위를 비율대로 덮습니다.
+    const uint2 begin = id.xy * uint2(g_sourceWidth, g_sourceHeight) / uint2(g_targetWidth, g_targetHeight);
+    const uint2 end = max((id.xy + 1) * uint2(g_sourceWidth, g_sourceHeight) / uint2(g_targetWidth, g_targetHeight),
+                          begin + 1);
+    float farthest = 0.0f;
+    for (uint y = begin.y; y < end.y; ++y)
+    {
+        for (uint x = begin.x; x < end.x; ++x)
+        {
+            farthest = max(farthest, g_hiZSource.Load(int3(x, y, 0)));
+        }
+    }
+    g_hiZTarget[id.xy] = farthest;
+}
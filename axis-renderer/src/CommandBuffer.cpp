@@ -0,0 +1,263 @@
+#include "axis/renderer/CommandBuffer.h"
+
+#include "axis/utils/Profiler.h"
+
+#include <cassert>
+#include <new>
+
+namespace axis
+{
+    CommandBuffer::CommandBuffer(Allocator& allocator)
+        : m_allocator(&allocator)
+    {
+    }
+
+    CommandBuffer::~CommandBuffer()
+    {
+        reset();
+    }
+
+    DrawPacket* CommandBuffer::append()
+    {
+        if (m_tail == nullptr || m_tail->count == kPacketsPerBlock)
+        {
+            void* memory = m_allocator->allocate(sizeof(Block), alignof(Block));
+            if (memory == nullptr)
+            {
+                return nullptr;
+            }
+
+            Block* block = static_cast<Block*>(memory);
+            block->next = nullptr;
+            block->count = 0;
+            if (m_tail != nullptr)
+            {
+                m_tail->next = block;
+            }
+            else
+            {
+                m_head = block;
+            }
+            m_tail = block;
+        }
+
+        ++m_count;
+        return new (&m_tail->packets[m_tail->count++]) DrawPacket();
+    }
+
+    bool CommandBuffer::push(const DrawPacket& packet)
+    {
+        DrawPacket* target = append();
+        if (target == nullptr)
+        {
+            return false;
+        }
+        *target = packet;
+        return true;
+    }
+
+    void CommandBuffer::reset()
+    {
+        Block* block = m_head;
+        while (block != nullptr)
+        {
+            Block* next = block->next;
+            m_allocator->deallocate(block, sizeof(Block));
+            block = next;
+        }
+        m_head = nullptr;
+        m_tail = nullptr;
+        m_count = 0;
+    }
+
+    void CommandBuffer::truncate(uint32_t count)
+    {
+        if (count >= m_count)
+        {
+            return;
+        }
+        if (count == 0)
+        {
+            reset();
+            return;
+        }
+
+        // 마지막 블록 앞의 블록은 모두 가득 차 있으므로 남길 패킷이 끝나는 블록을 앞에서부터 찾습니다.
+        Block* block = m_head;
+        uint32_t remaining = count;
+        while (remaining > block->count)
+        {
+            remaining -= block->count;
+            block = block->next;
+        }
+
+        Block* next = block->next;
+        block->next = nullptr;
+        block->count = remaining;
+        m_tail = block;
+        m_count = count;
+        while (next != nullptr)
+        {
+            Block* following = next->next;
+            m_allocator->deallocate(next, sizeof(Block));
+            next = following;
+        }
+    }
+
+    CommandBufferSet::CommandBufferSet(JobSystem& jobs, Allocator& frameAllocator)
+        : m_jobs(jobs)
+        , m_allocator(frameAllocator)
+        , m_bufferCount(jobs.threadCount())
+    {
+        // 버퍼 배열 자체는 프레임마다 비워지면 안 되므로 기본 할당자에 둡니다.
+        void* memory = defaultAllocator().allocate(sizeof(CommandBuffer) * m_bufferCount, alignof(CommandBuffer));
+        m_buffers = static_cast<CommandBuffer*>(memory);
+        for (uint32_t i = 0; i < m_bufferCount; ++i)
+        {
+            new (&m_buffers[i]) CommandBuffer(frameAllocator);
+        }
+    }
+
+    CommandBufferSet::~CommandBufferSet()
+    {
+        reset();
+        for (uint32_t i = 0; i < m_bufferCount; ++i)
+        {
+            m_buffers[i].~CommandBuffer();
+        }
+        defaultAllocator().deallocate(m_buffers, sizeof(CommandBuffer) * m_bufferCount);
+    }
+
+    CommandBuffer& CommandBufferSet::current()
+    {
+        const uint32_t index = m_jobs.currentThreadIndex();
+        assert(index < m_bufferCount && "JobSystem에 속하지 않은 스레드에서 기록할 수 없습니다");
+        return m_buffers[index];
+    }
+
+    bool CommandBufferSet::sort()
+    {
+        AXIS_PROFILE_SCOPE("CommandBufferSet::sort");
+
+        releaseSorted();
+
+        uint32_t total = 0;
+        for (uint32_t i = 0; i < m_bufferCount; ++i)
+        {
+            total += m_buffers[i].size();
+        }
+        if (total == 0)
+        {
+            return true;
+        }
+
+        m_packets = static_cast<const DrawPacket**>(m_allocator.allocate(sizeof(DrawPacket*) * total, alignof(void*)));
+        m_items = static_cast<SortItem*>(m_allocator.allocate(sizeof(SortItem) * total, alignof(SortItem)));
+        m_scratch = static_cast<SortItem*>(m_allocator.allocate(sizeof(SortItem) * total, alignof(SortItem)));
+        if (m_packets == nullptr || m_items == nullptr || m_scratch == nullptr)
+        {
+            m_sortedCount = total;
+            releaseSorted();
+            return false;
+        }
+
+        // 스레드 인덱스 순서로 모으므로 키가 같은 패킷의 순서도 실행마다 같은 규칙을 따릅니다.
+        uint32_t index = 0;
+        for (uint32_t i = 0; i < m_bufferCount; ++i)
+        {
+            m_buffers[i].forEach([&](const DrawPacket& packet) {
+                m_packets[index] = &packet;
+                m_items[index] = SortItem{packet.key, index};
+                ++index;
+            });
+        }
+
+        radixSort(m_items, m_scratch, total);
+        m_sortedCount = total;
+        return true;
+    }
+
+    SubmitStats CommandBufferSet::submit(RenderBackend& backend) const
+    {
+        AXIS_PROFILE_SCOPE("CommandBufferSet::submit");
+
+        SubmitStats stats;
+        bool first = true;
+        PipelineHandle pipeline;
+        MaterialHandle material;
+        BufferHandle vertexBuffer;
+        uint32_t vertexBufferOffset = 0;
+        BufferHandle indexBuffer;
+        uint32_t indexBufferOffset = 0;
+        IndexFormat indexFormat = IndexFormat::UInt32;
+
+        for (uint32_t i = 0; i < m_sortedCount; ++i)
+        {
+            const DrawPacket& packet = *m_packets[m_items[i].index];
+
+            if (first || packet.pipeline != pipeline)
+            {
+                pipeline = packet.pipeline;
+                backend.setPipeline(pipeline);
+                ++stats.pipelineChanges;
+            }
+            if (first || packet.material != material)
+            {
+                material = packet.material;
+                backend.setMaterial(material);
+                ++stats.materialChanges;
+            }
+            if (first || packet.vertexBuffer != vertexBuffer || packet.vertexBufferOffset != vertexBufferOffset)
+            {
+                vertexBuffer = packet.vertexBuffer;
+                vertexBufferOffset = packet.vertexBufferOffset;
+                backend.setVertexBuffer(vertexBuffer, vertexBufferOffset);
+                ++stats.vertexBufferChanges;
+            }
+
+            if (packet.indexBuffer.isValid())
+            {
+                if (packet.indexBuffer != indexBuffer || packet.indexBufferOffset != indexBufferOffset ||
+                    packet.indexFormat != indexFormat)
+                {
+                    indexBuffer = packet.indexBuffer;
+                    indexBufferOffset = packet.indexBufferOffset;
+                    indexFormat = packet.indexFormat;
+                    backend.setIndexBuffer(indexBuffer, indexBufferOffset, indexFormat);
+                    ++stats.indexBufferChanges;
+                }
+                backend.drawIndexed(packet.elementCount, packet.instanceCount, packet.firstElement,
+                                    packet.vertexOffset, packet.firstInstance);
+            }
+            else
+            {
+                backend.draw(packet.elementCount, packet.instanceCount, packet.firstElement, packet.firstInstance);
+            }
+
+            first = false;
+            ++stats.drawCount;
+        }
+        return stats;
+    }
+
+    void CommandBufferSet::reset()
+    {
+        releaseSorted();
+        for (uint32_t i = 0; i < m_bufferCount; ++i)
+        {
+            m_buffers[i].reset();
+        }
+    }
+
+    void CommandBufferSet::releaseSorted()
+    {
+        const uint32_t count = m_sortedCount;
+        m_allocator.deallocate(m_scratch, sizeof(SortItem) * count);
+        m_allocator.deallocate(m_items, sizeof(SortItem) * count);
+        m_allocator.deallocate(m_packets, sizeof(DrawPacket*) * count);
+        m_scratch = nullptr;
+        m_items = nullptr;
+        m_packets = nullptr;
+        m_sortedCount = 0;
+    }
+}
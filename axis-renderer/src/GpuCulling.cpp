@@ -0,0 +1,437 @@
+#include "axis/renderer/GpuCulling.h"
+
+#include "axis/utils/Profiler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace axis
+{
+    namespace
+    {
+        // GpuCulling.hlsl / HiZDownsample.hlsl의 레지스터 번호.
+        constexpr uint32_t kSlotInstances = 0;
+        constexpr uint32_t kSlotMeshes = 1;
+        constexpr uint32_t kSlotHiZ = 2;
+        constexpr uint32_t kSlotGroups = 3;
+        constexpr uint32_t kSlotCounters = 0;
+        constexpr uint32_t kSlotVisible = 1;
+        constexpr uint32_t kSlotArgs = 2;
+
+        constexpr uint32_t kSlotHiZSource = 0;
+        constexpr uint32_t kSlotHiZTarget = 0;
+
+        struct HiZConstants
+        {
+            uint32_t sourceWidth;
+            uint32_t sourceHeight;
+            uint32_t targetWidth;
+            uint32_t targetHeight;
+        };
+
+        uint32_t groupsFor(uint32_t count, uint32_t groupSize)
+        {
+            return (count + groupSize - 1) / groupSize;
+        }
+    }
+
+    GpuCulling::GpuCulling(GpuDrivenBackend& backend, const GpuCullingDesc& desc)
+        : m_backend(backend)
+        , m_desc(desc)
+    {
+        assert(desc.maxInstances != 0 && desc.maxMeshes != 0 && desc.maxGroups != 0);
+
+        const uint32_t counterCount = desc.maxMeshes + desc.maxGroups;
+        m_valid =
+            createBuffer(m_instanceBuffer, uint64_t(desc.maxInstances) * sizeof(GpuInstanceData), kBufferUsageStorage,
+                         sizeof(GpuInstanceData), "GpuCulling.instances") &&
+            createBuffer(m_meshBuffer, uint64_t(desc.maxMeshes) * sizeof(GpuMeshData), kBufferUsageStorage,
+                         sizeof(GpuMeshData), "GpuCulling.meshes") &&
+            createBuffer(m_groupBuffer, uint64_t(desc.maxGroups) * sizeof(uint32_t), kBufferUsageStorage,
+                         sizeof(uint32_t), "GpuCulling.groups") &&
+            createBuffer(m_counterBuffer, uint64_t(counterCount) * sizeof(uint32_t),
+                         kBufferUsageStorageWrite | kBufferUsageIndirect, 0, "GpuCulling.counters") &&
+            createBuffer(m_visibleBuffer, uint64_t(desc.maxInstances) * sizeof(uint32_t),
+                         kBufferUsageStorage | kBufferUsageStorageWrite, sizeof(uint32_t), "GpuCulling.visible") &&
+            createBuffer(m_argsBuffer, uint64_t(desc.maxMeshes) * sizeof(DrawIndexedIndirectArgs),
+                         kBufferUsageStorageWrite | kBufferUsageIndirect, 0, "GpuCulling.args");
+
+        m_instances.reserve(desc.maxInstances);
+        m_denseToHandle.reserve(desc.maxInstances);
+        m_dirtyFlags.assign(desc.maxInstances, 0);
+        m_meshes.reserve(desc.maxMeshes);
+        m_meshInstanceCounts.reserve(desc.maxMeshes);
+        m_groups.reserve(desc.maxGroups);
+    }
+
+    GpuCulling::~GpuCulling()
+    {
+        for (TrackedBuffer* buffer : {&m_instanceBuffer, &m_meshBuffer, &m_groupBuffer, &m_counterBuffer,
+                                      &m_visibleBuffer, &m_argsBuffer})
+        {
+            if (buffer->handle.isValid())
+            {
+                m_backend.destroyBuffer(buffer->handle);
+            }
+        }
+    }
+
+    bool GpuCulling::createBuffer(TrackedBuffer& buffer, uint64_t size, uint32_t usage, uint32_t stride,
+                                  const char* name)
+    {
+        BufferDesc desc;
+        desc.size = size;
+        desc.usage = usage;
+        desc.stride = stride;
+        desc.debugName = name;
+        buffer.handle = m_backend.createBuffer(desc);
+        buffer.state = ResourceState::CopyDest;
+        return buffer.handle.isValid();
+    }
+
+    void GpuCulling::transition(TrackedBuffer& buffer, ResourceState state)
+    {
+        // 쓰기 뒤의 쓰기는 상태가 같아도 순서를 보장하는 배리어가 필요합니다.
+        if (buffer.state != state || state == ResourceState::ShaderWrite)
+        {
+            m_backend.bufferBarrier(buffer.handle, buffer.state, state);
+            buffer.state = state;
+        }
+    }
+
+    uint32_t GpuCulling::addDrawGroup(const GpuDrawGroupDesc& desc)
+    {
+        if (m_groups.size() >= m_desc.maxGroups)
+        {
+            return kInvalidGpuIndex;
+        }
+        Group group;
+        group.desc = desc;
+        m_groups.push_back(group);
+        m_layoutDirty = true;
+        return static_cast<uint32_t>(m_groups.size() - 1);
+    }
+
+    uint32_t GpuCulling::addMesh(const GpuMeshDesc& desc)
+    {
+        assert(desc.group < m_groups.size() && "등록되지 않은 그룹입니다");
+        if (m_meshes.size() >= m_desc.maxMeshes)
+        {
+            return kInvalidGpuIndex;
+        }
+
+        GpuMeshData mesh{};
+        std::memcpy(mesh.center, desc.bounds.center, sizeof(mesh.center));
+        mesh.radius = desc.bounds.radius;
+        mesh.indexCount = desc.indexCount;
+        mesh.firstIndex = desc.firstIndex;
+        mesh.vertexOffset = desc.vertexOffset;
+        mesh.group = desc.group;
+        m_meshes.push_back(mesh);
+        m_meshInstanceCounts.push_back(0);
+        ++m_groups[desc.group].meshCount;
+        m_layoutDirty = true;
+        return static_cast<uint32_t>(m_meshes.size() - 1);
+    }
+
+    GpuInstanceHandle GpuCulling::addInstance(uint32_t mesh, const Mat4& world)
+    {
+        assert(mesh < m_meshes.size() && "등록되지 않은 메시입니다");
+        if (m_instances.size() >= m_desc.maxInstances)
+        {
+            return kInvalidGpuInstance;
+        }
+
+        GpuInstanceHandle handle;
+        if (!m_freeSlots.empty())
+        {
+            handle = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            handle = static_cast<GpuInstanceHandle>(m_slots.size());
+            m_slots.push_back(kInvalidGpuIndex);
+        }
+
+        const uint32_t dense = static_cast<uint32_t>(m_instances.size());
+        GpuInstanceData instance{};
+        instance.world = world;
+        instance.mesh = mesh;
+        m_instances.push_back(instance);
+        m_denseToHandle.push_back(handle);
+        m_slots[handle] = dense;
+
+        ++m_meshInstanceCounts[mesh];
+        m_layoutDirty = true;
+        markDirty(dense);
+        return handle;
+    }
+
+    void GpuCulling::setTransform(GpuInstanceHandle handle, const Mat4& world)
+    {
+        assert(handle < m_slots.size() && m_slots[handle] != kInvalidGpuIndex);
+        const uint32_t dense = m_slots[handle];
+        m_instances[dense].world = world;
+        markDirty(dense);
+    }
+
+    void GpuCulling::removeInstance(GpuInstanceHandle handle)
+    {
+        assert(handle < m_slots.size() && m_slots[handle] != kInvalidGpuIndex);
+        const uint32_t dense = m_slots[handle];
+        const uint32_t last = static_cast<uint32_t>(m_instances.size() - 1);
+
+        --m_meshInstanceCounts[m_instances[dense].mesh];
+        m_layoutDirty = true;
+
+        // 마지막 인스턴스를 빈자리로 옮겨 GPU 배열에 구멍이 생기지 않게 합니다.
+        if (dense != last)
+        {
+            m_instances[dense] = m_instances[last];
+            const GpuInstanceHandle moved = m_denseToHandle[last];
+            m_denseToHandle[dense] = moved;
+            m_slots[moved] = dense;
+            markDirty(dense);
+        }
+        m_instances.pop_back();
+        m_denseToHandle.pop_back();
+        m_slots[handle] = kInvalidGpuIndex;
+        m_freeSlots.push_back(handle);
+    }
+
+    void GpuCulling::markDirty(uint32_t denseIndex)
+    {
+        if (m_dirtyFlags[denseIndex] == 0)
+        {
+            m_dirtyFlags[denseIndex] = 1;
+            m_dirty.push_back(denseIndex);
+        }
+    }
+
+    void GpuCulling::rebuildLayout()
+    {
+        // 그룹별 간접 인자 구간과 메시별 보이는 인스턴스 구간을 앞에서부터 나눠 줍니다.
+        uint32_t argBase = 0;
+        std::vector<uint32_t> groupBases(m_groups.size());
+        for (size_t i = 0; i < m_groups.size(); ++i)
+        {
+            m_groups[i].argBase = argBase;
+            groupBases[i] = argBase;
+            argBase += m_groups[i].meshCount;
+        }
+
+        uint32_t instanceBase = 0;
+        for (size_t i = 0; i < m_meshes.size(); ++i)
+        {
+            m_meshes[i].instanceBase = instanceBase;
+            instanceBase += m_meshInstanceCounts[i];
+        }
+
+        if (!m_meshes.empty())
+        {
+            transition(m_meshBuffer, ResourceState::CopyDest);
+            m_backend.updateBuffer(m_meshBuffer.handle, 0, m_meshes.data(), m_meshes.size() * sizeof(GpuMeshData));
+        }
+        if (!groupBases.empty())
+        {
+            transition(m_groupBuffer, ResourceState::CopyDest);
+            m_backend.updateBuffer(m_groupBuffer.handle, 0, groupBases.data(), groupBases.size() * sizeof(uint32_t));
+        }
+        m_layoutDirty = false;
+    }
+
+    uint32_t GpuCulling::uploadInstances(uint32_t& uploaded)
+    {
+        uploaded = 0;
+        if (m_dirty.empty())
+        {
+            return 0;
+        }
+
+        transition(m_instanceBuffer, ResourceState::CopyDest);
+
+        // 바뀐 위치를 정렬해 연속 구간마다 한 번씩 올립니다.
+        std::sort(m_dirty.begin(), m_dirty.end());
+        const uint32_t count = static_cast<uint32_t>(m_instances.size());
+        uint32_t ranges = 0;
+        size_t i = 0;
+        while (i < m_dirty.size())
+        {
+            const uint32_t begin = m_dirty[i];
+            uint32_t end = begin + 1;
+            for (++i; i < m_dirty.size() && m_dirty[i] == end; ++i)
+            {
+                ++end;
+            }
+            // 제거로 배열이 줄었으면 끝부분 표시는 버립니다.
+            end = std::min(end, count);
+            if (begin < end)
+            {
+                m_backend.updateBuffer(m_instanceBuffer.handle, uint64_t(begin) * sizeof(GpuInstanceData),
+                                       &m_instances[begin], uint64_t(end - begin) * sizeof(GpuInstanceData));
+                uploaded += end - begin;
+                ++ranges;
+            }
+        }
+
+        for (uint32_t index : m_dirty)
+        {
+            m_dirtyFlags[index] = 0;
+        }
+        m_dirty.clear();
+        return ranges;
+    }
+
+    GpuCullStats GpuCulling::cull(const GpuCullView& view)
+    {
+        AXIS_PROFILE_SCOPE("GpuCulling::cull");
+
+        GpuCullStats stats;
+        if (!m_valid)
+        {
+            return stats;
+        }
+
+        if (m_layoutDirty)
+        {
+            rebuildLayout();
+        }
+        stats.uploadRanges = uploadInstances(stats.uploadedInstances);
+
+        transition(m_counterBuffer, ResourceState::CopyDest);
+        const uint64_t counterBytes = uint64_t(m_desc.maxMeshes + m_desc.maxGroups) * sizeof(uint32_t);
+        m_backend.fillBuffer(m_counterBuffer.handle, 0, counterBytes, 0);
+
+        const uint32_t instanceCount = static_cast<uint32_t>(m_instances.size());
+        if (instanceCount == 0)
+        {
+            return stats;
+        }
+
+        transition(m_instanceBuffer, ResourceState::ShaderRead);
+        transition(m_meshBuffer, ResourceState::ShaderRead);
+        transition(m_groupBuffer, ResourceState::ShaderRead);
+        transition(m_counterBuffer, ResourceState::ShaderWrite);
+        transition(m_visibleBuffer, ResourceState::ShaderWrite);
+
+        // 셰이더가 구 반지름과 바로 비교하도록 평면을 정규화해 둡니다.
+        GpuCullConstants constants{};
+        for (uint32_t i = 0; i < 6; ++i)
+        {
+            const float* plane = view.frustum.planes[i];
+            const float length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+            const float scale = length > 0.0f ? 1.0f / length : 0.0f;
+            for (uint32_t j = 0; j < 4; ++j)
+            {
+                constants.planes[i][j] = plane[j] * scale;
+            }
+        }
+        constants.occlusionViewProj = view.occlusionViewProj;
+        constants.instanceCount = instanceCount;
+        constants.meshCount = static_cast<uint32_t>(m_meshes.size());
+        constants.occlusion = view.hiZ.isValid() && view.hiZMipCount != 0 ? 1u : 0u;
+        constants.hiZWidth = view.hiZWidth;
+        constants.hiZHeight = view.hiZHeight;
+        constants.hiZMipCount = view.hiZMipCount;
+        constants.countersMeshBase = 0;
+        constants.countersGroupBase = m_desc.maxMeshes;
+
+        m_backend.setComputePipeline(m_desc.cullPipeline);
+        m_backend.setComputeBuffer(kSlotInstances, m_instanceBuffer.handle, false);
+        m_backend.setComputeBuffer(kSlotMeshes, m_meshBuffer.handle, false);
+        m_backend.setComputeBuffer(kSlotCounters, m_counterBuffer.handle, true);
+        m_backend.setComputeBuffer(kSlotVisible, m_visibleBuffer.handle, true);
+        if (constants.occlusion != 0)
+        {
+            m_backend.setComputeTexture(kSlotHiZ, view.hiZ, 0, false);
+        }
+        m_backend.setComputeConstants(&constants, sizeof(constants));
+        m_backend.dispatch(groupsFor(instanceCount, kGpuCullGroupSize), 1, 1);
+        ++stats.dispatches;
+
+        transition(m_counterBuffer, ResourceState::ShaderWrite);
+        transition(m_argsBuffer, ResourceState::ShaderWrite);
+
+        m_backend.setComputePipeline(m_desc.buildArgsPipeline);
+        m_backend.setComputeBuffer(kSlotMeshes, m_meshBuffer.handle, false);
+        m_backend.setComputeBuffer(kSlotGroups, m_groupBuffer.handle, false);
+        m_backend.setComputeBuffer(kSlotCounters, m_counterBuffer.handle, true);
+        m_backend.setComputeBuffer(kSlotArgs, m_argsBuffer.handle, true);
+        m_backend.setComputeConstants(&constants, sizeof(constants));
+        m_backend.dispatch(groupsFor(constants.meshCount, kGpuCullGroupSize), 1, 1);
+        ++stats.dispatches;
+
+        transition(m_argsBuffer, ResourceState::IndirectArgument);
+        transition(m_counterBuffer, ResourceState::IndirectArgument);
+        transition(m_visibleBuffer, ResourceState::ShaderRead);
+        return stats;
+    }
+
+    GpuCullStats GpuCulling::draw(const GpuCullStats& cullStats)
+    {
+        AXIS_PROFILE_SCOPE("GpuCulling::draw");
+
+        GpuCullStats stats = cullStats;
+        if (!m_valid || m_instances.empty())
+        {
+            return stats;
+        }
+        assert(m_argsBuffer.state == ResourceState::IndirectArgument && "cull()을 먼저 호출해야 합니다");
+
+        for (uint32_t i = 0; i < m_groups.size(); ++i)
+        {
+            const Group& group = m_groups[i];
+            if (group.meshCount == 0)
+            {
+                continue;
+            }
+            m_backend.setPipeline(group.desc.pipeline);
+            m_backend.setMaterial(group.desc.material);
+            m_backend.setVertexBuffer(group.desc.vertexBuffer, group.desc.vertexBufferOffset);
+            m_backend.setIndexBuffer(group.desc.indexBuffer, group.desc.indexBufferOffset, group.desc.indexFormat);
+            const uint64_t argsOffset = uint64_t(group.argBase) * sizeof(DrawIndexedIndirectArgs);
+            const uint64_t countOffset = uint64_t(m_desc.maxMeshes + i) * sizeof(uint32_t);
+            m_backend.drawIndexedIndirectCount(m_argsBuffer.handle, argsOffset, m_counterBuffer.handle, countOffset,
+                                               group.meshCount);
+            ++stats.indirectDraws;
+        }
+        return stats;
+    }
+
+    void GpuCulling::buildHiZ(TextureHandle depth, TextureHandle hiZ, uint32_t width, uint32_t height,
+                              uint32_t mipCount)
+    {
+        AXIS_PROFILE_SCOPE("GpuCulling::buildHiZ");
+
+        m_backend.setComputePipeline(m_desc.hiZPipeline);
+
+        uint32_t sourceWidth = width;
+        uint32_t sourceHeight = height;
+        for (uint32_t mip = 0; mip < mipCount; ++mip)
+        {
+            // 밉 0은 깊이를 그대로 복사하고, 이후 밉은 바로 위 밉을 줄입니다.
+            const uint32_t targetWidth = mip == 0 ? width : std::max(sourceWidth / 2, 1u);
+            const uint32_t targetHeight = mip == 0 ? height : std::max(sourceHeight / 2, 1u);
+
+            const HiZConstants constants{sourceWidth, sourceHeight, targetWidth, targetHeight};
+            if (mip == 0)
+            {
+                m_backend.setComputeTexture(kSlotHiZSource, depth, 0, false);
+            }
+            else
+            {
+                m_backend.setComputeTexture(kSlotHiZSource, hiZ, mip - 1, false);
+            }
+            m_backend.setComputeTexture(kSlotHiZTarget, hiZ, mip, true);
+            m_backend.setComputeConstants(&constants, sizeof(constants));
+            m_backend.dispatch(groupsFor(targetWidth, kGpuHiZGroupSize), groupsFor(targetHeight, kGpuHiZGroupSize), 1);
+            m_backend.textureBarrier(hiZ, mip, ResourceState::ShaderWrite, ResourceState::ShaderRead);
+
+            sourceWidth = targetWidth;
+            sourceHeight = targetHeight;
+        }
+    }
+}
@@ -0,0 +1,274 @@
+#include "axis/renderer/InstanceBatcher.h"
+
+#include "axis/renderer/DrawKey.h"
+#include "axis/utils/Profiler.h"
+#include "axis/utils/RadixSort.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace axis
+{
+    namespace
+    {
+        constexpr size_t kRecordAlignment = 16;
+    }
+
+    // 머리글 뒤에 m_recordStride 간격의 기록이 kRecordsPerBlock개 이어집니다.
+    struct alignas(kRecordAlignment) InstanceBatcher::Block
+    {
+        Block* next;
+        uint32_t count;
+    };
+
+    InstanceBatcher::InstanceBatcher(JobSystem& jobs, Allocator& frameAllocator, const InstanceBatcherDesc& desc)
+        : m_jobs(jobs)
+        , m_allocator(frameAllocator)
+        , m_desc(desc)
+        , m_threadCount(jobs.threadCount())
+    {
+        assert(desc.instanceStride > 0 && desc.instanceStride % 16 == 0 && "instanceStride는 16의 배수여야 합니다");
+        m_recordStride = static_cast<uint32_t>(alignUp(sizeof(Record) + desc.instanceStride, kRecordAlignment));
+        m_threads.reset(new ThreadRecords[m_threadCount]);
+    }
+
+    InstanceBatcher::~InstanceBatcher()
+    {
+        reset();
+    }
+
+    BatchMeshId InstanceBatcher::addMesh(const BatchMeshDesc& desc)
+    {
+        assert(recordedCount() == 0 && "기록 중에는 메시를 추가할 수 없습니다");
+        m_meshes.push_back(desc);
+        return static_cast<BatchMeshId>(m_meshes.size() - 1);
+    }
+
+    bool InstanceBatcher::add(const BatchDraw& draw, const void* instanceData)
+    {
+        assert(draw.mesh < m_meshes.size() && "등록되지 않은 메시입니다");
+
+        const uint32_t index = m_jobs.currentThreadIndex();
+        assert(index < m_threadCount && "JobSystem에 속하지 않은 스레드에서 기록할 수 없습니다");
+        ThreadRecords& records = m_threads[index];
+
+        if (records.tail == nullptr || records.tail->count == kRecordsPerBlock)
+        {
+            void* memory = m_allocator.allocate(blockBytes(), kRecordAlignment);
+            if (memory == nullptr)
+            {
+                return false;
+            }
+
+            Block* block = static_cast<Block*>(memory);
+            block->next = nullptr;
+            block->count = 0;
+            if (records.tail != nullptr)
+            {
+                records.tail->next = block;
+            }
+            else
+            {
+                records.head = block;
+            }
+            records.tail = block;
+        }
+
+        Block* block = records.tail;
+        uint8_t* slot = reinterpret_cast<uint8_t*>(block) + sizeof(Block) + size_t{m_recordStride} * block->count;
+        Record* record = reinterpret_cast<Record*>(slot);
+
+        // 불투명은 깊이 자리에 메시 번호를 두어 같은 파이프라인/머티리얼 안에서 같은 메시가 모이게 합니다.
+        record->key = draw.translucent
+                          ? DrawKey::translucent(draw.layer, draw.pass, DrawKey::quantizeDepth(draw.depth),
+                                                 draw.materialSortId)
+                          : DrawKey::opaque(draw.layer, draw.pass, draw.pipeline.id, draw.materialSortId, draw.mesh);
+        record->pipeline = draw.pipeline;
+        record->material = draw.material;
+        record->mesh = draw.mesh;
+        record->translucent = draw.translucent;
+        std::memcpy(slot + sizeof(Record), instanceData, m_desc.instanceStride);
+
+        ++block->count;
+        ++records.count;
+        return true;
+    }
+
+    bool InstanceBatcher::build(UploadRing& ring, CommandBuffer& out)
+    {
+        AXIS_PROFILE_SCOPE("InstanceBatcher::build");
+
+        m_allocation = UploadAllocation();
+        m_stats.inputDraws = 0;
+        m_stats.batches = 0;
+        m_stats.uploadedBytes = 0;
+
+        const uint32_t total = recordedCount();
+        if (total == 0)
+        {
+            return true;
+        }
+
+        const Record** records =
+            static_cast<const Record**>(m_allocator.allocate(sizeof(Record*) * total, alignof(void*)));
+        SortItem* items = static_cast<SortItem*>(m_allocator.allocate(sizeof(SortItem) * total, alignof(SortItem)));
+        SortItem* scratch = static_cast<SortItem*>(m_allocator.allocate(sizeof(SortItem) * total, alignof(SortItem)));
+
+        auto release = [&]() {
+            m_allocator.deallocate(scratch, sizeof(SortItem) * total);
+            m_allocator.deallocate(items, sizeof(SortItem) * total);
+            m_allocator.deallocate(records, sizeof(Record*) * total);
+        };
+
+        if (records == nullptr || items == nullptr || scratch == nullptr)
+        {
+            release();
+            ++m_stats.failures;
+            return false;
+        }
+
+        // CommandBufferSet::sort와 같이 스레드 인덱스 순서로 모아 키가 같은 기록의 순서를 실행마다 같게 둡니다.
+        uint32_t index = 0;
+        for (uint32_t i = 0; i < m_threadCount; ++i)
+        {
+            for (const Block* block = m_threads[i].head; block != nullptr; block = block->next)
+            {
+                const uint8_t* base = reinterpret_cast<const uint8_t*>(block) + sizeof(Block);
+                for (uint32_t j = 0; j < block->count; ++j)
+                {
+                    const Record* record = reinterpret_cast<const Record*>(base + size_t{m_recordStride} * j);
+                    records[index] = record;
+                    items[index] = SortItem{record->key, index};
+                    ++index;
+                }
+            }
+        }
+        radixSort(items, scratch, total);
+
+        // 구조화 버퍼의 원소 번호로 쓸 수 있도록 구간 시작을 instanceStride의 배수에 둡니다.
+        // stride가 2의 거듭제곱이 아니면 정렬만으로는 맞출 수 없으므로 stride만큼 더 받아 앞을 건너뜁니다.
+        const uint64_t stride = m_desc.instanceStride;
+        const bool powerOfTwo = (stride & (stride - 1)) == 0;
+        const uint64_t bytes = stride * total;
+        UploadAllocation allocation =
+            powerOfTwo ? ring.allocate(bytes, static_cast<uint32_t>(stride)) : ring.allocate(bytes + stride);
+        if (!allocation.isValid())
+        {
+            release();
+            ++m_stats.failures;
+            return false;
+        }
+        const uint64_t skip = (stride - allocation.offset % stride) % stride;
+        allocation.offset += skip;
+        allocation.cpu = static_cast<uint8_t*>(allocation.cpu) + skip;
+        allocation.size = bytes;
+
+        const uint32_t baseInstance = static_cast<uint32_t>(allocation.offset / stride);
+        const uint32_t maxInstances = m_desc.maxInstancesPerDraw != 0 ? m_desc.maxInstancesPerDraw : ~0u;
+        uint8_t* destination = static_cast<uint8_t*>(allocation.cpu);
+
+        // 도중에 push가 실패하면 이미 기록한 패킷을 되돌려, 호출자가 다시 시도하거나 개별 드로우로 돌아가도
+        // 같은 인스턴스가 두 번 그려지지 않게 합니다.
+        const uint32_t recorded = out.size();
+        bool ok = true;
+        uint32_t batches = 0;
+        uint32_t first = 0;
+        while (first < total && ok)
+        {
+            const Record& head = *records[items[first].index];
+            uint32_t last = first + 1;
+            while (last < total && last - first < maxInstances && sameBatch(head, *records[items[last].index]))
+            {
+                ++last;
+            }
+
+            for (uint32_t i = first; i < last; ++i)
+            {
+                const uint8_t* source = reinterpret_cast<const uint8_t*>(records[items[i].index]) + sizeof(Record);
+                std::memcpy(destination + stride * i, source, m_desc.instanceStride);
+            }
+
+            const BatchMeshDesc& mesh = m_meshes[head.mesh];
+            DrawPacket packet;
+            packet.key = head.key;
+            packet.pipeline = head.pipeline;
+            packet.material = head.material;
+            packet.vertexBuffer = mesh.vertexBuffer;
+            packet.vertexBufferOffset = mesh.vertexBufferOffset;
+            packet.indexBuffer = mesh.indexBuffer;
+            packet.indexBufferOffset = mesh.indexBufferOffset;
+            packet.indexFormat = mesh.indexFormat;
+            packet.elementCount = mesh.elementCount;
+            packet.instanceCount = last - first;
+            packet.firstElement = mesh.firstElement;
+            packet.vertexOffset = mesh.vertexOffset;
+            packet.firstInstance = baseInstance + first;
+            ok = out.push(packet);
+
+            ++batches;
+            first = last;
+        }
+
+        release();
+        if (!ok)
+        {
+            out.truncate(recorded);
+            ++m_stats.failures;
+            return false;
+        }
+
+        m_allocation = allocation;
+        m_stats.inputDraws = total;
+        m_stats.batches = batches;
+        m_stats.uploadedBytes = bytes;
+        return true;
+    }
+
+    uint32_t InstanceBatcher::recordedCount() const
+    {
+        uint32_t total = 0;
+        for (uint32_t i = 0; i < m_threadCount; ++i)
+        {
+            total += m_threads[i].count;
+        }
+        return total;
+    }
+
+    void InstanceBatcher::reset()
+    {
+        for (uint32_t i = 0; i < m_threadCount; ++i)
+        {
+            releaseBlocks(m_threads[i]);
+        }
+        m_allocation = UploadAllocation();
+    }
+
+    size_t InstanceBatcher::blockBytes() const
+    {
+        return sizeof(Block) + size_t{m_recordStride} * kRecordsPerBlock;
+    }
+
+    bool InstanceBatcher::sameBatch(const Record& a, const Record& b) const
+    {
+        // 키가 같아야 정렬 순서를 건너뛰지 않습니다. 반투명은 키가 깊이를 담으므로 상태와 layer/pass만 봅니다.
+        if (a.translucent != b.translucent || a.pipeline != b.pipeline || a.material != b.material || a.mesh != b.mesh)
+        {
+            return false;
+        }
+        return a.translucent ? (a.key >> 48) == (b.key >> 48) : a.key == b.key;
+    }
+
+    void InstanceBatcher::releaseBlocks(ThreadRecords& records)
+    {
+        Block* block = records.head;
+        while (block != nullptr)
+        {
+            Block* next = block->next;
+            m_allocator.deallocate(block, blockBytes());
+            block = next;
+        }
+        records.head = nullptr;
+        records.tail = nullptr;
+        records.count = 0;
+    }
+}
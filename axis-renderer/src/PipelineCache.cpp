@@ -0,0 +1,476 @@
+#include "axis/renderer/PipelineCache.h"
+
+#include "axis/utils/Profiler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+namespace axis
+{
+    namespace
+    {
+        // 파일 형식 (리틀 엔디언).
+        //
+        //   [CacheHeader 64B][blob][blob]...[FileEntry 표]
+        //
+        // blob은 16바이트 경계에서 시작하며, 항목 표는 (key, kind) 순으로 정렬되어 있습니다.
+        constexpr uint32_t kPipelineCacheMagic = 0x43505841u; // "AXPC"
+        constexpr uint32_t kPipelineCacheVersion = 1;
+        constexpr uint64_t kBlobAlignment = 16;
+
+        struct CacheHeader
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t entryCount;
+            uint32_t reserved;
+            uint32_t vendorId;
+            uint32_t deviceId;
+            uint64_t driverVersion;
+            uint64_t engineVersion;
+            uint64_t entriesOffset;
+            uint64_t fileSize;
+            uint64_t reserved2;
+        };
+
+        static_assert(sizeof(CacheHeader) == 64);
+
+        enum : uint8_t
+        {
+            kUnverified = 0,
+            kVerified = 1,
+            kCorrupt = 2,
+        };
+
+        bool sameIdentity(const CacheHeader& header, const PipelineCacheIdentity& identity)
+        {
+            return header.vendorId == identity.vendorId && header.deviceId == identity.deviceId &&
+                   header.driverVersion == identity.driverVersion && header.engineVersion == identity.engineVersion;
+        }
+    }
+
+    struct PipelineCache::FileEntry
+    {
+        uint64_t key;
+        uint64_t offset;
+        uint64_t checksum;
+        uint32_t size;
+        BlobKind kind;
+        uint8_t reserved[3];
+    };
+
+    PipelineCache::PipelineCache(PipelineCacheBackend& backend, Allocator& allocator)
+        : m_backend(backend)
+        , m_allocator(allocator)
+        , m_identity(backend.cacheIdentity())
+        , m_pendingPipelines(allocator)
+        , m_pendingShaders(allocator)
+        , m_warmKeys(allocator)
+        , m_pipelines(allocator)
+    {
+    }
+
+    PipelineCache::~PipelineCache()
+    {
+        assert(!isWarming() && "예열 작업이 남아 있는 상태로 캐시를 파괴했습니다");
+        for (const auto& [key, pipeline] : m_pipelines)
+        {
+            if (pipeline.isValid())
+            {
+                m_backend.destroyPipeline(pipeline);
+            }
+        }
+    }
+
+    bool PipelineCache::open(const char* path)
+    {
+        assert(!isWarming() && "예열 중에는 캐시 파일을 바꿀 수 없습니다");
+        m_path = path != nullptr ? path : "";
+        return mapFile();
+    }
+
+    bool PipelineCache::mapFile()
+    {
+        static_assert(sizeof(FileEntry) == 32);
+
+        std::unique_lock<std::shared_mutex> lock(m_fileMutex);
+        m_file.close();
+        m_entries = nullptr;
+        m_entryCount = 0;
+        m_verified.reset();
+
+        if (m_path.empty() || !m_file.open(m_path.c_str()) || m_file.size() < sizeof(CacheHeader))
+        {
+            m_file.close();
+            return false;
+        }
+
+        const uint8_t* base = m_file.data();
+        const uint64_t fileSize = m_file.size();
+        const CacheHeader* header = reinterpret_cast<const CacheHeader*>(base);
+        const uint64_t tableSize = uint64_t(header->entryCount) * sizeof(FileEntry);
+        const bool valid = header->magic == kPipelineCacheMagic && header->version == kPipelineCacheVersion &&
+                           header->fileSize == fileSize && header->entriesOffset % alignof(FileEntry) == 0 &&
+                           header->entriesOffset <= fileSize && tableSize <= fileSize - header->entriesOffset;
+        if (!valid || !sameIdentity(*header, m_identity))
+        {
+            // 다른 드라이버에서 만든 바이너리는 드라이버가 받아 주더라도 믿지 않습니다. 다음 save가 덮어씁니다.
+            m_file.close();
+            return false;
+        }
+
+        const FileEntry* entries = reinterpret_cast<const FileEntry*>(base + header->entriesOffset);
+        for (uint32_t i = 0; i < header->entryCount; ++i)
+        {
+            const FileEntry& entry = entries[i];
+            if (entry.offset > header->entriesOffset || entry.size > header->entriesOffset - entry.offset)
+            {
+                m_file.close();
+                return false;
+            }
+        }
+
+        m_entries = entries;
+        m_entryCount = header->entryCount;
+        m_verified = std::make_unique<std::atomic<uint8_t>[]>(m_entryCount);
+        return true;
+    }
+
+    bool PipelineCache::save()
+    {
+        AXIS_PROFILE_SCOPE("PipelineCache::save");
+        assert(!isWarming() && "예열 중에는 저장할 수 없습니다");
+        releaseWarmBatches();
+        if (m_path.empty())
+        {
+            return false;
+        }
+
+        struct Source
+        {
+            uint64_t key;
+            BlobKind kind;
+            const uint8_t* data;
+            uint64_t size;
+            uint64_t checksum;
+        };
+
+        std::vector<Source> sources;
+        // 이번 파일에 담은 새 바이너리의 키. 저장하는 동안 다른 스레드가 storeShader로 넣은 것은 남겨 둡니다.
+        std::vector<uint64_t> savedPipelines;
+        std::vector<uint64_t> savedShaders;
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            if (m_pendingPipelines.empty() && m_pendingShaders.empty() && m_entries != nullptr)
+            {
+                return true;
+            }
+
+            for (const auto& [key, blob] : m_pendingPipelines)
+            {
+                sources.push_back(Source{key, BlobKind::Pipeline, blob.data(), blob.size(),
+                                         xxHash64(blob.data(), blob.size())});
+                savedPipelines.push_back(key);
+            }
+            for (const auto& [key, blob] : m_pendingShaders)
+            {
+                sources.push_back(Source{key, BlobKind::Shader, blob.data(), blob.size(),
+                                         xxHash64(blob.data(), blob.size())});
+                savedShaders.push_back(key);
+            }
+            // 새로 얻은 바이너리가 같은 키의 기존 항목을 대신합니다. 깨진 것으로 확인된 항목은 옮기지 않습니다.
+            // 아직 확인하지 않은 항목은 파일의 체크섬을 그대로 옮겨, 깨진 바이트가 새 체크섬을 얻지 못하게 합니다.
+            for (uint32_t i = 0; i < m_entryCount; ++i)
+            {
+                const FileEntry& entry = m_entries[i];
+                const PendingMap& pending = entry.kind == BlobKind::Pipeline ? m_pendingPipelines : m_pendingShaders;
+                if (m_verified[i].load(std::memory_order_relaxed) != kCorrupt && !pending.contains(entry.key))
+                {
+                    sources.push_back(
+                        Source{entry.key, entry.kind, m_file.data() + entry.offset, entry.size, entry.checksum});
+                }
+            }
+        }
+
+        std::sort(sources.begin(), sources.end(), [](const Source& a, const Source& b) {
+            return a.key != b.key ? a.key < b.key : a.kind < b.kind;
+        });
+
+        std::vector<uint8_t> image(sizeof(CacheHeader));
+        std::vector<FileEntry> entries;
+        entries.reserve(sources.size());
+        for (const Source& source : sources)
+        {
+            image.resize((image.size() + kBlobAlignment - 1) / kBlobAlignment * kBlobAlignment);
+            FileEntry entry{};
+            entry.key = source.key;
+            entry.offset = image.size();
+            entry.checksum = source.checksum;
+            entry.size = static_cast<uint32_t>(source.size);
+            entry.kind = source.kind;
+            entries.push_back(entry);
+            image.insert(image.end(), source.data, source.data + source.size);
+        }
+        image.resize((image.size() + alignof(FileEntry) - 1) / alignof(FileEntry) * alignof(FileEntry));
+
+        CacheHeader header{};
+        header.magic = kPipelineCacheMagic;
+        header.version = kPipelineCacheVersion;
+        header.entryCount = static_cast<uint32_t>(entries.size());
+        header.vendorId = m_identity.vendorId;
+        header.deviceId = m_identity.deviceId;
+        header.driverVersion = m_identity.driverVersion;
+        header.engineVersion = m_identity.engineVersion;
+        header.entriesOffset = image.size();
+        header.fileSize = image.size() + entries.size() * sizeof(FileEntry);
+        std::memcpy(image.data(), &header, sizeof(header));
+        const uint8_t* table = reinterpret_cast<const uint8_t*>(entries.data());
+        image.insert(image.end(), table, table + entries.size() * sizeof(FileEntry));
+
+        // 쓰다가 끊겨도 기존 캐시가 남도록 임시 파일에 쓴 뒤 바꿉니다.
+        const std::string temporary = m_path + ".tmp";
+        std::FILE* file = std::fopen(temporary.c_str(), "wb");
+        if (file == nullptr)
+        {
+            return false;
+        }
+        const bool written = std::fwrite(image.data(), 1, image.size(), file) == image.size();
+        const bool closed = std::fclose(file) == 0;
+        if (!written || !closed)
+        {
+            std::remove(temporary.c_str());
+            return false;
+        }
+
+        // 매핑을 닫아야 Windows에서 원본을 바꿀 수 있습니다. 이 뒤로 옛 매핑의 포인터는 쓰지 않습니다.
+        sources.clear();
+        {
+            std::unique_lock<std::shared_mutex> lock(m_fileMutex);
+            m_file.close();
+            m_entries = nullptr;
+            m_entryCount = 0;
+            m_verified.reset();
+        }
+        if (!replaceFile(temporary.c_str(), m_path.c_str()))
+        {
+            std::remove(temporary.c_str());
+            mapFile();
+            return false;
+        }
+
+        {
+            // 셰이더는 같은 키로 다시 넣어도 바뀌지 않고(emplace), 파이프라인은 save를 부르는 제출 스레드만 바꿉니다.
+            // 그래서 지우는 키의 바이너리는 모두 새 파일에 있습니다.
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            for (uint64_t key : savedPipelines)
+            {
+                m_pendingPipelines.erase(key);
+            }
+            for (uint64_t key : savedShaders)
+            {
+                m_pendingShaders.erase(key);
+            }
+        }
+        return mapFile();
+    }
+
+    void PipelineCache::warm(JobSystem& jobs, const PipelineStateDesc* descs, uint32_t count)
+    {
+        releaseWarmBatches();
+
+        WarmBatch batch;
+        batch.jobs = std::make_unique<Job[]>(count);
+        batch.items = std::make_unique<WarmItem[]>(count);
+        uint32_t queued = 0;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const uint64_t key = pipelineKey(descs[i]);
+            if (m_pipelines.contains(key) || findFileEntry(key, BlobKind::Pipeline) != nullptr ||
+                !m_warmKeys.insert(key))
+            {
+                continue;
+            }
+            batch.items[queued] = WarmItem{this, descs[i]};
+            batch.jobs[queued].function = &PipelineCache::warmJob;
+            batch.jobs[queued].data = &batch.items[queued];
+            batch.jobs[queued].counter = &m_warmCounter;
+            ++queued;
+        }
+
+        if (queued != 0)
+        {
+            jobs.submit(batch.jobs.get(), queued);
+            m_warmBatches.push_back(std::move(batch));
+        }
+    }
+
+    void PipelineCache::waitForWarm(JobSystem& jobs)
+    {
+        jobs.wait(m_warmCounter);
+        releaseWarmBatches();
+    }
+
+    void PipelineCache::releaseWarmBatches()
+    {
+        if (!isWarming())
+        {
+            m_warmBatches.clear();
+        }
+    }
+
+    void PipelineCache::warmJob(void* data)
+    {
+        AXIS_PROFILE_SCOPE("PipelineCache::warm");
+        const WarmItem& item = *static_cast<const WarmItem*>(data);
+        PipelineCache& cache = *item.owner;
+        if (cache.compileAndStore(item.desc, pipelineKey(item.desc), false))
+        {
+            std::lock_guard<std::mutex> lock(cache.m_pendingMutex);
+            ++cache.m_stats.warmed;
+        }
+    }
+
+    bool PipelineCache::compileAndStore(const PipelineStateDesc& desc, uint64_t key, bool replace)
+    {
+        std::vector<uint8_t> binary;
+        const bool compiled = m_backend.compilePipeline(desc, binary) && !binary.empty();
+
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        if (!compiled)
+        {
+            ++m_stats.failures;
+            return false;
+        }
+        // 예열 작업은 기존 값을 바꾸지 않습니다. 제출 스레드가 그 바이너리를 읽고 있을 수 있기 때문입니다.
+        if (replace)
+        {
+            m_pendingPipelines.insertOrAssign(key, std::move(binary));
+        }
+        else
+        {
+            m_pendingPipelines.emplace(key, std::move(binary));
+        }
+        return true;
+    }
+
+    PipelineHandle PipelineCache::acquire(const PipelineStateDesc& desc)
+    {
+        const uint64_t key = pipelineKey(desc);
+        const auto found = m_pipelines.find(key);
+        if (found != m_pipelines.end())
+        {
+            return found->second;
+        }
+
+        PipelineHandle pipeline;
+        const void* data = nullptr;
+        uint64_t size = 0;
+        if (findBlob(key, BlobKind::Pipeline, data, size))
+        {
+            pipeline = m_backend.createPipeline(desc, data, size);
+            if (pipeline.isValid())
+            {
+                ++m_stats.hits;
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(m_pendingMutex);
+                ++m_stats.rejected;
+            }
+        }
+
+        if (!pipeline.isValid())
+        {
+            AXIS_PROFILE_SCOPE("PipelineCache::compile");
+            ++m_stats.misses;
+            if (compileAndStore(desc, key, true) && findBlob(key, BlobKind::Pipeline, data, size))
+            {
+                pipeline = m_backend.createPipeline(desc, data, size);
+            }
+        }
+
+        // 실패도 기억해 두어 매 프레임 다시 컴파일하지 않습니다.
+        m_pipelines.emplace(key, pipeline);
+        return pipeline;
+    }
+
+    bool PipelineCache::findShader(uint64_t key, const void*& data, uint64_t& size)
+    {
+        return findBlob(key, BlobKind::Shader, data, size);
+    }
+
+    void PipelineCache::storeShader(uint64_t key, const void* data, uint64_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        m_pendingShaders.emplace(key, std::vector<uint8_t>(bytes, bytes + size));
+    }
+
+    uint32_t PipelineCache::pendingEntryCount()
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        return static_cast<uint32_t>(m_pendingPipelines.size() + m_pendingShaders.size());
+    }
+
+    const PipelineCache::FileEntry* PipelineCache::findFileEntry(uint64_t key, BlobKind kind) const
+    {
+        if (m_entries == nullptr)
+        {
+            return nullptr;
+        }
+        const FileEntry* end = m_entries + m_entryCount;
+        const FileEntry* it = std::lower_bound(m_entries, end, key, [kind](const FileEntry& entry, uint64_t value) {
+            return entry.key != value ? entry.key < value : entry.kind < kind;
+        });
+        return it != end && it->key == key && it->kind == kind ? it : nullptr;
+    }
+
+    bool PipelineCache::findBlob(uint64_t key, BlobKind kind, const void*& data, uint64_t& size)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            const PendingMap& pending = kind == BlobKind::Pipeline ? m_pendingPipelines : m_pendingShaders;
+            const auto found = pending.find(key);
+            if (found != pending.end())
+            {
+                // 값(vector)이 재해시로 옮겨져도 버퍼 주소는 그대로입니다.
+                data = found->second.data();
+                size = found->second.size();
+                return true;
+            }
+        }
+
+        // 제출 스레드의 save가 매핑을 바꾸는 동안에는 기다립니다. 찾은 포인터는 다음 save까지 유효합니다.
+        std::shared_lock<std::shared_mutex> fileLock(m_fileMutex);
+        const FileEntry* entry = findFileEntry(key, kind);
+        if (entry == nullptr)
+        {
+            return false;
+        }
+
+        // 체크섬은 처음 읽을 때 한 번만 확인합니다. 열 때 전부 확인하면 매핑의 이점이 사라집니다.
+        const uint8_t* blob = m_file.data() + entry->offset;
+        std::atomic<uint8_t>& state = m_verified[entry - m_entries];
+        uint8_t current = state.load(std::memory_order_acquire);
+        if (current == kUnverified)
+        {
+            current = xxHash64(blob, entry->size) == entry->checksum ? kVerified : kCorrupt;
+            state.store(current, std::memory_order_release);
+            if (current == kCorrupt)
+            {
+                std::lock_guard<std::mutex> lock(m_pendingMutex);
+                ++m_stats.rejected;
+            }
+        }
+        if (current != kVerified)
+        {
+            return false;
+        }
+
+        data = blob;
+        size = entry->size;
+        return true;
+    }
+}
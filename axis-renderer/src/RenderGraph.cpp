@@ -0,0 +1,668 @@
+#include "axis/renderer/RenderGraph.h"
+
+#include "axis/utils/Profiler.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace axis
+{
+    namespace
+    {
+        bool sameDesc(const TextureDesc& a, const TextureDesc& b)
+        {
+            return a.width == b.width && a.height == b.height && a.mipCount == b.mipCount && a.format == b.format &&
+                   a.usage == b.usage;
+        }
+
+        bool sameDesc(const BufferDesc& a, const BufferDesc& b)
+        {
+            return a.size == b.size && a.usage == b.usage && a.stride == b.stride;
+        }
+
+        uint64_t alignOffset(uint64_t value, uint64_t alignment)
+        {
+            return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+        }
+    }
+
+    TextureHandle RenderGraphContext::texture(RgTexture texture) const
+    {
+        assert(texture.index < m_graph.m_resources.size() && m_graph.m_resources[texture.index].isTexture);
+        return m_graph.m_resources[texture.index].texture;
+    }
+
+    BufferHandle RenderGraphContext::buffer(RgBuffer buffer) const
+    {
+        assert(buffer.index < m_graph.m_resources.size() && !m_graph.m_resources[buffer.index].isTexture);
+        return m_graph.m_resources[buffer.index].buffer;
+    }
+
+    const char* RenderGraphContext::passName() const
+    {
+        return m_graph.m_passes[m_pass].name;
+    }
+
+    RgTexture RenderPassBuilder::read(RgTexture texture, ResourceState state)
+    {
+        m_graph.addAccess(m_pass, texture.index, state, false);
+        return texture;
+    }
+
+    RgTexture RenderPassBuilder::write(RgTexture texture, ResourceState state)
+    {
+        m_graph.addAccess(m_pass, texture.index, state, true);
+        return texture;
+    }
+
+    RgBuffer RenderPassBuilder::read(RgBuffer buffer, ResourceState state)
+    {
+        m_graph.addAccess(m_pass, buffer.index, state, false);
+        return buffer;
+    }
+
+    RgBuffer RenderPassBuilder::write(RgBuffer buffer, ResourceState state)
+    {
+        m_graph.addAccess(m_pass, buffer.index, state, true);
+        return buffer;
+    }
+
+    RgTexture RenderPassBuilder::createTexture(const char* name, const TextureDesc& desc)
+    {
+        return m_graph.createTexture(name, desc);
+    }
+
+    RgBuffer RenderPassBuilder::createBuffer(const char* name, const BufferDesc& desc)
+    {
+        return m_graph.createBuffer(name, desc);
+    }
+
+    void RenderPassBuilder::setSideEffect()
+    {
+        m_graph.m_passes[m_pass].sideEffect = true;
+    }
+
+    RenderGraph::RenderGraph(RenderGraphBackend& backend, Allocator& frameAllocator, const RenderGraphDesc& desc)
+        : m_backend(backend)
+        , m_frameAllocator(frameAllocator)
+        , m_desc(desc)
+    {
+    }
+
+    RenderGraph::~RenderGraph()
+    {
+        reset();
+        for (const PlacedResource& placed : m_placed)
+        {
+            retire(placed.texture, placed.buffer, HeapHandle{});
+        }
+        for (const Heap& heap : m_heaps)
+        {
+            retire(TextureHandle{}, BufferHandle{}, heap.handle);
+        }
+        m_placed.clear();
+        m_heaps.clear();
+        collectRetired(true);
+    }
+
+    RgTexture RenderGraph::createTexture(const char* name, const TextureDesc& desc)
+    {
+        Resource resource;
+        resource.name = name;
+        resource.isTexture = true;
+        resource.textureDesc = desc;
+        return RgTexture{addResource(resource)};
+    }
+
+    RgBuffer RenderGraph::createBuffer(const char* name, const BufferDesc& desc)
+    {
+        Resource resource;
+        resource.name = name;
+        resource.isTexture = false;
+        resource.bufferDesc = desc;
+        return RgBuffer{addResource(resource)};
+    }
+
+    RgTexture RenderGraph::importTexture(const char* name, TextureHandle texture, const TextureDesc& desc,
+                                         ResourceState initialState, ResourceState finalState)
+    {
+        Resource resource;
+        resource.name = name;
+        resource.isTexture = true;
+        resource.imported = true;
+        resource.textureDesc = desc;
+        resource.texture = texture;
+        resource.initialState = initialState;
+        resource.finalState = finalState;
+        return RgTexture{addResource(resource)};
+    }
+
+    RgBuffer RenderGraph::importBuffer(const char* name, BufferHandle buffer, const BufferDesc& desc,
+                                       ResourceState initialState, ResourceState finalState)
+    {
+        Resource resource;
+        resource.name = name;
+        resource.isTexture = false;
+        resource.imported = true;
+        resource.bufferDesc = desc;
+        resource.buffer = buffer;
+        resource.initialState = initialState;
+        resource.finalState = finalState;
+        return RgBuffer{addResource(resource)};
+    }
+
+    uint32_t RenderGraph::addResource(const Resource& resource)
+    {
+        assert(!m_compiled && "compile 뒤에는 리소스를 추가할 수 없습니다");
+        m_resources.push_back(resource);
+        return static_cast<uint32_t>(m_resources.size() - 1);
+    }
+
+    uint32_t RenderGraph::beginPass(const char* name)
+    {
+        assert(!m_compiled && "compile 뒤에는 패스를 추가할 수 없습니다");
+        Pass pass;
+        pass.name = name;
+        pass.firstAccess = static_cast<uint32_t>(m_accesses.size());
+        m_passes.push_back(pass);
+        return static_cast<uint32_t>(m_passes.size() - 1);
+    }
+
+    void RenderGraph::addAccess(uint32_t pass, uint32_t resource, ResourceState state, bool write)
+    {
+        assert(resource < m_resources.size() && "유효하지 않은 그래프 리소스입니다");
+        assert(pass == m_passes.size() - 1 && "접근은 설정 중인 패스에만 선언할 수 있습니다");
+        m_accesses.push_back(Access{resource, state, write});
+        ++m_passes[pass].accessCount;
+    }
+
+    void RenderGraph::setPassExecute(uint32_t pass, void* closure, size_t size, ExecuteThunk execute,
+                                     DestroyThunk destroy)
+    {
+        Pass& target = m_passes[pass];
+        target.closure = closure;
+        target.closureSize = size;
+        target.executeThunk = execute;
+        target.destroyThunk = destroy;
+    }
+
+    bool RenderGraph::compile()
+    {
+        AXIS_PROFILE_SCOPE("RenderGraph::compile");
+
+        assert(!m_compiled && "프레임마다 한 번만 compile할 수 있습니다");
+        m_stats = RenderGraphStats{};
+        m_stats.passCount = static_cast<uint32_t>(m_passes.size());
+        if (m_setupFailed)
+        {
+            return false;
+        }
+
+        cullPasses();
+        computeLifetimes();
+        if (!allocateTransients() || !placeResources())
+        {
+            return false;
+        }
+        buildBarriers();
+        m_compiled = true;
+        return true;
+    }
+
+    void RenderGraph::cullPasses()
+    {
+        // 뒤에서부터 훑으며, 필요한 리소스에 쓰는 패스만 살리고 그 패스가 읽는 리소스를 필요한 것으로 표시합니다.
+        // 가져온 리소스는 그래프 밖에서 보이므로 처음부터 필요합니다.
+        m_needed.assign(m_resources.size(), 0);
+        for (size_t i = 0; i < m_resources.size(); ++i)
+        {
+            m_needed[i] = m_resources[i].imported ? 1 : 0;
+        }
+
+        for (size_t p = m_passes.size(); p-- > 0;)
+        {
+            Pass& pass = m_passes[p];
+            bool live = pass.sideEffect;
+            for (uint32_t a = 0; a < pass.accessCount && !live; ++a)
+            {
+                const Access& access = m_accesses[pass.firstAccess + a];
+                live = access.write && m_needed[access.resource] != 0;
+            }
+
+            pass.culled = !live;
+            if (!live)
+            {
+                ++m_stats.culledPasses;
+                continue;
+            }
+            for (uint32_t a = 0; a < pass.accessCount; ++a)
+            {
+                const Access& access = m_accesses[pass.firstAccess + a];
+                if (!access.write)
+                {
+                    m_needed[access.resource] = 1;
+                }
+            }
+        }
+    }
+
+    void RenderGraph::computeLifetimes()
+    {
+        for (uint32_t p = 0; p < m_passes.size(); ++p)
+        {
+            const Pass& pass = m_passes[p];
+            if (pass.culled)
+            {
+                continue;
+            }
+            for (uint32_t a = 0; a < pass.accessCount; ++a)
+            {
+                Resource& resource = m_resources[m_accesses[pass.firstAccess + a].resource];
+                if (resource.firstPass == kInvalidRenderGraphResource)
+                {
+                    resource.firstPass = p;
+                }
+                resource.lastPass = p;
+            }
+        }
+    }
+
+    bool RenderGraph::allocateTransients()
+    {
+        // 큰 리소스부터 배치하면 작은 리소스가 남은 틈을 채워 힙이 덜 커집니다.
+        m_order.clear();
+        for (uint32_t i = 0; i < m_resources.size(); ++i)
+        {
+            Resource& resource = m_resources[i];
+            if (resource.imported || resource.firstPass == kInvalidRenderGraphResource)
+            {
+                continue;
+            }
+            resource.requirements = resource.isTexture ? m_backend.memoryRequirements(resource.textureDesc)
+                                                       : m_backend.memoryRequirements(resource.bufferDesc);
+            m_stats.unaliasedBytes += resource.requirements.size;
+            m_order.push_back(i);
+        }
+        m_stats.transientResources = static_cast<uint32_t>(m_order.size());
+
+        std::stable_sort(m_order.begin(), m_order.end(), [this](uint32_t a, uint32_t b) {
+            return m_resources[a].requirements.size > m_resources[b].requirements.size;
+        });
+
+        struct Placement
+        {
+            uint64_t begin;
+            uint64_t end;
+        };
+        std::vector<Placement> conflicts;
+        std::vector<std::pair<uint32_t, uint64_t>> heapSizes;
+
+        for (size_t i = 0; i < m_order.size(); ++i)
+        {
+            Resource& resource = m_resources[m_order[i]];
+
+            // 이미 배치된 같은 분류의 리소스 중 수명이 겹치는 것만 피하면 됩니다.
+            conflicts.clear();
+            for (size_t j = 0; j < i; ++j)
+            {
+                const Resource& other = m_resources[m_order[j]];
+                if (other.requirements.heapClass == resource.requirements.heapClass &&
+                    other.firstPass <= resource.lastPass && resource.firstPass <= other.lastPass)
+                {
+                    conflicts.push_back(Placement{other.offset, other.offset + other.requirements.size});
+                }
+            }
+            std::sort(conflicts.begin(), conflicts.end(),
+                      [](const Placement& a, const Placement& b) { return a.begin < b.begin; });
+
+            uint64_t offset = 0;
+            for (const Placement& conflict : conflicts)
+            {
+                const uint64_t candidate = alignOffset(offset, resource.requirements.alignment);
+                if (candidate + resource.requirements.size <= conflict.begin)
+                {
+                    break;
+                }
+                offset = std::max(offset, conflict.end);
+            }
+            resource.offset = alignOffset(offset, resource.requirements.alignment);
+
+            const uint64_t end = resource.offset + resource.requirements.size;
+            auto it = std::find_if(heapSizes.begin(), heapSizes.end(), [&](const std::pair<uint32_t, uint64_t>& entry) {
+                return entry.first == resource.requirements.heapClass;
+            });
+            if (it == heapSizes.end())
+            {
+                heapSizes.emplace_back(resource.requirements.heapClass, end);
+            }
+            else
+            {
+                it->second = std::max(it->second, end);
+            }
+        }
+
+        // 분류마다 힙 하나. 모자라면 더 큰 힙으로 바꾸고, 옛 힙에 놓였던 리소스는 함께 폐기합니다.
+        for (const std::pair<uint32_t, uint64_t>& required : heapSizes)
+        {
+            uint32_t heapIndex = kInvalidRenderGraphResource;
+            for (uint32_t h = 0; h < m_heaps.size(); ++h)
+            {
+                if (m_heaps[h].heapClass == required.first)
+                {
+                    heapIndex = h;
+                    break;
+                }
+            }
+            if (heapIndex == kInvalidRenderGraphResource)
+            {
+                m_heaps.push_back(Heap{HeapHandle{}, 0, required.first});
+                heapIndex = static_cast<uint32_t>(m_heaps.size() - 1);
+            }
+
+            Heap& heap = m_heaps[heapIndex];
+            if (heap.size < required.second)
+            {
+                for (size_t p = m_placed.size(); p-- > 0;)
+                {
+                    if (m_placed[p].heap == heapIndex)
+                    {
+                        retire(m_placed[p].texture, m_placed[p].buffer, HeapHandle{});
+                        m_placed[p] = m_placed.back();
+                        m_placed.pop_back();
+                    }
+                }
+                if (heap.handle.isValid())
+                {
+                    retire(TextureHandle{}, BufferHandle{}, heap.handle);
+                }
+                heap.handle = m_backend.createHeap(required.second, required.first);
+                heap.size = heap.handle.isValid() ? required.second : 0;
+                if (!heap.handle.isValid())
+                {
+                    return false;
+                }
+            }
+            m_stats.heapBytes += required.second;
+            ++m_stats.heapCount;
+
+            for (uint32_t index : m_order)
+            {
+                if (m_resources[index].requirements.heapClass == required.first)
+                {
+                    m_resources[index].heap = heapIndex;
+                }
+            }
+        }
+
+        // 같은 메모리를 먼저 쓴 리소스 중 가장 늦게 끝난 것이 별칭 배리어의 이전 리소스입니다.
+        for (uint32_t index : m_order)
+        {
+            Resource& resource = m_resources[index];
+            const uint64_t begin = resource.offset;
+            const uint64_t end = begin + resource.requirements.size;
+            uint32_t latestEnd = 0;
+            for (uint32_t otherIndex : m_order)
+            {
+                const Resource& other = m_resources[otherIndex];
+                if (otherIndex == index || other.heap != resource.heap || other.offset >= end ||
+                    begin >= other.offset + other.requirements.size)
+                {
+                    continue;
+                }
+                resource.aliased = true;
+                if (other.lastPass < resource.firstPass &&
+                    (resource.aliasBefore == kInvalidRenderGraphResource || other.lastPass >= latestEnd))
+                {
+                    resource.aliasBefore = otherIndex;
+                    latestEnd = other.lastPass;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool RenderGraph::placeResources()
+    {
+        for (PlacedResource& placed : m_placed)
+        {
+            placed.usedThisFrame = false;
+        }
+
+        for (uint32_t index : m_order)
+        {
+            Resource& resource = m_resources[index];
+            PlacedResource* match = nullptr;
+            for (PlacedResource& placed : m_placed)
+            {
+                if (!placed.usedThisFrame && placed.isTexture == resource.isTexture &&
+                    placed.heap == resource.heap && placed.offset == resource.offset &&
+                    (resource.isTexture ? sameDesc(placed.textureDesc, resource.textureDesc)
+                                        : sameDesc(placed.bufferDesc, resource.bufferDesc)))
+                {
+                    match = &placed;
+                    break;
+                }
+            }
+
+            if (match == nullptr)
+            {
+                PlacedResource placed;
+                placed.isTexture = resource.isTexture;
+                placed.textureDesc = resource.textureDesc;
+                placed.bufferDesc = resource.bufferDesc;
+                placed.heap = resource.heap;
+                placed.offset = resource.offset;
+                const HeapHandle heap = m_heaps[resource.heap].handle;
+                if (resource.isTexture)
+                {
+                    placed.texture = m_backend.createPlacedTexture(heap, resource.offset, resource.textureDesc);
+                }
+                else
+                {
+                    placed.buffer = m_backend.createPlacedBuffer(heap, resource.offset, resource.bufferDesc);
+                }
+                if (!placed.texture.isValid() && !placed.buffer.isValid())
+                {
+                    return false;
+                }
+                m_placed.push_back(placed);
+                match = &m_placed.back();
+            }
+
+            match->usedThisFrame = true;
+            resource.texture = match->texture;
+            resource.buffer = match->buffer;
+        }
+
+        // 이번 프레임 배치에 없는 리소스는 GPU가 다 쓴 뒤에 파괴합니다.
+        for (size_t p = m_placed.size(); p-- > 0;)
+        {
+            if (!m_placed[p].usedThisFrame)
+            {
+                retire(m_placed[p].texture, m_placed[p].buffer, HeapHandle{});
+                m_placed[p] = m_placed.back();
+                m_placed.pop_back();
+            }
+        }
+        return true;
+    }
+
+    void RenderGraph::buildBarriers()
+    {
+        m_barriers.clear();
+        for (Resource& resource : m_resources)
+        {
+            resource.state = resource.imported ? resource.initialState : ResourceState::Undefined;
+            resource.lastAccessPass = kInvalidRenderGraphResource;
+        }
+
+        auto makeBarrier = [](const Resource& resource, BarrierType type) {
+            ResourceBarrier barrier;
+            barrier.type = type;
+            barrier.texture = resource.isTexture ? resource.texture : TextureHandle{};
+            barrier.buffer = resource.isTexture ? BufferHandle{} : resource.buffer;
+            return barrier;
+        };
+
+        for (uint32_t p = 0; p < m_passes.size(); ++p)
+        {
+            Pass& pass = m_passes[p];
+            pass.firstBarrier = static_cast<uint32_t>(m_barriers.size());
+            if (pass.culled)
+            {
+                continue;
+            }
+
+            for (uint32_t a = 0; a < pass.accessCount; ++a)
+            {
+                const Access& access = m_accesses[pass.firstAccess + a];
+                Resource& resource = m_resources[access.resource];
+
+                // 같은 패스 안의 중복 선언(읽고 쓰기)은 배리어 하나로 충분합니다.
+                if (resource.lastAccessPass == p)
+                {
+                    assert(resource.state == access.state && "한 패스에서 같은 리소스를 서로 다른 상태로 쓸 수 없습니다");
+                    continue;
+                }
+                assert((resource.imported || access.write || resource.state != ResourceState::Undefined) &&
+                       "쓰기 전에 읽는 임시 리소스입니다");
+
+                if (!resource.imported && resource.firstPass == p && resource.aliased)
+                {
+                    ResourceBarrier barrier = makeBarrier(resource, BarrierType::Aliasing);
+                    if (resource.aliasBefore != kInvalidRenderGraphResource)
+                    {
+                        const Resource& before = m_resources[resource.aliasBefore];
+                        barrier.aliasBeforeTexture = before.isTexture ? before.texture : TextureHandle{};
+                        barrier.aliasBeforeBuffer = before.isTexture ? BufferHandle{} : before.buffer;
+                    }
+                    m_barriers.push_back(barrier);
+                    ++m_stats.aliasingBarriers;
+                }
+
+                if (resource.state != access.state)
+                {
+                    ResourceBarrier barrier = makeBarrier(resource, BarrierType::Transition);
+                    barrier.before = resource.state;
+                    barrier.after = access.state;
+                    m_barriers.push_back(barrier);
+                }
+                else if (access.state == ResourceState::ShaderWrite &&
+                         resource.lastAccessPass != kInvalidRenderGraphResource)
+                {
+                    m_barriers.push_back(makeBarrier(resource, BarrierType::Uav));
+                }
+                // 읽기 뒤의 같은 상태 읽기는 배리어가 필요 없습니다.
+
+                resource.state = access.state;
+                resource.lastAccessPass = p;
+            }
+
+            pass.barrierCount = static_cast<uint32_t>(m_barriers.size()) - pass.firstBarrier;
+            if (pass.barrierCount != 0)
+            {
+                ++m_stats.barrierBatches;
+            }
+        }
+
+        // 가져온 리소스를 약속한 상태로 돌려놓는 전이도 한 묶음으로 보냅니다.
+        m_finalBarrier = static_cast<uint32_t>(m_barriers.size());
+        for (const Resource& resource : m_resources)
+        {
+            if (resource.imported && resource.state != resource.finalState)
+            {
+                ResourceBarrier barrier = makeBarrier(resource, BarrierType::Transition);
+                barrier.before = resource.state;
+                barrier.after = resource.finalState;
+                m_barriers.push_back(barrier);
+            }
+        }
+        if (m_barriers.size() != m_finalBarrier)
+        {
+            ++m_stats.barrierBatches;
+        }
+        m_stats.barriers = static_cast<uint32_t>(m_barriers.size());
+    }
+
+    void RenderGraph::execute()
+    {
+        AXIS_PROFILE_SCOPE("RenderGraph::execute");
+
+        assert(m_compiled && "compile()이 성공한 뒤에 실행해야 합니다");
+        for (uint32_t p = 0; p < m_passes.size(); ++p)
+        {
+            const Pass& pass = m_passes[p];
+            if (pass.culled)
+            {
+                continue;
+            }
+            if (pass.barrierCount != 0)
+            {
+                m_backend.resourceBarriers(&m_barriers[pass.firstBarrier], pass.barrierCount);
+            }
+            RenderGraphContext context(*this, p);
+            pass.executeThunk(pass.closure, context);
+        }
+
+        const uint32_t finalCount = static_cast<uint32_t>(m_barriers.size()) - m_finalBarrier;
+        if (finalCount != 0)
+        {
+            m_backend.resourceBarriers(&m_barriers[m_finalBarrier], finalCount);
+        }
+    }
+
+    void RenderGraph::reset()
+    {
+        for (Pass& pass : m_passes)
+        {
+            if (pass.closure != nullptr)
+            {
+                pass.destroyThunk(pass.closure);
+                m_frameAllocator.deallocate(pass.closure, pass.closureSize);
+            }
+        }
+        m_passes.clear();
+        m_accesses.clear();
+        m_resources.clear();
+        m_barriers.clear();
+        m_finalBarrier = 0;
+        m_compiled = false;
+        m_setupFailed = false;
+
+        ++m_frameIndex;
+        collectRetired(false);
+    }
+
+    void RenderGraph::retire(TextureHandle texture, BufferHandle buffer, HeapHandle heap)
+    {
+        m_retired.push_back(Retired{m_frameIndex, texture, buffer, heap});
+    }
+
+    void RenderGraph::collectRetired(bool all)
+    {
+        // 폐기 순서대로 파괴하므로 힙 위의 리소스가 힙보다 먼저 파괴됩니다.
+        size_t kept = 0;
+        for (size_t i = 0; i < m_retired.size(); ++i)
+        {
+            const Retired& retired = m_retired[i];
+            if (!all && m_frameIndex - retired.frame < m_desc.framesInFlight)
+            {
+                m_retired[kept++] = retired;
+                continue;
+            }
+            if (retired.texture.isValid())
+            {
+                m_backend.destroyPlacedTexture(retired.texture);
+            }
+            if (retired.buffer.isValid())
+            {
+                m_backend.destroyPlacedBuffer(retired.buffer);
+            }
+            if (retired.heap.isValid())
+            {
+                m_backend.destroyHeap(retired.heap);
+            }
+        }
+        m_retired.resize(kept);
+    }
+}
@@ -0,0 +1,226 @@
+#include "axis/renderer/UploadRing.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <mutex>
+
+namespace axis
+{
+    namespace
+    {
+        // capacity를 이 값의 배수로 맞춰, 어떤 정렬 요청도 링의 처음(바퀴 경계)에서는 항상 맞게 합니다.
+        constexpr uint64_t kCapacityGranularity = 64 * 1024;
+
+        uint64_t nowNs()
+        {
+            const auto now = std::chrono::steady_clock::now().time_since_epoch();
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+        }
+    }
+
+    UploadRing::UploadRing(UploadBackend& backend, const UploadRingDesc& desc)
+        : m_backend(backend)
+        , m_desc(desc)
+    {
+        m_desc.framesInFlight = std::clamp(m_desc.framesInFlight, 1u, kMaxUploadFramesInFlight);
+        m_capacity = std::max<uint64_t>(
+            (desc.capacity + kCapacityGranularity - 1) / kCapacityGranularity * kCapacityGranularity,
+            kCapacityGranularity);
+
+        BufferDesc bufferDesc;
+        bufferDesc.size = m_capacity;
+        bufferDesc.usage = kBufferUsageConstant | kBufferUsageVertex | kBufferUsageIndex | kBufferUsageStorage;
+        bufferDesc.debugName = m_desc.debugName;
+
+        void* mapped = nullptr;
+        m_buffer = m_backend.createUploadBuffer(bufferDesc, &mapped);
+        if (!m_buffer.isValid() || mapped == nullptr)
+        {
+            m_buffer = {};
+            return;
+        }
+        m_base = static_cast<uint8_t*>(mapped);
+        m_limit.store(m_capacity, std::memory_order_relaxed);
+    }
+
+    UploadRing::~UploadRing()
+    {
+        if (!m_buffer.isValid())
+        {
+            return;
+        }
+        // GPU가 아직 읽고 있을 수 있는 버퍼를 지우지 않도록 마지막 프레임까지 기다립니다.
+        if (m_frameCount != 0)
+        {
+            const uint32_t last = (m_frameFirst + m_frameCount - 1) % kMaxUploadFramesInFlight;
+            m_backend.waitForFence(m_frames[last].fence);
+        }
+        m_backend.destroyUploadBuffer(m_buffer);
+    }
+
+    void UploadRing::beginFrame()
+    {
+        if (!isValid())
+        {
+            return;
+        }
+
+        std::lock_guard<SpinLock> lock(m_lock);
+        reclaim(false);
+        while (m_frameCount >= m_desc.framesInFlight)
+        {
+            reclaim(true);
+        }
+        m_frameStart = m_head.load(std::memory_order_relaxed);
+    }
+
+    void UploadRing::endFrame(uint64_t fenceValue)
+    {
+        if (!isValid())
+        {
+            return;
+        }
+
+        std::lock_guard<SpinLock> lock(m_lock);
+        const uint64_t head = m_head.load(std::memory_order_acquire);
+        const uint64_t bytes = head - m_frameStart;
+        m_stats.frameBytes = bytes;
+        m_stats.peakFrameBytes = std::max(m_stats.peakFrameBytes, bytes);
+        m_stats.wrapWasteBytes = m_wrapWasteBytes.load(std::memory_order_relaxed);
+
+        // 이번 프레임이 쓴 구간은 링 끝에서 한 번 감길 수 있습니다.
+        if (bytes != 0)
+        {
+            const uint64_t first = m_frameStart % m_capacity;
+            const uint64_t firstBytes = std::min(bytes, m_capacity - first);
+            m_backend.flushUploadBuffer(m_buffer, first, firstBytes);
+            if (firstBytes < bytes)
+            {
+                m_backend.flushUploadBuffer(m_buffer, 0, bytes - firstBytes);
+            }
+        }
+
+        assert(m_frameCount < kMaxUploadFramesInFlight && "beginFrame 없이 endFrame을 호출했습니다");
+        m_frames[(m_frameFirst + m_frameCount) % kMaxUploadFramesInFlight] = InFlightFrame{head, fenceValue};
+        ++m_frameCount;
+        m_frameStart = head;
+    }
+
+    UploadAllocation UploadRing::allocate(uint64_t size, uint32_t alignment)
+    {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0 && "정렬은 2의 거듭제곱이어야 합니다");
+        assert(alignment <= kCapacityGranularity && "정렬이 너무 큽니다");
+        // 절반을 넘는 할당은 감기는 위치에 따라 빈 링에도 들어가지 않을 수 있으므로 일관되게 거절합니다.
+        if (!isValid() || size == 0 || size > m_capacity / 2)
+        {
+            return {};
+        }
+
+        uint64_t start = 0;
+        if (tryBump(size, alignment, start))
+        {
+            return makeAllocation(start, size);
+        }
+
+        // 느린 경로: 끝난 프레임을 먼저 돌려받고, 그래도 모자라면 가장 오래된 프레임부터 기다립니다.
+        // 잠금은 구간을 확인하는 동안만 잡고 펜스는 밖에서 기다려, 다른 기록 스레드가 GPU 한 프레임 동안 돌지 않게 합니다.
+        uint64_t stalledNs = 0;
+        bool stalled = false;
+        for (;;)
+        {
+            uint64_t fence = 0;
+            {
+                std::lock_guard<SpinLock> lock(m_lock);
+                if (stalled)
+                {
+                    ++m_stats.stalls;
+                    m_stats.stallNs += stalledNs;
+                    stalled = false;
+                }
+                reclaim(false);
+                if (tryBump(size, alignment, start))
+                {
+                    return makeAllocation(start, size);
+                }
+                if (m_frameCount == 0)
+                {
+                    ++m_stats.failures;
+                    return {};
+                }
+                fence = m_frames[m_frameFirst].fence;
+            }
+
+            const uint64_t begin = nowNs();
+            m_backend.waitForFence(fence);
+            stalledNs = nowNs() - begin;
+            stalled = true;
+        }
+    }
+
+    bool UploadRing::tryBump(uint64_t size, uint64_t alignment, uint64_t& outStart)
+    {
+        uint64_t head = m_head.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            uint64_t start = (head + alignment - 1) & ~(alignment - 1);
+            const bool wraps = start % m_capacity + size > m_capacity;
+            if (wraps)
+            {
+                start = (start / m_capacity + 1) * m_capacity;
+            }
+
+            const uint64_t end = start + size;
+            if (end > m_limit.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            if (m_head.compare_exchange_weak(head, end, std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                if (wraps)
+                {
+                    m_wrapWasteBytes.fetch_add(start - head, std::memory_order_relaxed);
+                }
+                outStart = start;
+                return true;
+            }
+        }
+    }
+
+    UploadAllocation UploadRing::makeAllocation(uint64_t start, uint64_t size) const
+    {
+        UploadAllocation allocation;
+        allocation.buffer = m_buffer;
+        allocation.offset = start % m_capacity;
+        allocation.size = size;
+        allocation.cpu = m_base + allocation.offset;
+        return allocation;
+    }
+
+    void UploadRing::reclaim(bool wait)
+    {
+        if (m_frameCount == 0)
+        {
+            return;
+        }
+
+        uint64_t completed = m_backend.completedFenceValue();
+        const InFlightFrame& oldest = m_frames[m_frameFirst];
+        if (wait && completed < oldest.fence)
+        {
+            const uint64_t begin = nowNs();
+            m_backend.waitForFence(oldest.fence);
+            completed = std::max(completed, oldest.fence);
+            ++m_stats.stalls;
+            m_stats.stallNs += nowNs() - begin;
+        }
+
+        while (m_frameCount != 0 && m_frames[m_frameFirst].fence <= completed)
+        {
+            m_tail = m_frames[m_frameFirst].end;
+            m_frameFirst = (m_frameFirst + 1) % kMaxUploadFramesInFlight;
+            --m_frameCount;
+        }
+        m_limit.store(m_tail + m_capacity, std::memory_order_release);
+    }
+}
@@ -0,0 +1,212 @@
+// AsyncIo 검사. 백엔드(io_uring/IOCP/Blocking)와 무관하게 같은 결과를 기대합니다.
+
+#include "Test.h"
+
+#include "axis/platform/AsyncIo.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace axis;
+    using namespace axis::test;
+
+    constexpr const char* kFilePath = "axis-tests-asyncio.bin";
+    constexpr uint32_t kWordCount = 256 * 1024;
+    constexpr uint32_t kChunkBytes = 16 * 1024;
+
+    // 단어 i에 i를 쓴 파일을 만들고, 끝나면 지웁니다.
+    struct WordFile
+    {
+        WordFile()
+        {
+            std::vector<uint32_t> words(kWordCount);
+            for (uint32_t i = 0; i < kWordCount; ++i)
+            {
+                words[i] = i;
+            }
+            FILE* file = std::fopen(kFilePath, "wb");
+            valid = file != nullptr && std::fwrite(words.data(), sizeof(uint32_t), kWordCount, file) == kWordCount;
+            if (file != nullptr)
+            {
+                std::fclose(file);
+            }
+        }
+
+        ~WordFile() { std::remove(kFilePath); }
+
+        bool valid = false;
+    };
+
+    bool holdsWords(const IoRequest& request)
+    {
+        const uint32_t* words = static_cast<const uint32_t*>(request.buffer);
+        const uint64_t first = request.offset / sizeof(uint32_t);
+        for (uint32_t i = 0; i < request.bytesRead / sizeof(uint32_t); ++i)
+        {
+            if (words[i] != first + i)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void waitAll(const std::vector<IoRequest>& requests)
+    {
+        for (const IoRequest& request : requests)
+        {
+            while (!request.isDone())
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    std::atomic<uint32_t> g_callbacks{0};
+
+    void countCallback(IoRequest&) { g_callbacks.fetch_add(1, std::memory_order_relaxed); }
+
+    void readsAllPriorities(TestContext& t)
+    {
+        WordFile data;
+        AXIS_REQUIRE(t, data.valid);
+
+        AsyncIoDesc desc;
+        desc.queueDepth = 8;
+        AsyncIo io(desc);
+        const AsyncFileId file = io.openFile(kFilePath);
+        AXIS_REQUIRE(t, file != kInvalidAsyncFile);
+        AXIS_CHECK(t, io.fileSize(file) == uint64_t{kWordCount} * sizeof(uint32_t));
+
+        const uint32_t chunkCount = kWordCount * sizeof(uint32_t) / kChunkBytes;
+        std::vector<IoRequest> requests(chunkCount);
+        std::vector<uint32_t> buffers(kWordCount);
+        g_callbacks.store(0);
+        for (uint32_t i = 0; i < chunkCount; ++i)
+        {
+            requests[i].file = file;
+            requests[i].offset = uint64_t{i} * kChunkBytes;
+            requests[i].size = kChunkBytes;
+            requests[i].buffer = buffers.data() + i * (kChunkBytes / sizeof(uint32_t));
+            requests[i].priority = static_cast<IoPriority>(i % kIoPriorityCount);
+            requests[i].callback = countCallback;
+        }
+        // 절반은 한 번에, 나머지는 하나씩 넣어 두 경로를 모두 거칩니다.
+        io.submit(requests.data(), chunkCount / 2);
+        for (uint32_t i = chunkCount / 2; i < chunkCount; ++i)
+        {
+            io.submit(requests[i]);
+        }
+        waitAll(requests);
+
+        for (const IoRequest& request : requests)
+        {
+            AXIS_CHECK(t, request.status.load() == IoStatus::Completed);
+            AXIS_CHECK(t, request.bytesRead == kChunkBytes);
+            AXIS_CHECK(t, holdsWords(request));
+        }
+        AXIS_CHECK(t, g_callbacks.load() == chunkCount);
+        AXIS_CHECK(t, io.outstanding() == 0);
+        io.closeFile(file);
+    }
+
+    void shortReadAtEndOfFile(TestContext& t)
+    {
+        WordFile data;
+        AXIS_REQUIRE(t, data.valid);
+
+        AsyncIo io;
+        const AsyncFileId file = io.openFile(kFilePath);
+        AXIS_REQUIRE(t, file != kInvalidAsyncFile);
+
+        std::vector<uint32_t> buffer(kChunkBytes / sizeof(uint32_t));
+        std::vector<IoRequest> requests(1);
+        requests[0].file = file;
+        requests[0].offset = uint64_t{kWordCount} * sizeof(uint32_t) - 64;
+        requests[0].size = kChunkBytes;
+        requests[0].buffer = buffer.data();
+        io.submit(requests[0]);
+        waitAll(requests);
+
+        AXIS_CHECK(t, requests[0].status.load() == IoStatus::Completed);
+        AXIS_CHECK(t, requests[0].bytesRead == 64);
+        AXIS_CHECK(t, holdsWords(requests[0]));
+        io.closeFile(file);
+    }
+
+    // 잘못된 파일을 가리키는 요청이 섞인 묶음: 실패한 요청은 바로 끝나고 나머지는 그대로 읽혀야 합니다.
+    void failsInvalidFilesInBatch(TestContext& t)
+    {
+        WordFile data;
+        AXIS_REQUIRE(t, data.valid);
+
+        AsyncIo io;
+        const AsyncFileId file = io.openFile(kFilePath);
+        AXIS_REQUIRE(t, file != kInvalidAsyncFile);
+
+        constexpr uint32_t kCount = 32;
+        std::vector<IoRequest> requests(kCount);
+        std::vector<uint32_t> buffers(kCount * 1024);
+        for (uint32_t i = 0; i < kCount; ++i)
+        {
+            const bool invalid = i % 3 == 1;
+            requests[i].file = invalid ? file + 100 : file;
+            requests[i].offset = uint64_t{i} * 4096;
+            requests[i].size = 4096;
+            requests[i].buffer = buffers.data() + i * 1024;
+        }
+        io.submit(requests.data(), kCount);
+        waitAll(requests);
+
+        for (uint32_t i = 0; i < kCount; ++i)
+        {
+            const bool invalid = i % 3 == 1;
+            AXIS_CHECK(t, requests[i].status.load() == (invalid ? IoStatus::Failed : IoStatus::Completed));
+            AXIS_CHECK(t, invalid || holdsWords(requests[i]));
+        }
+        AXIS_CHECK(t, io.outstanding() == 0);
+        io.closeFile(file);
+    }
+
+    // 대기 중인 요청을 남긴 채 파괴해도 모든 요청이 Pending을 벗어나야 합니다.
+    void destroyWithPendingRequests(TestContext& t)
+    {
+        WordFile data;
+        AXIS_REQUIRE(t, data.valid);
+
+        constexpr uint32_t kCount = 128;
+        std::vector<IoRequest> requests(kCount);
+        std::vector<uint32_t> buffers(kCount * 1024);
+        {
+            AsyncIoDesc desc;
+            desc.queueDepth = 2;
+            AsyncIo io(desc);
+            const AsyncFileId file = io.openFile(kFilePath);
+            AXIS_REQUIRE(t, file != kInvalidAsyncFile);
+            for (uint32_t i = 0; i < kCount; ++i)
+            {
+                requests[i].file = file;
+                requests[i].offset = uint64_t{i} * 4096;
+                requests[i].size = 4096;
+                requests[i].buffer = buffers.data() + i * 1024;
+            }
+            io.submit(requests.data(), kCount);
+        }
+
+        for (const IoRequest& request : requests)
+        {
+            const IoStatus status = request.status.load();
+            AXIS_CHECK(t, status == IoStatus::Completed || status == IoStatus::Cancelled);
+        }
+    }
+}
+
+AXIS_TEST("platform.asyncio.reads_all_priorities", readsAllPriorities);
+AXIS_TEST("platform.asyncio.short_read_at_end_of_file", shortReadAtEndOfFile);
+AXIS_TEST("platform.asyncio.fails_invalid_files_in_batch", failsInvalidFilesInBatch);
+AXIS_TEST("platform.asyncio.destroy_with_pending_requests", destroyWithPendingRequests);
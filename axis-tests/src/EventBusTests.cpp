@@ -0,0 +1,297 @@
+// EventBus 검사. 세대 분리(구독자 안의 publish는 다음 dispatch로)와 순서 보장, 구독 변경 시점을 봅니다.
+
+#include "Test.h"
+
+#include "axis/core/EventBus.h"
+#include "axis/core/JobSystem.h"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace axis;
+    using namespace axis::test;
+
+    struct TestPing
+    {
+        uint32_t value;
+    };
+
+    struct TestPong
+    {
+        uint32_t value;
+    };
+
+    struct TestTagged
+    {
+        uint32_t thread;
+        uint32_t sequence;
+    };
+
+    struct TestUnheard
+    {
+        uint64_t value;
+    };
+
+    struct Recorder
+    {
+        std::vector<uint32_t> values;
+        uint32_t batches = 0;
+    };
+
+    void recordPings(const TestPing* events, uint32_t count, void* userData)
+    {
+        Recorder& recorder = *static_cast<Recorder*>(userData);
+        ++recorder.batches;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            recorder.values.push_back(events[i].value);
+        }
+    }
+
+    void recordPongs(const TestPong* events, uint32_t count, void* userData)
+    {
+        Recorder& recorder = *static_cast<Recorder*>(userData);
+        ++recorder.batches;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            recorder.values.push_back(events[i].value);
+        }
+    }
+
+    void keepsPublishOrderPerType(TestContext& t)
+    {
+        JobSystemDesc jobsDesc;
+        jobsDesc.workerCount = 1;
+        JobSystem jobs(jobsDesc);
+        EventBus bus(jobs);
+
+        Recorder pings;
+        Recorder pongs;
+        bus.subscribe<TestPing>(recordPings, &pings);
+        bus.subscribe<TestPong>(recordPongs, &pongs);
+
+        for (uint32_t i = 0; i < 300; ++i)
+        {
+            AXIS_CHECK(t, bus.publish(TestPing{i}));
+            if (i % 3 == 0)
+            {
+                AXIS_CHECK(t, bus.publish(TestPong{i}));
+            }
+        }
+        AXIS_CHECK(t, bus.dispatch() == 400);
+        AXIS_CHECK(t, bus.stats().events == 400);
+        AXIS_CHECK(t, bus.stats().types == 2);
+
+        // 타입마다 묶음 하나로, publish 순서 그대로 받아야 합니다.
+        AXIS_CHECK(t, pings.batches == 1);
+        AXIS_CHECK(t, pongs.batches == 1);
+        AXIS_REQUIRE(t, pings.values.size() == 300 && pongs.values.size() == 100);
+        for (uint32_t i = 0; i < 300; ++i)
+        {
+            AXIS_CHECK(t, pings.values[i] == i);
+        }
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            AXIS_CHECK(t, pongs.values[i] == i * 3);
+        }
+
+        AXIS_CHECK(t, bus.dispatch() == 0);
+        AXIS_CHECK(t, pings.batches == 1);
+    }
+
+    struct Relay
+    {
+        EventBus* bus = nullptr;
+        uint32_t received = 0;
+        bool inside = false;
+        bool reentered = false;
+    };
+
+    // 받은 값마다 값+1을 다시 보냅니다. 같은 dispatch 안에서 다시 불리면 재진입입니다.
+    void relayPings(const TestPing* events, uint32_t count, void* userData)
+    {
+        Relay& relay = *static_cast<Relay*>(userData);
+        relay.reentered = relay.reentered || relay.inside;
+        relay.inside = true;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            ++relay.received;
+            if (events[i].value < 5)
+            {
+                relay.bus->publish(TestPing{events[i].value + 1});
+            }
+        }
+        relay.inside = false;
+    }
+
+    void defersEventsPublishedDuringDispatch(TestContext& t)
+    {
+        JobSystemDesc jobsDesc;
+        jobsDesc.workerCount = 1;
+        JobSystem jobs(jobsDesc);
+        EventBus bus(jobs);
+
+        Relay relay;
+        relay.bus = &bus;
+        bus.subscribe<TestPing>(relayPings, &relay);
+        bus.publish(TestPing{0});
+
+        // 0 → 1 → ... → 5: dispatch마다 정확히 한 세대씩 나아가야 합니다.
+        for (uint32_t round = 0; round < 6; ++round)
+        {
+            AXIS_CHECK(t, bus.dispatch() == 1);
+            AXIS_CHECK(t, relay.received == round + 1);
+        }
+        AXIS_CHECK(t, bus.dispatch() == 0);
+        AXIS_CHECK(t, !relay.reentered);
+    }
+
+    struct TaggedLog
+    {
+        uint32_t threads = 0;
+        std::vector<uint32_t> counts;
+        bool ordered = true;
+    };
+
+    void checkTagged(const TestTagged* events, uint32_t count, void* userData)
+    {
+        TaggedLog& log = *static_cast<TaggedLog*>(userData);
+        std::vector<int64_t> last(log.threads, -1);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const TestTagged& event = events[i];
+            log.ordered = log.ordered && int64_t{event.sequence} > last[event.thread];
+            last[event.thread] = event.sequence;
+            ++log.counts[event.thread];
+        }
+    }
+
+    void collectsFromAllThreads(TestContext& t)
+    {
+        JobSystemDesc jobsDesc;
+        jobsDesc.workerCount = 3;
+        JobSystem jobs(jobsDesc);
+        EventBusDesc busDesc;
+        // 작은 청크로 스레드마다 청크를 여러 개 잇게 합니다.
+        busDesc.chunkSize = 4096;
+        EventBus bus(jobs, busDesc);
+
+        constexpr uint32_t kPerBatch = 500;
+        constexpr uint32_t kBatches = 40;
+        constexpr uint32_t kExternal = 3000;
+        const uint32_t externalSlot = jobs.threadCount();
+
+        TaggedLog log;
+        log.threads = jobs.threadCount() + 1;
+        log.counts.assign(log.threads, 0);
+        bus.subscribe<TestTagged>(checkTagged, &log);
+
+        // 스레드마다 publish한 순번이 늘어나는지 보려고 스레드별 순번을 둡니다.
+        std::vector<uint32_t> sequences(log.threads, 0);
+        std::thread external([&] {
+            for (uint32_t i = 0; i < kExternal; ++i)
+            {
+                bus.publish(TestTagged{externalSlot, i});
+            }
+        });
+        jobs.parallelFor(kPerBatch * kBatches, kPerBatch, [&](uint32_t begin, uint32_t end) {
+            const uint32_t thread = jobs.currentThreadIndex();
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                bus.publish(TestTagged{thread, sequences[thread]++});
+            }
+        });
+        external.join();
+
+        AXIS_CHECK(t, bus.dispatch() == kPerBatch * kBatches + kExternal);
+        AXIS_CHECK(t, log.ordered);
+        uint32_t total = 0;
+        for (uint32_t i = 0; i < log.threads; ++i)
+        {
+            total += log.counts[i];
+        }
+        AXIS_CHECK(t, total == kPerBatch * kBatches + kExternal);
+        AXIS_CHECK(t, log.counts[externalSlot] == kExternal);
+        AXIS_CHECK(t, bus.stats().dropped == 0);
+    }
+
+    struct Changer
+    {
+        EventBus* bus = nullptr;
+        SubscriptionId victim = kInvalidSubscription;
+        Recorder* late = nullptr;
+        bool changed = false;
+    };
+
+    // 첫 dispatch에서 퐁 구독자를 해제하고 새 핑 구독자를 등록합니다.
+    void changeSubscribers(const TestPing*, uint32_t, void* userData)
+    {
+        Changer& changer = *static_cast<Changer*>(userData);
+        if (!changer.changed)
+        {
+            changer.bus->unsubscribe(changer.victim);
+            changer.bus->subscribe<TestPing>(recordPings, changer.late);
+            changer.changed = true;
+        }
+    }
+
+    void appliesSubscriberChangesAtTheRightTime(TestContext& t)
+    {
+        JobSystemDesc jobsDesc;
+        jobsDesc.workerCount = 1;
+        JobSystem jobs(jobsDesc);
+        EventBus bus(jobs);
+
+        Recorder pongs;
+        Recorder late;
+        Changer changer;
+        changer.bus = &bus;
+        changer.late = &late;
+        // 핑 타입을 먼저 등록해 핑 묶음이 퐁 묶음보다 먼저 나가게 합니다.
+        bus.subscribe<TestPing>(changeSubscribers, &changer);
+        changer.victim = bus.subscribe<TestPong>(recordPongs, &pongs);
+        AXIS_REQUIRE(t, eventTypeId<TestPing>() < eventTypeId<TestPong>());
+
+        bus.publish(TestPing{1});
+        bus.publish(TestPong{2});
+        bus.dispatch();
+        // 해제는 이번 dispatch의 남은 묶음부터, 등록은 다음 dispatch부터 적용됩니다.
+        AXIS_CHECK(t, pongs.batches == 0);
+        AXIS_CHECK(t, late.batches == 0);
+
+        bus.publish(TestPing{3});
+        bus.publish(TestPong{4});
+        bus.dispatch();
+        AXIS_CHECK(t, pongs.batches == 0);
+        AXIS_REQUIRE(t, late.values.size() == 1);
+        AXIS_CHECK(t, late.values[0] == 3);
+    }
+
+    void countsUndeliveredEvents(TestContext& t)
+    {
+        JobSystemDesc jobsDesc;
+        jobsDesc.workerCount = 1;
+        JobSystem jobs(jobsDesc);
+        EventBus bus(jobs);
+
+        for (uint64_t i = 0; i < 10; ++i)
+        {
+            bus.publish(TestUnheard{i});
+        }
+        // dispatch는 구독자에게 넘긴 수만 돌려줍니다.
+        AXIS_CHECK(t, bus.dispatch() == 0);
+        AXIS_CHECK(t, bus.stats().undelivered == 10);
+
+        bus.dispatch();
+        AXIS_CHECK(t, bus.stats().undelivered == 0);
+    }
+}
+
+AXIS_TEST("core.event_bus.keeps_publish_order_per_type", keepsPublishOrderPerType);
+AXIS_TEST("core.event_bus.defers_events_published_during_dispatch", defersEventsPublishedDuringDispatch);
+AXIS_TEST("core.event_bus.collects_from_all_threads", collectsFromAllThreads);
+AXIS_TEST("core.event_bus.applies_subscriber_changes_at_the_right_time", appliesSubscriberChangesAtTheRightTime);
+AXIS_TEST("core.event_bus.counts_undelivered_events", countsUndeliveredEvents);
@@ -0,0 +1,192 @@
+// FlatHashMap/FlatHashSet 검사. 같은 연산을 std::unordered_map에 함께 적용해 결과를 비교합니다.
+
+#include "Test.h"
+
+#include "axis/utils/FlatHashMap.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace
+{
+    using namespace axis;
+    using namespace axis::test;
+
+    uint64_t nextRandom(uint64_t& state)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    // 하위 몇 비트만 남겨 같은 그룹에 키를 몰아넣습니다. 긴 탐사와 묘비 처리를 거치게 합니다.
+    struct CrowdedHash
+    {
+        size_t operator()(uint64_t key) const { return static_cast<size_t>(key & 0x3F); }
+    };
+
+    template <typename Map>
+    bool sameContents(const Map& map, const std::unordered_map<uint64_t, uint64_t>& reference)
+    {
+        if (map.size() != reference.size())
+        {
+            return false;
+        }
+        size_t visited = 0;
+        for (const auto& entry : map)
+        {
+            const auto it = reference.find(entry.first);
+            if (it == reference.end() || it->second != entry.second)
+            {
+                return false;
+            }
+            ++visited;
+        }
+        return visited == reference.size();
+    }
+
+    template <typename Hash>
+    void matchesReference(TestContext& t, uint64_t keyRange)
+    {
+        FlatHashMap<uint64_t, uint64_t, Hash> map;
+        std::unordered_map<uint64_t, uint64_t> reference;
+        uint64_t state = 0x9E3779B97F4A7C15ull;
+        bool agrees = true;
+        for (uint32_t step = 0; step < 200000; ++step)
+        {
+            const uint64_t key = nextRandom(state) % keyRange;
+            switch (nextRandom(state) % 4)
+            {
+            case 0:
+            case 1:
+                agrees = agrees && map.emplace(key, step).second == reference.emplace(key, step).second;
+                break;
+            case 2:
+                agrees = agrees && map.erase(key) == reference.erase(key);
+                break;
+            default:
+            {
+                const auto it = map.find(key);
+                const auto expected = reference.find(key);
+                agrees = agrees && (it == map.end()) == (expected == reference.end()) &&
+                         (it == map.end() || it->second == expected->second);
+                break;
+            }
+            }
+        }
+        AXIS_CHECK(t, agrees);
+        AXIS_CHECK(t, sameContents(map, reference));
+    }
+
+    void matchesUnorderedMap(TestContext& t) { matchesReference<std::hash<uint64_t>>(t, 4096); }
+
+    void matchesUnorderedMapWithCrowdedHash(TestContext& t) { matchesReference<CrowdedHash>(t, 2048); }
+
+    void eraseWhileIterating(TestContext& t)
+    {
+        FlatHashMap<uint64_t, uint64_t> map;
+        std::unordered_map<uint64_t, uint64_t> reference;
+        for (uint64_t i = 0; i < 1000; ++i)
+        {
+            map.emplace(i, i * 3);
+            if (i % 2 == 1)
+            {
+                reference.emplace(i, i * 3);
+            }
+        }
+        for (auto it = map.begin(); it != map.end();)
+        {
+            it = it->first % 2 == 0 ? map.erase(it) : ++it;
+        }
+        AXIS_CHECK(t, sameContents(map, reference));
+    }
+
+    void reserveAvoidsRehash(TestContext& t)
+    {
+        FlatHashMap<uint64_t, uint64_t> map;
+        AXIS_REQUIRE(t, map.reserve(1000));
+        const size_t capacity = map.capacity();
+        AXIS_CHECK(t, capacity >= 1000);
+        for (uint64_t i = 0; i < 1000; ++i)
+        {
+            map[i] = i;
+        }
+        AXIS_CHECK(t, map.capacity() == capacity);
+
+        // 지우고 넣기를 반복해도 묘비 정리는 같은 용량 안에서 끝나야 합니다.
+        for (uint64_t round = 0; round < 20; ++round)
+        {
+            for (uint64_t i = 0; i < 1000; ++i)
+            {
+                map.erase(i + round * 1000);
+                map[i + (round + 1) * 1000] = i;
+            }
+        }
+        AXIS_CHECK(t, map.size() == 1000);
+        AXIS_CHECK(t, map.capacity() == capacity);
+
+        map.clear();
+        AXIS_CHECK(t, map.empty());
+        AXIS_CHECK(t, map.capacity() == capacity);
+        AXIS_CHECK(t, map.find(20500) == map.end());
+    }
+
+    void ownsNonTrivialValues(TestContext& t)
+    {
+        FlatHashMap<std::string, std::string, std::hash<std::string>> map;
+        for (int i = 0; i < 500; ++i)
+        {
+            map.emplace(std::to_string(i), std::string(40, static_cast<char>('a' + i % 26)));
+        }
+        AXIS_CHECK(t, map.insertOrAssign("7", std::string("seven")).second == false);
+        AXIS_CHECK(t, map.find("7")->second == "seven");
+
+        FlatHashMap<std::string, std::string, std::hash<std::string>> copy(map);
+        FlatHashMap<std::string, std::string, std::hash<std::string>> moved(std::move(map));
+        AXIS_CHECK(t, copy.size() == 500);
+        AXIS_CHECK(t, moved.size() == 500);
+        AXIS_CHECK(t, copy.find("7")->second == "seven");
+        AXIS_CHECK(t, moved.find("499")->second == std::string(40, static_cast<char>('a' + 499 % 26)));
+
+        copy.erase("7");
+        AXIS_CHECK(t, !copy.contains("7"));
+        AXIS_CHECK(t, moved.contains("7"));
+    }
+
+    void setMatchesUnorderedSet(TestContext& t)
+    {
+        FlatHashSet<uint64_t, CrowdedHash> set;
+        std::unordered_set<uint64_t> reference;
+        uint64_t state = 12345;
+        bool agrees = true;
+        for (uint32_t step = 0; step < 50000; ++step)
+        {
+            const uint64_t key = nextRandom(state) % 1024;
+            if (nextRandom(state) % 3 == 0)
+            {
+                agrees = agrees && set.erase(key) == reference.erase(key);
+            }
+            else
+            {
+                agrees = agrees && set.insert(key) == reference.insert(key).second;
+            }
+        }
+        AXIS_CHECK(t, agrees);
+        AXIS_CHECK(t, set.size() == reference.size());
+        for (uint64_t key : set)
+        {
+            AXIS_CHECK(t, reference.count(key) == 1);
+        }
+    }
+}
+
+AXIS_TEST("utils.flat_hash_map.matches_unordered_map", matchesUnorderedMap);
+AXIS_TEST("utils.flat_hash_map.matches_unordered_map_with_crowded_hash", matchesUnorderedMapWithCrowdedHash);
+AXIS_TEST("utils.flat_hash_map.erase_while_iterating", eraseWhileIterating);
+AXIS_TEST("utils.flat_hash_map.reserve_avoids_rehash", reserveAvoidsRehash);
+AXIS_TEST("utils.flat_hash_map.owns_non_trivial_values", ownsNonTrivialValues);
+AXIS_TEST("utils.flat_hash_set.matches_unordered_set", setMatchesUnorderedSet);
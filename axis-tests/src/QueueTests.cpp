@@ -0,0 +1,283 @@
+// 잠금 없는 큐 검사. 단일 스레드로 경계 조건을 본 뒤, 여러 스레드로 값이 빠짐없이 한 번씩만 나오는지 봅니다.
+
+#include "Test.h"
+
+#include "axis/core/MpmcQueue.h"
+#include "axis/core/MpscQueue.h"
+#include "axis/core/SpscRing.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace axis;
+    using namespace axis::test;
+
+    constexpr uint32_t kProducers = 4;
+    constexpr uint32_t kItemsPerProducer = 50000;
+
+    // 생산자 p의 i번째 값. 소비자가 값에서 생산자와 순번을 되짚습니다.
+    uint64_t encode(uint32_t producer, uint32_t index) { return (uint64_t{producer} << 32) | index; }
+
+    // 소멸자 호출을 세어 큐가 남은 값을 정확히 한 번씩 파괴하는지 봅니다.
+    struct Counted
+    {
+        explicit Counted(std::atomic<int>* counter = nullptr)
+            : live(counter)
+        {
+            if (live != nullptr)
+            {
+                live->fetch_add(1);
+            }
+        }
+        Counted(Counted&& other) noexcept
+            : live(other.live)
+        {
+            other.live = nullptr;
+        }
+        Counted& operator=(Counted&& other) noexcept
+        {
+            if (live != nullptr)
+            {
+                live->fetch_sub(1);
+            }
+            live = other.live;
+            other.live = nullptr;
+            return *this;
+        }
+        ~Counted()
+        {
+            if (live != nullptr)
+            {
+                live->fetch_sub(1);
+            }
+        }
+
+        std::atomic<int>* live;
+    };
+
+    void spscFullAndEmpty(TestContext& t)
+    {
+        SpscRing<uint32_t> ring(4);
+        uint32_t value = 0;
+        AXIS_CHECK(t, !ring.tryPop(value));
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            AXIS_CHECK(t, ring.tryPush(i));
+        }
+        AXIS_CHECK(t, !ring.tryPush(99u));
+        AXIS_CHECK(t, ring.sizeApprox() == 4);
+
+        // 여러 바퀴를 돌아도 FIFO 순서가 유지되어야 합니다.
+        for (uint32_t i = 4; i < 40; ++i)
+        {
+            AXIS_REQUIRE(t, ring.tryPop(value));
+            AXIS_CHECK(t, value == i - 4);
+            AXIS_CHECK(t, ring.tryPush(i));
+        }
+        for (uint32_t i = 36; i < 40; ++i)
+        {
+            AXIS_REQUIRE(t, ring.tryPop(value));
+            AXIS_CHECK(t, value == i);
+        }
+        AXIS_CHECK(t, !ring.tryPop(value));
+    }
+
+    void spscKeepsOrderAcrossThreads(TestContext& t)
+    {
+        constexpr uint32_t kCount = 200000;
+        SpscRing<uint32_t> ring(64);
+        std::thread producer([&] {
+            for (uint32_t i = 0; i < kCount; ++i)
+            {
+                while (!ring.tryPush(i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        uint32_t expected = 0;
+        bool ordered = true;
+        while (expected < kCount)
+        {
+            uint32_t value;
+            if (ring.tryPop(value))
+            {
+                ordered = ordered && value == expected;
+                ++expected;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        AXIS_CHECK(t, ordered);
+    }
+
+    void mpmcFullAndEmpty(TestContext& t)
+    {
+        MpmcQueue<uint32_t> queue(8);
+        uint32_t value = 0;
+        AXIS_CHECK(t, queue.capacity() == 8);
+        AXIS_CHECK(t, !queue.tryPop(value));
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            AXIS_CHECK(t, queue.tryPush(i));
+        }
+        AXIS_CHECK(t, !queue.tryPush(99u));
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            AXIS_REQUIRE(t, queue.tryPop(value));
+            AXIS_CHECK(t, value == i);
+        }
+        AXIS_CHECK(t, !queue.tryPop(value));
+    }
+
+    void mpmcDestroysRemainingValues(TestContext& t)
+    {
+        std::atomic<int> live{0};
+        {
+            MpmcQueue<Counted> queue(8);
+            for (int i = 0; i < 5; ++i)
+            {
+                AXIS_CHECK(t, queue.tryPush(Counted(&live)));
+            }
+            Counted out;
+            AXIS_CHECK(t, queue.tryPop(out));
+            AXIS_CHECK(t, live.load() == 5);
+        }
+        AXIS_CHECK(t, live.load() == 0);
+    }
+
+    // 생산자 여럿과 소비자 여럿이 동시에 써도 모든 값이 정확히 한 번씩 나오고, 생산자마다의 순서가 유지되어야 합니다.
+    void mpmcDeliversEveryValueOnce(TestContext& t)
+    {
+        constexpr uint32_t kConsumers = 4;
+        MpmcQueue<uint64_t> queue(256);
+        std::vector<std::atomic<uint8_t>> seen(size_t{kProducers} * kItemsPerProducer);
+        std::atomic<uint32_t> consumed{0};
+        std::atomic<bool> ordered{true};
+
+        std::vector<std::thread> threads;
+        for (uint32_t p = 0; p < kProducers; ++p)
+        {
+            threads.emplace_back([&, p] {
+                for (uint32_t i = 0; i < kItemsPerProducer; ++i)
+                {
+                    while (!queue.tryPush(encode(p, i)))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (uint32_t c = 0; c < kConsumers; ++c)
+        {
+            threads.emplace_back([&] {
+                // 한 소비자가 본 값은 생산자별로 순번이 늘어나야 합니다.
+                std::vector<int64_t> last(kProducers, -1);
+                while (consumed.load(std::memory_order_relaxed) < kProducers * kItemsPerProducer)
+                {
+                    uint64_t value;
+                    if (!queue.tryPop(value))
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    const uint32_t producer = static_cast<uint32_t>(value >> 32);
+                    const uint32_t index = static_cast<uint32_t>(value);
+                    if (int64_t{index} <= last[producer])
+                    {
+                        ordered.store(false);
+                    }
+                    last[producer] = index;
+                    seen[size_t{producer} * kItemsPerProducer + index].fetch_add(1);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        bool once = true;
+        for (const std::atomic<uint8_t>& count : seen)
+        {
+            once = once && count.load() == 1;
+        }
+        AXIS_CHECK(t, once);
+        AXIS_CHECK(t, ordered.load());
+        AXIS_CHECK(t, queue.sizeApprox() == 0);
+    }
+
+    struct Message : MpscNode
+    {
+        uint64_t value = 0;
+    };
+
+    void mpscDeliversEveryValueOnce(TestContext& t)
+    {
+        MpscQueue<Message> queue;
+        AXIS_CHECK(t, queue.tryPop() == nullptr);
+        AXIS_CHECK(t, queue.emptyApprox());
+
+        std::unique_ptr<Message[]> messages(new Message[size_t{kProducers} * kItemsPerProducer]);
+        std::vector<std::thread> producers;
+        for (uint32_t p = 0; p < kProducers; ++p)
+        {
+            producers.emplace_back([&, p] {
+                for (uint32_t i = 0; i < kItemsPerProducer; ++i)
+                {
+                    Message& message = messages[size_t{p} * kItemsPerProducer + i];
+                    message.value = encode(p, i);
+                    queue.push(message);
+                }
+            });
+        }
+
+        // tryPop은 생산자가 push 도중이면 잠시 nullptr을 돌려줄 수 있으므로 개수가 찰 때까지 다시 봅니다.
+        std::vector<int64_t> last(kProducers, -1);
+        bool ordered = true;
+        uint32_t received = 0;
+        while (received < kProducers * kItemsPerProducer)
+        {
+            Message* message = queue.tryPop();
+            if (message == nullptr)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            const uint32_t producer = static_cast<uint32_t>(message->value >> 32);
+            const uint32_t index = static_cast<uint32_t>(message->value);
+            ordered = ordered && int64_t{index} == last[producer] + 1;
+            last[producer] = index;
+            ++received;
+        }
+        for (std::thread& thread : producers)
+        {
+            thread.join();
+        }
+
+        AXIS_CHECK(t, ordered);
+        AXIS_CHECK(t, queue.tryPop() == nullptr);
+
+        // 꺼낸 노드는 다시 넣을 수 있어야 합니다.
+        queue.push(messages[0]);
+        AXIS_CHECK(t, queue.tryPop() == &messages[0]);
+        AXIS_CHECK(t, queue.tryPop() == nullptr);
+    }
+}
+
+AXIS_TEST("core.queue.spsc_full_and_empty", spscFullAndEmpty);
+AXIS_TEST("core.queue.spsc_keeps_order_across_threads", spscKeepsOrderAcrossThreads);
+AXIS_TEST("core.queue.mpmc_full_and_empty", mpmcFullAndEmpty);
+AXIS_TEST("core.queue.mpmc_destroys_remaining_values", mpmcDestroysRemainingValues);
+AXIS_TEST("core.queue.mpmc_delivers_every_value_once", mpmcDeliversEveryValueOnce);
+AXIS_TEST("core.queue.mpsc_delivers_every_value_once", mpscDeliversEveryValueOnce);
@@ -0,0 +1,266 @@
+// 스냅숏과 델타 검사. 스냅숏은 같은 레이아웃의 무복사 읽기와 바뀐 레이아웃의 변환을, 델타는 왕복과
+// 믿을 수 없는 입력(잘못된 base, 잘린 델타, 부풀린 targetSize)의 거부를 봅니다.
+
+#include "Test.h"
+
+#include "axis/utils/Serialization.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    struct TestPointV1
+    {
+        float x;
+        float y;
+        uint32_t id;
+    };
+
+    // 필드 순서를 바꾸고 z, flags를 더한 다음 버전.
+    struct TestPointV2
+    {
+        uint32_t id = 0;
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 5.0f;
+        uint32_t flags = 0;
+    };
+}
+
+namespace axis
+{
+    template <>
+    struct SerialSchema<TestPointV1>
+    {
+        static constexpr const char* name = "TestPoint";
+        static constexpr uint32_t version = 1;
+        static constexpr auto fields = serialFields(serialField("x", &TestPointV1::x),
+                                                    serialField("y", &TestPointV1::y),
+                                                    serialField("id", &TestPointV1::id));
+    };
+
+    template <>
+    struct SerialSchema<TestPointV2>
+    {
+        static constexpr const char* name = "TestPoint";
+        static constexpr uint32_t version = 2;
+        static constexpr auto fields =
+            serialFields(serialField("id", &TestPointV2::id), serialField("x", &TestPointV2::x),
+                         serialField("y", &TestPointV2::y), serialField("z", &TestPointV2::z),
+                         serialField("flags", &TestPointV2::flags));
+
+        static void upgrade(TestPointV2& value, uint32_t storedVersion)
+        {
+            if (storedVersion < 2)
+            {
+                value.flags = 0x100;
+            }
+        }
+    };
+}
+
+namespace
+{
+    using namespace axis;
+    using namespace axis::test;
+
+    constexpr uint64_t kPointsKey = 1;
+    constexpr uint64_t kBlobKey = 7;
+
+    std::vector<TestPointV1> makePoints(uint32_t count)
+    {
+        std::vector<TestPointV1> points(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            points[i] = TestPointV1{static_cast<float>(i), static_cast<float>(i) * 2.0f, i};
+        }
+        return points;
+    }
+
+    std::vector<uint8_t> makeSnapshot(const std::vector<TestPointV1>& points)
+    {
+        static const char kBlob[] = "axis";
+        SnapshotWriter writer;
+        writer.add(kPointsKey, points.data(), static_cast<uint32_t>(points.size()));
+        writer.addBlob(kBlobKey, kBlob, sizeof(kBlob));
+        std::vector<uint8_t> bytes;
+        writer.finish(bytes);
+        return bytes;
+    }
+
+    std::vector<uint8_t> pattern(size_t size, uint8_t seed)
+    {
+        std::vector<uint8_t> bytes(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            bytes[i] = static_cast<uint8_t>(seed + i * 31);
+        }
+        return bytes;
+    }
+
+    bool roundTrips(const std::vector<uint8_t>& base, const std::vector<uint8_t>& target)
+    {
+        std::vector<uint8_t> delta;
+        std::vector<uint8_t> out;
+        encodeDelta(base.data(), base.size(), target.data(), target.size(), delta);
+        return applyDelta(base.data(), base.size(), delta.data(), delta.size(), out) && out == target;
+    }
+
+    void snapshotReadsSameLayoutWithoutCopy(TestContext& t)
+    {
+        const std::vector<TestPointV1> points = makePoints(1000);
+        SnapshotWriter writer;
+        AXIS_CHECK(t, writer.add(kPointsKey, points.data(), static_cast<uint32_t>(points.size())));
+        AXIS_CHECK(t, !writer.add(kPointsKey, points.data(), 1));
+        std::vector<uint8_t> bytes;
+        writer.finish(bytes);
+        AXIS_CHECK(t, bytes.size() == writer.size());
+
+        // finish의 벡터는 64바이트 정렬이 아닐 수 있으므로 정렬된 사본에서 엽니다.
+        std::vector<uint64_t> aligned((bytes.size() + 7) / 8 + kSnapshotAlignment / 8);
+        uint8_t* base = reinterpret_cast<uint8_t*>(aligned.data());
+        base += (kSnapshotAlignment - reinterpret_cast<uintptr_t>(base) % kSnapshotAlignment) % kSnapshotAlignment;
+        std::memcpy(base, bytes.data(), bytes.size());
+
+        SnapshotReader reader;
+        AXIS_REQUIRE(t, reader.open(base, bytes.size()));
+        SerialArray<TestPointV1> read;
+        AXIS_REQUIRE(t, reader.read(kPointsKey, read));
+        AXIS_CHECK(t, read.isZeroCopy());
+        AXIS_REQUIRE(t, read.size() == points.size());
+        AXIS_CHECK(t, std::memcmp(read.data(), points.data(), sizeof(TestPointV1) * points.size()) == 0);
+        AXIS_CHECK(t, !reader.contains(kBlobKey));
+    }
+
+    void snapshotConvertsChangedLayout(TestContext& t)
+    {
+        const std::vector<TestPointV1> points = makePoints(300);
+        const std::vector<uint8_t> bytes = makeSnapshot(points);
+
+        SnapshotReader reader;
+        AXIS_REQUIRE(t, reader.open(bytes.data(), bytes.size()));
+        SerialArray<TestPointV2> read;
+        AXIS_REQUIRE(t, reader.read(kPointsKey, read));
+        AXIS_CHECK(t, !read.isZeroCopy());
+        AXIS_REQUIRE(t, read.size() == points.size());
+        bool converted = true;
+        for (uint32_t i = 0; i < read.size(); ++i)
+        {
+            // 이름이 같은 필드는 옮기고, 새 필드는 기본값에 upgrade를 적용한 값이어야 합니다.
+            converted = converted && read[i].id == points[i].id && read[i].x == points[i].x &&
+                        read[i].y == points[i].y && read[i].z == 5.0f && read[i].flags == 0x100;
+        }
+        AXIS_CHECK(t, converted);
+
+        uint64_t blobSize = 0;
+        const char* blob = static_cast<const char*>(reader.blob(kBlobKey, blobSize));
+        AXIS_CHECK(t, blob != nullptr && blobSize == 5 && std::strcmp(blob, "axis") == 0);
+        // 원시 구역은 타입 배열로 읽을 수 없습니다.
+        AXIS_CHECK(t, !reader.read(kBlobKey, read));
+    }
+
+    void snapshotRejectsCorruptHeader(TestContext& t)
+    {
+        std::vector<uint8_t> bytes = makeSnapshot(makePoints(10));
+        SnapshotReader reader;
+        AXIS_CHECK(t, !reader.open(bytes.data(), bytes.size() - 1));
+        bytes[0] ^= 0xFF;
+        AXIS_CHECK(t, !reader.open(bytes.data(), bytes.size()));
+
+        // 레코드 크기 × 개수가 구역 크기와 정확히 맞지 않는 구역은 거부해야 합니다. 키 순이므로 첫 구역이 점 배열입니다.
+        bytes = makeSnapshot(makePoints(10));
+        SnapshotHeader header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        SnapshotSection section;
+        std::memcpy(&section, bytes.data() + header.sectionsOffset, sizeof(section));
+        AXIS_REQUIRE(t, section.key == kPointsKey);
+        section.count -= 1;
+        std::memcpy(bytes.data() + header.sectionsOffset, &section, sizeof(section));
+        AXIS_CHECK(t, !reader.open(bytes.data(), bytes.size()));
+    }
+
+    void deltaRoundTripsConsecutiveSnapshots(TestContext& t)
+    {
+        std::vector<TestPointV1> points = makePoints(20000);
+        const std::vector<uint8_t> before = makeSnapshot(points);
+        for (uint32_t i = 0; i < 50; ++i)
+        {
+            points[i * 400].x += 1.0f;
+        }
+        const std::vector<uint8_t> after = makeSnapshot(points);
+
+        std::vector<uint8_t> delta;
+        std::vector<uint8_t> out;
+        encodeDelta(before.data(), before.size(), after.data(), after.size(), delta);
+        AXIS_CHECK(t, applyDelta(before.data(), before.size(), delta.data(), delta.size(), out));
+        AXIS_CHECK(t, out == after);
+        // 바뀐 단어 50개 정도만 남아야 합니다.
+        AXIS_CHECK(t, delta.size() < after.size() / 50);
+
+        // 같은 바이트열의 델타는 헤더뿐입니다.
+        encodeDelta(after.data(), after.size(), after.data(), after.size(), delta);
+        AXIS_CHECK(t, delta.size() == 32);
+        AXIS_CHECK(t, roundTrips(after, after));
+    }
+
+    void deltaRoundTripsSizeChanges(TestContext& t)
+    {
+        // 8의 배수가 아닌 크기로 늘이고 줄이며, 늘어난 부분이 0인 경우도 봅니다.
+        AXIS_CHECK(t, roundTrips(pattern(13, 1), pattern(29, 2)));
+        AXIS_CHECK(t, roundTrips(pattern(29, 2), pattern(13, 1)));
+        AXIS_CHECK(t, roundTrips(pattern(100, 3), std::vector<uint8_t>(1000, 0)));
+        AXIS_CHECK(t, roundTrips(pattern(64, 4), pattern(61, 4)));
+        AXIS_CHECK(t, roundTrips(std::vector<uint8_t>(), pattern(17, 5)));
+        AXIS_CHECK(t, roundTrips(pattern(17, 5), std::vector<uint8_t>()));
+    }
+
+    void deltaRejectsUntrustedInput(TestContext& t)
+    {
+        const std::vector<uint8_t> base = pattern(1000, 6);
+        std::vector<uint8_t> target = base;
+        target[10] ^= 1;
+        target[900] ^= 1;
+        target.resize(1200, 7);
+
+        std::vector<uint8_t> delta;
+        std::vector<uint8_t> out;
+        encodeDelta(base.data(), base.size(), target.data(), target.size(), delta);
+        AXIS_REQUIRE(t, applyDelta(base.data(), base.size(), delta.data(), delta.size(), out));
+
+        // base가 다르면(내용 또는 크기) 거부합니다.
+        std::vector<uint8_t> otherBase = base;
+        otherBase[500] ^= 1;
+        AXIS_CHECK(t, !applyDelta(otherBase.data(), otherBase.size(), delta.data(), delta.size(), out));
+        AXIS_CHECK(t, !applyDelta(base.data(), base.size() - 1, delta.data(), delta.size(), out));
+
+        // 늘어난 단어는 델타 끝의 리터럴에 있으므로, 잘린 델타는 어느 지점에서 잘려도 거부합니다.
+        bool truncatedRejected = true;
+        for (size_t size = 0; size < delta.size(); ++size)
+        {
+            truncatedRejected = truncatedRejected && !applyDelta(base.data(), base.size(), delta.data(), size, out);
+        }
+        AXIS_CHECK(t, truncatedRejected);
+
+        // 헤더의 targetSize만 부풀린 델타는 큰 버퍼를 잡기 전에 거부합니다.
+        std::vector<uint8_t> inflated = delta;
+        const uint64_t huge = uint64_t{1} << 40;
+        std::memcpy(inflated.data() + 16, &huge, sizeof(huge));
+        AXIS_CHECK(t, !applyDelta(base.data(), base.size(), inflated.data(), inflated.size(), out));
+
+        // 건너뛰기가 target 끝을 넘는 델타도 거부합니다.
+        std::vector<uint8_t> overrun(delta.begin(), delta.begin() + 32);
+        overrun.push_back(0xFF);
+        overrun.push_back(0x7F);
+        overrun.push_back(0);
+        AXIS_CHECK(t, !applyDelta(base.data(), base.size(), overrun.data(), overrun.size(), out));
+    }
+}
+
+AXIS_TEST("utils.snapshot.reads_same_layout_without_copy", snapshotReadsSameLayoutWithoutCopy);
+AXIS_TEST("utils.snapshot.converts_changed_layout", snapshotConvertsChangedLayout);
+AXIS_TEST("utils.snapshot.rejects_corrupt_header", snapshotRejectsCorruptHeader);
+AXIS_TEST("utils.delta.round_trips_consecutive_snapshots", deltaRoundTripsConsecutiveSnapshots);
+AXIS_TEST("utils.delta.round_trips_size_changes", deltaRoundTripsSizeChanges);
+AXIS_TEST("utils.delta.rejects_untrusted_input", deltaRejectsUntrustedInput);
@@ -0,0 +1,67 @@
+#pragma once
+
+// axis-tests 실행 파일의 검사 도구.
+//
+// 각 *Tests.cpp가 AXIS_TEST로 테스트 함수를 등록하고, TestMain.cpp가 실행과 결과 출력을 맡습니다.
+// 테스트는 TestContext로 실패를 기록합니다. AXIS_CHECK는 실패를 남기고 계속 진행하며, AXIS_REQUIRE는 실패하면
+// 그 테스트 함수를 바로 끝냅니다(뒤의 검사가 앞의 결과에 기대는 경우에 씁니다).
+
+#include <cstdint>
+#include <vector>
+
+namespace axis::test
+{
+    class TestContext
+    {
+    public:
+        // 실패 위치와 식을 표준 오류에 쓰고 실패 수를 셉니다.
+        void fail(const char* expression, const char* file, int line);
+
+        uint32_t failures() const { return m_failures; }
+
+    private:
+        uint32_t m_failures = 0;
+    };
+
+    using TestFunction = void (*)(TestContext& context);
+
+    struct TestEntry
+    {
+        const char* name;
+        TestFunction function;
+    };
+
+    // 등록된 테스트 목록. 정적 초기화 순서와 무관하도록 함수 안의 정적 변수로 둡니다.
+    std::vector<TestEntry>& registry();
+
+    struct Registrar
+    {
+        Registrar(const char* name, TestFunction function) { registry().push_back({name, function}); }
+    };
+}
+
+#define AXIS_TEST_CONCAT_INNER(a, b) a##b
+#define AXIS_TEST_CONCAT(a, b) AXIS_TEST_CONCAT_INNER(a, b)
+
+// 이름은 "모듈.대상.동작" 형태로 짓습니다. --filter는 이름의 부분 문자열로 고릅니다.
+#define AXIS_TEST(name, function) \
+    static const ::axis::test::Registrar AXIS_TEST_CONCAT(s_test, __LINE__)(name, function)
+
+#define AXIS_CHECK(context, condition)                      \
+    do                                                      \
+    {                                                       \
+        if (!(condition))                                   \
+        {                                                   \
+            (context).fail(#condition, __FILE__, __LINE__); \
+        }                                                   \
+    } while (false)
+
+#define AXIS_REQUIRE(context, condition)                    \
+    do                                                      \
+    {                                                       \
+        if (!(condition))                                   \
+        {                                                   \
+            (context).fail(#condition, __FILE__, __LINE__); \
+            return;                                         \
+        }                                                   \
+    } while (false)
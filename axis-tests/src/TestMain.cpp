@@ -0,0 +1,88 @@
+// axis-tests: 핵심 구조들의 단위 테스트.
+//
+// 등록된 테스트를 이름 순으로 실행하고 결과를 표준 오류에 씁니다. 하나라도 실패하면 종료 코드 1을 반환합니다.
+//
+// 사용법: axis-tests [--filter 문자열] [--list]
+//
+// 실행 파일은 src/의 모든 .cpp(이 파일과 *Tests.cpp)로 만들며, 검사하는 모듈을 모두 링크합니다.
+// 테스트가 만드는 임시 파일은 현재 디렉터리에 두고 끝나면 지웁니다.
+
+#include "Test.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace axis::test
+{
+    void TestContext::fail(const char* expression, const char* file, int line)
+    {
+        std::fprintf(stderr, "    %s:%d: 실패: %s\n", file, line, expression);
+        ++m_failures;
+    }
+
+    std::vector<TestEntry>& registry()
+    {
+        static std::vector<TestEntry> s_registry;
+        return s_registry;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace axis::test;
+
+    const char* filter = nullptr;
+    bool list = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+        {
+            filter = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--list") == 0)
+        {
+            list = true;
+        }
+        else
+        {
+            std::fprintf(stderr, "알 수 없는 인자: %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    // 등록 순서는 링크 순서를 따르므로 이름 순으로 정렬해 실행마다 같은 순서를 보장합니다.
+    std::vector<TestEntry> tests = registry();
+    std::sort(tests.begin(), tests.end(),
+              [](const TestEntry& a, const TestEntry& b) { return std::strcmp(a.name, b.name) < 0; });
+
+    uint32_t run = 0;
+    uint32_t failed = 0;
+    for (const TestEntry& entry : tests)
+    {
+        if (filter != nullptr && std::strstr(entry.name, filter) == nullptr)
+        {
+            continue;
+        }
+        if (list)
+        {
+            std::printf("%s\n", entry.name);
+            continue;
+        }
+
+        TestContext context;
+        entry.function(context);
+        ++run;
+        if (context.failures() != 0)
+        {
+            ++failed;
+        }
+        std::fprintf(stderr, "[%s] %s\n", context.failures() == 0 ? " ok " : "FAIL", entry.name);
+    }
+
+    if (!list)
+    {
+        std::fprintf(stderr, "%u개 중 %u개 실패\n", run, failed);
+    }
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "axis/utils/Export.h"
+#include "axis/utils/MemoryBudget.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace axis
+{
+    constexpr size_t kDefaultAlignment = alignof(std::max_align_t);
+
+    constexpr size_t alignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    // 할당자 안의 빈 공간 분포. 빈 바이트가 많아도 가장 큰 빈 블록이 작으면 큰 요청은 실패하거나 풀을 늘립니다.
+    struct FragmentationStats
+    {
+        uint64_t reservedBytes = 0;
+        uint64_t usedBytes = 0;
+        uint64_t freeBytes = 0;
+        uint64_t largestFreeBlock = 0;
+        uint32_t freeBlocks = 0;
+
+        // 0이면 빈 공간이 한 덩어리, 1에 가까울수록 잘게 흩어져 있습니다.
+        double ratio() const
+        {
+            return freeBytes != 0 ? 1.0 - static_cast<double>(largestFreeBlock) / static_cast<double>(freeBytes) : 0.0;
+        }
+    };
+
+    // 명시적 할당자 인터페이스.
+    //
+    // 모든 할당자는 예산 태그를 가지며, 확보한 메모리와 나누어 준 메모리를 MemoryBudget에 보고합니다.
+    // deallocate의 size는 allocate에 넘긴 값과 같아야 합니다.
+    class AXIS_UTILS_API Allocator
+    {
+    public:
+        explicit Allocator(BudgetTag tag)
+            : m_tag(tag)
+        {
+        }
+        virtual ~Allocator() = default;
+
+        Allocator(const Allocator&) = delete;
+        Allocator& operator=(const Allocator&) = delete;
+
+        // 실패하면 nullptr. 예외를 던지지 않습니다.
+        virtual void* allocate(size_t size, size_t alignment = kDefaultAlignment) = 0;
+        virtual void deallocate(void* ptr, size_t size) = 0;
+
+        virtual const char* name() const = 0;
+
+        // 빈 공간 분포를 알 수 있는 할당자만 true를 반환합니다. 전체를 순회할 수 있으므로 진단용입니다.
+        virtual bool queryFragmentation(FragmentationStats& out)
+        {
+            (void)out;
+            return false;
+        }
+
+        BudgetTag tag() const { return m_tag; }
+
+        template <typename T, typename... Args>
+        T* create(Args&&... args)
+        {
+            void* memory = allocate(sizeof(T), alignof(T));
+            return memory != nullptr ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+        }
+
+        template <typename T>
+        void destroy(T* object)
+        {
+            if (object != nullptr)
+            {
+                object->~T();
+                deallocate(object, sizeof(T));
+            }
+        }
+
+    private:
+        BudgetTag m_tag;
+    };
+
+    // 전역 힙을 감싸는 할당자. 태그만 다르게 두고 싶을 때 사용합니다.
+    class AXIS_UTILS_API SystemAllocator final : public Allocator
+    {
+    public:
+        explicit SystemAllocator(BudgetTag tag = kUntaggedBudget)
+            : Allocator(tag)
+        {
+        }
+
+        void* allocate(size_t size, size_t alignment = kDefaultAlignment) override;
+        void deallocate(void* ptr, size_t size) override;
+        const char* name() const override { return "SystemAllocator"; }
+    };
+
+    // 할당자를 지정하지 않았을 때 사용하는 프로세스 전역 SystemAllocator.
+    AXIS_UTILS_API Allocator& defaultAllocator();
+
+    // STL 컨테이너용 어댑터. 할당자를 가리키기만 하며 소유하지 않습니다.
+    template <typename T>
+    class StlAllocator
+    {
+    public:
+        using value_type = T;
+
+        StlAllocator() noexcept
+            : m_allocator(&defaultAllocator())
+        {
+        }
+
+        StlAllocator(Allocator& allocator) noexcept
+            : m_allocator(&allocator)
+        {
+        }
+
+        template <typename U>
+        StlAllocator(const StlAllocator<U>& other) noexcept
+            : m_allocator(other.allocator())
+        {
+        }
+
+        T* allocate(size_t count)
+        {
+            void* memory = m_allocator->allocate(count * sizeof(T), alignof(T));
+            if (memory == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(memory);
+        }
+
+        void deallocate(T* ptr, size_t count) noexcept { m_allocator->deallocate(ptr, count * sizeof(T)); }
+
+        Allocator* allocator() const noexcept { return m_allocator; }
+
+        template <typename U>
+        friend bool operator==(const StlAllocator& a, const StlAllocator<U>& b) noexcept
+        {
+            return a.m_allocator == b.allocator();
+        }
+
+        template <typename U>
+        friend bool operator!=(const StlAllocator& a, const StlAllocator<U>& b) noexcept
+        {
+            return !(a == b);
+        }
+
+    private:
+        Allocator* m_allocator;
+    };
+}
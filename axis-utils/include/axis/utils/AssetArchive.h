@@ -0,0 +1,135 @@
+#pragma once
+
+#include "axis/platform/MappedFile.h"
+#include "axis/utils/Export.h"
+#include "axis/utils/StringId.h"
+
+#include <cstdint>
+
+namespace axis
+{
+    // 패킹된 에셋 아카이브 형식 (리틀 엔디언).
+    //
+    //   [ArchiveHeader 64B][blob][blob]...[ArchiveEntry 표][ArchiveChunk 표][이름 표]
+    //
+    // blob은 모두 64바이트 경계에서 시작합니다. 표는 오프셋만으로 서로를 가리키므로
+    // 매핑한 파일을 그대로 구조체 배열로 읽으며, 열 때 파싱하거나 복사하는 단계가 없습니다.
+    // 항목 표는 이름 해시 순으로 정렬되어 있어 이진 탐색으로 찾습니다.
+
+    constexpr uint32_t kArchiveMagic = 0x52415841u; // "AXAR"
+    constexpr uint32_t kArchiveVersion = 1;
+    constexpr uint32_t kArchiveAlignment = 64;
+    constexpr uint32_t kArchiveDefaultChunkSize = 64 * 1024;
+
+    enum class ArchiveCompression : uint8_t
+    {
+        None,
+        Lz4,
+        Zstd,
+    };
+
+    struct ArchiveHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t chunkCount;
+        uint64_t entriesOffset;
+        uint64_t chunksOffset;
+        uint64_t namesOffset;
+        uint64_t namesSize;
+        uint64_t fileSize;
+        uint64_t reserved;
+    };
+
+    // chunkCount가 0이면 압축되지 않은 항목이며 [offset, offset + size)에 원본이 그대로 있습니다.
+    // 그렇지 않으면 원본을 chunkSize 단위로 나눠 조각마다 따로 압축한 것입니다.
+    struct ArchiveEntry
+    {
+        uint64_t nameHash;
+        uint64_t offset;
+        uint64_t size;
+        uint64_t storedSize;
+        uint32_t nameOffset;
+        uint32_t firstChunk;
+        uint32_t chunkCount;
+        uint32_t chunkSize;
+    };
+
+    // 압축해도 줄지 않은 조각은 None으로 저장됩니다.
+    struct ArchiveChunk
+    {
+        uint64_t offset;
+        uint32_t storedSize;
+        uint32_t size;
+        ArchiveCompression compression;
+        uint8_t reserved[7];
+    };
+
+    static_assert(sizeof(ArchiveHeader) == 64);
+    static_assert(sizeof(ArchiveEntry) == 48);
+    static_assert(sizeof(ArchiveChunk) == 24);
+
+    // 아카이브 이름 해시 (64비트 FNV-1a). StringId의 값과 같으므로 "name"_sid로 바로 찾을 수 있습니다.
+    constexpr uint64_t archiveNameHash(const char* name) { return fnv1a64(name); }
+
+    // 이 빌드에서 해당 코덱을 풀 수 있는지. AXIS_UTILS_WITH_LZ4 / AXIS_UTILS_WITH_ZSTD로 켭니다.
+    AXIS_UTILS_API bool isArchiveCompressionAvailable(ArchiveCompression compression);
+
+    // 메모리 매핑 기반 아카이브 리더.
+    // 압축되지 않은 항목은 매핑 안을 직접 가리키는 포인터로 내어 주며, 그 수명은 아카이브가 열려 있는 동안입니다.
+    // 모든 const 메서드는 여러 스레드에서 동시에 호출할 수 있습니다.
+    class AXIS_UTILS_API AssetArchive
+    {
+    public:
+        AssetArchive() = default;
+        ~AssetArchive() = default;
+
+        AssetArchive(const AssetArchive&) = delete;
+        AssetArchive& operator=(const AssetArchive&) = delete;
+
+        // 머리글과 표 범위만 검사합니다. 형식이 맞지 않으면 false.
+        bool open(const char* path);
+        void close();
+        bool isOpen() const { return m_header != nullptr; }
+
+        uint32_t entryCount() const { return m_header != nullptr ? m_header->entryCount : 0; }
+        const ArchiveEntry& entry(uint32_t index) const { return m_entries[index]; }
+
+        const ArchiveEntry* find(uint64_t nameHash) const;
+        const ArchiveEntry* find(StringId name) const { return find(name.value()); }
+        const ArchiveEntry* find(const char* name) const { return find(archiveNameHash(name)); }
+        const char* name(const ArchiveEntry& entry) const { return m_names + entry.nameOffset; }
+
+        static bool isCompressed(const ArchiveEntry& entry) { return entry.chunkCount != 0; }
+
+        // 원본 그대로 저장된 항목의 데이터. 압축되지 않은 항목과, 조각이 모두 None으로 저장된 항목이 해당합니다.
+        // 압축된 조각이 하나라도 있으면 nullptr.
+        const void* data(const ArchiveEntry& entry) const;
+
+        // 항목 전체를 dst로 풉니다(압축되지 않았다면 복사합니다). dstSize는 entry.size 이상이어야 합니다.
+        bool read(const ArchiveEntry& entry, void* dst, uint64_t dstSize) const;
+
+        // 조각 단위 읽기. 스트리밍에서 조각마다 작업을 나눌 때 씁니다.
+        const ArchiveChunk& chunk(const ArchiveEntry& entry, uint32_t index) const
+        {
+            return m_chunks[entry.firstChunk + index];
+        }
+        bool readChunk(const ArchiveEntry& entry, uint32_t index, void* dst, uint32_t dstSize) const;
+
+        // 항목이 차지하는 페이지를 미리 읽도록 OS에 알립니다.
+        void prefetch(const ArchiveEntry& entry) const { m_file.prefetch(entry.offset, entry.storedSize); }
+
+        const MappedFile& file() const { return m_file; }
+
+    private:
+        // 항목의 조각 범위가 조각 표 안에 있는지.
+        bool chunksInRange(const ArchiveEntry& entry) const;
+
+        MappedFile m_file;
+        const ArchiveHeader* m_header = nullptr;
+        const ArchiveEntry* m_entries = nullptr;
+        const ArchiveChunk* m_chunks = nullptr;
+        const char* m_names = nullptr;
+    };
+}
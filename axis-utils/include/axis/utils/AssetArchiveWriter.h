@@ -0,0 +1,49 @@
+#pragma once
+
+#include "axis/utils/AssetArchive.h"
+#include "axis/utils/Export.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace axis
+{
+    // 빌드 도구용 아카이브 작성기. 추가한 데이터는 write까지 메모리에 보관됩니다.
+    class AXIS_UTILS_API AssetArchiveWriter
+    {
+    public:
+        // 이름 해시가 이미 있는 이름과 겹치면 false.
+        // 이 빌드에서 쓸 수 없는 코덱을 고르면 압축 없이 저장합니다.
+        bool add(const char* name, const void* data, uint64_t size,
+                 ArchiveCompression compression = ArchiveCompression::None,
+                 uint32_t chunkSize = kArchiveDefaultChunkSize);
+
+        bool write(const char* path) const;
+
+        uint32_t entryCount() const { return static_cast<uint32_t>(m_entries.size()); }
+
+    private:
+        struct PendingChunk
+        {
+            uint64_t blobOffset;
+            uint32_t storedSize;
+            uint32_t size;
+            ArchiveCompression compression;
+        };
+
+        struct PendingEntry
+        {
+            std::string name;
+            uint64_t nameHash;
+            uint64_t size;
+            uint64_t blobOffset;
+            uint64_t storedSize;
+            uint32_t chunkSize;
+            std::vector<PendingChunk> chunks;
+        };
+
+        std::vector<PendingEntry> m_entries;
+        std::vector<uint8_t> m_blobs;
+    };
+}
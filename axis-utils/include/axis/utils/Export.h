@@ -0,0 +1,22 @@
+#pragma once
+
+// axis-utils DLL 경계 매크로.
+// axis-utils를 빌드하는 프로젝트는 AXIS_UTILS_EXPORTS를,
+// 정적 라이브러리로 사용하는 경우 AXIS_UTILS_STATIC을 정의합니다.
+
+#if defined(AXIS_UTILS_STATIC)
+    #define AXIS_UTILS_API
+#elif defined(_WIN32)
+    #if defined(AXIS_UTILS_EXPORTS)
+        #define AXIS_UTILS_API __declspec(dllexport)
+    #else
+        #define AXIS_UTILS_API __declspec(dllimport)
+    #endif
+#else
+    #define AXIS_UTILS_API __attribute__((visibility("default")))
+#endif
+
+#if defined(_MSC_VER)
+    // STL 멤버를 가진 클래스를 내보낼 때의 경고. AXIS 모듈은 동일한 CRT를 전제로 빌드됩니다.
+    #pragma warning(disable : 4251)
+#endif
@@ -0,0 +1,658 @@
+#pragma once
+
+#include "axis/utils/Allocator.h"
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define AXIS_FLAT_HASH_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define AXIS_FLAT_HASH_SSE2 0
+#endif
+
+namespace axis
+{
+    namespace detail
+    {
+        // 제어 바이트. 채워진 슬롯은 해시 하위 7비트(0..127)를, 빈 슬롯과 지운 슬롯은 음수를 가집니다.
+        constexpr int8_t kCtrlEmpty = -128;
+        constexpr int8_t kCtrlDeleted = -2;
+
+        // 그룹 안에서 조건을 만족하는 슬롯 비트 집합. 가장 낮은 비트부터 꺼냅니다.
+        template <uint32_t Shift>
+        class CtrlMask
+        {
+        public:
+            explicit CtrlMask(uint64_t bits)
+                : m_bits(bits)
+            {
+            }
+
+            explicit operator bool() const { return m_bits != 0; }
+            uint32_t lowest() const { return static_cast<uint32_t>(std::countr_zero(m_bits)) >> Shift; }
+            uint32_t highest() const { return static_cast<uint32_t>(63 - std::countl_zero(m_bits)) >> Shift; }
+            void clearLowest() { m_bits &= m_bits - 1; }
+
+        private:
+            uint64_t m_bits;
+        };
+
+#if AXIS_FLAT_HASH_SSE2
+        // 16개 제어 바이트를 한 번에 비교합니다.
+        struct CtrlGroup
+        {
+            static constexpr uint32_t kWidth = 16;
+            using Mask = CtrlMask<0>;
+
+            explicit CtrlGroup(const int8_t* ctrl)
+                : bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+            {
+            }
+
+            Mask match(int8_t h2) const
+            {
+                return Mask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), bytes))));
+            }
+
+            Mask matchEmpty() const
+            {
+                return Mask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(kCtrlEmpty), bytes))));
+            }
+
+            // 부호 비트가 곧 비어 있거나 지운 슬롯 표시입니다.
+            Mask matchEmptyOrDeleted() const { return Mask(static_cast<uint32_t>(_mm_movemask_epi8(bytes))); }
+
+            __m128i bytes;
+        };
+#else
+        // SIMD가 없을 때 8개 제어 바이트를 64비트 정수 하나로 비교합니다.
+        // match는 드물게 거짓 양성을 내지만 호출하는 쪽이 키를 다시 비교하므로 결과에는 영향이 없습니다.
+        struct CtrlGroup
+        {
+            static constexpr uint32_t kWidth = 8;
+            using Mask = CtrlMask<3>;
+
+            static constexpr uint64_t kLsbs = 0x0101010101010101ull;
+            static constexpr uint64_t kMsbs = 0x8080808080808080ull;
+
+            // 바이트 순서와 무관하게 i번째 슬롯이 i번째 바이트가 되도록 조립합니다.
+            explicit CtrlGroup(const int8_t* ctrl)
+            {
+                bytes = 0;
+                for (uint32_t i = 0; i < kWidth; ++i)
+                {
+                    bytes |= static_cast<uint64_t>(static_cast<uint8_t>(ctrl[i])) << (i * 8);
+                }
+            }
+
+            Mask match(int8_t h2) const
+            {
+                const uint64_t x = bytes ^ (kLsbs * static_cast<uint8_t>(h2));
+                return Mask((x - kLsbs) & ~x & kMsbs);
+            }
+
+            // 0x80(빈 슬롯)만 비트 1이 0이고 최상위 비트가 1입니다.
+            Mask matchEmpty() const { return Mask(bytes & ~(bytes << 6) & kMsbs); }
+            Mask matchEmptyOrDeleted() const { return Mask(bytes & kMsbs); }
+
+            uint64_t bytes;
+        };
+#endif
+
+        // 해시 함수의 품질과 무관하게 상위/하위 비트가 고르게 섞이도록 한 번 더 섞습니다.
+        inline uint64_t mixHash(uint64_t hash)
+        {
+            hash ^= hash >> 33;
+            hash *= 0xFF51AFD7ED558CCDull;
+            hash ^= hash >> 33;
+            return hash;
+        }
+
+        // SwissTable 방식 개방 주소법 해시 테이블. FlatHashMap/FlatHashSet의 공통 구현입니다.
+        //
+        // 슬롯마다 1바이트 제어 바이트를 두고, 해시 상위 비트(H1)로 시작 그룹을, 하위 7비트(H2)로 그룹 안의
+        // 후보를 고릅니다. 한 그룹(16 또는 8 슬롯)의 제어 바이트를 한 번에 비교하므로 대부분의 조회는
+        // 제어 바이트 캐시 라인 하나와 슬롯 하나만 읽습니다. 제어 바이트 배열 끝에는 앞쪽 kWidth개를
+        // 복제해 두어 그룹을 경계에서 잘라 읽지 않습니다.
+        // 제어 바이트와 슬롯은 한 번의 할당으로 잡으며, 최대 적재율은 7/8입니다.
+        template <typename Slot, typename Key, typename KeyOf, typename Hash, typename Eq>
+        class FlatTable
+        {
+        public:
+            template <bool Const>
+            class Iterator
+            {
+            public:
+                using Value = std::conditional_t<Const, const Slot, Slot>;
+
+                Iterator() = default;
+
+                Value& operator*() const { return m_table->m_slots[m_index]; }
+                Value* operator->() const { return &m_table->m_slots[m_index]; }
+
+                Iterator& operator++()
+                {
+                    ++m_index;
+                    skipEmpty();
+                    return *this;
+                }
+
+                operator Iterator<true>() const
+                    requires(!Const)
+                {
+                    return Iterator<true>(m_table, m_index);
+                }
+
+                friend bool operator==(const Iterator& a, const Iterator& b) { return a.m_index == b.m_index; }
+                friend bool operator!=(const Iterator& a, const Iterator& b) { return a.m_index != b.m_index; }
+
+            private:
+                friend class FlatTable;
+                template <bool>
+                friend class Iterator;
+                using Table = std::conditional_t<Const, const FlatTable, FlatTable>;
+
+                Iterator(Table* table, size_t index)
+                    : m_table(table)
+                    , m_index(index)
+                {
+                }
+
+                void skipEmpty()
+                {
+                    while (m_index < m_table->m_capacity && m_table->m_ctrl[m_index] < 0)
+                    {
+                        ++m_index;
+                    }
+                }
+
+                Table* m_table = nullptr;
+                size_t m_index = 0;
+            };
+
+            using iterator = Iterator<false>;
+            using const_iterator = Iterator<true>;
+
+            explicit FlatTable(Allocator& allocator)
+                : m_allocator(&allocator)
+            {
+            }
+
+            FlatTable(const FlatTable& other)
+                : m_allocator(other.m_allocator)
+                , m_hash(other.m_hash)
+                , m_eq(other.m_eq)
+            {
+                copyFrom(other);
+            }
+
+            FlatTable(FlatTable&& other) noexcept
+                : m_allocator(other.m_allocator)
+                , m_hash(std::move(other.m_hash))
+                , m_eq(std::move(other.m_eq))
+            {
+                takeFrom(other);
+            }
+
+            FlatTable& operator=(const FlatTable& other)
+            {
+                if (this != &other)
+                {
+                    release();
+                    copyFrom(other);
+                }
+                return *this;
+            }
+
+            FlatTable& operator=(FlatTable&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    release();
+                    m_allocator = other.m_allocator;
+                    takeFrom(other);
+                }
+                return *this;
+            }
+
+            ~FlatTable() { release(); }
+
+            iterator begin()
+            {
+                iterator it(this, 0);
+                it.skipEmpty();
+                return it;
+            }
+            iterator end() { return iterator(this, m_capacity); }
+            const_iterator begin() const
+            {
+                const_iterator it(this, 0);
+                it.skipEmpty();
+                return it;
+            }
+            const_iterator end() const { return const_iterator(this, m_capacity); }
+
+            size_t size() const { return m_size; }
+            bool empty() const { return m_size == 0; }
+            size_t capacity() const { return m_capacity; }
+            Allocator& allocator() const { return *m_allocator; }
+
+            iterator find(const Key& key) { return iterator(this, findIndex(key)); }
+            const_iterator find(const Key& key) const { return const_iterator(this, findIndex(key)); }
+            bool contains(const Key& key) const { return findIndex(key) != m_capacity; }
+
+            // 키가 없을 때만 make(슬롯 메모리)로 새 슬롯을 만듭니다. 할당에 실패하면 {end(), false}.
+            template <typename Make>
+            std::pair<iterator, bool> findOrInsert(const Key& key, Make&& make)
+            {
+                const uint64_t hash = hashOf(key);
+                const size_t found = findIndex(key, hash);
+                if (found != m_capacity)
+                {
+                    return {iterator(this, found), false};
+                }
+
+                if (m_growthLeft == 0 && !grow())
+                {
+                    assert(false && "FlatHashMap 할당에 실패했습니다");
+                    return {end(), false};
+                }
+
+                const size_t index = findInsertSlot(hash);
+                make(static_cast<void*>(m_slots + index));
+                m_growthLeft -= m_ctrl[index] == kCtrlEmpty ? 1 : 0;
+                setCtrl(index, h2(hash));
+                ++m_size;
+                return {iterator(this, index), true};
+            }
+
+            size_t erase(const Key& key)
+            {
+                const size_t index = findIndex(key);
+                if (index == m_capacity)
+                {
+                    return 0;
+                }
+                eraseAt(index);
+                return 1;
+            }
+
+            // 지운 다음 원소를 가리키는 반복자를 반환합니다.
+            iterator erase(const_iterator position)
+            {
+                eraseAt(position.m_index);
+                iterator next(this, position.m_index + 1);
+                next.skipEmpty();
+                return next;
+            }
+
+            // 용량은 유지합니다.
+            void clear()
+            {
+                if (m_capacity == 0)
+                {
+                    return;
+                }
+                destroySlots();
+                std::memset(m_ctrl, static_cast<uint8_t>(kCtrlEmpty), m_capacity + CtrlGroup::kWidth);
+                m_size = 0;
+                m_growthLeft = maxLoad(m_capacity);
+            }
+
+            // count개까지 재해시 없이 넣을 수 있게 합니다. 할당에 실패하면 false.
+            bool reserve(size_t count)
+            {
+                if (count <= m_size + m_growthLeft)
+                {
+                    return true;
+                }
+                size_t capacity = CtrlGroup::kWidth;
+                while (maxLoad(capacity) < count)
+                {
+                    capacity *= 2;
+                }
+                return rehash(capacity);
+            }
+
+        private:
+            static size_t maxLoad(size_t capacity) { return capacity - capacity / 8; }
+            static int8_t h2(uint64_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+            uint64_t hashOf(const Key& key) const { return mixHash(static_cast<uint64_t>(m_hash(key))); }
+
+            size_t findIndex(const Key& key) const { return m_capacity != 0 ? findIndex(key, hashOf(key)) : 0; }
+
+            size_t findIndex(const Key& key, uint64_t hash) const
+            {
+                if (m_capacity == 0)
+                {
+                    return 0;
+                }
+
+                // 그룹 단위 삼각수 탐사. 용량이 2의 거듭제곱이므로 모든 그룹을 한 번씩 방문합니다.
+                const size_t mask = m_capacity - 1;
+                size_t position = static_cast<size_t>(hash >> 7) & mask;
+                for (size_t step = CtrlGroup::kWidth;; step += CtrlGroup::kWidth)
+                {
+                    const CtrlGroup group(m_ctrl + position);
+                    for (auto match = group.match(h2(hash)); match; match.clearLowest())
+                    {
+                        const size_t index = (position + match.lowest()) & mask;
+                        if (m_eq(KeyOf()(m_slots[index]), key))
+                        {
+                            return index;
+                        }
+                    }
+                    if (group.matchEmpty())
+                    {
+                        return m_capacity;
+                    }
+                    position = (position + step) & mask;
+                }
+            }
+
+            size_t findInsertSlot(uint64_t hash) const
+            {
+                const size_t mask = m_capacity - 1;
+                size_t position = static_cast<size_t>(hash >> 7) & mask;
+                for (size_t step = CtrlGroup::kWidth;; step += CtrlGroup::kWidth)
+                {
+                    const auto free = CtrlGroup(m_ctrl + position).matchEmptyOrDeleted();
+                    if (free)
+                    {
+                        return (position + free.lowest()) & mask;
+                    }
+                    position = (position + step) & mask;
+                }
+            }
+
+            void setCtrl(size_t index, int8_t value)
+            {
+                m_ctrl[index] = value;
+                if (index < CtrlGroup::kWidth)
+                {
+                    m_ctrl[m_capacity + index] = value;
+                }
+            }
+
+            void eraseAt(size_t index)
+            {
+                m_slots[index].~Slot();
+                --m_size;
+
+                // 이 슬롯을 품고 빈 슬롯이 하나도 없는 kWidth 폭의 구간이 있었다면 탐사가 이 슬롯을 지나쳐 갔을 수
+                // 있으므로 묘비(Deleted)를 남깁니다. 그렇지 않으면 바로 비워 적재율을 되돌립니다.
+                const size_t mask = m_capacity - 1;
+                const size_t before = (index - CtrlGroup::kWidth) & mask;
+                const auto emptyAfter = CtrlGroup(m_ctrl + index).matchEmpty();
+                const auto emptyBefore = CtrlGroup(m_ctrl + before).matchEmpty();
+                const bool probedPast = !emptyAfter || !emptyBefore ||
+                                        emptyAfter.lowest() + (CtrlGroup::kWidth - 1 - emptyBefore.highest()) >=
+                                            CtrlGroup::kWidth;
+                if (probedPast)
+                {
+                    setCtrl(index, kCtrlDeleted);
+                }
+                else
+                {
+                    setCtrl(index, kCtrlEmpty);
+                    ++m_growthLeft;
+                }
+            }
+
+            // 묘비가 많으면 같은 용량으로 다시 해시해 정리하고, 아니면 두 배로 늘립니다.
+            bool grow()
+            {
+                if (m_capacity == 0)
+                {
+                    return rehash(CtrlGroup::kWidth);
+                }
+                return rehash(m_size * 2 <= maxLoad(m_capacity) ? m_capacity : m_capacity * 2);
+            }
+
+            bool rehash(size_t capacity)
+            {
+                const size_t ctrlBytes = alignUp(capacity + CtrlGroup::kWidth, alignof(Slot));
+                const size_t bytes = ctrlBytes + capacity * sizeof(Slot);
+                void* memory = m_allocator->allocate(bytes, alignof(Slot) > 16 ? alignof(Slot) : 16);
+                if (memory == nullptr)
+                {
+                    return false;
+                }
+
+                int8_t* oldCtrl = m_ctrl;
+                Slot* oldSlots = m_slots;
+                const size_t oldCapacity = m_capacity;
+
+                m_ctrl = static_cast<int8_t*>(memory);
+                m_slots = reinterpret_cast<Slot*>(static_cast<uint8_t*>(memory) + ctrlBytes);
+                m_capacity = capacity;
+                m_growthLeft = maxLoad(capacity) - m_size;
+                std::memset(m_ctrl, static_cast<uint8_t>(kCtrlEmpty), capacity + CtrlGroup::kWidth);
+
+                for (size_t i = 0; i < oldCapacity; ++i)
+                {
+                    if (oldCtrl[i] >= 0)
+                    {
+                        const uint64_t hash = hashOf(KeyOf()(oldSlots[i]));
+                        const size_t index = findInsertSlot(hash);
+                        new (m_slots + index) Slot(std::move(oldSlots[i]));
+                        oldSlots[i].~Slot();
+                        setCtrl(index, h2(hash));
+                    }
+                }
+
+                if (oldCapacity != 0)
+                {
+                    m_allocator->deallocate(oldCtrl, allocationSize(oldCapacity));
+                }
+                return true;
+            }
+
+            static size_t allocationSize(size_t capacity)
+            {
+                return alignUp(capacity + CtrlGroup::kWidth, alignof(Slot)) + capacity * sizeof(Slot);
+            }
+
+            void destroySlots()
+            {
+                if constexpr (!std::is_trivially_destructible_v<Slot>)
+                {
+                    for (size_t i = 0; i < m_capacity; ++i)
+                    {
+                        if (m_ctrl[i] >= 0)
+                        {
+                            m_slots[i].~Slot();
+                        }
+                    }
+                }
+            }
+
+            void release()
+            {
+                if (m_capacity != 0)
+                {
+                    destroySlots();
+                    m_allocator->deallocate(m_ctrl, allocationSize(m_capacity));
+                }
+                m_ctrl = nullptr;
+                m_slots = nullptr;
+                m_capacity = 0;
+                m_size = 0;
+                m_growthLeft = 0;
+            }
+
+            void copyFrom(const FlatTable& other)
+            {
+                if (other.m_size == 0 || !reserve(other.m_size))
+                {
+                    return;
+                }
+                for (size_t i = 0; i < other.m_capacity; ++i)
+                {
+                    if (other.m_ctrl[i] >= 0)
+                    {
+                        const Slot& slot = other.m_slots[i];
+                        findOrInsert(KeyOf()(slot), [&](void* memory) { new (memory) Slot(slot); });
+                    }
+                }
+            }
+
+            void takeFrom(FlatTable& other)
+            {
+                m_ctrl = other.m_ctrl;
+                m_slots = other.m_slots;
+                m_capacity = other.m_capacity;
+                m_size = other.m_size;
+                m_growthLeft = other.m_growthLeft;
+                other.m_ctrl = nullptr;
+                other.m_slots = nullptr;
+                other.m_capacity = 0;
+                other.m_size = 0;
+                other.m_growthLeft = 0;
+            }
+
+            Allocator* m_allocator;
+            [[no_unique_address]] Hash m_hash;
+            [[no_unique_address]] Eq m_eq;
+            int8_t* m_ctrl = nullptr;
+            Slot* m_slots = nullptr;
+            size_t m_capacity = 0;
+            size_t m_size = 0;
+            size_t m_growthLeft = 0;
+        };
+
+        struct PairKey
+        {
+            template <typename Pair>
+            const auto& operator()(const Pair& pair) const
+            {
+                return pair.first;
+            }
+        };
+
+        struct SelfKey
+        {
+            template <typename T>
+            const T& operator()(const T& value) const
+            {
+                return value;
+            }
+        };
+    }
+
+    // 개방 주소법 해시 맵. std::unordered_map과 달리 원소마다 할당하지 않고 노드를 따라가지 않습니다.
+    //
+    // 재해시와 erase가 원소를 옮기므로 삽입/삭제 뒤에는 반복자와 원소 포인터가 무효가 됩니다.
+    // 원소는 std::pair<Key, Value>이며 first(키)를 바꾸면 안 됩니다.
+    // Hash의 결과는 내부에서 다시 섞으므로 항등 해시(std::hash<int> 등)를 그대로 써도 됩니다.
+    template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Eq = std::equal_to<Key>>
+    class FlatHashMap
+    {
+    public:
+        using value_type = std::pair<Key, Value>;
+        using Table = detail::FlatTable<value_type, Key, detail::PairKey, Hash, Eq>;
+        using iterator = typename Table::iterator;
+        using const_iterator = typename Table::const_iterator;
+
+        explicit FlatHashMap(Allocator& allocator = defaultAllocator())
+            : m_table(allocator)
+        {
+        }
+
+        iterator begin() { return m_table.begin(); }
+        iterator end() { return m_table.end(); }
+        const_iterator begin() const { return m_table.begin(); }
+        const_iterator end() const { return m_table.end(); }
+
+        size_t size() const { return m_table.size(); }
+        bool empty() const { return m_table.empty(); }
+        size_t capacity() const { return m_table.capacity(); }
+
+        iterator find(const Key& key) { return m_table.find(key); }
+        const_iterator find(const Key& key) const { return m_table.find(key); }
+        bool contains(const Key& key) const { return m_table.contains(key); }
+
+        // 키가 없을 때만 args로 값을 만듭니다(std::unordered_map::try_emplace와 같습니다).
+        template <typename... Args>
+        std::pair<iterator, bool> emplace(const Key& key, Args&&... args)
+        {
+            return m_table.findOrInsert(key, [&](void* memory) {
+                new (memory) value_type(std::piecewise_construct, std::forward_as_tuple(key),
+                                        std::forward_as_tuple(std::forward<Args>(args)...));
+            });
+        }
+
+        // 키가 있으면 값을 덮어씁니다.
+        template <typename V>
+        std::pair<iterator, bool> insertOrAssign(const Key& key, V&& value)
+        {
+            auto result = emplace(key, std::forward<V>(value));
+            if (!result.second && result.first != end())
+            {
+                result.first->second = std::forward<V>(value);
+            }
+            return result;
+        }
+
+        Value& operator[](const Key& key) { return emplace(key).first->second; }
+
+        size_t erase(const Key& key) { return m_table.erase(key); }
+        iterator erase(const_iterator position) { return m_table.erase(position); }
+
+        void clear() { m_table.clear(); }
+        bool reserve(size_t count) { return m_table.reserve(count); }
+
+    private:
+        Table m_table;
+    };
+
+    // 개방 주소법 해시 집합. 무효화 규칙은 FlatHashMap과 같습니다.
+    template <typename Key, typename Hash = std::hash<Key>, typename Eq = std::equal_to<Key>>
+    class FlatHashSet
+    {
+    public:
+        using value_type = Key;
+        using Table = detail::FlatTable<Key, Key, detail::SelfKey, Hash, Eq>;
+        using iterator = typename Table::const_iterator;
+        using const_iterator = typename Table::const_iterator;
+
+        explicit FlatHashSet(Allocator& allocator = defaultAllocator())
+            : m_table(allocator)
+        {
+        }
+
+        const_iterator begin() const { return m_table.begin(); }
+        const_iterator end() const { return m_table.end(); }
+
+        size_t size() const { return m_table.size(); }
+        bool empty() const { return m_table.empty(); }
+        size_t capacity() const { return m_table.capacity(); }
+
+        const_iterator find(const Key& key) const { return m_table.find(key); }
+        bool contains(const Key& key) const { return m_table.contains(key); }
+
+        // 새로 넣었으면 true.
+        bool insert(const Key& key)
+        {
+            return m_table.findOrInsert(key, [&](void* memory) { new (memory) Key(key); }).second;
+        }
+
+        size_t erase(const Key& key) { return m_table.erase(key); }
+
+        void clear() { m_table.clear(); }
+        bool reserve(size_t count) { return m_table.reserve(count); }
+
+    private:
+        Table m_table;
+    };
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace axis
+{
+    // 64비트 FNV-1a. 짧은 이름에 알맞고 컴파일 시점에 계산할 수 있습니다.
+    // StringId와 아카이브 이름 해시가 이 함수를 씁니다.
+    constexpr uint64_t fnv1a64(std::string_view text)
+    {
+        uint64_t hash = 0xCBF29CE484222325ull;
+        for (char c : text)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 0x100000001B3ull;
+        }
+        return hash;
+    }
+
+    namespace detail
+    {
+        constexpr uint64_t kXxPrime1 = 0x9E3779B185EBCA87ull;
+        constexpr uint64_t kXxPrime2 = 0xC2B2AE3D27D4EB4Full;
+        constexpr uint64_t kXxPrime3 = 0x165667B19E3779F9ull;
+        constexpr uint64_t kXxPrime4 = 0x85EBCA77C2B2AE63ull;
+        constexpr uint64_t kXxPrime5 = 0x27D4EB2F165667C5ull;
+
+        constexpr uint64_t rotl64(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+        // 바이트를 조립해 읽으므로 상수 평가에서도 쓸 수 있고, 최적화하면 한 번의 적재가 됩니다.
+        constexpr uint64_t readLe64(const char* p)
+        {
+            uint64_t value = 0;
+            for (int i = 0; i < 8; ++i)
+            {
+                value |= static_cast<uint64_t>(static_cast<uint8_t>(p[i])) << (i * 8);
+            }
+            return value;
+        }
+
+        constexpr uint32_t readLe32(const char* p)
+        {
+            uint32_t value = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                value |= static_cast<uint32_t>(static_cast<uint8_t>(p[i])) << (i * 8);
+            }
+            return value;
+        }
+
+        constexpr uint64_t xxRound(uint64_t acc, uint64_t input)
+        {
+            acc += input * kXxPrime2;
+            acc = rotl64(acc, 31);
+            return acc * kXxPrime1;
+        }
+
+        constexpr uint64_t xxMerge(uint64_t acc, uint64_t value)
+        {
+            acc ^= xxRound(0, value);
+            return acc * kXxPrime1 + kXxPrime4;
+        }
+    }
+
+    // XXH64. 긴 데이터(셰이더 바이트코드, 파이프라인 상태 등)에서 FNV-1a보다 훨씬 빠르며 결과는 표준 XXH64와 같습니다.
+    constexpr uint64_t xxHash64(std::string_view data, uint64_t seed = 0)
+    {
+        using namespace detail;
+
+        const char* p = data.data();
+        const char* const end = p + data.size();
+        uint64_t hash;
+
+        if (data.size() >= 32)
+        {
+            uint64_t v1 = seed + kXxPrime1 + kXxPrime2;
+            uint64_t v2 = seed + kXxPrime2;
+            uint64_t v3 = seed;
+            uint64_t v4 = seed - kXxPrime1;
+            for (; end - p >= 32; p += 32)
+            {
+                v1 = xxRound(v1, readLe64(p));
+                v2 = xxRound(v2, readLe64(p + 8));
+                v3 = xxRound(v3, readLe64(p + 16));
+                v4 = xxRound(v4, readLe64(p + 24));
+            }
+            hash = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+            hash = xxMerge(hash, v1);
+            hash = xxMerge(hash, v2);
+            hash = xxMerge(hash, v3);
+            hash = xxMerge(hash, v4);
+        }
+        else
+        {
+            hash = seed + kXxPrime5;
+        }
+
+        hash += static_cast<uint64_t>(data.size());
+
+        for (; end - p >= 8; p += 8)
+        {
+            hash ^= xxRound(0, readLe64(p));
+            hash = rotl64(hash, 27) * kXxPrime1 + kXxPrime4;
+        }
+        if (end - p >= 4)
+        {
+            hash ^= static_cast<uint64_t>(readLe32(p)) * kXxPrime1;
+            hash = rotl64(hash, 23) * kXxPrime2 + kXxPrime3;
+            p += 4;
+        }
+        for (; p < end; ++p)
+        {
+            hash ^= static_cast<uint8_t>(*p) * kXxPrime5;
+            hash = rotl64(hash, 11) * kXxPrime1;
+        }
+
+        hash ^= hash >> 33;
+        hash *= kXxPrime2;
+        hash ^= hash >> 29;
+        hash *= kXxPrime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    inline uint64_t xxHash64(const void* data, size_t size, uint64_t seed = 0)
+    {
+        return xxHash64(std::string_view(static_cast<const char*>(data), size), seed);
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "axis/utils/Allocator.h"
+#include "axis/utils/Export.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace axis
+{
+    // 선형(bump) 할당자.
+    //
+    // 고정 크기 버퍼에서 앞으로만 할당하며, 개별 해제는 없고 reset으로 한 번에 비웁니다.
+    // allocate는 원자적 CAS로 동작하므로 여러 스레드에서 동시에 호출할 수 있습니다.
+    // 버퍼가 부족하면 nullptr을 반환하며 자동으로 늘어나지 않습니다.
+    class AXIS_UTILS_API LinearArena final : public Allocator
+    {
+    public:
+        // 되감기 지점. 단일 스레드에서만 사용합니다.
+        using Marker = size_t;
+
+        // parent가 nullptr이면 defaultAllocator()에서 버퍼를 확보합니다.
+        LinearArena(size_t capacity, BudgetTag tag, Allocator* parent = nullptr);
+        ~LinearArena() override;
+
+        void* allocate(size_t size, size_t alignment = kDefaultAlignment) override;
+        void deallocate(void* ptr, size_t size) override;
+        const char* name() const override { return "LinearArena"; }
+
+        void reset();
+        Marker mark() const { return m_offset.load(std::memory_order_relaxed); }
+        void rewind(Marker marker);
+
+        size_t used() const { return m_offset.load(std::memory_order_relaxed); }
+        size_t capacity() const { return m_capacity; }
+        bool owns(const void* ptr) const;
+
+    private:
+        Allocator* m_parent;
+        uint8_t* m_buffer;
+        size_t m_capacity;
+        std::atomic<size_t> m_offset{0};
+    };
+
+    // 프레임 단위로 비워지는 선형 할당자 묶음.
+    //
+    // frameCount개의 LinearArena를 돌려 쓰며, endFrame()이 다음 아레나로 넘어가면서 그것을 비웁니다.
+    // frameCount가 2 이상이면 한 프레임에 할당한 데이터는 다음 프레임 동안에도 유효하므로
+    // 렌더 스레드처럼 한 프레임 늦게 소비하는 쪽에 넘길 수 있습니다.
+    class AXIS_UTILS_API FrameArena final : public Allocator
+    {
+    public:
+        static constexpr uint32_t kMaxFrames = 4;
+
+        FrameArena(size_t capacityPerFrame, uint32_t frameCount, BudgetTag tag, Allocator* parent = nullptr);
+        ~FrameArena() override;
+
+        void* allocate(size_t size, size_t alignment = kDefaultAlignment) override;
+        void deallocate(void* ptr, size_t size) override;
+        const char* name() const override { return "FrameArena"; }
+
+        // 프레임 종료 시 소유 스레드에서 호출합니다. 이 호출과 allocate가 겹치면 안 됩니다.
+        void endFrame();
+
+        LinearArena& current() { return *m_arenas[m_current]; }
+        uint32_t frameCount() const { return m_frameCount; }
+
+    private:
+        LinearArena* m_arenas[kMaxFrames] = {};
+        uint32_t m_frameCount;
+        uint32_t m_current = 0;
+        Allocator* m_parent;
+    };
+}
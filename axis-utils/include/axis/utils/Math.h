@@ -0,0 +1,418 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+// 기본 벡터 명령어 집합. x64는 SSE2가, ARM64는 NEON이 항상 있으므로 컴파일 시점에 고릅니다.
+// AVX2 같은 확장은 MathBatch의 런타임 디스패치로만 사용합니다.
+#if defined(AXIS_MATH_FORCE_SCALAR)
+    #define AXIS_MATH_SSE 0
+    #define AXIS_MATH_NEON 0
+#elif defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define AXIS_MATH_SSE 1
+    #define AXIS_MATH_NEON 0
+    #include <emmintrin.h>
+#elif defined(_M_ARM64) || (defined(__aarch64__) && defined(__ARM_NEON))
+    #define AXIS_MATH_SSE 0
+    #define AXIS_MATH_NEON 1
+    #include <arm_neon.h>
+#else
+    #define AXIS_MATH_SSE 0
+    #define AXIS_MATH_NEON 0
+#endif
+
+namespace axis
+{
+    constexpr float kPi = 3.14159265358979323846f;
+
+    namespace detail
+    {
+        // 4개 float 레지스터에 대한 얇은 래퍼. Math 타입의 구현에만 사용합니다.
+#if AXIS_MATH_SSE
+        using Float4 = __m128;
+
+        inline Float4 load4(const float* p) { return _mm_load_ps(p); }
+        inline void store4(float* p, Float4 v) { _mm_store_ps(p, v); }
+        inline Float4 set4(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+        inline Float4 splat4(float s) { return _mm_set1_ps(s); }
+        inline Float4 add4(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+        inline Float4 sub4(Float4 a, Float4 b) { return _mm_sub_ps(a, b); }
+        inline Float4 mul4(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+        inline Float4 madd4(Float4 a, Float4 b, Float4 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+
+        template <int Lane>
+        inline Float4 lane4(Float4 v)
+        {
+            return _mm_shuffle_ps(v, v, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+        }
+
+        inline float dot4(Float4 a, Float4 b)
+        {
+            const Float4 m = _mm_mul_ps(a, b);
+            const Float4 s = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+            return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehl_ps(s, s)));
+        }
+#elif AXIS_MATH_NEON
+        using Float4 = float32x4_t;
+
+        inline Float4 load4(const float* p) { return vld1q_f32(p); }
+        inline void store4(float* p, Float4 v) { vst1q_f32(p, v); }
+        inline Float4 set4(float x, float y, float z, float w)
+        {
+            const float values[4] = {x, y, z, w};
+            return vld1q_f32(values);
+        }
+        inline Float4 splat4(float s) { return vdupq_n_f32(s); }
+        inline Float4 add4(Float4 a, Float4 b) { return vaddq_f32(a, b); }
+        inline Float4 sub4(Float4 a, Float4 b) { return vsubq_f32(a, b); }
+        inline Float4 mul4(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+        inline Float4 madd4(Float4 a, Float4 b, Float4 c) { return vmlaq_f32(c, a, b); }
+
+        template <int Lane>
+        inline Float4 lane4(Float4 v)
+        {
+            return vdupq_laneq_f32(v, Lane);
+        }
+
+        inline float dot4(Float4 a, Float4 b) { return vaddvq_f32(vmulq_f32(a, b)); }
+#else
+        struct Float4
+        {
+            float v[4];
+        };
+
+        inline Float4 load4(const float* p) { return {{p[0], p[1], p[2], p[3]}}; }
+        inline void store4(float* p, Float4 v)
+        {
+            p[0] = v.v[0];
+            p[1] = v.v[1];
+            p[2] = v.v[2];
+            p[3] = v.v[3];
+        }
+        inline Float4 set4(float x, float y, float z, float w) { return {{x, y, z, w}}; }
+        inline Float4 splat4(float s) { return {{s, s, s, s}}; }
+        inline Float4 add4(Float4 a, Float4 b)
+        {
+            return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+        }
+        inline Float4 sub4(Float4 a, Float4 b)
+        {
+            return {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};
+        }
+        inline Float4 mul4(Float4 a, Float4 b)
+        {
+            return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+        }
+        inline Float4 madd4(Float4 a, Float4 b, Float4 c) { return add4(mul4(a, b), c); }
+
+        template <int Lane>
+        inline Float4 lane4(Float4 v)
+        {
+            return splat4(v.v[Lane]);
+        }
+
+        inline float dot4(Float4 a, Float4 b)
+        {
+            return a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2] + a.v[3] * b.v[3];
+        }
+#endif
+    }
+
+    // 저장용 3성분 벡터. 연산은 스칼라로 하며, 대량 처리는 MathBatch의 Vec3x8을 사용합니다.
+    struct Vec3
+    {
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+    };
+
+    inline Vec3 operator+(const Vec3& a, const Vec3& b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+    inline Vec3 operator-(const Vec3& a, const Vec3& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+    inline Vec3 operator-(const Vec3& v) { return {-v.x, -v.y, -v.z}; }
+    inline Vec3 operator*(const Vec3& v, float s) { return {v.x * s, v.y * s, v.z * s}; }
+    inline Vec3 operator*(float s, const Vec3& v) { return {v.x * s, v.y * s, v.z * s}; }
+    inline Vec3 operator*(const Vec3& a, const Vec3& b) { return {a.x * b.x, a.y * b.y, a.z * b.z}; }
+
+    inline float dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+    inline Vec3 cross(const Vec3& a, const Vec3& b)
+    {
+        return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+    }
+    inline float lengthSq(const Vec3& v) { return dot(v, v); }
+    inline float length(const Vec3& v) { return std::sqrt(dot(v, v)); }
+
+    // 길이가 0이면 0 벡터를 그대로 돌려줍니다.
+    inline Vec3 normalize(const Vec3& v)
+    {
+        const float lenSq = dot(v, v);
+        return lenSq > 0.0f ? v * (1.0f / std::sqrt(lenSq)) : v;
+    }
+
+    inline Vec3 lerp(const Vec3& a, const Vec3& b, float t) { return a + (b - a) * t; }
+
+    struct alignas(16) Vec4
+    {
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+        float w = 0.0f;
+
+        static Vec4 fromSimd(detail::Float4 v)
+        {
+            Vec4 result;
+            detail::store4(&result.x, v);
+            return result;
+        }
+        detail::Float4 simd() const { return detail::load4(&x); }
+        Vec3 xyz() const { return {x, y, z}; }
+    };
+
+    inline Vec4 operator+(const Vec4& a, const Vec4& b) { return Vec4::fromSimd(detail::add4(a.simd(), b.simd())); }
+    inline Vec4 operator-(const Vec4& a, const Vec4& b) { return Vec4::fromSimd(detail::sub4(a.simd(), b.simd())); }
+    inline Vec4 operator*(const Vec4& a, const Vec4& b) { return Vec4::fromSimd(detail::mul4(a.simd(), b.simd())); }
+    inline Vec4 operator*(const Vec4& v, float s)
+    {
+        return Vec4::fromSimd(detail::mul4(v.simd(), detail::splat4(s)));
+    }
+
+    inline float dot(const Vec4& a, const Vec4& b) { return detail::dot4(a.simd(), b.simd()); }
+    inline Vec4 lerp(const Vec4& a, const Vec4& b, float t)
+    {
+        return Vec4::fromSimd(detail::madd4(detail::sub4(b.simd(), a.simd()), detail::splat4(t), a.simd()));
+    }
+
+    // 단위 쿼터니언 (x, y, z, w). w가 실수부입니다.
+    struct alignas(16) Quat
+    {
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+        float w = 1.0f;
+
+        static Quat fromSimd(detail::Float4 v)
+        {
+            Quat result;
+            detail::store4(&result.x, v);
+            return result;
+        }
+        detail::Float4 simd() const { return detail::load4(&x); }
+
+        static Quat fromAxisAngle(const Vec3& axis, float radians)
+        {
+            const Vec3 n = normalize(axis);
+            const float s = std::sin(radians * 0.5f);
+            return {n.x * s, n.y * s, n.z * s, std::cos(radians * 0.5f)};
+        }
+    };
+
+    // 해밀턴 곱. a * b는 b를 먼저 적용한 뒤 a를 적용하는 회전입니다.
+    inline Quat operator*(const Quat& a, const Quat& b)
+    {
+        const detail::Float4 bv = b.simd();
+        // a.w * b + a.x * (w, -z, y, -x) + a.y * (z, w, -x, -y) + a.z * (-y, x, w, -z)
+        detail::Float4 r = detail::mul4(detail::splat4(a.w), bv);
+        r = detail::madd4(detail::splat4(a.x), detail::set4(b.w, -b.z, b.y, -b.x), r);
+        r = detail::madd4(detail::splat4(a.y), detail::set4(b.z, b.w, -b.x, -b.y), r);
+        r = detail::madd4(detail::splat4(a.z), detail::set4(-b.y, b.x, b.w, -b.z), r);
+        return Quat::fromSimd(r);
+    }
+
+    inline Quat conjugate(const Quat& q) { return {-q.x, -q.y, -q.z, q.w}; }
+    inline float dot(const Quat& a, const Quat& b) { return detail::dot4(a.simd(), b.simd()); }
+
+    inline Quat normalize(const Quat& q)
+    {
+        const float lenSq = dot(q, q);
+        if (lenSq <= 0.0f)
+        {
+            return Quat{};
+        }
+        return Quat::fromSimd(detail::mul4(q.simd(), detail::splat4(1.0f / std::sqrt(lenSq))));
+    }
+
+    inline Vec3 rotate(const Quat& q, const Vec3& v)
+    {
+        // v + 2w(u x v) + 2u x (u x v), u = q.xyz
+        const Vec3 u = {q.x, q.y, q.z};
+        const Vec3 t = cross(u, v) * 2.0f;
+        return v + t * q.w + cross(u, t);
+    }
+
+    // 최단 경로 구면 보간. 두 회전이 거의 같으면 정규화 선형 보간으로 대신합니다.
+    inline Quat slerp(const Quat& a, const Quat& b, float t)
+    {
+        float cosTheta = dot(a, b);
+        Quat target = b;
+        if (cosTheta < 0.0f)
+        {
+            cosTheta = -cosTheta;
+            target = {-b.x, -b.y, -b.z, -b.w};
+        }
+
+        float wa = 1.0f - t;
+        float wb = t;
+        if (cosTheta < 0.9995f)
+        {
+            const float theta = std::acos(cosTheta);
+            const float inverseSin = 1.0f / std::sin(theta);
+            wa = std::sin((1.0f - t) * theta) * inverseSin;
+            wb = std::sin(t * theta) * inverseSin;
+        }
+
+        const detail::Float4 r =
+            detail::madd4(a.simd(), detail::splat4(wa), detail::mul4(target.simd(), detail::splat4(wb)));
+        return normalize(Quat::fromSimd(r));
+    }
+
+    // 열 우선(column-major) 4x4 행렬. columns[3]이 이동 성분이며, 벡터는 오른쪽에 곱합니다(M * v).
+    struct alignas(16) Mat4
+    {
+        Vec4 columns[4] = {
+            {1.0f, 0.0f, 0.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f, 0.0f},
+            {0.0f, 0.0f, 1.0f, 0.0f},
+            {0.0f, 0.0f, 0.0f, 1.0f},
+        };
+
+        const float* data() const { return &columns[0].x; }
+        float* data() { return &columns[0].x; }
+
+        static Mat4 identity() { return Mat4{}; }
+
+        static Mat4 translation(const Vec3& t)
+        {
+            Mat4 m;
+            m.columns[3] = {t.x, t.y, t.z, 1.0f};
+            return m;
+        }
+
+        static Mat4 scale(const Vec3& s)
+        {
+            Mat4 m;
+            m.columns[0].x = s.x;
+            m.columns[1].y = s.y;
+            m.columns[2].z = s.z;
+            return m;
+        }
+
+        static Mat4 rotation(const Quat& q)
+        {
+            const float xx = q.x * q.x;
+            const float yy = q.y * q.y;
+            const float zz = q.z * q.z;
+            const float xy = q.x * q.y;
+            const float xz = q.x * q.z;
+            const float yz = q.y * q.z;
+            const float wx = q.w * q.x;
+            const float wy = q.w * q.y;
+            const float wz = q.w * q.z;
+
+            Mat4 m;
+            m.columns[0] = {1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f};
+            m.columns[1] = {2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f};
+            m.columns[2] = {2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f};
+            return m;
+        }
+
+        // 이동 * 회전 * 크기 순으로 합성합니다.
+        static Mat4 fromTrs(const Vec3& t, const Quat& r, const Vec3& s)
+        {
+            Mat4 m = rotation(r);
+            m.columns[0] = m.columns[0] * s.x;
+            m.columns[1] = m.columns[1] * s.y;
+            m.columns[2] = m.columns[2] * s.z;
+            m.columns[3] = {t.x, t.y, t.z, 1.0f};
+            return m;
+        }
+
+        // 왼손 좌표계 원근 투영. 깊이는 [0, 1]로 사상됩니다(Bounds의 Frustum 추출 규약과 같음).
+        static Mat4 perspective(float fovY, float aspect, float nearZ, float farZ)
+        {
+            const float yScale = 1.0f / std::tan(fovY * 0.5f);
+            const float range = farZ / (farZ - nearZ);
+
+            Mat4 m;
+            m.columns[0] = {yScale / aspect, 0.0f, 0.0f, 0.0f};
+            m.columns[1] = {0.0f, yScale, 0.0f, 0.0f};
+            m.columns[2] = {0.0f, 0.0f, range, 1.0f};
+            m.columns[3] = {0.0f, 0.0f, -range * nearZ, 0.0f};
+            return m;
+        }
+
+        // 왼손 좌표계 시야 행렬(+Z가 앞).
+        static Mat4 lookAt(const Vec3& eye, const Vec3& target, const Vec3& up)
+        {
+            const Vec3 f = normalize(target - eye);
+            const Vec3 r = normalize(cross(up, f));
+            const Vec3 u = cross(f, r);
+
+            Mat4 m;
+            m.columns[0] = {r.x, u.x, f.x, 0.0f};
+            m.columns[1] = {r.y, u.y, f.y, 0.0f};
+            m.columns[2] = {r.z, u.z, f.z, 0.0f};
+            m.columns[3] = {-dot(r, eye), -dot(u, eye), -dot(f, eye), 1.0f};
+            return m;
+        }
+    };
+
+    inline Vec4 operator*(const Mat4& m, const Vec4& v)
+    {
+        const detail::Float4 p = v.simd();
+        detail::Float4 r = detail::mul4(m.columns[0].simd(), detail::lane4<0>(p));
+        r = detail::madd4(m.columns[1].simd(), detail::lane4<1>(p), r);
+        r = detail::madd4(m.columns[2].simd(), detail::lane4<2>(p), r);
+        r = detail::madd4(m.columns[3].simd(), detail::lane4<3>(p), r);
+        return Vec4::fromSimd(r);
+    }
+
+    inline Mat4 operator*(const Mat4& a, const Mat4& b)
+    {
+        Mat4 result;
+        for (uint32_t c = 0; c < 4; ++c)
+        {
+            result.columns[c] = a * b.columns[c];
+        }
+        return result;
+    }
+
+    // w = 1로 보고 변환합니다. 투영 나눗셈은 하지 않습니다.
+    inline Vec3 transformPoint(const Mat4& m, const Vec3& p) { return (m * Vec4{p.x, p.y, p.z, 1.0f}).xyz(); }
+    inline Vec3 transformDirection(const Mat4& m, const Vec3& d) { return (m * Vec4{d.x, d.y, d.z, 0.0f}).xyz(); }
+
+    inline Mat4 transpose(const Mat4& m)
+    {
+        Mat4 t;
+        for (uint32_t c = 0; c < 4; ++c)
+        {
+            for (uint32_t r = 0; r < 4; ++r)
+            {
+                t.data()[r * 4 + c] = m.data()[c * 4 + r];
+            }
+        }
+        return t;
+    }
+
+    // 마지막 행이 (0, 0, 0, 1)인 아핀 행렬의 역행렬. 일반 inverse보다 훨씬 쌉니다.
+    inline Mat4 inverseAffine(const Mat4& m)
+    {
+        const Vec3 c0 = m.columns[0].xyz();
+        const Vec3 c1 = m.columns[1].xyz();
+        const Vec3 c2 = m.columns[2].xyz();
+        const Vec3 t = m.columns[3].xyz();
+
+        // 3x3 역행렬의 행은 열 벡터 쌍의 외적을 행렬식으로 나눈 것입니다.
+        const Vec3 r0 = cross(c1, c2);
+        const Vec3 r1 = cross(c2, c0);
+        const Vec3 r2 = cross(c0, c1);
+        const float det = dot(c0, r0);
+        const float inverseDet = det != 0.0f ? 1.0f / det : 0.0f;
+
+        Mat4 inv;
+        inv.columns[0] = {r0.x * inverseDet, r1.x * inverseDet, r2.x * inverseDet, 0.0f};
+        inv.columns[1] = {r0.y * inverseDet, r1.y * inverseDet, r2.y * inverseDet, 0.0f};
+        inv.columns[2] = {r0.z * inverseDet, r1.z * inverseDet, r2.z * inverseDet, 0.0f};
+        const Vec3 it = transformDirection(inv, t);
+        inv.columns[3] = {-it.x, -it.y, -it.z, 1.0f};
+        return inv;
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "axis/utils/Export.h"
+#include "axis/utils/Math.h"
+
+#include <cstdint>
+
+namespace axis
+{
+    constexpr uint32_t kBatchWidth = 8;
+
+    // 3성분 벡터 8개를 성분별로 모은 SoA 묶음. 한 묶음이 AVX2 레지스터 하나 폭입니다.
+    // 개수가 8의 배수가 아니면 마지막 묶음의 남는 칸을 채워 두고 결과를 무시합니다.
+    struct alignas(32) Vec3x8
+    {
+        float x[kBatchWidth];
+        float y[kBatchWidth];
+        float z[kBatchWidth];
+
+        Vec3 get(uint32_t lane) const { return {x[lane], y[lane], z[lane]}; }
+        void set(uint32_t lane, const Vec3& v)
+        {
+            x[lane] = v.x;
+            y[lane] = v.y;
+            z[lane] = v.z;
+        }
+    };
+
+    enum class SimdLevel : uint8_t
+    {
+        Scalar,
+        Sse2,
+        Neon,
+        Avx2,
+    };
+
+    struct CpuFeatures
+    {
+        bool sse2 = false;
+        bool sse41 = false;
+        bool avx = false;
+        bool avx2 = false;
+        bool fma = false;
+        bool avx512f = false;
+        bool neon = false;
+    };
+
+    // CPUID(및 OS의 AVX 상태 저장 지원)로 한 번 판별한 결과.
+    AXIS_UTILS_API const CpuFeatures& cpuFeatures();
+
+    // 배치 커널이 현재 사용하는 구현.
+    AXIS_UTILS_API SimdLevel activeSimdLevel();
+    AXIS_UTILS_API const char* simdLevelName(SimdLevel level);
+
+    // 비교 측정/검증용으로 구현을 강제합니다. CPU가 지원하지 않는 수준이면 false를 반환하고 바꾸지 않습니다.
+    // 다른 스레드가 배치 커널을 실행하는 동안 호출해도 안전하지만, 실행 중인 호출은 이전 구현으로 끝납니다.
+    AXIS_UTILS_API bool forceSimdLevel(SimdLevel level);
+
+    // 배치 커널. 모두 count개의 묶음(항목 수 = count * 8)을 처리하며 in과 out은 같아도 됩니다.
+    // 구현은 처음 호출될 때 CPU 기능을 보고 골라지므로, DLL 하나로 AVX2가 없는 CPU에서도 동작합니다.
+
+    // out = m * (p, 1). 투영 나눗셈은 하지 않습니다.
+    AXIS_UTILS_API void transformPoints(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count);
+
+    // out = m * (d, 0).
+    AXIS_UTILS_API void transformDirections(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count);
+
+    // 길이가 0인 벡터는 0으로 남습니다.
+    AXIS_UTILS_API void normalize(const Vec3x8* in, Vec3x8* out, uint32_t count);
+
+    // 구 8개씩을 절두체 평면 6개(nx, ny, nz, d; 안쪽이 양수)와 비교합니다.
+    // radii는 count * 8개, outVisible[i]의 비트 k는 묶음 i의 k번째 구가 보이는지입니다.
+    AXIS_UTILS_API void cullSpheres(const float planes[6][4], const Vec3x8* centers, const float* radii, uint32_t count,
+                                    uint8_t* outVisible);
+
+    // out[i] = a[i] * b[i]. 계층 변환의 부모 * 로컬 연쇄에 씁니다. out은 a나 b와 같아도 됩니다.
+    AXIS_UTILS_API void multiplyMatrices(const Mat4* a, const Mat4* b, Mat4* out, uint32_t count);
+}
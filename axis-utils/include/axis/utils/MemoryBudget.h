@@ -0,0 +1,60 @@
+#pragma once
+
+#include "axis/utils/Export.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace axis
+{
+    // 메모리를 소유한 하위 시스템이 어느 축에 속하는지.
+    enum class MemoryAxis : uint8_t
+    {
+        Time,  // 스케줄러, 작업, 프레임 임시 데이터
+        Space, // 공간 분할, 씬, 렌더링
+        Data,  // 엔티티/컴포넌트, 에셋, 스트리밍
+    };
+
+    // 예산 항목 식별자. MemoryBudget::registerTag로 발급받습니다.
+    using BudgetTag = uint16_t;
+
+    constexpr BudgetTag kUntaggedBudget = 0;
+    constexpr uint32_t kMaxBudgetTags = 64;
+
+    struct BudgetUsage
+    {
+        // 할당자가 상위(OS 또는 부모 할당자)에서 확보해 둔 바이트.
+        uint64_t reservedBytes = 0;
+        // 실제로 나누어 준 바이트와 그 최댓값.
+        uint64_t usedBytes = 0;
+        uint64_t peakUsedBytes = 0;
+        uint64_t allocationCount = 0;
+        // 0이면 제한 없음.
+        uint64_t limitBytes = 0;
+    };
+
+    // 하위 시스템별 메모리 사용량 집계.
+    //
+    // 모든 AXIS 할당자는 생성 시 태그를 받고, 확보/할당/해제를 여기에 보고합니다.
+    // 카운터는 원자적으로 갱신되므로 어느 스레드에서든 읽을 수 있습니다.
+    // 한도를 넘더라도 할당을 막지는 않으며, isOverBudget으로 확인만 할 수 있습니다.
+    class AXIS_UTILS_API MemoryBudget
+    {
+    public:
+        // 같은 이름으로 다시 등록하면 기존 태그를 돌려줍니다. 이름은 복사해 두며 47바이트까지입니다.
+        static BudgetTag registerTag(const char* name, MemoryAxis axis, uint64_t limitBytes = 0);
+
+        static void setLimit(BudgetTag tag, uint64_t limitBytes);
+
+        static void onReserve(BudgetTag tag, size_t bytes);
+        static void onRelease(BudgetTag tag, size_t bytes);
+        static void onAllocate(BudgetTag tag, size_t bytes);
+        static void onFree(BudgetTag tag, size_t bytes);
+
+        static uint32_t tagCount();
+        static const char* name(BudgetTag tag);
+        static MemoryAxis axis(BudgetTag tag);
+        static BudgetUsage usage(BudgetTag tag);
+        static bool isOverBudget(BudgetTag tag);
+    };
+}
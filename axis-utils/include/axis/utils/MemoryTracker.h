@@ -0,0 +1,134 @@
+#pragma once
+
+#include "axis/utils/Allocator.h"
+#include "axis/utils/Export.h"
+#include "axis/utils/MemoryBudget.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 0으로 정의하면 할당자의 추적 호출이 빈 문장이 됩니다. 1이어도 MemoryTracker::enable 전에는 원자 변수 하나만 읽습니다.
+#if !defined(AXIS_MEMORY_TRACKING_ENABLED)
+    #define AXIS_MEMORY_TRACKING_ENABLED 1
+#endif
+
+namespace axis
+{
+    // 샘플링한 호출 스택의 식별자. 0은 스택을 남기지 않은 할당입니다.
+    using StackId = uint32_t;
+
+    constexpr StackId kUnsampledStack = 0;
+    constexpr uint32_t kMaxTrackedStackDepth = 32;
+
+    struct MemoryTrackerDesc
+    {
+        // 스레드마다 이 수의 할당 중 하나씩 호출 스택을 남깁니다. 1이면 모두, 0이면 크기 조건만 봅니다.
+        uint32_t sampleInterval = 64;
+        // 이 크기 이상의 할당은 항상 스택을 남깁니다. 0이면 크기로는 고르지 않습니다.
+        size_t alwaysSampleBytes = 64 * 1024;
+        // 남길 프레임 수. kMaxTrackedStackDepth를 넘으면 잘립니다.
+        uint32_t stackDepth = 16;
+    };
+
+    struct TagMemoryStats
+    {
+        BudgetTag tag = kUntaggedBudget;
+        // 추적을 켠 뒤에 할당되어 아직 살아 있는 것만 셉니다.
+        uint64_t liveBytes = 0;
+        uint64_t liveCount = 0;
+        uint64_t highWaterBytes = 0;
+        // 마지막으로 끝난 프레임(markFrame 사이)의 할당/해제.
+        uint32_t frameAllocations = 0;
+        uint32_t frameFrees = 0;
+        uint64_t frameAllocatedBytes = 0;
+    };
+
+    // 살아 있는 할당을 (태그, 스택)별로 모은 것.
+    struct MemorySnapshotEntry
+    {
+        BudgetTag tag = kUntaggedBudget;
+        StackId stack = kUnsampledStack;
+        uint64_t count = 0;
+        uint64_t bytes = 0;
+    };
+
+    struct MemorySnapshot
+    {
+        uint64_t frame = 0;
+        uint64_t totalBytes = 0;
+        uint64_t totalCount = 0;
+        // (tag, stack) 순으로 정렬되어 있습니다.
+        std::vector<MemorySnapshotEntry> entries;
+    };
+
+    struct MemoryDiffEntry
+    {
+        BudgetTag tag = kUntaggedBudget;
+        StackId stack = kUnsampledStack;
+        int64_t countDelta = 0;
+        int64_t bytesDelta = 0;
+    };
+
+    // 할당 단위 메모리 추적.
+    //
+    // 켜 두면 개별 해제가 있는 AXIS 할당자(SystemAllocator, TlsfAllocator, PoolAllocator)가 할당마다 주소, 크기,
+    // 예산 태그를 보고하고, 추적기는 살아 있는 할당 표를 주소 해시로 나눈 조각별 잠금 아래 유지합니다.
+    // 호출 스택은 비싸므로 sampleInterval개 중 하나와 큰 할당만 남기고, 같은 스택은 한 번만 저장합니다.
+    // 한꺼번에 비우는 LinearArena/FrameArena는 할당 단위로 추적하지 않으며 MemoryBudget 집계로만 보입니다.
+    //
+    // 프레임 경계(markFrame)마다 태그별 프레임 할당 수와 살아 있는 바이트를 프로파일러 카운터
+    // ("<태그 이름>", "<태그 이름>.allocs")로 기록하므로 Chrome trace에서 태그별 그래프로 볼 수 있습니다.
+    // 카운터는 프로파일러를 끄면 사라지지만 프레임 통계는 프로파일러와 무관하게 넘어갑니다.
+    //
+    // 하위 할당자(TlsfAllocator, PoolAllocator)가 부모에서 받은 풀/페이지는 markReservation으로 표시되어
+    // 살아 있는 바이트와 스냅숏에서 빠집니다. 그 안에서 나눠 준 블록만 세므로 같은 메모리를 두 번 세지 않습니다.
+    // 장시간 세션의 메모리 증가는 snapshot 두 개를 diff해 어느 태그의 어느 호출 지점이 늘었는지 찾습니다.
+    //
+    // 추적기 자신의 표는 "utils.memorytracker" 태그로 잡히며 추적 대상에서는 빠집니다.
+    class AXIS_UTILS_API MemoryTracker
+    {
+    public:
+        // 켜기 전에 만들어진 할당은 해제되어도 무시합니다. 다시 켜면 표와 통계를 비우고 시작합니다.
+        static void enable(const MemoryTrackerDesc& desc = {});
+        static void disable();
+        static bool isEnabled();
+
+        // 할당자가 호출합니다. AXIS_MEMORY_TRACK_ALLOC/AXIS_MEMORY_TRACK_FREE를 쓰십시오.
+        static void onAllocate(BudgetTag tag, const void* ptr, size_t bytes);
+        static void onFree(const void* ptr);
+        // 방금 부모에게서 받은 ptr이 다른 할당자의 풀임을 알립니다. AXIS_MEMORY_TRACK_RESERVE를 쓰십시오.
+        static void markReservation(const void* ptr);
+
+        // 프레임 통계를 넘기고 프로파일러 카운터를 기록합니다. Scheduler::runFrame이 프레임 시작마다 부르며,
+        // Scheduler 없이 프레임을 돌리는 호스트는 프레임 경계에서 직접 부릅니다.
+        static void markFrame();
+
+        // 추적된 할당이 있었던 태그만 채웁니다. 채운 개수를 반환합니다.
+        static uint32_t tagStats(TagMemoryStats* out, uint32_t capacity);
+
+        static void snapshot(MemorySnapshot& out);
+        // after - before. 바이트 증가가 큰 순서로 정렬하며, 변화가 없는 항목은 뺍니다.
+        static void diff(const MemorySnapshot& before, const MemorySnapshot& after, std::vector<MemoryDiffEntry>& out);
+
+        // 스택의 프레임을 out에 채우고 개수를 반환합니다.
+        static uint32_t stackFrames(StackId stack, void** out, uint32_t capacity);
+
+        // 사람이 읽을 수 있는 보고서. 스택은 describeAddress로 심볼을 찾으므로 느립니다.
+        static std::string formatSnapshot(const MemorySnapshot& snapshot, uint32_t maxEntries = 32);
+        static std::string formatDiff(const std::vector<MemoryDiffEntry>& diff, uint32_t maxEntries = 32);
+        // 태그별로 확보했지만 나눠 주지 않은 바이트(MemoryBudget)와, 할당자별 빈 블록 분포(queryFragmentation)를 씁니다.
+        static std::string formatFragmentation(Allocator* const* allocators = nullptr, uint32_t allocatorCount = 0);
+    };
+}
+
+#if AXIS_MEMORY_TRACKING_ENABLED
+    #define AXIS_MEMORY_TRACK_ALLOC(tag, ptr, bytes) ::axis::MemoryTracker::onAllocate(tag, ptr, bytes)
+    #define AXIS_MEMORY_TRACK_FREE(ptr) ::axis::MemoryTracker::onFree(ptr)
+    #define AXIS_MEMORY_TRACK_RESERVE(ptr) ::axis::MemoryTracker::markReservation(ptr)
+#else
+    #define AXIS_MEMORY_TRACK_ALLOC(tag, ptr, bytes) ((void)0)
+    #define AXIS_MEMORY_TRACK_FREE(ptr) ((void)0)
+    #define AXIS_MEMORY_TRACK_RESERVE(ptr) ((void)0)
+#endif
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "axis/utils/Allocator.h"
+#include "axis/utils/Export.h"
+#include "axis/utils/SpinLock.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace axis
+{
+    // 고정 크기 블록 풀.
+    //
+    // 페이지 단위로 blocksPerPage개의 블록을 확보하고, 해제된 블록은 침입형 free list로 재사용합니다.
+    // 페이지는 풀이 파괴될 때만 반환되므로 사용량이 최고점에 도달한 뒤에는 상위 할당이 없습니다.
+    // 스핀 락으로 보호되므로 여러 스레드에서 사용할 수 있습니다.
+    class AXIS_UTILS_API PoolAllocator final : public Allocator
+    {
+    public:
+        // maxPages가 0이면 페이지 수 제한이 없습니다.
+        PoolAllocator(size_t blockSize, size_t blockAlignment, uint32_t blocksPerPage, BudgetTag tag,
+                      Allocator* parent = nullptr, uint32_t maxPages = 0);
+        ~PoolAllocator() override;
+
+        // size는 blockSize 이하, alignment는 blockAlignment 이하여야 합니다.
+        void* allocate(size_t size, size_t alignment = kDefaultAlignment) override;
+        void deallocate(void* ptr, size_t size) override;
+        const char* name() const override { return "PoolAllocator"; }
+
+        void* allocateBlock();
+        void deallocateBlock(void* ptr);
+
+        size_t blockSize() const { return m_blockSize; }
+        uint32_t pageCount() const { return m_pageCount; }
+        uint32_t usedBlocks() const { return m_usedBlocks; }
+        uint32_t capacityBlocks() const { return m_pageCount * m_blocksPerPage; }
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        // 페이지 앞부분에 놓이는 헤더. 페이지 목록을 연결합니다.
+        struct PageHeader
+        {
+            PageHeader* next;
+        };
+
+        bool addPage();
+
+        Allocator* m_parent;
+        size_t m_blockSize;
+        size_t m_blockAlignment;
+        size_t m_pageHeaderSize;
+        size_t m_pageSize;
+        uint32_t m_blocksPerPage;
+        uint32_t m_maxPages;
+
+        SpinLock m_lock;
+        FreeBlock* m_freeList = nullptr;
+        PageHeader* m_pages = nullptr;
+        uint32_t m_pageCount = 0;
+        uint32_t m_usedBlocks = 0;
+    };
+
+    // 타입이 정해진 객체 풀.
+    template <typename T>
+    class ObjectPool
+    {
+    public:
+        ObjectPool(uint32_t objectsPerPage, BudgetTag tag, Allocator* parent = nullptr, uint32_t maxPages = 0)
+            : m_pool(sizeof(T) < sizeof(void*) ? sizeof(void*) : sizeof(T), alignof(T), objectsPerPage, tag, parent,
+                     maxPages)
+        {
+        }
+
+        template <typename... Args>
+        T* create(Args&&... args)
+        {
+            void* memory = m_pool.allocateBlock();
+            return memory != nullptr ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+        }
+
+        void destroy(T* object)
+        {
+            if (object != nullptr)
+            {
+                object->~T();
+                m_pool.deallocateBlock(object);
+            }
+        }
+
+        PoolAllocator& pool() { return m_pool; }
+
+    private:
+        PoolAllocator m_pool;
+    };
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "axis/utils/Export.h"
+
+#include <cstdint>
+
+// 0으로 정의하면 모든 계측 매크로가 빈 문장이 되어 바이너리에 흔적을 남기지 않습니다.
+#if !defined(AXIS_PROFILER_ENABLED)
+    #define AXIS_PROFILER_ENABLED 1
+#endif
+
+namespace axis
+{
+    enum class ProfileEventType : uint8_t
+    {
+        Scope,
+        Instant,
+        FrameMark,
+        // 시간에 따라 변하는 값(메모리 사용량 등). 값은 durationNs 자리에 담깁니다.
+        Counter,
+    };
+
+    struct ProfileEvent
+    {
+        const char* name = nullptr;
+        uint64_t beginNs = 0;
+        uint64_t durationNs = 0;
+        uint32_t threadId = 0;
+        uint8_t depth = 0;
+        ProfileEventType type = ProfileEventType::Scope;
+    };
+
+    // 이름별 집계. 같은 이름 포인터(또는 같은 문자열)를 하나로 묶습니다.
+    struct ProfileScopeStats
+    {
+        const char* name = nullptr;
+        uint32_t count = 0;
+        uint64_t totalNs = 0;
+        uint64_t minNs = 0;
+        uint64_t maxNs = 0;
+    };
+
+    // 핫 패스 프로파일러.
+    //
+    // 스레드마다 고정 크기 링 버퍼를 하나씩 가지며, 기록은 그 스레드만 하고(잠금 없음, 할당 없음)
+    // 조회/내보내기는 아무 스레드에서나 할 수 있습니다. 버퍼가 가득 차면 오래된 이벤트부터 덮어씁니다.
+    // 이벤트는 이름 포인터만 저장하므로 이름 문자열은 내보내기가 끝날 때까지 유지되어야 합니다.
+    class AXIS_UTILS_API Profiler
+    {
+    public:
+        using EventCallback = void (*)(const ProfileEvent& event, void* userData);
+
+        static void setEnabled(bool enabled);
+        static bool isEnabled();
+
+        // 이후에 처음 기록하는 스레드부터 적용됩니다. 2의 거듭제곱으로 올림됩니다.
+        static void setThreadBufferCapacity(uint32_t eventCount);
+
+        // 현재 스레드 이름. 복사해서 저장합니다.
+        static void setThreadName(const char* name);
+
+        static uint64_t now();
+
+        // ProfileScope가 사용합니다. beginScope가 0을 반환하면 endScope는 아무것도 하지 않습니다.
+        static uint64_t beginScope();
+        static void endScope(const char* name, uint64_t beginNs);
+
+        static void recordInstant(const char* name);
+
+        // 이름별 값 하나를 기록합니다. Chrome trace에서는 이름마다 그래프 하나로 보입니다.
+        static void recordCounter(const char* name, uint64_t value);
+
+        // 프레임 경계를 기록합니다. queryLastFrame은 마지막 두 경계 사이를 집계합니다.
+        static void markFrame();
+        static uint64_t frameCount();
+        static uint64_t lastFrameDurationNs();
+
+        // 모든 스레드 버퍼에서 [fromNs, toNs) 구간에 시작한 이벤트를 순회합니다. 순회한 개수를 반환합니다.
+        static uint32_t forEachEvent(EventCallback callback, void* userData, uint64_t fromNs = 0,
+                                     uint64_t toNs = ~uint64_t{0});
+
+        // 마지막으로 완료된 프레임의 Scope 이벤트를 이름별로 집계해 out에 채웁니다.
+        // out이 부족하면 나머지 이름은 버립니다. 채운 개수를 반환합니다.
+        static uint32_t queryLastFrame(ProfileScopeStats* out, uint32_t capacity);
+
+        // 현재 버퍼 내용을 Chrome trace / Perfetto에서 읽을 수 있는 JSON으로 씁니다.
+        static bool writeChromeTrace(const char* path);
+    };
+
+    class ProfileScope
+    {
+    public:
+        explicit ProfileScope(const char* name)
+            : m_name(name)
+            , m_beginNs(Profiler::beginScope())
+        {
+        }
+
+        ~ProfileScope() { Profiler::endScope(m_name, m_beginNs); }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        const char* m_name;
+        uint64_t m_beginNs;
+    };
+}
+
+#define AXIS_PROFILE_CONCAT_INNER(a, b) a##b
+#define AXIS_PROFILE_CONCAT(a, b) AXIS_PROFILE_CONCAT_INNER(a, b)
+
+#if AXIS_PROFILER_ENABLED
+    #define AXIS_PROFILE_SCOPE(name) ::axis::ProfileScope AXIS_PROFILE_CONCAT(axisProfileScope_, __LINE__)(name)
+    #define AXIS_PROFILE_FUNCTION() AXIS_PROFILE_SCOPE(__func__)
+    #define AXIS_PROFILE_INSTANT(name) ::axis::Profiler::recordInstant(name)
+    #define AXIS_PROFILE_COUNTER(name, value) ::axis::Profiler::recordCounter(name, value)
+    #define AXIS_PROFILE_FRAME_MARK() ::axis::Profiler::markFrame()
+    #define AXIS_PROFILE_THREAD_NAME(name) ::axis::Profiler::setThreadName(name)
+#else
+    #define AXIS_PROFILE_SCOPE(name) ((void)0)
+    #define AXIS_PROFILE_FUNCTION() ((void)0)
+    #define AXIS_PROFILE_INSTANT(name) ((void)0)
+    #define AXIS_PROFILE_COUNTER(name, value) ((void)0)
+    #define AXIS_PROFILE_FRAME_MARK() ((void)0)
+    #define AXIS_PROFILE_THREAD_NAME(name) ((void)0)
+#endif
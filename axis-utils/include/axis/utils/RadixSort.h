@@ -0,0 +1,22 @@
+#pragma once
+
+#include "axis/utils/Export.h"
+
+#include <cstdint>
+
+namespace axis
+{
+    // 64비트 정렬 키와 원본 인덱스 쌍.
+    struct SortItem
+    {
+        uint64_t key;
+        uint32_t index;
+    };
+
+    // LSD 기수 정렬 (11비트 자릿수 6회).
+    //
+    // 모든 자릿수의 히스토그램을 한 번의 순회로 만들고, 모든 키가 같은 값을 가진 자릿수는 건너뜁니다.
+    // 안정 정렬이므로 키가 같은 항목은 입력 순서를 유지합니다.
+    // scratch는 count개 이상이어야 하며, 결과는 항상 items에 놓입니다.
+    AXIS_UTILS_API void radixSort(SortItem* items, SortItem* scratch, uint32_t count);
+}
@@ -0,0 +1,396 @@
+#pragma once
+
+#include "axis/platform/MappedFile.h"
+#include "axis/utils/Allocator.h"
+#include "axis/utils/Export.h"
+#include "axis/utils/Hash.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace axis
+{
+    // 스키마 버전이 붙은 바이너리 스냅숏 (리틀 엔디언).
+    //
+    //   [SnapshotHeader 64B][레이아웃 표][구역 표][구역 데이터]...
+    //
+    // 타입은 SerialSchema 특수화에 constexpr 필드 목록으로 등록합니다. 파일에는 타입마다 필드 이름 해시와
+    // 오프셋/크기를 담은 레이아웃이 함께 기록되므로, 읽는 쪽의 레이아웃이 같으면 매핑한 버퍼를 그대로
+    // const T* 배열로 쓰고(복사 없음), 다르면 이름이 같은 필드만 옮겨 새 레이아웃으로 변환합니다.
+    // 구역 데이터는 64바이트 경계에서 시작합니다.
+    //
+    //   struct Transform { Vec3 position; Quat rotation; float scale; };
+    //
+    //   template <>
+    //   struct SerialSchema<Transform>
+    //   {
+    //       static constexpr const char* name = "Transform";
+    //       static constexpr uint32_t version = 2;
+    //       static constexpr auto fields = serialFields(serialField("position", &Transform::position),
+    //                                                   serialField("rotation", &Transform::rotation),
+    //                                                   serialField("scale", &Transform::scale));
+    //       // 선택. 이전 버전에서 변환한 값을 고칩니다. 새 필드는 T()의 값으로 채워진 상태입니다.
+    //       static void upgrade(Transform& value, uint32_t storedVersion);
+    //   };
+
+    constexpr uint32_t kSnapshotMagic = 0x4E535841u; // "AXSN"
+    constexpr uint32_t kSnapshotVersion = 1;
+    constexpr uint32_t kSnapshotAlignment = 64;
+    constexpr uint32_t kMaxSerialFields = 32;
+    // 레이아웃 없이 바이트만 담은 구역.
+    constexpr uint32_t kSnapshotRawSection = 0xFFFFFFFFu;
+
+    struct SnapshotHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t layoutCount;
+        uint32_t sectionCount;
+        uint64_t layoutsOffset;
+        uint64_t sectionsOffset;
+        uint64_t dataOffset;
+        uint64_t totalSize;
+        uint64_t reserved[2];
+    };
+
+    struct SerialFieldLayout
+    {
+        uint64_t nameHash;
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    // 파일의 레이아웃 표 항목. 바로 뒤에 fieldCount개의 SerialFieldLayout이 이어집니다.
+    struct SerialLayoutRecord
+    {
+        uint64_t typeHash;
+        uint64_t layoutHash;
+        uint32_t version;
+        uint32_t size;
+        uint32_t fieldCount;
+        uint32_t reserved;
+    };
+
+    // 구역 표는 key 순으로 정렬되어 있습니다.
+    struct SnapshotSection
+    {
+        uint64_t key;
+        uint64_t offset;
+        uint64_t size;
+        // 레이아웃 표에서의 위치(바이트). 원시 구역이면 kSnapshotRawSection입니다.
+        uint32_t layout;
+        uint32_t count;
+    };
+
+    static_assert(sizeof(SnapshotHeader) == 64);
+    static_assert(sizeof(SerialFieldLayout) == 16);
+    static_assert(sizeof(SerialLayoutRecord) == 32);
+    static_assert(sizeof(SnapshotSection) == 32);
+
+    // 실행 중인 빌드의 타입 레이아웃. serialLayout<T>()가 타입마다 한 번 만듭니다.
+    struct SerialLayout
+    {
+        SerialLayoutRecord record = {};
+        SerialFieldLayout fields[kMaxSerialFields] = {};
+    };
+
+    template <typename Owner, typename Member>
+    struct SerialField
+    {
+        const char* name;
+        uint64_t nameHash;
+        Member Owner::*member;
+    };
+
+    template <typename Owner, typename Member>
+    constexpr SerialField<Owner, Member> serialField(const char* name, Member Owner::*member)
+    {
+        return SerialField<Owner, Member>{name, fnv1a64(name), member};
+    }
+
+    template <typename... Fields>
+    constexpr std::tuple<Fields...> serialFields(Fields... fields)
+    {
+        static_assert(sizeof...(Fields) <= kMaxSerialFields, "필드 수가 kMaxSerialFields를 넘었습니다");
+        return std::tuple<Fields...>(fields...);
+    }
+
+    // 타입별로 특수화합니다. 형식은 파일 머리말의 예를 따릅니다.
+    template <typename T>
+    struct SerialSchema;
+
+    namespace detail
+    {
+        // 필드 이름, 오프셋, 크기와 타입 크기로 만든 해시. 같으면 메모리 배치가 같습니다.
+        AXIS_UTILS_API void finalizeSerialLayout(SerialLayout& layout);
+
+        template <typename T, typename Owner, typename Member>
+        void addSerialField(SerialLayout& layout, const SerialField<Owner, Member>& field)
+        {
+            static_assert(std::is_same_v<T, Owner>, "다른 타입의 멤버를 필드로 등록했습니다");
+            static_assert(std::is_trivially_copyable_v<Member>, "필드는 자명하게 복사 가능한 타입이어야 합니다");
+
+            // 실제 객체에서 멤버 오프셋을 구합니다. 변환 읽기가 T()로 값을 채우므로 T는 이미 기본 생성 가능해야 합니다.
+            static const T s_probe{};
+            const size_t offset = reinterpret_cast<const unsigned char*>(&(s_probe.*field.member)) -
+                                  reinterpret_cast<const unsigned char*>(&s_probe);
+
+            SerialFieldLayout& out = layout.fields[layout.record.fieldCount++];
+            out.nameHash = field.nameHash;
+            out.offset = static_cast<uint32_t>(offset);
+            out.size = static_cast<uint32_t>(sizeof(Member));
+        }
+
+        template <typename T>
+        SerialLayout buildSerialLayout()
+        {
+            using Schema = SerialSchema<T>;
+            static_assert(std::is_trivially_copyable_v<T>, "직렬화 타입은 자명하게 복사 가능해야 합니다");
+            static_assert(alignof(T) <= kSnapshotAlignment, "직렬화 타입의 정렬이 너무 큽니다");
+
+            SerialLayout layout;
+            layout.record.typeHash = fnv1a64(Schema::name);
+            layout.record.version = Schema::version;
+            layout.record.size = static_cast<uint32_t>(sizeof(T));
+            std::apply([&](const auto&... field) { (addSerialField<T>(layout, field), ...); }, Schema::fields);
+            finalizeSerialLayout(layout);
+            return layout;
+        }
+
+        template <typename T>
+        concept HasSerialUpgrade = requires(T& value, uint32_t version) { SerialSchema<T>::upgrade(value, version); };
+    }
+
+    template <typename T>
+    const SerialLayout& serialLayout()
+    {
+        static const SerialLayout s_layout = detail::buildSerialLayout<std::remove_cv_t<T>>();
+        return s_layout;
+    }
+
+    // SnapshotReader가 돌려주는 배열. 레이아웃이 같으면 스냅숏 버퍼를 직접 가리키고(그 수명을 따름),
+    // 변환했으면 변환한 사본을 소유합니다.
+    template <typename T>
+    class SerialArray
+    {
+    public:
+        SerialArray() = default;
+        ~SerialArray() { reset(); }
+
+        SerialArray(const SerialArray&) = delete;
+        SerialArray& operator=(const SerialArray&) = delete;
+
+        SerialArray(SerialArray&& other) noexcept
+            : m_data(std::exchange(other.m_data, nullptr))
+            , m_count(std::exchange(other.m_count, 0))
+            , m_allocator(std::exchange(other.m_allocator, nullptr))
+        {
+        }
+
+        SerialArray& operator=(SerialArray&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                m_data = std::exchange(other.m_data, nullptr);
+                m_count = std::exchange(other.m_count, 0);
+                m_allocator = std::exchange(other.m_allocator, nullptr);
+            }
+            return *this;
+        }
+
+        const T* data() const { return m_data; }
+        uint32_t size() const { return m_count; }
+        bool empty() const { return m_count == 0; }
+        const T* begin() const { return m_data; }
+        const T* end() const { return m_data + m_count; }
+
+        const T& operator[](uint32_t index) const
+        {
+            assert(index < m_count);
+            return m_data[index];
+        }
+
+        bool isZeroCopy() const { return m_allocator == nullptr; }
+
+        void reset()
+        {
+            if (m_allocator != nullptr)
+            {
+                m_allocator->deallocate(const_cast<T*>(m_data), sizeof(T) * m_count);
+            }
+            m_data = nullptr;
+            m_count = 0;
+            m_allocator = nullptr;
+        }
+
+    private:
+        friend class SnapshotReader;
+
+        const T* m_data = nullptr;
+        uint32_t m_count = 0;
+        Allocator* m_allocator = nullptr;
+    };
+
+    // 스냅숏 작성기. 추가한 배열은 복사하지 않고 가리키기만 하므로 finish/write까지 유지되어야 합니다.
+    // 같은 순서, 같은 키로 구역을 추가하면 연속된 스냅숏의 바이트 배치가 맞아 encodeDelta가 잘 줄어듭니다.
+    class AXIS_UTILS_API SnapshotWriter
+    {
+    public:
+        // 키가 이미 있으면 false.
+        template <typename T>
+        bool add(uint64_t key, const T* items, uint32_t count)
+        {
+            return addSection(key, &serialLayout<T>(), items, static_cast<uint64_t>(count) * sizeof(T), count);
+        }
+        bool addBlob(uint64_t key, const void* data, uint64_t size)
+        {
+            return addSection(key, nullptr, data, size, 0);
+        }
+
+        void clear();
+
+        // 완성된 스냅숏의 크기.
+        uint64_t size() const;
+
+        // out을 비우고 스냅숏을 씁니다. 용량은 유지하므로 매 프레임 같은 벡터를 넘기면 할당이 없습니다.
+        void finish(std::vector<uint8_t>& out) const;
+        // 경로는 UTF-8입니다. 중간 버퍼 없이 파일에 바로 씁니다.
+        bool write(const char* path) const;
+
+    private:
+        struct PendingSection
+        {
+            uint64_t key;
+            const SerialLayout* layout;
+            const void* data;
+            uint64_t size;
+            uint32_t count;
+        };
+
+        using SinkFn = bool (*)(void* context, const void* data, size_t size);
+
+        bool addSection(uint64_t key, const SerialLayout* layout, const void* data, uint64_t size, uint32_t count);
+        bool emit(SinkFn sink, void* context) const;
+
+        std::vector<PendingSection> m_sections;
+        std::vector<const SerialLayout*> m_layouts;
+    };
+
+    // 스냅숏 리더. open은 표의 범위만 확인하며 데이터를 복사하거나 훑지 않습니다.
+    class AXIS_UTILS_API SnapshotReader
+    {
+    public:
+        // 변환이 필요한 배열은 allocator에서 할당합니다.
+        explicit SnapshotReader(Allocator& allocator = defaultAllocator())
+            : m_allocator(allocator)
+        {
+        }
+
+        SnapshotReader(const SnapshotReader&) = delete;
+        SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+        // data는 리더를 쓰는 동안 유지되어야 합니다. 구역이 타입 정렬에 맞지 않으면 복사해서 읽으므로,
+        // 복사 없이 읽으려면 64바이트 정렬 버퍼(매핑한 파일 등)를 넘깁니다.
+        bool open(const void* data, uint64_t size);
+        // 경로는 UTF-8입니다. 파일을 매핑해 엽니다.
+        bool openFile(const char* path);
+        void close();
+
+        bool isOpen() const { return m_header != nullptr; }
+        uint32_t sectionCount() const { return m_header != nullptr ? m_header->sectionCount : 0; }
+        bool contains(uint64_t key) const { return findSection(key) != nullptr; }
+
+        // 구역이 없거나, 다른 타입의 구역이거나, 변환용 메모리를 얻지 못하면 false.
+        template <typename T>
+        bool read(uint64_t key, SerialArray<T>& out) const;
+
+        // 원시 구역. 없으면 nullptr.
+        const void* blob(uint64_t key, uint64_t& size) const;
+
+    private:
+        const SnapshotSection* findSection(uint64_t key) const;
+        const SerialLayoutRecord* layoutOf(const SnapshotSection& section) const;
+
+        // 저장된 레코드를 current 레이아웃으로 옮깁니다. dst는 기본값으로 채워져 있어야 합니다.
+        static void convertRecords(const SerialLayoutRecord& stored, const uint8_t* src, uint32_t count,
+                                   const SerialLayout& current, uint8_t* dst);
+
+        Allocator& m_allocator;
+        MappedFile m_file;
+        const uint8_t* m_data = nullptr;
+        uint64_t m_size = 0;
+        const SnapshotHeader* m_header = nullptr;
+        const SnapshotSection* m_sections = nullptr;
+    };
+
+    template <typename T>
+    bool SnapshotReader::read(uint64_t key, SerialArray<T>& out) const
+    {
+        out.reset();
+        const SnapshotSection* section = findSection(key);
+        const SerialLayoutRecord* stored = section != nullptr ? layoutOf(*section) : nullptr;
+        const SerialLayout& current = serialLayout<T>();
+        if (stored == nullptr || stored->typeHash != current.record.typeHash)
+        {
+            return false;
+        }
+
+        // layoutHash는 파일에서 읽은 값일 뿐이므로, 레코드 크기까지 같을 때만 구역을 T 배열로 그대로 내줍니다.
+        const uint8_t* src = m_data + section->offset;
+        if (stored->layoutHash == current.record.layoutHash && stored->version == current.record.version &&
+            stored->size == sizeof(T) && reinterpret_cast<uintptr_t>(src) % alignof(T) == 0)
+        {
+            out.m_data = reinterpret_cast<const T*>(src);
+            out.m_count = section->count;
+            return true;
+        }
+
+        T* converted = nullptr;
+        if (section->count != 0)
+        {
+            converted = static_cast<T*>(m_allocator.allocate(sizeof(T) * section->count, alignof(T)));
+            if (converted == nullptr)
+            {
+                return false;
+            }
+        }
+        for (uint32_t i = 0; i < section->count; ++i)
+        {
+            new (&converted[i]) T();
+        }
+        convertRecords(*stored, src, section->count, current, reinterpret_cast<uint8_t*>(converted));
+        if constexpr (detail::HasSerialUpgrade<T>)
+        {
+            if (stored->version < current.record.version)
+            {
+                for (uint32_t i = 0; i < section->count; ++i)
+                {
+                    SerialSchema<T>::upgrade(converted[i], stored->version);
+                }
+            }
+        }
+
+        out.m_data = converted;
+        out.m_count = section->count;
+        out.m_allocator = converted != nullptr ? &m_allocator : nullptr;
+        return true;
+    }
+
+    // 두 바이트열의 차이를 8바이트 단위 XOR과 같은 단어 건너뛰기로 기록합니다.
+    // 연속된 스냅숏처럼 대부분이 그대로인 데이터에서 변경된 단어만 남으므로 롤백용 기록을 싸게 쌓을 수 있습니다.
+    // 기존 out 내용은 지우며, 용량은 유지합니다.
+    AXIS_UTILS_API void encodeDelta(const void* base, uint64_t baseSize, const void* target, uint64_t targetSize,
+                                    std::vector<uint8_t>& out);
+
+    // base에 delta를 적용해 target을 out에 만듭니다. base가 델타를 만들 때와 다르면(크기, 해시) false.
+    // 델타는 믿을 수 없는 입력으로 다룹니다. targetSize가 base와 델타에 담긴 단어로 만들 수 있는 크기를 넘어도 false.
+    AXIS_UTILS_API bool applyDelta(const void* base, uint64_t baseSize, const void* delta, uint64_t deltaSize,
+                                   std::vector<uint8_t>& out);
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "axis/utils/Allocator.h"
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace axis
+{
+    // SlotMap 핸들. index는 슬롯 위치, generation은 재사용 검출용입니다. 기본값은 항상 무효입니다.
+    struct SlotHandle
+    {
+        uint32_t index = 0;
+        uint32_t generation = 0;
+
+        bool isValid() const { return generation != 0; }
+
+        friend bool operator==(const SlotHandle& a, const SlotHandle& b)
+        {
+            return a.index == b.index && a.generation == b.generation;
+        }
+        friend bool operator!=(const SlotHandle& a, const SlotHandle& b) { return !(a == b); }
+    };
+
+    // 세대 번호 핸들로 접근하는 객체 저장소.
+    //
+    // 값은 빈틈없는 배열에 모여 있어 순회가 연속 메모리 접근이고, 핸들은 슬롯 표를 한 번 거쳐 값을 찾습니다.
+    // 지우면 마지막 값이 빈자리로 옮겨지므로 값의 주소는 바뀌지만 핸들은 지울 때까지 유효하며,
+    // 지운 뒤의 핸들은 슬롯이 재사용되어도 세대가 달라 get()이 nullptr을 반환합니다.
+    template <typename T>
+    class SlotMap
+    {
+    public:
+        explicit SlotMap(Allocator& allocator = defaultAllocator())
+            : m_values(StlAllocator<T>(allocator))
+            , m_owners(StlAllocator<uint32_t>(allocator))
+            , m_slots(StlAllocator<Slot>(allocator))
+        {
+        }
+
+        template <typename... Args>
+        SlotHandle emplace(Args&&... args)
+        {
+            uint32_t index;
+            if (m_freeHead != kNoSlot)
+            {
+                index = m_freeHead;
+                m_freeHead = m_slots[index].dense;
+            }
+            else
+            {
+                index = static_cast<uint32_t>(m_slots.size());
+                m_slots.push_back(Slot{kNoSlot, 1});
+            }
+
+            Slot& slot = m_slots[index];
+            slot.dense = static_cast<uint32_t>(m_values.size());
+            m_values.emplace_back(std::forward<Args>(args)...);
+            m_owners.push_back(index);
+            return SlotHandle{index, slot.generation};
+        }
+
+        SlotHandle insert(const T& value) { return emplace(value); }
+        SlotHandle insert(T&& value) { return emplace(std::move(value)); }
+
+        // 이미 지웠거나 세대가 맞지 않으면 false.
+        bool erase(SlotHandle handle)
+        {
+            if (!contains(handle))
+            {
+                return false;
+            }
+
+            Slot& slot = m_slots[handle.index];
+            const uint32_t dense = slot.dense;
+            const uint32_t last = static_cast<uint32_t>(m_values.size()) - 1;
+            if (dense != last)
+            {
+                m_values[dense] = std::move(m_values[last]);
+                m_owners[dense] = m_owners[last];
+                m_slots[m_owners[dense]].dense = dense;
+            }
+            m_values.pop_back();
+            m_owners.pop_back();
+
+            // 세대 0은 무효 핸들용이므로 건너뜁니다.
+            slot.generation = slot.generation + 1 != 0 ? slot.generation + 1 : 1;
+            slot.dense = m_freeHead;
+            m_freeHead = handle.index;
+            return true;
+        }
+
+        bool contains(SlotHandle handle) const
+        {
+            // 지울 때 세대를 올리므로 세대가 같으면 살아 있는 슬롯입니다.
+            return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation;
+        }
+
+        T* get(SlotHandle handle) { return contains(handle) ? &m_values[m_slots[handle.index].dense] : nullptr; }
+        const T* get(SlotHandle handle) const
+        {
+            return contains(handle) ? &m_values[m_slots[handle.index].dense] : nullptr;
+        }
+
+        // 모든 핸들을 무효로 만듭니다. 슬롯 표와 값 배열의 용량은 유지합니다.
+        void clear()
+        {
+            for (uint32_t index : m_owners)
+            {
+                Slot& slot = m_slots[index];
+                slot.generation = slot.generation + 1 != 0 ? slot.generation + 1 : 1;
+                slot.dense = m_freeHead;
+                m_freeHead = index;
+            }
+            m_values.clear();
+            m_owners.clear();
+        }
+
+        void reserve(uint32_t count)
+        {
+            m_values.reserve(count);
+            m_owners.reserve(count);
+            m_slots.reserve(count);
+        }
+
+        uint32_t size() const { return static_cast<uint32_t>(m_values.size()); }
+        bool empty() const { return m_values.empty(); }
+
+        // 빈틈없는 값 배열. 순서는 삽입/삭제에 따라 바뀝니다.
+        T* data() { return m_values.data(); }
+        const T* data() const { return m_values.data(); }
+        T* begin() { return m_values.data(); }
+        T* end() { return m_values.data() + m_values.size(); }
+        const T* begin() const { return m_values.data(); }
+        const T* end() const { return m_values.data() + m_values.size(); }
+
+        // 값 배열의 dense번째 값을 가리키는 핸들.
+        SlotHandle handleAt(uint32_t dense) const
+        {
+            assert(dense < m_values.size() && "SlotMap 범위를 벗어났습니다");
+            const uint32_t index = m_owners[dense];
+            return SlotHandle{index, m_slots[index].generation};
+        }
+
+    private:
+        static constexpr uint32_t kNoSlot = 0xFFFFFFFFu;
+
+        // 살아 있는 슬롯은 dense에 값 위치를, 빈 슬롯은 다음 빈 슬롯을 가집니다.
+        struct Slot
+        {
+            uint32_t dense;
+            uint32_t generation;
+        };
+
+        std::vector<T, StlAllocator<T>> m_values;
+        std::vector<uint32_t, StlAllocator<uint32_t>> m_owners;
+        std::vector<Slot, StlAllocator<Slot>> m_slots;
+        uint32_t m_freeHead = kNoSlot;
+    };
+}
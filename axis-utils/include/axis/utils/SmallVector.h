@@ -0,0 +1,303 @@
+#pragma once
+
+#include "axis/utils/Allocator.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace axis
+{
+    // 원소 N개까지는 객체 안의 저장 공간을 쓰고, 넘으면 할당자에서 힙 버퍼를 잡는 가변 배열.
+    //
+    // 엔티티나 리소스마다 몇 개 안 되는 목록을 std::vector로 두면 목록마다 할당과 포인터 추적이 생기는데,
+    // 대부분이 N개 안에 들어가면 할당 없이 소유 객체와 같은 캐시 라인에 놓입니다.
+    // 할당 실패는 디버그 빌드에서 assert로 알리고, 실패한 연산은 원소를 바꾸지 않은 채 실패를 반환합니다.
+    // 원소를 옮길 때 이동 생성자를 쓰므로 이동이 예외를 던지지 않아야 합니다.
+    template <typename T, uint32_t N>
+    class SmallVector
+    {
+        static_assert(N > 0, "인라인 용량이 0이면 std::vector를 사용합니다");
+
+    public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        explicit SmallVector(Allocator& allocator = defaultAllocator())
+            : m_allocator(&allocator)
+        {
+        }
+
+        SmallVector(std::initializer_list<T> values, Allocator& allocator = defaultAllocator())
+            : m_allocator(&allocator)
+        {
+            reserve(static_cast<uint32_t>(values.size()));
+            for (const T& value : values)
+            {
+                pushBack(value);
+            }
+        }
+
+        SmallVector(const SmallVector& other)
+            : m_allocator(other.m_allocator)
+        {
+            copyFrom(other);
+        }
+
+        SmallVector(SmallVector&& other) noexcept
+            : m_allocator(other.m_allocator)
+        {
+            moveFrom(other);
+        }
+
+        SmallVector& operator=(const SmallVector& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        SmallVector& operator=(SmallVector&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                releaseHeap();
+                m_allocator = other.m_allocator;
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        ~SmallVector()
+        {
+            clear();
+            releaseHeap();
+        }
+
+        T* data() { return m_data; }
+        const T* data() const { return m_data; }
+        uint32_t size() const { return m_size; }
+        uint32_t capacity() const { return m_capacity; }
+        bool empty() const { return m_size == 0; }
+        // 원소가 아직 객체 안의 저장 공간에 있으면 true.
+        bool isInline() const { return m_data == inlineData(); }
+        static constexpr uint32_t inlineCapacity() { return N; }
+
+        iterator begin() { return m_data; }
+        iterator end() { return m_data + m_size; }
+        const_iterator begin() const { return m_data; }
+        const_iterator end() const { return m_data + m_size; }
+
+        T& operator[](uint32_t index)
+        {
+            assert(index < m_size && "SmallVector 범위를 벗어났습니다");
+            return m_data[index];
+        }
+
+        const T& operator[](uint32_t index) const
+        {
+            assert(index < m_size && "SmallVector 범위를 벗어났습니다");
+            return m_data[index];
+        }
+
+        T& front() { return (*this)[0]; }
+        const T& front() const { return (*this)[0]; }
+        T& back() { return (*this)[m_size - 1]; }
+        const T& back() const { return (*this)[m_size - 1]; }
+
+        // 용량을 capacity 이상으로 늘립니다. 할당에 실패하면 false.
+        bool reserve(uint32_t capacity)
+        {
+            if (capacity <= m_capacity)
+            {
+                return true;
+            }
+
+            T* data = static_cast<T*>(m_allocator->allocate(sizeof(T) * capacity, alignof(T)));
+            if (data == nullptr)
+            {
+                assert(false && "SmallVector 할당에 실패했습니다");
+                return false;
+            }
+            relocate(m_data, m_size, data);
+            releaseHeap();
+            m_data = data;
+            m_capacity = capacity;
+            return true;
+        }
+
+        // 새 원소를 반환합니다. 늘리다 할당에 실패하면 원소를 바꾸지 않고 nullptr.
+        template <typename... Args>
+        T* emplaceBack(Args&&... args)
+        {
+            if (m_size == m_capacity)
+            {
+                // 인자가 자기 원소를 가리킬 수 있으므로 새 버퍼에 먼저 만들고 나서 옮깁니다.
+                const uint32_t capacity = m_capacity * 2;
+                T* data = static_cast<T*>(m_allocator->allocate(sizeof(T) * capacity, alignof(T)));
+                if (data == nullptr)
+                {
+                    assert(false && "SmallVector 할당에 실패했습니다");
+                    return nullptr;
+                }
+                new (data + m_size) T(std::forward<Args>(args)...);
+                relocate(m_data, m_size, data);
+                releaseHeap();
+                m_data = data;
+                m_capacity = capacity;
+                return &m_data[m_size++];
+            }
+            T* slot = new (m_data + m_size) T(std::forward<Args>(args)...);
+            ++m_size;
+            return slot;
+        }
+
+        // 할당에 실패하면 false.
+        bool pushBack(const T& value) { return emplaceBack(value) != nullptr; }
+        bool pushBack(T&& value) { return emplaceBack(std::move(value)) != nullptr; }
+
+        void popBack()
+        {
+            assert(m_size > 0 && "빈 SmallVector입니다");
+            m_data[--m_size].~T();
+        }
+
+        // 늘어나는 원소는 값 초기화됩니다.
+        bool resize(uint32_t size)
+        {
+            if (!reserve(size))
+            {
+                return false;
+            }
+            while (m_size < size)
+            {
+                new (m_data + m_size) T();
+                ++m_size;
+            }
+            while (m_size > size)
+            {
+                popBack();
+            }
+            return true;
+        }
+
+        // 순서를 유지하며 지웁니다. 지운 자리의 다음 원소를 가리키는 반복자를 반환합니다.
+        iterator erase(const_iterator position)
+        {
+            T* target = m_data + (position - m_data);
+            for (T* it = target; it + 1 != end(); ++it)
+            {
+                *it = std::move(*(it + 1));
+            }
+            popBack();
+            return target;
+        }
+
+        // 마지막 원소로 빈자리를 채웁니다. 순서가 필요 없을 때 씁니다.
+        void swapErase(uint32_t index)
+        {
+            assert(index < m_size && "SmallVector 범위를 벗어났습니다");
+            if (index != m_size - 1)
+            {
+                m_data[index] = std::move(m_data[m_size - 1]);
+            }
+            popBack();
+        }
+
+        // 용량은 유지합니다.
+        void clear()
+        {
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                for (uint32_t i = 0; i < m_size; ++i)
+                {
+                    m_data[i].~T();
+                }
+            }
+            m_size = 0;
+        }
+
+        Allocator& allocator() const { return *m_allocator; }
+
+    private:
+        T* inlineData() { return reinterpret_cast<T*>(m_inline); }
+        const T* inlineData() const { return reinterpret_cast<const T*>(m_inline); }
+
+        static void relocate(T* from, uint32_t count, T* to)
+        {
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                if (count != 0)
+                {
+                    std::memcpy(to, from, sizeof(T) * count);
+                }
+            }
+            else
+            {
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    new (to + i) T(std::move(from[i]));
+                    from[i].~T();
+                }
+            }
+        }
+
+        void releaseHeap()
+        {
+            if (!isInline())
+            {
+                m_allocator->deallocate(m_data, sizeof(T) * m_capacity);
+                m_data = inlineData();
+                m_capacity = N;
+            }
+        }
+
+        void copyFrom(const SmallVector& other)
+        {
+            if (!reserve(other.m_size))
+            {
+                return;
+            }
+            for (uint32_t i = 0; i < other.m_size; ++i)
+            {
+                new (m_data + i) T(other.m_data[i]);
+            }
+            m_size = other.m_size;
+        }
+
+        // 상대가 힙 버퍼를 쓰면 버퍼를 넘겨받고, 객체 안에 있으면 원소를 하나씩 옮깁니다.
+        void moveFrom(SmallVector& other)
+        {
+            if (other.isInline())
+            {
+                relocate(other.m_data, other.m_size, m_data);
+                m_size = other.m_size;
+            }
+            else
+            {
+                m_data = other.m_data;
+                m_size = other.m_size;
+                m_capacity = other.m_capacity;
+                other.m_data = other.inlineData();
+                other.m_capacity = N;
+            }
+            other.m_size = 0;
+        }
+
+        Allocator* m_allocator;
+        T* m_data = inlineData();
+        uint32_t m_size = 0;
+        uint32_t m_capacity = N;
+        alignas(T) unsigned char m_inline[sizeof(T) * N];
+    };
+}
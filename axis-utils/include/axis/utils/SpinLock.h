@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+#endif
+
+namespace axis
+{
+    // 짧은 임계 구역용 스핀 락. std::lock_guard와 함께 사용할 수 있습니다.
+    // 대기 중에는 읽기만 반복하므로 잠금을 가진 스레드의 캐시 라인을 빼앗지 않습니다.
+    class SpinLock
+    {
+    public:
+        void lock()
+        {
+            for (;;)
+            {
+                if (!m_locked.exchange(true, std::memory_order_acquire))
+                {
+                    return;
+                }
+
+                uint32_t spins = 0;
+                while (m_locked.load(std::memory_order_relaxed))
+                {
+                    if (++spins < 64)
+                    {
+                        relax();
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        }
+
+        bool try_lock()
+        {
+            return !m_locked.load(std::memory_order_relaxed) && !m_locked.exchange(true, std::memory_order_acquire);
+        }
+
+        void unlock() { m_locked.store(false, std::memory_order_release); }
+
+    private:
+        static void relax()
+        {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+            _mm_pause();
+#endif
+        }
+
+        std::atomic<bool> m_locked{false};
+    };
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "axis/platform/AsyncIo.h"
+#include "axis/utils/Allocator.h"
+#include "axis/utils/AssetArchive.h"
+#include "axis/utils/Export.h"
+#include "axis/utils/PoolAllocator.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace axis
+{
+    using StreamResourceId = uint32_t;
+
+    constexpr StreamResourceId kInvalidStreamResource = 0xFFFFFFFFu;
+
+    struct StreamingDesc
+    {
+        // 상주 바이트 + 읽는 중인 바이트(대상 버퍼와 압축 해제용 임시 버퍼)의 상한.
+        uint64_t budgetBytes = 512ull * 1024 * 1024;
+        // 동시에 AsyncIo에 넘겨 둘 최대 로드 수.
+        uint32_t maxInFlightLoads = 32;
+        // update 한 번에 새로 제출하는 최대 로드 수. 첫 프레임에 요청이 몰려도 제출이 한 프레임을 잡아먹지 않습니다.
+        uint32_t maxLoadsPerUpdate = 16;
+    };
+
+    struct StreamingStats
+    {
+        uint64_t residentBytes = 0;
+        uint64_t inFlightBytes = 0;
+        uint64_t peakBytes = 0;
+        uint64_t evictedBytes = 0;
+        uint32_t evictedLevels = 0;
+        uint32_t loadsIssued = 0;
+        uint32_t loadsCompleted = 0;
+        uint32_t loadsFailed = 0;
+        // 예산이 모자라 다음 update로 미룬 횟수. 계속 늘어나면 예산이 요청량보다 작은 것입니다.
+        uint32_t budgetDeferrals = 0;
+    };
+
+    // 예산 안에서 에셋을 비동기로 읽어 들이는 스트리밍 관리자.
+    //
+    // 리소스는 단계(mip/LOD) 목록으로 등록하며, 단계마다 아카이브 항목 하나가 대응합니다.
+    // 0이 가장 정밀한 단계이고 뒤로 갈수록 작아집니다. 로드는 가장 거친 단계부터 하나씩 진행하므로
+    // 상주 단계는 항상 [residentLevel, levelCount) 연속 구간이며, 필요한 단계가 오기 전까지 거친 단계를 쓸 수 있습니다.
+    //
+    // 읽는 중인 바이트도 예산에 포함됩니다. 자리가 모자라면 다음 순서로 단계를 내립니다.
+    //   1) 이번 프레임에 요청되지 않은 리소스: 우선순위가 낮은 것부터, 오래 쓰지 않은 것부터 전부
+    //   2) 요청된 리소스가 요청보다 정밀하게 들고 있는 단계
+    //   3) 요청자보다 우선순위가 낮은 리소스의 가장 거친 단계를 뺀 나머지
+    // 그래도 모자라면 그 요청과 이후 요청은 다음 update로 미룹니다.
+    //
+    // request/update와 조회는 한 스레드에서 호출합니다. levelData가 돌려준 포인터는 다음 update까지 유효합니다.
+    // 압축된 항목은 I/O 완료 콜백에서 풀므로, AsyncIo에 IoJobBridge를 연결하면 워커에서 풀립니다.
+    class AXIS_UTILS_API StreamingManager
+    {
+    public:
+        // file은 archive와 같은 파일을 io로 연 것입니다. allocator가 없으면 "utils.streaming" 태그로 할당합니다.
+        StreamingManager(AsyncIo& io, AsyncFileId file, const AssetArchive& archive, const StreamingDesc& desc = {},
+                         Allocator* allocator = nullptr);
+        ~StreamingManager();
+
+        StreamingManager(const StreamingManager&) = delete;
+        StreamingManager& operator=(const StreamingManager&) = delete;
+
+        // levelNames[0]이 가장 정밀한 단계입니다. 아카이브에 없는 이름이 있으면 kInvalidStreamResource.
+        StreamResourceId addResource(const uint64_t* levelNames, uint32_t levelCount);
+        StreamResourceId addResource(uint64_t name) { return addResource(&name, 1); }
+
+        // 이번 프레임에 level까지 필요하다고 알립니다. 한 프레임에 여러 번 부르면
+        // 가장 정밀한 단계와 가장 높은 우선순위를 따릅니다.
+        void request(StreamResourceId id, uint32_t level = 0, IoPriority priority = IoPriority::Normal);
+
+        // 완료된 로드를 반영하고, 필요하면 단계를 내린 뒤 새 로드를 제출합니다. 프레임마다 한 번 호출합니다.
+        void update();
+
+        // 연속으로 상주하는 가장 정밀한 단계. 아무것도 없으면 levelCount입니다.
+        uint32_t residentLevel(StreamResourceId id) const { return m_resources[id].residentLevel; }
+        uint32_t levelCount(StreamResourceId id) const { return m_resources[id].levelCount; }
+        bool isResident(StreamResourceId id, uint32_t level) const { return residentLevel(id) <= level; }
+
+        // 상주하지 않는 단계면 nullptr.
+        const void* levelData(StreamResourceId id, uint32_t level) const;
+        uint64_t levelSize(StreamResourceId id, uint32_t level) const;
+
+        // 예산이 모자라 건너뛴 단계는 다음 update에서 다시 시도합니다.
+        void setBudget(uint64_t budgetBytes);
+        uint64_t budget() const { return m_desc.budgetBytes; }
+
+        uint32_t resourceCount() const { return static_cast<uint32_t>(m_resources.size()); }
+        const StreamingStats& stats() const { return m_stats; }
+
+    private:
+        enum class LevelState : uint8_t
+        {
+            Unloaded,
+            Loading,
+            Resident,
+            Failed,
+            // 예산 전체보다 커서 건너뛴 단계. setBudget이 Unloaded로 되돌립니다.
+            OverBudget,
+        };
+
+        struct Level
+        {
+            const ArchiveEntry* entry = nullptr;
+            void* data = nullptr;
+            LevelState state = LevelState::Unloaded;
+        };
+
+        struct Resource
+        {
+            uint32_t firstLevel = 0;
+            uint32_t levelCount = 0;
+            uint32_t residentLevel = 0;
+            uint32_t desiredLevel = 0;
+            uint64_t lastRequestFrame = 0;
+            IoPriority priority = IoPriority::Low;
+            bool loading = false;
+        };
+
+        // 진행 중인 로드. IoRequest 메모리는 완료가 반영될 때까지 풀에 유지됩니다.
+        struct LoadRequest
+        {
+            IoRequest io;
+            const StreamingManager* owner = nullptr;
+            const ArchiveEntry* entry = nullptr;
+            StreamResourceId resource = kInvalidStreamResource;
+            uint32_t level = 0;
+            void* data = nullptr;
+            void* staging = nullptr;
+            // 압축 해제 결과. I/O 완료 콜백에서 쓰고, status가 공개된 뒤 update에서 읽습니다.
+            bool decoded = false;
+        };
+
+        // 단계를 내릴 후보. tier가 작을수록 먼저 내립니다.
+        struct EvictionCandidate
+        {
+            uint32_t tier;
+            IoPriority priority;
+            uint64_t lastRequestFrame;
+            StreamResourceId resource;
+        };
+
+        static void decodeCompressed(IoRequest& request);
+
+        Level& level(const Resource& resource, uint32_t index) { return m_levels[resource.firstLevel + index]; }
+        const Level& level(const Resource& resource, uint32_t index) const
+        {
+            return m_levels[resource.firstLevel + index];
+        }
+
+        uint64_t usedBytes() const { return m_stats.residentBytes + m_stats.inFlightBytes; }
+        static uint64_t loadCost(const ArchiveEntry& entry)
+        {
+            return entry.size + (AssetArchive::isCompressed(entry) ? entry.storedSize : 0);
+        }
+
+        void pollCompletions();
+        void finishLoad(LoadRequest& load);
+        bool issueLoad(StreamResourceId id);
+        bool makeRoom(uint64_t bytes, IoPriority priority, StreamResourceId requester);
+        void buildCandidates();
+        void evictLevel(Resource& resource);
+
+        AsyncIo& m_io;
+        AsyncFileId m_file;
+        const AssetArchive& m_archive;
+        StreamingDesc m_desc;
+        BudgetTag m_tag;
+        SystemAllocator m_systemAllocator;
+        Allocator& m_allocator;
+
+        std::vector<Resource> m_resources;
+        std::vector<Level> m_levels;
+
+        ObjectPool<LoadRequest> m_loadPool;
+        std::vector<LoadRequest*> m_inFlight;
+
+        // 이번 프레임에 요청된 리소스. update에서 비웁니다.
+        std::vector<StreamResourceId> m_requested;
+
+        std::vector<EvictionCandidate> m_candidates;
+        bool m_candidatesBuilt = false;
+
+        uint64_t m_frame = 1;
+        StreamingStats m_stats;
+    };
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "axis/utils/Export.h"
+#include "axis/utils/Hash.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+// 디버그 빌드에서는 실행 중에 만든 StringId를 모두 인턴 표에 기록해 str()로 되짚을 수 있게 합니다.
+// 릴리스에서는 StringId::intern으로 명시한 문자열만 기록합니다.
+#if !defined(AXIS_STRING_ID_DEBUG)
+    #if defined(NDEBUG)
+        #define AXIS_STRING_ID_DEBUG 0
+    #else
+        #define AXIS_STRING_ID_DEBUG 1
+    #endif
+#endif
+
+namespace axis
+{
+    // 이름의 64비트 해시. 컴포넌트, 셰이더, 에셋처럼 이름으로 찾는 대상의 키로 씁니다.
+    //
+    // 비교와 해시가 정수 하나이고 할당이 없습니다. 리터럴("name"_sid)은 릴리스에서 컴파일 시점에 계산됩니다.
+    // 원래 문자열은 전역 인턴 표에 있을 때만 str()로 얻을 수 있습니다. 값 0은 무효 ID입니다.
+    class AXIS_UTILS_API StringId
+    {
+    public:
+        constexpr StringId() = default;
+        constexpr explicit StringId(uint64_t value)
+            : m_value(value)
+        {
+        }
+
+        constexpr explicit StringId(std::string_view text)
+            : m_value(fnv1a64(text))
+        {
+#if AXIS_STRING_ID_DEBUG
+            if (!std::is_constant_evaluated())
+            {
+                record(m_value, text);
+            }
+#endif
+        }
+
+        constexpr explicit StringId(const char* text)
+            : StringId(std::string_view(text))
+        {
+        }
+
+        // 문자열을 인턴 표에 복사해 두고 ID를 반환합니다. 빌드 설정과 무관하게 str()로 되짚을 수 있습니다.
+        // 실행 중에 읽어 들인 이름(에셋 목록 등)에 씁니다. 여러 스레드에서 잠금 없이 호출할 수 있습니다.
+        static StringId intern(std::string_view text);
+
+        constexpr uint64_t value() const { return m_value; }
+        constexpr bool isValid() const { return m_value != 0; }
+
+        // 인턴 표에 기록된 문자열. 없으면 nullptr. 반환한 포인터는 프로세스 수명 동안 유효합니다.
+        const char* str() const;
+
+        friend constexpr bool operator==(StringId a, StringId b) { return a.m_value == b.m_value; }
+        friend constexpr bool operator!=(StringId a, StringId b) { return a.m_value != b.m_value; }
+        friend constexpr bool operator<(StringId a, StringId b) { return a.m_value < b.m_value; }
+
+    private:
+        static void record(uint64_t value, std::string_view text);
+
+        uint64_t m_value = 0;
+    };
+
+    // 인턴 표 상태. 디버그 도구와 메모리 보고용입니다.
+    struct StringTableStats
+    {
+        uint32_t count = 0;
+        // 지금 새 이름을 받는 가장 새 표의 슬롯 수. 표는 차면 두 배로 커집니다.
+        uint32_t capacity = 0;
+        uint64_t stringBytes = 0;
+        // 같은 해시에 다른 문자열이 들어온 횟수. 0이 아니면 이름을 바꿔야 합니다.
+        uint32_t collisions = 0;
+        // 메모리가 모자라 문자열이나 표를 잡지 못해 str()로 되짚을 수 없게 된 이름 수.
+        uint32_t dropped = 0;
+    };
+
+    AXIS_UTILS_API StringTableStats stringTableStats();
+
+    inline namespace literals
+    {
+#if AXIS_STRING_ID_DEBUG
+        // 디버그에서는 실행 중에 평가되는 리터럴도 문자열을 기록하도록 constexpr로 둡니다.
+        // 상수 식(constexpr 변수, case 라벨)에서 쓴 리터럴은 기록되지 않습니다.
+        constexpr StringId operator""_sid(const char* text, size_t length)
+        {
+            return StringId(std::string_view(text, length));
+        }
+#else
+        consteval StringId operator""_sid(const char* text, size_t length)
+        {
+            return StringId(fnv1a64(std::string_view(text, length)));
+        }
+#endif
+    }
+}
+
+template <>
+struct std::hash<axis::StringId>
+{
+    size_t operator()(axis::StringId id) const noexcept { return static_cast<size_t>(id.value()); }
+};
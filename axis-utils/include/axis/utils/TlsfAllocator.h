@@ -0,0 +1,77 @@
+#pragma once
+
+#include "axis/utils/Allocator.h"
+#include "axis/utils/Export.h"
+#include "axis/utils/SpinLock.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace axis
+{
+    // TLSF(Two-Level Segregated Fit) 범용 힙 (Masmano et al. 2004).
+    //
+    // 크기 구간을 2단계 비트맵으로 나누어 할당과 해제를 모두 O(1)로 처리하고,
+    // 해제 시 인접한 빈 블록을 즉시 병합해 단편화를 억제합니다.
+    // 블록마다 16바이트 헤더가 붙으며 기본 정렬은 16바이트입니다.
+    // 풀이 부족하면 growSize만큼 상위 할당자에서 새 풀을 확보합니다(growSize가 0이면 실패).
+    class AXIS_UTILS_API TlsfAllocator final : public Allocator
+    {
+    public:
+        struct Stats
+        {
+            size_t poolBytes = 0;
+            size_t usedBytes = 0;
+            size_t freeBytes = 0;
+            size_t largestFreeBlock = 0;
+            uint32_t usedBlocks = 0;
+            uint32_t freeBlocks = 0;
+            uint32_t poolCount = 0;
+        };
+
+        TlsfAllocator(size_t poolSize, BudgetTag tag, Allocator* parent = nullptr, size_t growSize = 0);
+        ~TlsfAllocator() override;
+
+        void* allocate(size_t size, size_t alignment = kDefaultAlignment) override;
+        void deallocate(void* ptr, size_t size) override;
+        const char* name() const override { return "TlsfAllocator"; }
+
+        // 실제로 확보된 블록 크기(요청 크기 이상).
+        size_t blockSize(const void* ptr) const;
+
+        // 모든 블록을 순회하므로 진단용으로만 사용합니다.
+        Stats stats();
+        bool queryFragmentation(FragmentationStats& out) override;
+
+    private:
+        static constexpr uint32_t kAlignLog2 = 4;
+        static constexpr size_t kAlignSize = size_t{1} << kAlignLog2;
+        static constexpr uint32_t kSlLog2 = 5;
+        static constexpr uint32_t kSlCount = 1u << kSlLog2;
+        static constexpr uint32_t kFlShift = kSlLog2 + kAlignLog2;
+        static constexpr uint32_t kFlMax = 40;
+        static constexpr uint32_t kFlCount = kFlMax - kFlShift + 1;
+        static constexpr size_t kSmallBlockSize = size_t{1} << kFlShift;
+        static constexpr size_t kMaxBlockSize = size_t{1} << kFlMax;
+
+        struct Block;
+        struct PoolHeader;
+
+        bool addPool(size_t bytes);
+        Block* findFree(size_t size);
+        void insertFree(Block* block);
+        void removeFree(Block* block);
+        Block* split(Block* block, size_t size);
+
+        static void mapping(size_t size, uint32_t& fl, uint32_t& sl);
+
+        Allocator* m_parent;
+        size_t m_growSize;
+
+        mutable SpinLock m_lock;
+        uint32_t m_flBitmap = 0;
+        uint32_t m_slBitmap[kFlCount] = {};
+        Block* m_freeLists[kFlCount][kSlCount] = {};
+        PoolHeader* m_pools = nullptr;
+    };
+}
@@ -0,0 +1,70 @@
+#include "axis/utils/Allocator.h"
+
+#include "axis/utils/MemoryTracker.h"
+
+#include <cstdlib>
+
+#if defined(_WIN32)
+    #include <malloc.h>
+#endif
+
+namespace axis
+{
+    namespace
+    {
+        // 해제 시 정렬 값이 필요 없는 플랫폼 함수를 직접 사용합니다.
+        void* alignedMalloc(size_t size, size_t alignment)
+        {
+#if defined(_WIN32)
+            return _aligned_malloc(size, alignment);
+#else
+            void* memory = nullptr;
+            return posix_memalign(&memory, alignment, size) == 0 ? memory : nullptr;
+#endif
+        }
+
+        void alignedFree(void* ptr)
+        {
+#if defined(_WIN32)
+            _aligned_free(ptr);
+#else
+            std::free(ptr);
+#endif
+        }
+    }
+
+    void* SystemAllocator::allocate(size_t size, size_t alignment)
+    {
+        if (alignment < kDefaultAlignment)
+        {
+            alignment = kDefaultAlignment;
+        }
+
+        void* memory = alignedMalloc(size != 0 ? size : 1, alignment);
+        if (memory != nullptr)
+        {
+            MemoryBudget::onReserve(tag(), size);
+            MemoryBudget::onAllocate(tag(), size);
+            AXIS_MEMORY_TRACK_ALLOC(tag(), memory, size);
+        }
+        return memory;
+    }
+
+    void SystemAllocator::deallocate(void* ptr, size_t size)
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        AXIS_MEMORY_TRACK_FREE(ptr);
+        MemoryBudget::onFree(tag(), size);
+        MemoryBudget::onRelease(tag(), size);
+        alignedFree(ptr);
+    }
+
+    Allocator& defaultAllocator()
+    {
+        static SystemAllocator s_allocator(kUntaggedBudget);
+        return s_allocator;
+    }
+}
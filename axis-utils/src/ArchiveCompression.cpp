@@ -0,0 +1,118 @@
+#include "ArchiveCompression.h"
+
+#include <cstring>
+
+#if defined(AXIS_UTILS_WITH_LZ4)
+    #include <lz4.h>
+    #include <lz4hc.h>
+#endif
+#if defined(AXIS_UTILS_WITH_ZSTD)
+    #include <zstd.h>
+#endif
+
+namespace axis
+{
+    bool isArchiveCompressionAvailable(ArchiveCompression compression)
+    {
+        switch (compression)
+        {
+        case ArchiveCompression::None:
+            return true;
+        case ArchiveCompression::Lz4:
+#if defined(AXIS_UTILS_WITH_LZ4)
+            return true;
+#else
+            return false;
+#endif
+        case ArchiveCompression::Zstd:
+#if defined(AXIS_UTILS_WITH_ZSTD)
+            return true;
+#else
+            return false;
+#endif
+        }
+        return false;
+    }
+
+    namespace detail
+    {
+        uint32_t compressChunk(ArchiveCompression compression, [[maybe_unused]] const void* src, uint32_t size,
+                               std::vector<uint8_t>& out)
+        {
+            const size_t base = out.size();
+            size_t written = 0;
+            switch (compression)
+            {
+            case ArchiveCompression::None:
+                return 0;
+            case ArchiveCompression::Lz4:
+#if defined(AXIS_UTILS_WITH_LZ4)
+            {
+                // 오프라인 작성이므로 압축률이 좋은 HC를 쓰고, 읽을 때는 일반 LZ4 디코더로 풉니다.
+                const int bound = LZ4_compressBound(static_cast<int>(size));
+                out.resize(base + static_cast<size_t>(bound));
+                const int result = LZ4_compress_HC(static_cast<const char*>(src), reinterpret_cast<char*>(&out[base]),
+                                                   static_cast<int>(size), bound, LZ4HC_CLEVEL_DEFAULT);
+                written = result > 0 ? static_cast<size_t>(result) : 0;
+                break;
+            }
+#else
+                return 0;
+#endif
+            case ArchiveCompression::Zstd:
+#if defined(AXIS_UTILS_WITH_ZSTD)
+            {
+                const size_t bound = ZSTD_compressBound(size);
+                out.resize(base + bound);
+                const size_t result = ZSTD_compress(&out[base], bound, src, size, 19);
+                written = ZSTD_isError(result) ? 0 : result;
+                break;
+            }
+#else
+                return 0;
+#endif
+            }
+
+            if (written == 0 || written >= size)
+            {
+                out.resize(base);
+                return 0;
+            }
+            out.resize(base + written);
+            return static_cast<uint32_t>(written);
+        }
+
+        bool decompressChunk(ArchiveCompression compression, const void* src, uint32_t srcSize, void* dst,
+                             uint32_t dstSize)
+        {
+            switch (compression)
+            {
+            case ArchiveCompression::None:
+                if (srcSize != dstSize)
+                {
+                    return false;
+                }
+                std::memcpy(dst, src, dstSize);
+                return true;
+            case ArchiveCompression::Lz4:
+#if defined(AXIS_UTILS_WITH_LZ4)
+                return LZ4_decompress_safe(static_cast<const char*>(src), static_cast<char*>(dst),
+                                           static_cast<int>(srcSize), static_cast<int>(dstSize)) ==
+                       static_cast<int>(dstSize);
+#else
+                return false;
+#endif
+            case ArchiveCompression::Zstd:
+#if defined(AXIS_UTILS_WITH_ZSTD)
+            {
+                const size_t result = ZSTD_decompress(dst, dstSize, src, srcSize);
+                return !ZSTD_isError(result) && result == dstSize;
+            }
+#else
+                return false;
+#endif
+            }
+            return false;
+        }
+    }
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "axis/utils/AssetArchive.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace axis::detail
+{
+    // src를 out 끝에 압축해 붙입니다. 코덱이 없거나 크기가 줄지 않으면 아무것도 붙이지 않고 0을 반환합니다.
+    uint32_t compressChunk(ArchiveCompression compression, const void* src, uint32_t size, std::vector<uint8_t>& out);
+
+    // 정확히 dstSize 바이트로 풀리면 true.
+    bool decompressChunk(ArchiveCompression compression, const void* src, uint32_t srcSize, void* dst,
+                         uint32_t dstSize);
+}
@@ -0,0 +1,181 @@
+#include "axis/utils/AssetArchive.h"
+
+#include "ArchiveCompression.h"
+
+#include <algorithm>
+
+namespace axis
+{
+    namespace
+    {
+        bool inRange(uint64_t offset, uint64_t size, uint64_t fileSize)
+        {
+            return offset <= fileSize && size <= fileSize - offset;
+        }
+    }
+
+    bool AssetArchive::open(const char* path)
+    {
+        close();
+        if (!m_file.open(path) || m_file.size() < sizeof(ArchiveHeader))
+        {
+            m_file.close();
+            return false;
+        }
+
+        const uint8_t* base = m_file.data();
+        const uint64_t fileSize = m_file.size();
+        const ArchiveHeader* header = reinterpret_cast<const ArchiveHeader*>(base);
+        const bool valid = header->magic == kArchiveMagic && header->version == kArchiveVersion &&
+                           header->fileSize == fileSize &&
+                           inRange(header->entriesOffset, uint64_t(header->entryCount) * sizeof(ArchiveEntry), fileSize) &&
+                           inRange(header->chunksOffset, uint64_t(header->chunkCount) * sizeof(ArchiveChunk), fileSize) &&
+                           inRange(header->namesOffset, header->namesSize, fileSize) &&
+                           header->entriesOffset % alignof(ArchiveEntry) == 0 &&
+                           header->chunksOffset % alignof(ArchiveChunk) == 0;
+        if (!valid)
+        {
+            m_file.close();
+            return false;
+        }
+
+        const ArchiveEntry* entries = reinterpret_cast<const ArchiveEntry*>(base + header->entriesOffset);
+        const char* names = reinterpret_cast<const char*>(base + header->namesOffset);
+
+        // data()/read()/name()는 매핑을 바로 가리키므로, 항목과 조각의 범위, 이름 위치를 여기서 한 번에 검사합니다.
+        // 압축 항목은 storedSize가 모든 조각을 덮습니다. 이름 블록은 '\0'으로 끝나야 name()이 블록 밖으로 읽지 않습니다.
+        const ArchiveChunk* chunks = reinterpret_cast<const ArchiveChunk*>(base + header->chunksOffset);
+        bool entriesValid = header->namesSize == 0 || names[header->namesSize - 1] == '\0';
+        for (uint32_t i = 0; entriesValid && i < header->entryCount; ++i)
+        {
+            const ArchiveEntry& entry = entries[i];
+            entriesValid = entry.nameOffset < header->namesSize &&
+                           inRange(entry.offset, isCompressed(entry) ? entry.storedSize : entry.size, fileSize) &&
+                           uint64_t(entry.firstChunk) + entry.chunkCount <= header->chunkCount;
+        }
+        for (uint32_t i = 0; entriesValid && i < header->chunkCount; ++i)
+        {
+            entriesValid = inRange(chunks[i].offset, chunks[i].storedSize, fileSize);
+        }
+        if (!entriesValid)
+        {
+            m_file.close();
+            return false;
+        }
+
+        m_header = header;
+        m_entries = entries;
+        m_chunks = chunks;
+        m_names = names;
+        return true;
+    }
+
+    void AssetArchive::close()
+    {
+        m_file.close();
+        m_header = nullptr;
+        m_entries = nullptr;
+        m_chunks = nullptr;
+        m_names = nullptr;
+    }
+
+    const ArchiveEntry* AssetArchive::find(uint64_t nameHash) const
+    {
+        if (m_header == nullptr)
+        {
+            return nullptr;
+        }
+        const ArchiveEntry* end = m_entries + m_header->entryCount;
+        const ArchiveEntry* it = std::lower_bound(m_entries, end, nameHash,
+            [](const ArchiveEntry& entry, uint64_t hash) { return entry.nameHash < hash; });
+        return it != end && it->nameHash == nameHash ? it : nullptr;
+    }
+
+    const void* AssetArchive::data(const ArchiveEntry& entry) const
+    {
+        if (!isCompressed(entry))
+        {
+            return m_file.data() + entry.offset;
+        }
+        if (!chunksInRange(entry))
+        {
+            return nullptr;
+        }
+
+        // 모든 조각이 압축에 실패해 원본 그대로 저장됐다면, 조각이 offset부터 빈틈없이 이어지므로 매핑을 그대로 씁니다.
+        uint64_t expected = entry.offset;
+        for (uint32_t i = 0; i < entry.chunkCount; ++i)
+        {
+            const ArchiveChunk& info = chunk(entry, i);
+            if (info.compression != ArchiveCompression::None || info.offset != expected || info.storedSize != info.size ||
+                info.size > m_file.size() - expected)
+            {
+                return nullptr;
+            }
+            expected += info.size;
+        }
+        return expected - entry.offset == entry.size ? m_file.data() + entry.offset : nullptr;
+    }
+
+    bool AssetArchive::read(const ArchiveEntry& entry, void* dst, uint64_t dstSize) const
+    {
+        if (dstSize < entry.size)
+        {
+            return false;
+        }
+        if (!isCompressed(entry))
+        {
+            std::copy_n(m_file.data() + entry.offset, entry.size, static_cast<uint8_t*>(dst));
+            return true;
+        }
+
+        if (!chunksInRange(entry))
+        {
+            return false;
+        }
+
+        // 조각 크기의 합이 entry.size와 다른 항목은 깨졌거나 조작된 것입니다. dst를 넘어 쓰기 전에 거부합니다.
+        uint64_t total = 0;
+        for (uint32_t i = 0; i < entry.chunkCount; ++i)
+        {
+            total += chunk(entry, i).size;
+        }
+        if (total != entry.size)
+        {
+            return false;
+        }
+
+        uint8_t* out = static_cast<uint8_t*>(dst);
+        for (uint32_t i = 0; i < entry.chunkCount; ++i)
+        {
+            const ArchiveChunk& info = chunk(entry, i);
+            const uint8_t* stored = m_file.data() + info.offset;
+            if (!inRange(info.offset, info.storedSize, m_file.size()) ||
+                !detail::decompressChunk(info.compression, stored, info.storedSize, out, info.size))
+            {
+                return false;
+            }
+            out += info.size;
+        }
+        return true;
+    }
+
+    bool AssetArchive::readChunk(const ArchiveEntry& entry, uint32_t index, void* dst, uint32_t dstSize) const
+    {
+        if (!isCompressed(entry) || index >= entry.chunkCount || !chunksInRange(entry))
+        {
+            return false;
+        }
+        const ArchiveChunk& info = chunk(entry, index);
+        if (dstSize < info.size || !inRange(info.offset, info.storedSize, m_file.size()))
+        {
+            return false;
+        }
+        return detail::decompressChunk(info.compression, m_file.data() + info.offset, info.storedSize, dst, info.size);
+    }
+
+    bool AssetArchive::chunksInRange(const ArchiveEntry& entry) const
+    {
+        return uint64_t(entry.firstChunk) + entry.chunkCount <= m_header->chunkCount;
+    }
+}
@@ -0,0 +1,165 @@
+#include "axis/utils/AssetArchiveWriter.h"
+
+#include "ArchiveCompression.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+namespace axis
+{
+    namespace
+    {
+        uint64_t alignUp(uint64_t value, uint64_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        void padTo(std::vector<uint8_t>& bytes, uint64_t alignment)
+        {
+            bytes.resize(static_cast<size_t>(alignUp(bytes.size(), alignment)), 0);
+        }
+    }
+
+    bool AssetArchiveWriter::add(const char* name, const void* data, uint64_t size, ArchiveCompression compression,
+                                 uint32_t chunkSize)
+    {
+        assert(name != nullptr && (data != nullptr || size == 0));
+        const uint64_t hash = archiveNameHash(name);
+        for (const PendingEntry& existing : m_entries)
+        {
+            if (existing.nameHash == hash)
+            {
+                return false;
+            }
+        }
+
+        if (!isArchiveCompressionAvailable(compression) || size == 0)
+        {
+            compression = ArchiveCompression::None;
+        }
+
+        PendingEntry entry;
+        entry.name = name;
+        entry.nameHash = hash;
+        entry.size = size;
+        entry.chunkSize = 0;
+
+        padTo(m_blobs, kArchiveAlignment);
+        entry.blobOffset = m_blobs.size();
+
+        const uint8_t* src = static_cast<const uint8_t*>(data);
+        if (compression == ArchiveCompression::None)
+        {
+            m_blobs.insert(m_blobs.end(), src, src + size);
+        }
+        else
+        {
+            assert(chunkSize != 0);
+            entry.chunkSize = chunkSize;
+            for (uint64_t offset = 0; offset < size; offset += chunkSize)
+            {
+                PendingChunk chunk;
+                chunk.size = static_cast<uint32_t>(std::min<uint64_t>(chunkSize, size - offset));
+                chunk.blobOffset = m_blobs.size();
+                chunk.compression = compression;
+                chunk.storedSize = detail::compressChunk(compression, src + offset, chunk.size, m_blobs);
+                if (chunk.storedSize == 0)
+                {
+                    // 줄지 않는 조각은 원본으로 둡니다.
+                    chunk.compression = ArchiveCompression::None;
+                    chunk.storedSize = chunk.size;
+                    m_blobs.insert(m_blobs.end(), src + offset, src + offset + chunk.size);
+                }
+                entry.chunks.push_back(chunk);
+            }
+        }
+        entry.storedSize = m_blobs.size() - entry.blobOffset;
+        m_entries.push_back(std::move(entry));
+        return true;
+    }
+
+    bool AssetArchiveWriter::write(const char* path) const
+    {
+        std::vector<const PendingEntry*> sorted;
+        sorted.reserve(m_entries.size());
+        for (const PendingEntry& entry : m_entries)
+        {
+            sorted.push_back(&entry);
+        }
+        std::sort(sorted.begin(), sorted.end(),
+            [](const PendingEntry* a, const PendingEntry* b) { return a->nameHash < b->nameHash; });
+
+        // blob은 머리글 바로 뒤에 놓이므로 파일 오프셋은 blob 오프셋 + 머리글 크기입니다.
+        const uint64_t blobBase = alignUp(sizeof(ArchiveHeader), kArchiveAlignment);
+
+        std::vector<ArchiveEntry> entries;
+        std::vector<ArchiveChunk> chunks;
+        std::vector<char> names;
+        entries.reserve(sorted.size());
+        for (const PendingEntry* pending : sorted)
+        {
+            ArchiveEntry entry{};
+            entry.nameHash = pending->nameHash;
+            entry.offset = blobBase + pending->blobOffset;
+            entry.size = pending->size;
+            entry.storedSize = pending->storedSize;
+            entry.nameOffset = static_cast<uint32_t>(names.size());
+            entry.firstChunk = static_cast<uint32_t>(chunks.size());
+            entry.chunkCount = static_cast<uint32_t>(pending->chunks.size());
+            entry.chunkSize = pending->chunkSize;
+            entries.push_back(entry);
+
+            for (const PendingChunk& pendingChunk : pending->chunks)
+            {
+                ArchiveChunk chunk{};
+                chunk.offset = blobBase + pendingChunk.blobOffset;
+                chunk.storedSize = pendingChunk.storedSize;
+                chunk.size = pendingChunk.size;
+                chunk.compression = pendingChunk.compression;
+                chunks.push_back(chunk);
+            }
+            names.insert(names.end(), pending->name.begin(), pending->name.end());
+            names.push_back('\0');
+        }
+
+        ArchiveHeader header{};
+        header.magic = kArchiveMagic;
+        header.version = kArchiveVersion;
+        header.entryCount = static_cast<uint32_t>(entries.size());
+        header.chunkCount = static_cast<uint32_t>(chunks.size());
+        header.entriesOffset = alignUp(blobBase + m_blobs.size(), kArchiveAlignment);
+        header.chunksOffset = alignUp(header.entriesOffset + entries.size() * sizeof(ArchiveEntry), kArchiveAlignment);
+        header.namesOffset = header.chunksOffset + chunks.size() * sizeof(ArchiveChunk);
+        header.namesSize = names.size();
+        header.fileSize = header.namesOffset + header.namesSize;
+
+        std::vector<uint8_t> image(static_cast<size_t>(header.fileSize), 0);
+        std::memcpy(image.data(), &header, sizeof(header));
+        if (!m_blobs.empty())
+        {
+            std::memcpy(image.data() + blobBase, m_blobs.data(), m_blobs.size());
+        }
+        if (!entries.empty())
+        {
+            std::memcpy(image.data() + header.entriesOffset, entries.data(), entries.size() * sizeof(ArchiveEntry));
+        }
+        if (!chunks.empty())
+        {
+            std::memcpy(image.data() + header.chunksOffset, chunks.data(), chunks.size() * sizeof(ArchiveChunk));
+        }
+        if (!names.empty())
+        {
+            std::memcpy(image.data() + header.namesOffset, names.data(), names.size());
+        }
+
+        std::FILE* file = std::fopen(path, "wb");
+        if (file == nullptr)
+        {
+            return false;
+        }
+        const bool written = std::fwrite(image.data(), 1, image.size(), file) == image.size();
+        return std::fclose(file) == 0 && written;
+    }
+}
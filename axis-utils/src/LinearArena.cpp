@@ -0,0 +1,107 @@
+#include "axis/utils/LinearArena.h"
+
+#include <cassert>
+
+namespace axis
+{
+    LinearArena::LinearArena(size_t capacity, BudgetTag tag, Allocator* parent)
+        : Allocator(tag)
+        , m_parent(parent != nullptr ? parent : &defaultAllocator())
+        , m_buffer(static_cast<uint8_t*>(m_parent->allocate(capacity, 64)))
+        , m_capacity(m_buffer != nullptr ? capacity : 0)
+    {
+        MemoryBudget::onReserve(this->tag(), m_capacity);
+    }
+
+    LinearArena::~LinearArena()
+    {
+        reset();
+        MemoryBudget::onRelease(tag(), m_capacity);
+        if (m_buffer != nullptr)
+        {
+            m_parent->deallocate(m_buffer, m_capacity);
+        }
+    }
+
+    void* LinearArena::allocate(size_t size, size_t alignment)
+    {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+        const uintptr_t base = reinterpret_cast<uintptr_t>(m_buffer);
+        size_t offset = m_offset.load(std::memory_order_relaxed);
+        size_t aligned;
+        size_t next;
+        do
+        {
+            aligned = alignUp(base + offset, alignment) - base;
+            next = aligned + size;
+            if (next > m_capacity)
+            {
+                return nullptr;
+            }
+        } while (!m_offset.compare_exchange_weak(offset, next, std::memory_order_relaxed));
+
+        MemoryBudget::onAllocate(tag(), next - offset);
+        return m_buffer + aligned;
+    }
+
+    void LinearArena::deallocate(void*, size_t)
+    {
+        // 개별 해제는 하지 않습니다. reset/rewind로 한 번에 돌려받습니다.
+    }
+
+    void LinearArena::reset()
+    {
+        const size_t used = m_offset.exchange(0, std::memory_order_relaxed);
+        MemoryBudget::onFree(tag(), used);
+    }
+
+    void LinearArena::rewind(Marker marker)
+    {
+        const size_t used = m_offset.load(std::memory_order_relaxed);
+        assert(marker <= used);
+        m_offset.store(marker, std::memory_order_relaxed);
+        MemoryBudget::onFree(tag(), used - marker);
+    }
+
+    bool LinearArena::owns(const void* ptr) const
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(ptr);
+        return bytes >= m_buffer && bytes < m_buffer + m_capacity;
+    }
+
+    FrameArena::FrameArena(size_t capacityPerFrame, uint32_t frameCount, BudgetTag tag, Allocator* parent)
+        : Allocator(tag)
+        , m_frameCount(frameCount)
+        , m_parent(parent != nullptr ? parent : &defaultAllocator())
+    {
+        assert(frameCount >= 1 && frameCount <= kMaxFrames);
+        for (uint32_t i = 0; i < m_frameCount; ++i)
+        {
+            m_arenas[i] = m_parent->create<LinearArena>(capacityPerFrame, tag, m_parent);
+        }
+    }
+
+    FrameArena::~FrameArena()
+    {
+        for (uint32_t i = 0; i < m_frameCount; ++i)
+        {
+            m_parent->destroy(m_arenas[i]);
+        }
+    }
+
+    void* FrameArena::allocate(size_t size, size_t alignment)
+    {
+        return m_arenas[m_current]->allocate(size, alignment);
+    }
+
+    void FrameArena::deallocate(void*, size_t)
+    {
+    }
+
+    void FrameArena::endFrame()
+    {
+        m_current = (m_current + 1) % m_frameCount;
+        m_arenas[m_current]->reset();
+    }
+}
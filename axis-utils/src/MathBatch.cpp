@@ -0,0 +1,467 @@
+#include "axis/utils/MathBatch.h"
+
+#include "MathKernels.h"
+
+#include <atomic>
+#include <cmath>
+
+#if AXIS_MATH_X64
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+namespace axis
+{
+    namespace
+    {
+        using detail::MathKernels;
+
+        // --- Scalar: 기준 구현 ---
+
+        void transformScalar(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count, float w)
+        {
+            const float* e = m.data();
+            for (uint32_t b = 0; b < count; ++b)
+            {
+                for (uint32_t k = 0; k < kBatchWidth; ++k)
+                {
+                    const float x = in[b].x[k];
+                    const float y = in[b].y[k];
+                    const float z = in[b].z[k];
+                    out[b].x[k] = e[0] * x + e[4] * y + e[8] * z + e[12] * w;
+                    out[b].y[k] = e[1] * x + e[5] * y + e[9] * z + e[13] * w;
+                    out[b].z[k] = e[2] * x + e[6] * y + e[10] * z + e[14] * w;
+                }
+            }
+        }
+
+        void transformPointsScalar(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count)
+        {
+            transformScalar(m, in, out, count, 1.0f);
+        }
+
+        void transformDirectionsScalar(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count)
+        {
+            transformScalar(m, in, out, count, 0.0f);
+        }
+
+        void normalizeScalar(const Vec3x8* in, Vec3x8* out, uint32_t count)
+        {
+            for (uint32_t b = 0; b < count; ++b)
+            {
+                for (uint32_t k = 0; k < kBatchWidth; ++k)
+                {
+                    const float x = in[b].x[k];
+                    const float y = in[b].y[k];
+                    const float z = in[b].z[k];
+                    const float lenSq = x * x + y * y + z * z;
+                    const float inverse = lenSq > 0.0f ? 1.0f / std::sqrt(lenSq) : 0.0f;
+                    out[b].x[k] = x * inverse;
+                    out[b].y[k] = y * inverse;
+                    out[b].z[k] = z * inverse;
+                }
+            }
+        }
+
+        void cullSpheresScalar(const float planes[6][4], const Vec3x8* centers, const float* radii, uint32_t count,
+                               uint8_t* outVisible)
+        {
+            for (uint32_t b = 0; b < count; ++b)
+            {
+                uint8_t mask = 0;
+                for (uint32_t k = 0; k < kBatchWidth; ++k)
+                {
+                    bool visible = true;
+                    for (uint32_t i = 0; i < 6 && visible; ++i)
+                    {
+                        const float distance = planes[i][0] * centers[b].x[k] + planes[i][1] * centers[b].y[k] +
+                                               planes[i][2] * centers[b].z[k] + planes[i][3];
+                        visible = distance >= -radii[b * kBatchWidth + k];
+                    }
+                    mask |= visible ? static_cast<uint8_t>(1u << k) : 0;
+                }
+                outVisible[b] = mask;
+            }
+        }
+
+        void multiplyMatricesScalar(const Mat4* a, const Mat4* b, Mat4* out, uint32_t count)
+        {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const float* ea = a[i].data();
+                const float* eb = b[i].data();
+                float r[16];
+                for (uint32_t c = 0; c < 4; ++c)
+                {
+                    for (uint32_t row = 0; row < 4; ++row)
+                    {
+                        r[c * 4 + row] = ea[row] * eb[c * 4] + ea[4 + row] * eb[c * 4 + 1] +
+                                         ea[8 + row] * eb[c * 4 + 2] + ea[12 + row] * eb[c * 4 + 3];
+                    }
+                }
+                float* eo = out[i].data();
+                for (uint32_t k = 0; k < 16; ++k)
+                {
+                    eo[k] = r[k];
+                }
+            }
+        }
+
+        constexpr MathKernels kScalarKernels = {
+            SimdLevel::Scalar,
+            &transformPointsScalar,
+            &transformDirectionsScalar,
+            &normalizeScalar,
+            &cullSpheresScalar,
+            &multiplyMatricesScalar,
+        };
+
+        // --- SSE2 / NEON: 4폭 레지스터로 묶음의 절반씩 처리합니다 ---
+
+#if AXIS_MATH_SSE || AXIS_MATH_NEON
+    #if AXIS_MATH_SSE
+        using Wide = __m128;
+
+        inline Wide loadWide(const float* p) { return _mm_loadu_ps(p); }
+        inline void storeWide(float* p, Wide v) { _mm_storeu_ps(p, v); }
+        inline Wide splatWide(float s) { return _mm_set1_ps(s); }
+        inline Wide maddWide(Wide a, Wide b, Wide c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+        inline Wide mulWide(Wide a, Wide b) { return _mm_mul_ps(a, b); }
+
+        inline Wide inverseLengthWide(Wide lenSq)
+        {
+            const Wide inverse = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(lenSq));
+            return _mm_and_ps(inverse, _mm_cmpgt_ps(lenSq, _mm_setzero_ps()));
+        }
+
+        // distance >= -radius인 레인의 비트 마스크(4비트).
+        inline uint32_t insideMaskWide(const Wide (&distance)[6], Wide radius)
+        {
+            const Wide negRadius = _mm_sub_ps(_mm_setzero_ps(), radius);
+            Wide inside = _mm_cmpge_ps(distance[0], negRadius);
+            for (uint32_t i = 1; i < 6; ++i)
+            {
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(distance[i], negRadius));
+            }
+            return static_cast<uint32_t>(_mm_movemask_ps(inside));
+        }
+    #else
+        using Wide = float32x4_t;
+
+        inline Wide loadWide(const float* p) { return vld1q_f32(p); }
+        inline void storeWide(float* p, Wide v) { vst1q_f32(p, v); }
+        inline Wide splatWide(float s) { return vdupq_n_f32(s); }
+        inline Wide maddWide(Wide a, Wide b, Wide c) { return vfmaq_f32(c, a, b); }
+        inline Wide mulWide(Wide a, Wide b) { return vmulq_f32(a, b); }
+
+        inline Wide inverseLengthWide(Wide lenSq)
+        {
+            const Wide inverse = vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(lenSq));
+            const uint32x4_t positive = vcgtq_f32(lenSq, vdupq_n_f32(0.0f));
+            return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(inverse), positive));
+        }
+
+        inline uint32_t insideMaskWide(const Wide (&distance)[6], Wide radius)
+        {
+            const Wide negRadius = vnegq_f32(radius);
+            uint32x4_t inside = vcgeq_f32(distance[0], negRadius);
+            for (uint32_t i = 1; i < 6; ++i)
+            {
+                inside = vandq_u32(inside, vcgeq_f32(distance[i], negRadius));
+            }
+            const uint32_t lanes[4] = {1, 2, 4, 8};
+            return vaddvq_u32(vandq_u32(inside, vld1q_u32(lanes)));
+        }
+    #endif
+
+        void transformWide(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count, float w)
+        {
+            const float* e = m.data();
+            Wide c[12];
+            for (uint32_t i = 0; i < 12; ++i)
+            {
+                c[i] = splatWide(e[i]);
+            }
+            const Wide tx = splatWide(e[12] * w);
+            const Wide ty = splatWide(e[13] * w);
+            const Wide tz = splatWide(e[14] * w);
+
+            for (uint32_t b = 0; b < count; ++b)
+            {
+                for (uint32_t h = 0; h < kBatchWidth; h += 4)
+                {
+                    const Wide x = loadWide(in[b].x + h);
+                    const Wide y = loadWide(in[b].y + h);
+                    const Wide z = loadWide(in[b].z + h);
+                    const Wide rx = maddWide(c[0], x, maddWide(c[4], y, maddWide(c[8], z, tx)));
+                    const Wide ry = maddWide(c[1], x, maddWide(c[5], y, maddWide(c[9], z, ty)));
+                    const Wide rz = maddWide(c[2], x, maddWide(c[6], y, maddWide(c[10], z, tz)));
+                    storeWide(out[b].x + h, rx);
+                    storeWide(out[b].y + h, ry);
+                    storeWide(out[b].z + h, rz);
+                }
+            }
+        }
+
+        void transformPointsWide(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count)
+        {
+            transformWide(m, in, out, count, 1.0f);
+        }
+
+        void transformDirectionsWide(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count)
+        {
+            transformWide(m, in, out, count, 0.0f);
+        }
+
+        void normalizeWide(const Vec3x8* in, Vec3x8* out, uint32_t count)
+        {
+            for (uint32_t b = 0; b < count; ++b)
+            {
+                for (uint32_t h = 0; h < kBatchWidth; h += 4)
+                {
+                    const Wide x = loadWide(in[b].x + h);
+                    const Wide y = loadWide(in[b].y + h);
+                    const Wide z = loadWide(in[b].z + h);
+                    const Wide inverse = inverseLengthWide(maddWide(x, x, maddWide(y, y, mulWide(z, z))));
+                    storeWide(out[b].x + h, mulWide(x, inverse));
+                    storeWide(out[b].y + h, mulWide(y, inverse));
+                    storeWide(out[b].z + h, mulWide(z, inverse));
+                }
+            }
+        }
+
+        void cullSpheresWide(const float planes[6][4], const Vec3x8* centers, const float* radii, uint32_t count,
+                             uint8_t* outVisible)
+        {
+            Wide p[6][4];
+            for (uint32_t i = 0; i < 6; ++i)
+            {
+                for (uint32_t k = 0; k < 4; ++k)
+                {
+                    p[i][k] = splatWide(planes[i][k]);
+                }
+            }
+
+            for (uint32_t b = 0; b < count; ++b)
+            {
+                uint32_t mask = 0;
+                for (uint32_t h = 0; h < kBatchWidth; h += 4)
+                {
+                    const Wide x = loadWide(centers[b].x + h);
+                    const Wide y = loadWide(centers[b].y + h);
+                    const Wide z = loadWide(centers[b].z + h);
+
+                    Wide distance[6];
+                    for (uint32_t i = 0; i < 6; ++i)
+                    {
+                        distance[i] = maddWide(p[i][0], x, maddWide(p[i][1], y, maddWide(p[i][2], z, p[i][3])));
+                    }
+                    mask |= insideMaskWide(distance, loadWide(radii + b * kBatchWidth + h)) << h;
+                }
+                outVisible[b] = static_cast<uint8_t>(mask);
+            }
+        }
+
+        void multiplyMatricesWide(const Mat4* a, const Mat4* b, Mat4* out, uint32_t count)
+        {
+            // Math.h의 행렬 곱이 이미 4폭 레지스터를 씁니다. 결과를 임시에 받아 별칭을 허용합니다.
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const Mat4 result = a[i] * b[i];
+                out[i] = result;
+            }
+        }
+
+        constexpr MathKernels kWideKernels = {
+    #if AXIS_MATH_SSE
+            SimdLevel::Sse2,
+    #else
+            SimdLevel::Neon,
+    #endif
+            &transformPointsWide,
+            &transformDirectionsWide,
+            &normalizeWide,
+            &cullSpheresWide,
+            &multiplyMatricesWide,
+        };
+#endif
+
+        CpuFeatures detectCpuFeatures()
+        {
+            CpuFeatures features;
+#if AXIS_MATH_X64
+            auto cpuid = [](uint32_t leaf, uint32_t subleaf, uint32_t out[4]) {
+    #if defined(_MSC_VER)
+                int registers[4];
+                __cpuidex(registers, static_cast<int>(leaf), static_cast<int>(subleaf));
+                for (uint32_t i = 0; i < 4; ++i)
+                {
+                    out[i] = static_cast<uint32_t>(registers[i]);
+                }
+    #else
+                __cpuid_count(leaf, subleaf, out[0], out[1], out[2], out[3]);
+    #endif
+            };
+
+            uint32_t regs[4];
+            cpuid(0, 0, regs);
+            const uint32_t maxLeaf = regs[0];
+
+            cpuid(1, 0, regs);
+            features.sse2 = (regs[3] & (1u << 26)) != 0;
+            features.sse41 = (regs[2] & (1u << 19)) != 0;
+            const bool osxsave = (regs[2] & (1u << 27)) != 0;
+            const bool cpuAvx = (regs[2] & (1u << 28)) != 0;
+            const bool cpuFma = (regs[2] & (1u << 12)) != 0;
+
+            // CPU가 지원해도 OS가 YMM/ZMM 상태를 저장하지 않으면 쓸 수 없습니다.
+            uint64_t xcr0 = 0;
+            if (osxsave)
+            {
+    #if defined(_MSC_VER)
+                xcr0 = _xgetbv(0);
+    #else
+                uint32_t eax = 0;
+                uint32_t edx = 0;
+                __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+                xcr0 = (static_cast<uint64_t>(edx) << 32) | eax;
+    #endif
+            }
+            const bool osAvx = (xcr0 & 0x6) == 0x6;
+            const bool osAvx512 = (xcr0 & 0xE6) == 0xE6;
+
+            features.avx = cpuAvx && osAvx;
+            features.fma = cpuFma && osAvx;
+            if (maxLeaf >= 7)
+            {
+                cpuid(7, 0, regs);
+                features.avx2 = features.avx && (regs[1] & (1u << 5)) != 0;
+                features.avx512f = osAvx512 && (regs[1] & (1u << 16)) != 0;
+            }
+#elif AXIS_MATH_NEON
+            features.neon = true;
+#endif
+            return features;
+        }
+
+        const MathKernels* kernelsFor(SimdLevel level)
+        {
+            const CpuFeatures& features = cpuFeatures();
+            switch (level)
+            {
+            case SimdLevel::Scalar:
+                return &kScalarKernels;
+            case SimdLevel::Sse2:
+#if AXIS_MATH_SSE
+                return &kWideKernels;
+#else
+                return nullptr;
+#endif
+            case SimdLevel::Neon:
+#if AXIS_MATH_NEON
+                return &kWideKernels;
+#else
+                return nullptr;
+#endif
+            case SimdLevel::Avx2:
+                return features.avx2 && features.fma ? detail::avx2MathKernels() : nullptr;
+            }
+            return nullptr;
+        }
+
+        const MathKernels* selectBestKernels()
+        {
+            const SimdLevel order[] = {SimdLevel::Avx2, SimdLevel::Neon, SimdLevel::Sse2, SimdLevel::Scalar};
+            for (SimdLevel level : order)
+            {
+                if (const MathKernels* kernels = kernelsFor(level))
+                {
+                    return kernels;
+                }
+            }
+            return &kScalarKernels;
+        }
+
+        std::atomic<const MathKernels*> g_kernels{nullptr};
+
+        const MathKernels& kernels()
+        {
+            const MathKernels* current = g_kernels.load(std::memory_order_acquire);
+            if (current == nullptr)
+            {
+                // 여러 스레드가 동시에 골라도 같은 결과이므로 먼저 쓴 쪽을 따릅니다.
+                const MathKernels* best = selectBestKernels();
+                g_kernels.compare_exchange_strong(current, best, std::memory_order_acq_rel);
+                current = g_kernels.load(std::memory_order_acquire);
+            }
+            return *current;
+        }
+    }
+
+    const CpuFeatures& cpuFeatures()
+    {
+        static const CpuFeatures s_features = detectCpuFeatures();
+        return s_features;
+    }
+
+    SimdLevel activeSimdLevel()
+    {
+        return kernels().level;
+    }
+
+    const char* simdLevelName(SimdLevel level)
+    {
+        switch (level)
+        {
+        case SimdLevel::Scalar:
+            return "scalar";
+        case SimdLevel::Sse2:
+            return "sse2";
+        case SimdLevel::Neon:
+            return "neon";
+        case SimdLevel::Avx2:
+            return "avx2";
+        }
+        return "unknown";
+    }
+
+    bool forceSimdLevel(SimdLevel level)
+    {
+        const MathKernels* selected = kernelsFor(level);
+        if (selected == nullptr)
+        {
+            return false;
+        }
+        g_kernels.store(selected, std::memory_order_release);
+        return true;
+    }
+
+    void transformPoints(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count)
+    {
+        kernels().transformPoints(m, in, out, count);
+    }
+
+    void transformDirections(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count)
+    {
+        kernels().transformDirections(m, in, out, count);
+    }
+
+    void normalize(const Vec3x8* in, Vec3x8* out, uint32_t count)
+    {
+        kernels().normalize(in, out, count);
+    }
+
+    void cullSpheres(const float planes[6][4], const Vec3x8* centers, const float* radii, uint32_t count,
+                     uint8_t* outVisible)
+    {
+        kernels().cullSpheres(planes, centers, radii, count, outVisible);
+    }
+
+    void multiplyMatrices(const Mat4* a, const Mat4* b, Mat4* out, uint32_t count)
+    {
+        kernels().multiplyMatrices(a, b, out, count);
+    }
+}
@@ -0,0 +1,150 @@
+#include "MathKernels.h"
+
+#if AXIS_MATH_X64
+    #include <immintrin.h>
+#endif
+
+namespace axis::detail
+{
+#if AXIS_MATH_X64
+    namespace
+    {
+        AXIS_TARGET_AVX2 void transformAvx2(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count, bool points)
+        {
+            const float* e = m.data();
+            __m256 c[16];
+            for (uint32_t i = 0; i < 16; ++i)
+            {
+                c[i] = _mm256_set1_ps(e[i]);
+            }
+            const __m256 zero = _mm256_setzero_ps();
+
+            for (uint32_t b = 0; b < count; ++b)
+            {
+                const __m256 x = _mm256_loadu_ps(in[b].x);
+                const __m256 y = _mm256_loadu_ps(in[b].y);
+                const __m256 z = _mm256_loadu_ps(in[b].z);
+
+                const __m256 tx = points ? c[12] : zero;
+                const __m256 ty = points ? c[13] : zero;
+                const __m256 tz = points ? c[14] : zero;
+                const __m256 rx = _mm256_fmadd_ps(c[0], x, _mm256_fmadd_ps(c[4], y, _mm256_fmadd_ps(c[8], z, tx)));
+                const __m256 ry = _mm256_fmadd_ps(c[1], x, _mm256_fmadd_ps(c[5], y, _mm256_fmadd_ps(c[9], z, ty)));
+                const __m256 rz = _mm256_fmadd_ps(c[2], x, _mm256_fmadd_ps(c[6], y, _mm256_fmadd_ps(c[10], z, tz)));
+
+                _mm256_storeu_ps(out[b].x, rx);
+                _mm256_storeu_ps(out[b].y, ry);
+                _mm256_storeu_ps(out[b].z, rz);
+            }
+        }
+
+        AXIS_TARGET_AVX2 void transformPointsAvx2(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count)
+        {
+            transformAvx2(m, in, out, count, true);
+        }
+
+        AXIS_TARGET_AVX2 void transformDirectionsAvx2(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count)
+        {
+            transformAvx2(m, in, out, count, false);
+        }
+
+        AXIS_TARGET_AVX2 void normalizeAvx2(const Vec3x8* in, Vec3x8* out, uint32_t count)
+        {
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 one = _mm256_set1_ps(1.0f);
+            for (uint32_t b = 0; b < count; ++b)
+            {
+                const __m256 x = _mm256_loadu_ps(in[b].x);
+                const __m256 y = _mm256_loadu_ps(in[b].y);
+                const __m256 z = _mm256_loadu_ps(in[b].z);
+
+                const __m256 lenSq = _mm256_fmadd_ps(x, x, _mm256_fmadd_ps(y, y, _mm256_mul_ps(z, z)));
+                // rsqrt 근사 대신 정확한 값을 씁니다. 수준마다 결과가 달라지지 않게 하기 위함입니다.
+                const __m256 inverse = _mm256_and_ps(_mm256_div_ps(one, _mm256_sqrt_ps(lenSq)),
+                                                     _mm256_cmp_ps(lenSq, zero, _CMP_GT_OQ));
+
+                _mm256_storeu_ps(out[b].x, _mm256_mul_ps(x, inverse));
+                _mm256_storeu_ps(out[b].y, _mm256_mul_ps(y, inverse));
+                _mm256_storeu_ps(out[b].z, _mm256_mul_ps(z, inverse));
+            }
+        }
+
+        AXIS_TARGET_AVX2 void cullSpheresAvx2(const float planes[6][4], const Vec3x8* centers, const float* radii,
+                                              uint32_t count, uint8_t* outVisible)
+        {
+            __m256 p[6][4];
+            for (uint32_t i = 0; i < 6; ++i)
+            {
+                for (uint32_t k = 0; k < 4; ++k)
+                {
+                    p[i][k] = _mm256_set1_ps(planes[i][k]);
+                }
+            }
+            const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+            for (uint32_t b = 0; b < count; ++b)
+            {
+                const __m256 x = _mm256_loadu_ps(centers[b].x);
+                const __m256 y = _mm256_loadu_ps(centers[b].y);
+                const __m256 z = _mm256_loadu_ps(centers[b].z);
+                const __m256 negRadius = _mm256_xor_ps(_mm256_loadu_ps(radii + b * kBatchWidth), signMask);
+
+                __m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+                for (uint32_t i = 0; i < 6; ++i)
+                {
+                    const __m256 distance =
+                        _mm256_fmadd_ps(p[i][0], x, _mm256_fmadd_ps(p[i][1], y, _mm256_fmadd_ps(p[i][2], z, p[i][3])));
+                    visible = _mm256_and_ps(visible, _mm256_cmp_ps(distance, negRadius, _CMP_GE_OQ));
+                }
+                outVisible[b] = static_cast<uint8_t>(_mm256_movemask_ps(visible));
+            }
+        }
+
+        AXIS_TARGET_AVX2 void multiplyMatricesAvx2(const Mat4* a, const Mat4* b, Mat4* out, uint32_t count)
+        {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                // a의 열을 두 레인에 복제하고, b의 열 두 개를 한 레지스터에 담아 결과 열 두 개를 함께 계산합니다.
+                const __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&a[i].columns[0]));
+                const __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&a[i].columns[1]));
+                const __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&a[i].columns[2]));
+                const __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&a[i].columns[3]));
+                const __m256 b01 = _mm256_loadu_ps(&b[i].columns[0].x);
+                const __m256 b23 = _mm256_loadu_ps(&b[i].columns[2].x);
+
+                __m256 r01 = _mm256_mul_ps(a0, _mm256_shuffle_ps(b01, b01, 0x00));
+                r01 = _mm256_fmadd_ps(a1, _mm256_shuffle_ps(b01, b01, 0x55), r01);
+                r01 = _mm256_fmadd_ps(a2, _mm256_shuffle_ps(b01, b01, 0xAA), r01);
+                r01 = _mm256_fmadd_ps(a3, _mm256_shuffle_ps(b01, b01, 0xFF), r01);
+
+                __m256 r23 = _mm256_mul_ps(a0, _mm256_shuffle_ps(b23, b23, 0x00));
+                r23 = _mm256_fmadd_ps(a1, _mm256_shuffle_ps(b23, b23, 0x55), r23);
+                r23 = _mm256_fmadd_ps(a2, _mm256_shuffle_ps(b23, b23, 0xAA), r23);
+                r23 = _mm256_fmadd_ps(a3, _mm256_shuffle_ps(b23, b23, 0xFF), r23);
+
+                _mm256_storeu_ps(&out[i].columns[0].x, r01);
+                _mm256_storeu_ps(&out[i].columns[2].x, r23);
+            }
+        }
+
+        constexpr MathKernels kAvx2Kernels = {
+            SimdLevel::Avx2,
+            &transformPointsAvx2,
+            &transformDirectionsAvx2,
+            &normalizeAvx2,
+            &cullSpheresAvx2,
+            &multiplyMatricesAvx2,
+        };
+    }
+
+    const MathKernels* avx2MathKernels()
+    {
+        return &kAvx2Kernels;
+    }
+#else
+    const MathKernels* avx2MathKernels()
+    {
+        return nullptr;
+    }
+#endif
+}
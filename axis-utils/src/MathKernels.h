@@ -0,0 +1,35 @@
+#pragma once
+
+#include "axis/utils/MathBatch.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+    #define AXIS_MATH_X64 1
+#else
+    #define AXIS_MATH_X64 0
+#endif
+
+// 전체 빌드 옵션을 높이지 않고 함수 단위로 AVX2/FMA 코드를 생성합니다.
+// MSVC는 /arch 없이도 AVX 내장 함수를 허용하므로 속성이 필요 없습니다.
+#if AXIS_MATH_X64 && (defined(__GNUC__) || defined(__clang__))
+    #define AXIS_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+    #define AXIS_TARGET_AVX2
+#endif
+
+namespace axis::detail
+{
+    // 배치 커널 디스패치 테이블. 수준마다 정적 인스턴스 하나가 있습니다.
+    struct MathKernels
+    {
+        SimdLevel level;
+        void (*transformPoints)(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count);
+        void (*transformDirections)(const Mat4& m, const Vec3x8* in, Vec3x8* out, uint32_t count);
+        void (*normalize)(const Vec3x8* in, Vec3x8* out, uint32_t count);
+        void (*cullSpheres)(const float planes[6][4], const Vec3x8* centers, const float* radii, uint32_t count,
+                            uint8_t* outVisible);
+        void (*multiplyMatrices)(const Mat4* a, const Mat4* b, Mat4* out, uint32_t count);
+    };
+
+    // MathBatchAvx2.cpp. x64가 아니면 nullptr입니다.
+    const MathKernels* avx2MathKernels();
+}
@@ -0,0 +1,146 @@
+#include "axis/utils/MemoryBudget.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <mutex>
+
+namespace axis
+{
+    namespace
+    {
+        // 태그 이름("renderer.pipelinecache" 등)에 충분한 길이. 널 종료 문자를 포함합니다.
+        constexpr size_t kMaxTagNameLength = 48;
+
+        struct BudgetEntry
+        {
+            const char* name = nullptr;
+            // 등록한 DLL이 내려가도 이름이 남도록 복사해 둡니다. 인턴 표(StringId)는 자기 태그를 여기서 받으므로 쓰지 않습니다.
+            char nameStorage[kMaxTagNameLength] = {};
+            MemoryAxis axis = MemoryAxis::Data;
+            std::atomic<uint64_t> limit{0};
+            std::atomic<uint64_t> reserved{0};
+            std::atomic<uint64_t> used{0};
+            std::atomic<uint64_t> peak{0};
+            std::atomic<uint64_t> allocations{0};
+        };
+
+        BudgetEntry g_entries[kMaxBudgetTags];
+        // 0번(미분류)은 항상 존재합니다. 정적 초기화 순서에 의존하지 않도록 상수로 시작합니다.
+        std::atomic<uint32_t> g_count{1};
+        std::mutex g_registerMutex;
+
+        BudgetEntry& entry(BudgetTag tag)
+        {
+            // 범위를 벗어난 태그는 미분류 항목으로 모읍니다.
+            return tag < g_count.load(std::memory_order_acquire) ? g_entries[tag] : g_entries[kUntaggedBudget];
+        }
+
+    }
+
+    BudgetTag MemoryBudget::registerTag(const char* name, MemoryAxis axis, uint64_t limitBytes)
+    {
+        assert(name != nullptr);
+
+        std::lock_guard<std::mutex> lock(g_registerMutex);
+        const uint32_t count = g_count.load(std::memory_order_relaxed);
+        for (uint32_t i = 1; i < count; ++i)
+        {
+            if (std::strcmp(g_entries[i].name, name) == 0)
+            {
+                return static_cast<BudgetTag>(i);
+            }
+        }
+
+        assert(count < kMaxBudgetTags && "예산 태그 수가 kMaxBudgetTags를 넘었습니다");
+        if (count >= kMaxBudgetTags)
+        {
+            return kUntaggedBudget;
+        }
+
+        BudgetEntry& added = g_entries[count];
+        const size_t length = std::strlen(name);
+        assert(length < kMaxTagNameLength && "예산 태그 이름이 너무 깁니다");
+        const size_t copied = length < kMaxTagNameLength ? length : kMaxTagNameLength - 1;
+        std::memcpy(added.nameStorage, name, copied);
+        added.nameStorage[copied] = '\0';
+        added.name = added.nameStorage;
+        added.axis = axis;
+        added.limit.store(limitBytes, std::memory_order_relaxed);
+        g_count.store(count + 1, std::memory_order_release);
+        return static_cast<BudgetTag>(count);
+    }
+
+    void MemoryBudget::setLimit(BudgetTag tag, uint64_t limitBytes)
+    {
+        entry(tag).limit.store(limitBytes, std::memory_order_relaxed);
+    }
+
+    void MemoryBudget::onReserve(BudgetTag tag, size_t bytes)
+    {
+        entry(tag).reserved.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void MemoryBudget::onRelease(BudgetTag tag, size_t bytes)
+    {
+        entry(tag).reserved.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    void MemoryBudget::onAllocate(BudgetTag tag, size_t bytes)
+    {
+        BudgetEntry& target = entry(tag);
+        const uint64_t used = target.used.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        target.allocations.fetch_add(1, std::memory_order_relaxed);
+
+        uint64_t peak = target.peak.load(std::memory_order_relaxed);
+        while (used > peak && !target.peak.compare_exchange_weak(peak, used, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void MemoryBudget::onFree(BudgetTag tag, size_t bytes)
+    {
+        entry(tag).used.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    uint32_t MemoryBudget::tagCount()
+    {
+        return g_count.load(std::memory_order_acquire);
+    }
+
+    const char* MemoryBudget::name(BudgetTag tag)
+    {
+        const char* result = entry(tag).name;
+        return result != nullptr ? result : "untagged";
+    }
+
+    MemoryAxis MemoryBudget::axis(BudgetTag tag)
+    {
+        return entry(tag).axis;
+    }
+
+    BudgetUsage MemoryBudget::usage(BudgetTag tag)
+    {
+        const BudgetEntry& source = entry(tag);
+        BudgetUsage result;
+        result.reservedBytes = source.reserved.load(std::memory_order_relaxed);
+        result.usedBytes = source.used.load(std::memory_order_relaxed);
+        result.peakUsedBytes = source.peak.load(std::memory_order_relaxed);
+        result.allocationCount = source.allocations.load(std::memory_order_relaxed);
+        result.limitBytes = source.limit.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    bool MemoryBudget::isOverBudget(BudgetTag tag)
+    {
+        const BudgetEntry& source = entry(tag);
+        const uint64_t limit = source.limit.load(std::memory_order_relaxed);
+        if (limit == 0)
+        {
+            return false;
+        }
+        const uint64_t reserved = source.reserved.load(std::memory_order_relaxed);
+        const uint64_t used = source.used.load(std::memory_order_relaxed);
+        return (reserved > used ? reserved : used) > limit;
+    }
+}
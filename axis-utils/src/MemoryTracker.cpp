@@ -0,0 +1,638 @@
+#include "axis/utils/MemoryTracker.h"
+
+#include "axis/platform/StackTrace.h"
+#include "axis/utils/FlatHashMap.h"
+#include "axis/utils/Hash.h"
+#include "axis/utils/Profiler.h"
+#include "axis/utils/SpinLock.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+
+namespace axis
+{
+    namespace
+    {
+        constexpr uint32_t kShardBits = 6;
+        constexpr uint32_t kShardCount = 1u << kShardBits;
+        // 이보다 많은 서로 다른 스택은 더 저장하지 않고 샘플링하지 않은 것으로 셉니다.
+        constexpr uint32_t kMaxStacks = 1u << 16;
+        constexpr size_t kCounterNameSize = 48;
+
+        BudgetTag trackerTag()
+        {
+            static const BudgetTag s_tag = MemoryBudget::registerTag("utils.memorytracker", MemoryAxis::Data);
+            return s_tag;
+        }
+
+        Allocator& trackerAllocator()
+        {
+            static SystemAllocator s_allocator(trackerTag());
+            return s_allocator;
+        }
+
+        struct LiveRecord
+        {
+            uint64_t bytes = 0;
+            StackId stack = kUnsampledStack;
+            BudgetTag tag = kUntaggedBudget;
+            // 다른 할당자의 풀(markReservation). 태그 집계와 스냅숏에서 뺍니다.
+            bool reservation = false;
+        };
+
+        struct alignas(64) Shard
+        {
+            SpinLock lock;
+            FlatHashMap<uintptr_t, LiveRecord> live{trackerAllocator()};
+        };
+
+        struct TagCounters
+        {
+            std::atomic<uint64_t> liveBytes{0};
+            std::atomic<uint64_t> liveCount{0};
+            std::atomic<uint64_t> highWater{0};
+            std::atomic<uint32_t> frameAllocations{0};
+            std::atomic<uint32_t> frameFrees{0};
+            std::atomic<uint64_t> frameBytes{0};
+            std::atomic<uint32_t> lastAllocations{0};
+            std::atomic<uint32_t> lastFrees{0};
+            std::atomic<uint64_t> lastBytes{0};
+            std::atomic<bool> seen{false};
+            // 프로파일러 이벤트는 이름 포인터만 저장하므로 프로세스 동안 유지되는 곳에 둡니다.
+            char allocationsName[kCounterNameSize] = {};
+        };
+
+        // 같은 스택은 한 번만 저장합니다. 샘플링한 할당만 들어오므로 잠금 하나로 충분합니다.
+        struct StackTable
+        {
+            std::mutex mutex;
+            FlatHashMap<uint64_t, StackId> byHash{trackerAllocator()};
+            // offsets[id - 1]은 id번 스택이 frames에서 끝나는 위치이고, 시작은 앞 스택의 끝입니다.
+            std::vector<void*, StlAllocator<void*>> frames{StlAllocator<void*>(trackerAllocator())};
+            std::vector<uint32_t, StlAllocator<uint32_t>> offsets{StlAllocator<uint32_t>(trackerAllocator())};
+        };
+
+        // 정적 초기화 중의 할당에서도 읽을 수 있도록 상수로 초기화되는 원자 변수로 둡니다.
+        std::atomic<bool> g_enabled{false};
+
+        struct TrackerState
+        {
+            // 정적 소멸이 끝난 뒤의 해제가 사라진 표를 건드리지 않게 합니다.
+            ~TrackerState() { g_enabled.store(false, std::memory_order_relaxed); }
+
+            Shard shards[kShardCount];
+            TagCounters tags[kMaxBudgetTags];
+            StackTable stacks;
+            MemoryTrackerDesc desc;
+            std::mutex configMutex;
+            std::atomic<uint64_t> frame{0};
+        };
+
+        TrackerState& state()
+        {
+            static TrackerState s_state;
+            return s_state;
+        }
+
+        // 추적기 안에서 일어난 할당(표가 커질 때 등)을 다시 추적하지 않습니다.
+        thread_local bool t_inside = false;
+        thread_local uint32_t t_untilSample = 0;
+
+        struct ReentryGuard
+        {
+            ReentryGuard() { t_inside = true; }
+            ~ReentryGuard() { t_inside = false; }
+        };
+
+        Shard& shardOf(uintptr_t address)
+        {
+            return state().shards[(address >> 4) * 0x9E3779B97F4A7C15ull >> (64 - kShardBits)];
+        }
+
+        TagCounters& countersOf(BudgetTag tag)
+        {
+            return state().tags[tag < kMaxBudgetTags ? tag : kUntaggedBudget];
+        }
+
+        bool shouldSample(const MemoryTrackerDesc& desc, size_t bytes)
+        {
+            if (desc.alwaysSampleBytes != 0 && bytes >= desc.alwaysSampleBytes)
+            {
+                return true;
+            }
+            if (desc.sampleInterval == 0)
+            {
+                return false;
+            }
+            if (t_untilSample == 0)
+            {
+                t_untilSample = desc.sampleInterval - 1;
+                return true;
+            }
+            --t_untilSample;
+            return false;
+        }
+
+        StackId internStack(void* const* frames, uint32_t count)
+        {
+            StackTable& table = state().stacks;
+            const uint64_t hash = xxHash64(frames, sizeof(void*) * count);
+
+            std::lock_guard<std::mutex> lock(table.mutex);
+            const auto found = table.byHash.find(hash);
+            if (found != table.byHash.end())
+            {
+                return found->second;
+            }
+            if (table.offsets.size() >= kMaxStacks)
+            {
+                return kUnsampledStack;
+            }
+
+            table.frames.insert(table.frames.end(), frames, frames + count);
+            table.offsets.push_back(static_cast<uint32_t>(table.frames.size()));
+            const StackId id = static_cast<StackId>(table.offsets.size());
+            table.byHash.emplace(hash, id);
+            return id;
+        }
+
+        void updateHighWater(std::atomic<uint64_t>& highWater, uint64_t value)
+        {
+            uint64_t current = highWater.load(std::memory_order_relaxed);
+            while (value > current && !highWater.compare_exchange_weak(current, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void addLive(BudgetTag tag, uint64_t bytes)
+        {
+            TagCounters& counters = countersOf(tag);
+            const uint64_t live = counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+            counters.liveCount.fetch_add(1, std::memory_order_relaxed);
+            counters.frameAllocations.fetch_add(1, std::memory_order_relaxed);
+            counters.frameBytes.fetch_add(bytes, std::memory_order_relaxed);
+            updateHighWater(counters.highWater, live);
+            if (!counters.seen.load(std::memory_order_relaxed))
+            {
+                counters.seen.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        void removeLive(BudgetTag tag, uint64_t bytes)
+        {
+            TagCounters& counters = countersOf(tag);
+            counters.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+            counters.liveCount.fetch_sub(1, std::memory_order_relaxed);
+            counters.frameFrees.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void resetState()
+        {
+            TrackerState& s = state();
+            for (Shard& shard : s.shards)
+            {
+                std::lock_guard<SpinLock> lock(shard.lock);
+                shard.live.clear();
+            }
+            for (TagCounters& counters : s.tags)
+            {
+                counters.liveBytes.store(0, std::memory_order_relaxed);
+                counters.liveCount.store(0, std::memory_order_relaxed);
+                counters.highWater.store(0, std::memory_order_relaxed);
+                counters.frameAllocations.store(0, std::memory_order_relaxed);
+                counters.frameFrees.store(0, std::memory_order_relaxed);
+                counters.frameBytes.store(0, std::memory_order_relaxed);
+                counters.lastAllocations.store(0, std::memory_order_relaxed);
+                counters.lastFrees.store(0, std::memory_order_relaxed);
+                counters.lastBytes.store(0, std::memory_order_relaxed);
+                counters.seen.store(false, std::memory_order_relaxed);
+            }
+        }
+
+        void appendStack(std::string& text, StackId stack)
+        {
+            if (stack == kUnsampledStack)
+            {
+                text += "      (unsampled)\n";
+                return;
+            }
+
+            void* frames[kMaxTrackedStackDepth];
+            const uint32_t count = MemoryTracker::stackFrames(stack, frames, kMaxTrackedStackDepth);
+            char line[512];
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                describeAddress(frames[i], line, sizeof(line));
+                text += "      at ";
+                text += line;
+                text += "\n";
+            }
+        }
+
+        uint64_t entryKey(BudgetTag tag, StackId stack)
+        {
+            return (uint64_t{tag} << 32) | stack;
+        }
+    }
+
+    void MemoryTracker::enable(const MemoryTrackerDesc& desc)
+    {
+        TrackerState& s = state();
+        std::lock_guard<std::mutex> lock(s.configMutex);
+
+        // 켜고 끄는 순간에 진행 중인 할당은 통계가 조금 어긋날 수 있습니다.
+        g_enabled.store(false, std::memory_order_relaxed);
+        ReentryGuard guard;
+        resetState();
+        s.desc = desc;
+        s.desc.stackDepth = std::min(desc.stackDepth, kMaxTrackedStackDepth);
+        g_enabled.store(true, std::memory_order_release);
+    }
+
+    void MemoryTracker::disable()
+    {
+        TrackerState& s = state();
+        std::lock_guard<std::mutex> lock(s.configMutex);
+        g_enabled.store(false, std::memory_order_relaxed);
+        ReentryGuard guard;
+        resetState();
+    }
+
+    bool MemoryTracker::isEnabled()
+    {
+        return g_enabled.load(std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::onAllocate(BudgetTag tag, const void* ptr, size_t bytes)
+    {
+        if (!g_enabled.load(std::memory_order_acquire) || ptr == nullptr || t_inside)
+        {
+            return;
+        }
+        ReentryGuard guard;
+        TrackerState& s = state();
+
+        StackId stack = kUnsampledStack;
+        if (s.desc.stackDepth != 0 && shouldSample(s.desc, bytes))
+        {
+            // 이 함수와 보고한 할당자의 프레임은 뺍니다.
+            void* frames[kMaxTrackedStackDepth];
+            const uint32_t count = captureStackTrace(frames, s.desc.stackDepth, 2);
+            if (count != 0)
+            {
+                stack = internStack(frames, count);
+            }
+        }
+
+        const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+        Shard& shard = shardOf(address);
+        LiveRecord replaced;
+        bool hadRecord = false;
+        {
+            std::lock_guard<SpinLock> lock(shard.lock);
+            auto result = shard.live.emplace(address);
+            if (result.first == shard.live.end())
+            {
+                return;
+            }
+            // 해제 보고 없이 같은 주소가 다시 나오면(추적을 켜기 전의 블록을 재사용하는 풀 등) 이전 기록을 덮습니다.
+            hadRecord = !result.second;
+            replaced = result.first->second;
+            result.first->second = LiveRecord{bytes, stack, tag};
+        }
+
+        if (hadRecord && !replaced.reservation)
+        {
+            removeLive(replaced.tag, replaced.bytes);
+        }
+        addLive(tag, bytes);
+    }
+
+    void MemoryTracker::onFree(const void* ptr)
+    {
+        if (!g_enabled.load(std::memory_order_acquire) || ptr == nullptr || t_inside)
+        {
+            return;
+        }
+        ReentryGuard guard;
+
+        const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+        Shard& shard = shardOf(address);
+        LiveRecord record;
+        {
+            std::lock_guard<SpinLock> lock(shard.lock);
+            const auto found = shard.live.find(address);
+            if (found == shard.live.end())
+            {
+                return;
+            }
+            record = found->second;
+            shard.live.erase(found);
+        }
+        if (!record.reservation)
+        {
+            removeLive(record.tag, record.bytes);
+        }
+    }
+
+    void MemoryTracker::markReservation(const void* ptr)
+    {
+        if (!g_enabled.load(std::memory_order_acquire) || ptr == nullptr || t_inside)
+        {
+            return;
+        }
+        ReentryGuard guard;
+
+        // 부모가 추적하지 않는 할당자(LinearArena 등)면 기록이 없으므로 할 일이 없습니다.
+        const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+        Shard& shard = shardOf(address);
+        LiveRecord record;
+        {
+            std::lock_guard<SpinLock> lock(shard.lock);
+            const auto found = shard.live.find(address);
+            if (found == shard.live.end() || found->second.reservation)
+            {
+                return;
+            }
+            found->second.reservation = true;
+            record = found->second;
+        }
+
+        // 받은 순간에 센 할당은 되돌립니다. 이번 프레임 할당 수에서도 뺍니다.
+        TagCounters& counters = countersOf(record.tag);
+        counters.liveBytes.fetch_sub(record.bytes, std::memory_order_relaxed);
+        counters.liveCount.fetch_sub(1, std::memory_order_relaxed);
+        counters.frameAllocations.fetch_sub(1, std::memory_order_relaxed);
+        counters.frameBytes.fetch_sub(record.bytes, std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::markFrame()
+    {
+        if (!g_enabled.load(std::memory_order_acquire))
+        {
+            return;
+        }
+        TrackerState& s = state();
+        s.frame.fetch_add(1, std::memory_order_relaxed);
+
+        const uint32_t tagCount = MemoryBudget::tagCount();
+        for (uint32_t tag = 0; tag < tagCount && tag < kMaxBudgetTags; ++tag)
+        {
+            TagCounters& counters = s.tags[tag];
+            const uint32_t allocations = counters.frameAllocations.exchange(0, std::memory_order_relaxed);
+            counters.lastAllocations.store(allocations, std::memory_order_relaxed);
+            counters.lastFrees.store(counters.frameFrees.exchange(0, std::memory_order_relaxed),
+                                     std::memory_order_relaxed);
+            counters.lastBytes.store(counters.frameBytes.exchange(0, std::memory_order_relaxed),
+                                     std::memory_order_relaxed);
+
+            if (!counters.seen.load(std::memory_order_relaxed))
+            {
+                continue;
+            }
+            const char* name = MemoryBudget::name(static_cast<BudgetTag>(tag));
+            if (counters.allocationsName[0] == '\0')
+            {
+                std::snprintf(counters.allocationsName, kCounterNameSize, "%s.allocs", name);
+            }
+            AXIS_PROFILE_COUNTER(name, counters.liveBytes.load(std::memory_order_relaxed));
+            AXIS_PROFILE_COUNTER(counters.allocationsName, allocations);
+        }
+    }
+
+    uint32_t MemoryTracker::tagStats(TagMemoryStats* out, uint32_t capacity)
+    {
+        TrackerState& s = state();
+        uint32_t count = 0;
+        const uint32_t tagCount = MemoryBudget::tagCount();
+        for (uint32_t tag = 0; tag < tagCount && tag < kMaxBudgetTags && count < capacity; ++tag)
+        {
+            const TagCounters& counters = s.tags[tag];
+            if (!counters.seen.load(std::memory_order_relaxed))
+            {
+                continue;
+            }
+
+            TagMemoryStats& stats = out[count++];
+            stats.tag = static_cast<BudgetTag>(tag);
+            stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+            stats.liveCount = counters.liveCount.load(std::memory_order_relaxed);
+            stats.highWaterBytes = counters.highWater.load(std::memory_order_relaxed);
+            stats.frameAllocations = counters.lastAllocations.load(std::memory_order_relaxed);
+            stats.frameFrees = counters.lastFrees.load(std::memory_order_relaxed);
+            stats.frameAllocatedBytes = counters.lastBytes.load(std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    void MemoryTracker::snapshot(MemorySnapshot& out)
+    {
+        TrackerState& s = state();
+        out.frame = s.frame.load(std::memory_order_relaxed);
+        out.totalBytes = 0;
+        out.totalCount = 0;
+        out.entries.clear();
+
+        ReentryGuard guard;
+        FlatHashMap<uint64_t, MemorySnapshotEntry> groups(trackerAllocator());
+        for (Shard& shard : s.shards)
+        {
+            // 조각 하나씩만 잠그므로 그동안 다른 조각의 할당은 계속 진행됩니다.
+            std::lock_guard<SpinLock> lock(shard.lock);
+            for (const auto& item : shard.live)
+            {
+                const LiveRecord& record = item.second;
+                if (record.reservation)
+                {
+                    continue;
+                }
+                MemorySnapshotEntry& entry = groups[entryKey(record.tag, record.stack)];
+                entry.tag = record.tag;
+                entry.stack = record.stack;
+                ++entry.count;
+                entry.bytes += record.bytes;
+            }
+        }
+
+        out.entries.reserve(groups.size());
+        for (const auto& item : groups)
+        {
+            out.entries.push_back(item.second);
+            out.totalBytes += item.second.bytes;
+            out.totalCount += item.second.count;
+        }
+        std::sort(out.entries.begin(), out.entries.end(),
+                  [](const MemorySnapshotEntry& a, const MemorySnapshotEntry& b) {
+                      return entryKey(a.tag, a.stack) < entryKey(b.tag, b.stack);
+                  });
+    }
+
+    void MemoryTracker::diff(const MemorySnapshot& before, const MemorySnapshot& after,
+                             std::vector<MemoryDiffEntry>& out)
+    {
+        out.clear();
+
+        // 두 스냅숏 모두 (tag, stack) 순으로 정렬되어 있으므로 한 번의 병합으로 맞춥니다.
+        size_t i = 0;
+        size_t j = 0;
+        while (i < before.entries.size() || j < after.entries.size())
+        {
+            const MemorySnapshotEntry* a = i < before.entries.size() ? &before.entries[i] : nullptr;
+            const MemorySnapshotEntry* b = j < after.entries.size() ? &after.entries[j] : nullptr;
+            const uint64_t keyA = a != nullptr ? entryKey(a->tag, a->stack) : ~uint64_t{0};
+            const uint64_t keyB = b != nullptr ? entryKey(b->tag, b->stack) : ~uint64_t{0};
+
+            // 한쪽에만 있는 항목은 다른 쪽을 0으로 봅니다.
+            MemoryDiffEntry entry;
+            int64_t countA = 0;
+            int64_t bytesA = 0;
+            int64_t countB = 0;
+            int64_t bytesB = 0;
+            if (a != nullptr && keyA <= keyB)
+            {
+                entry.tag = a->tag;
+                entry.stack = a->stack;
+                countA = static_cast<int64_t>(a->count);
+                bytesA = static_cast<int64_t>(a->bytes);
+                ++i;
+            }
+            if (b != nullptr && keyB <= keyA)
+            {
+                entry.tag = b->tag;
+                entry.stack = b->stack;
+                countB = static_cast<int64_t>(b->count);
+                bytesB = static_cast<int64_t>(b->bytes);
+                ++j;
+            }
+            entry.countDelta = countB - countA;
+            entry.bytesDelta = bytesB - bytesA;
+
+            if (entry.countDelta != 0 || entry.bytesDelta != 0)
+            {
+                out.push_back(entry);
+            }
+        }
+
+        std::sort(out.begin(), out.end(),
+                  [](const MemoryDiffEntry& a, const MemoryDiffEntry& b) { return a.bytesDelta > b.bytesDelta; });
+    }
+
+    uint32_t MemoryTracker::stackFrames(StackId stack, void** out, uint32_t capacity)
+    {
+        StackTable& table = state().stacks;
+        std::lock_guard<std::mutex> lock(table.mutex);
+        if (stack == kUnsampledStack || stack > table.offsets.size())
+        {
+            return 0;
+        }
+
+        const uint32_t begin = stack > 1 ? table.offsets[stack - 2] : 0;
+        const uint32_t end = table.offsets[stack - 1];
+        const uint32_t count = std::min(end - begin, capacity);
+        std::copy(table.frames.begin() + begin, table.frames.begin() + begin + count, out);
+        return count;
+    }
+
+    std::string MemoryTracker::formatSnapshot(const MemorySnapshot& snapshot, uint32_t maxEntries)
+    {
+        std::vector<MemorySnapshotEntry> sorted = snapshot.entries;
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const MemorySnapshotEntry& a, const MemorySnapshotEntry& b) { return a.bytes > b.bytes; });
+
+        char line[256];
+        std::snprintf(line, sizeof(line), "live %llu bytes in %llu allocations (frame %llu)\n",
+                      static_cast<unsigned long long>(snapshot.totalBytes),
+                      static_cast<unsigned long long>(snapshot.totalCount),
+                      static_cast<unsigned long long>(snapshot.frame));
+        std::string text = line;
+
+        const size_t count = std::min<size_t>(sorted.size(), maxEntries);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const MemorySnapshotEntry& entry = sorted[i];
+            std::snprintf(line, sizeof(line), "  %-24s %12llu bytes %8llu allocs  stack #%u\n",
+                          MemoryBudget::name(entry.tag), static_cast<unsigned long long>(entry.bytes),
+                          static_cast<unsigned long long>(entry.count), entry.stack);
+            text += line;
+            appendStack(text, entry.stack);
+        }
+        return text;
+    }
+
+    std::string MemoryTracker::formatDiff(const std::vector<MemoryDiffEntry>& diff, uint32_t maxEntries)
+    {
+        int64_t totalBytes = 0;
+        int64_t totalCount = 0;
+        for (const MemoryDiffEntry& entry : diff)
+        {
+            totalBytes += entry.bytesDelta;
+            totalCount += entry.countDelta;
+        }
+
+        char line[256];
+        std::snprintf(line, sizeof(line), "%+lld bytes, %+lld allocations\n", static_cast<long long>(totalBytes),
+                      static_cast<long long>(totalCount));
+        std::string text = line;
+
+        const size_t count = std::min<size_t>(diff.size(), maxEntries);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const MemoryDiffEntry& entry = diff[i];
+            std::snprintf(line, sizeof(line), "  %-24s %+12lld bytes %+8lld allocs  stack #%u\n",
+                          MemoryBudget::name(entry.tag), static_cast<long long>(entry.bytesDelta),
+                          static_cast<long long>(entry.countDelta), entry.stack);
+            text += line;
+            appendStack(text, entry.stack);
+        }
+        return text;
+    }
+
+    std::string MemoryTracker::formatFragmentation(Allocator* const* allocators, uint32_t allocatorCount)
+    {
+        char line[256];
+        std::string text = "budget slack (reserved but not handed out)\n";
+
+        const uint32_t tagCount = MemoryBudget::tagCount();
+        for (uint32_t tag = 0; tag < tagCount; ++tag)
+        {
+            const BudgetUsage usage = MemoryBudget::usage(static_cast<BudgetTag>(tag));
+            if (usage.reservedBytes == 0)
+            {
+                continue;
+            }
+            const uint64_t slack = usage.reservedBytes > usage.usedBytes ? usage.reservedBytes - usage.usedBytes : 0;
+            std::snprintf(line, sizeof(line), "  %-24s reserved %12llu  used %12llu  slack %12llu (%.1f%%)\n",
+                          MemoryBudget::name(static_cast<BudgetTag>(tag)),
+                          static_cast<unsigned long long>(usage.reservedBytes),
+                          static_cast<unsigned long long>(usage.usedBytes), static_cast<unsigned long long>(slack),
+                          100.0 * static_cast<double>(slack) / static_cast<double>(usage.reservedBytes));
+            text += line;
+        }
+
+        if (allocatorCount != 0)
+        {
+            text += "allocators\n";
+        }
+        for (uint32_t i = 0; i < allocatorCount; ++i)
+        {
+            Allocator* allocator = allocators[i];
+            FragmentationStats stats;
+            if (allocator == nullptr || !allocator->queryFragmentation(stats))
+            {
+                std::snprintf(line, sizeof(line), "  %-24s (no fragmentation data)\n",
+                              allocator != nullptr ? allocator->name() : "null");
+                text += line;
+                continue;
+            }
+            std::snprintf(line, sizeof(line),
+                          "  %-24s %-24s free %12llu in %6u blocks  largest %12llu  fragmentation %.2f\n",
+                          allocator->name(), MemoryBudget::name(allocator->tag()),
+                          static_cast<unsigned long long>(stats.freeBytes), stats.freeBlocks,
+                          static_cast<unsigned long long>(stats.largestFreeBlock), stats.ratio());
+            text += line;
+        }
+        return text;
+    }
+}
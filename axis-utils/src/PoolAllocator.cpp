@@ -0,0 +1,118 @@
+#include "axis/utils/PoolAllocator.h"
+
+#include "axis/utils/MemoryTracker.h"
+
+#include <cassert>
+#include <mutex>
+
+namespace axis
+{
+    PoolAllocator::PoolAllocator(size_t blockSize, size_t blockAlignment, uint32_t blocksPerPage, BudgetTag tag,
+                                 Allocator* parent, uint32_t maxPages)
+        : Allocator(tag)
+        , m_parent(parent != nullptr ? parent : &defaultAllocator())
+        , m_blockAlignment(blockAlignment < alignof(FreeBlock) ? alignof(FreeBlock) : blockAlignment)
+        , m_blocksPerPage(blocksPerPage)
+        , m_maxPages(maxPages)
+    {
+        assert(blocksPerPage > 0);
+        assert((m_blockAlignment & (m_blockAlignment - 1)) == 0);
+
+        // free list 포인터를 블록 안에 저장하므로 블록은 포인터보다 작을 수 없습니다.
+        m_blockSize = alignUp(blockSize < sizeof(FreeBlock) ? sizeof(FreeBlock) : blockSize, m_blockAlignment);
+        m_pageHeaderSize = alignUp(sizeof(PageHeader), m_blockAlignment);
+        m_pageSize = m_pageHeaderSize + m_blockSize * blocksPerPage;
+    }
+
+    PoolAllocator::~PoolAllocator()
+    {
+        assert(m_usedBlocks == 0 && "해제되지 않은 블록이 남아 있습니다");
+
+        PageHeader* page = m_pages;
+        while (page != nullptr)
+        {
+            PageHeader* next = page->next;
+            m_parent->deallocate(page, m_pageSize);
+            MemoryBudget::onRelease(tag(), m_pageSize);
+            page = next;
+        }
+    }
+
+    void* PoolAllocator::allocate(size_t size, size_t alignment)
+    {
+        assert(size <= m_blockSize && alignment <= m_blockAlignment);
+        if (size > m_blockSize || alignment > m_blockAlignment)
+        {
+            return nullptr;
+        }
+        return allocateBlock();
+    }
+
+    void PoolAllocator::deallocate(void* ptr, size_t)
+    {
+        deallocateBlock(ptr);
+    }
+
+    void* PoolAllocator::allocateBlock()
+    {
+        std::lock_guard<SpinLock> lock(m_lock);
+        if (m_freeList == nullptr && !addPage())
+        {
+            return nullptr;
+        }
+
+        FreeBlock* block = m_freeList;
+        m_freeList = block->next;
+        ++m_usedBlocks;
+        MemoryBudget::onAllocate(tag(), m_blockSize);
+        AXIS_MEMORY_TRACK_ALLOC(tag(), block, m_blockSize);
+        return block;
+    }
+
+    void PoolAllocator::deallocateBlock(void* ptr)
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard<SpinLock> lock(m_lock);
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->next = m_freeList;
+        m_freeList = block;
+        --m_usedBlocks;
+        MemoryBudget::onFree(tag(), m_blockSize);
+        AXIS_MEMORY_TRACK_FREE(ptr);
+    }
+
+    bool PoolAllocator::addPage()
+    {
+        if (m_maxPages != 0 && m_pageCount >= m_maxPages)
+        {
+            return false;
+        }
+
+        void* memory = m_parent->allocate(m_pageSize, m_blockAlignment < 64 ? 64 : m_blockAlignment);
+        if (memory == nullptr)
+        {
+            return false;
+        }
+        MemoryBudget::onReserve(tag(), m_pageSize);
+        AXIS_MEMORY_TRACK_RESERVE(memory);
+
+        PageHeader* page = static_cast<PageHeader*>(memory);
+        page->next = m_pages;
+        m_pages = page;
+        ++m_pageCount;
+
+        // 낮은 주소의 블록이 먼저 나가도록 역순으로 연결합니다.
+        uint8_t* blocks = static_cast<uint8_t*>(memory) + m_pageHeaderSize;
+        for (uint32_t i = m_blocksPerPage; i > 0; --i)
+        {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(blocks + (i - 1) * m_blockSize);
+            block->next = m_freeList;
+            m_freeList = block;
+        }
+        return true;
+    }
+}
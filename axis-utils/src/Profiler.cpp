@@ -0,0 +1,443 @@
+#include "axis/utils/Profiler.h"
+
+#include "axis/platform/Clock.h"
+#include "axis/utils/Allocator.h"
+#include "axis/utils/MemoryBudget.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace axis
+{
+    namespace
+    {
+        constexpr uint32_t kWordsPerEvent = 4;
+        constexpr size_t kThreadNameSize = 64;
+
+        uint32_t roundUpPow2(uint32_t value)
+        {
+            uint32_t result = 1;
+            while (result < value)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        // 스레드 하나의 이벤트 링 버퍼.
+        //
+        // 쓰기는 소유 스레드만 하고 읽기는 여러 스레드가 할 수 있습니다.
+        // 이벤트 필드는 relaxed 원자 변수로 저장하고, 시퀀스락처럼 reserved/committed 두 카운터로
+        // 읽는 도중 덮어써진 슬롯을 걸러 냅니다.
+        struct ThreadBuffer
+        {
+            std::atomic<uint64_t> reserved{0};
+            std::atomic<uint64_t> committed{0};
+            std::atomic<uint64_t>* words = nullptr;
+            uint32_t capacity = 0;
+            uint32_t threadId = 0;
+            uint32_t depth = 0;
+            std::atomic<bool> inUse{true};
+            char name[kThreadNameSize] = {};
+            ThreadBuffer* next = nullptr;
+
+            void write(const char* eventName, uint64_t beginNs, uint64_t durationNs, uint64_t meta)
+            {
+                const uint64_t index = committed.load(std::memory_order_relaxed);
+                reserved.store(index + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+
+                std::atomic<uint64_t>* slot = words + (index & (capacity - 1)) * kWordsPerEvent;
+                slot[0].store(reinterpret_cast<uint64_t>(eventName), std::memory_order_relaxed);
+                slot[1].store(beginNs, std::memory_order_relaxed);
+                slot[2].store(durationNs, std::memory_order_relaxed);
+                slot[3].store(meta, std::memory_order_relaxed);
+
+                committed.store(index + 1, std::memory_order_release);
+            }
+
+            // 유효한 이벤트마다 callback을 호출합니다.
+            template <typename Fn>
+            void read(Fn&& fn) const
+            {
+                const uint64_t end = committed.load(std::memory_order_acquire);
+                const uint64_t begin = end > capacity ? end - capacity : 0;
+                for (uint64_t index = begin; index < end; ++index)
+                {
+                    const std::atomic<uint64_t>* slot = words + (index & (capacity - 1)) * kWordsPerEvent;
+                    ProfileEvent event;
+                    event.name = reinterpret_cast<const char*>(slot[0].load(std::memory_order_relaxed));
+                    event.beginNs = slot[1].load(std::memory_order_relaxed);
+                    event.durationNs = slot[2].load(std::memory_order_relaxed);
+                    const uint64_t meta = slot[3].load(std::memory_order_relaxed);
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (reserved.load(std::memory_order_relaxed) > index + capacity)
+                    {
+                        // 읽는 동안 작성자가 한 바퀴 돌아 이 슬롯을 덮어썼습니다.
+                        continue;
+                    }
+
+                    event.type = static_cast<ProfileEventType>(meta & 0xFF);
+                    event.depth = static_cast<uint8_t>((meta >> 8) & 0xFF);
+                    event.threadId = threadId;
+                    fn(event);
+                }
+            }
+        };
+
+        uint64_t makeMeta(ProfileEventType type, uint32_t depth)
+        {
+            return static_cast<uint64_t>(type) | (static_cast<uint64_t>(depth > 255 ? 255 : depth) << 8);
+        }
+
+        std::atomic<bool> g_enabled{true};
+        std::atomic<uint32_t> g_bufferCapacity{1u << 16};
+        std::atomic<ThreadBuffer*> g_buffers{nullptr};
+        std::atomic<uint32_t> g_nextThreadId{1};
+        std::mutex g_registerMutex;
+
+        std::atomic<uint64_t> g_frameCount{0};
+        std::atomic<uint64_t> g_previousFrameNs{0};
+        std::atomic<uint64_t> g_lastFrameNs{0};
+
+        BudgetTag profilerTag()
+        {
+            static const BudgetTag s_tag = MemoryBudget::registerTag("utils.profiler", MemoryAxis::Time);
+            return s_tag;
+        }
+
+        ThreadBuffer* acquireBuffer()
+        {
+            std::lock_guard<std::mutex> lock(g_registerMutex);
+
+            // 종료된 스레드의 버퍼를 재사용해 스레드를 반복 생성해도 메모리가 늘지 않게 합니다.
+            for (ThreadBuffer* buffer = g_buffers.load(std::memory_order_acquire); buffer != nullptr;
+                 buffer = buffer->next)
+            {
+                if (!buffer->inUse.load(std::memory_order_relaxed))
+                {
+                    buffer->inUse.store(true, std::memory_order_relaxed);
+                    buffer->threadId = g_nextThreadId.fetch_add(1, std::memory_order_relaxed);
+                    buffer->depth = 0;
+                    buffer->name[0] = '\0';
+                    return buffer;
+                }
+            }
+
+            Allocator& allocator = defaultAllocator();
+            const uint32_t capacity = roundUpPow2(g_bufferCapacity.load(std::memory_order_relaxed));
+            ThreadBuffer* buffer = allocator.create<ThreadBuffer>();
+            const size_t wordBytes = sizeof(std::atomic<uint64_t>) * kWordsPerEvent * capacity;
+            void* words = allocator.allocate(wordBytes, 64);
+            if (buffer == nullptr || words == nullptr)
+            {
+                allocator.destroy(buffer);
+                allocator.deallocate(words, wordBytes);
+                return nullptr;
+            }
+            MemoryBudget::onReserve(profilerTag(), sizeof(ThreadBuffer) + wordBytes);
+
+            buffer->words = static_cast<std::atomic<uint64_t>*>(words);
+            for (size_t i = 0; i < size_t{capacity} * kWordsPerEvent; ++i)
+            {
+                new (&buffer->words[i]) std::atomic<uint64_t>(0);
+            }
+            buffer->capacity = capacity;
+            buffer->threadId = g_nextThreadId.fetch_add(1, std::memory_order_relaxed);
+            buffer->next = g_buffers.load(std::memory_order_relaxed);
+            g_buffers.store(buffer, std::memory_order_release);
+            return buffer;
+        }
+
+        // 스레드가 끝날 때 버퍼를 반납합니다. 이벤트는 재사용될 때까지 남아 있습니다.
+        struct ThreadBufferHandle
+        {
+            ThreadBuffer* buffer = nullptr;
+
+            ~ThreadBufferHandle()
+            {
+                if (buffer != nullptr)
+                {
+                    buffer->inUse.store(false, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        thread_local ThreadBufferHandle t_handle;
+
+        ThreadBuffer* threadBuffer()
+        {
+            if (t_handle.buffer == nullptr)
+            {
+                t_handle.buffer = acquireBuffer();
+            }
+            return t_handle.buffer;
+        }
+
+        void writeJsonString(FILE* file, const char* text)
+        {
+            std::fputc('"', file);
+            for (const char* c = text != nullptr ? text : ""; *c != '\0'; ++c)
+            {
+                const unsigned char ch = static_cast<unsigned char>(*c);
+                if (ch == '"' || ch == '\\')
+                {
+                    std::fputc('\\', file);
+                    std::fputc(ch, file);
+                }
+                else if (ch < 0x20)
+                {
+                    std::fprintf(file, "\\u%04x", ch);
+                }
+                else
+                {
+                    std::fputc(ch, file);
+                }
+            }
+            std::fputc('"', file);
+        }
+    }
+
+    void Profiler::setEnabled(bool enabled)
+    {
+        g_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool Profiler::isEnabled()
+    {
+        return g_enabled.load(std::memory_order_relaxed);
+    }
+
+    void Profiler::setThreadBufferCapacity(uint32_t eventCount)
+    {
+        g_bufferCapacity.store(eventCount < 64 ? 64 : eventCount, std::memory_order_relaxed);
+    }
+
+    void Profiler::setThreadName(const char* name)
+    {
+        ThreadBuffer* buffer = threadBuffer();
+        if (buffer == nullptr || name == nullptr)
+        {
+            return;
+        }
+        std::strncpy(buffer->name, name, kThreadNameSize - 1);
+        buffer->name[kThreadNameSize - 1] = '\0';
+    }
+
+    uint64_t Profiler::now()
+    {
+        return Clock::nowNs();
+    }
+
+    uint64_t Profiler::beginScope()
+    {
+        if (!g_enabled.load(std::memory_order_relaxed))
+        {
+            return 0;
+        }
+        ThreadBuffer* buffer = threadBuffer();
+        if (buffer == nullptr)
+        {
+            return 0;
+        }
+        ++buffer->depth;
+        return now();
+    }
+
+    void Profiler::endScope(const char* name, uint64_t beginNs)
+    {
+        if (beginNs == 0)
+        {
+            return;
+        }
+        const uint64_t endNs = now();
+        ThreadBuffer* buffer = t_handle.buffer;
+        --buffer->depth;
+        buffer->write(name, beginNs, endNs - beginNs, makeMeta(ProfileEventType::Scope, buffer->depth));
+    }
+
+    void Profiler::recordInstant(const char* name)
+    {
+        if (!g_enabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        if (ThreadBuffer* buffer = threadBuffer())
+        {
+            buffer->write(name, now(), 0, makeMeta(ProfileEventType::Instant, buffer->depth));
+        }
+    }
+
+    void Profiler::recordCounter(const char* name, uint64_t value)
+    {
+        if (!g_enabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        if (ThreadBuffer* buffer = threadBuffer())
+        {
+            buffer->write(name, now(), value, makeMeta(ProfileEventType::Counter, buffer->depth));
+        }
+    }
+
+    void Profiler::markFrame()
+    {
+        const uint64_t timestamp = now();
+        g_previousFrameNs.store(g_lastFrameNs.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        g_lastFrameNs.store(timestamp, std::memory_order_relaxed);
+        g_frameCount.fetch_add(1, std::memory_order_relaxed);
+
+        if (g_enabled.load(std::memory_order_relaxed))
+        {
+            if (ThreadBuffer* buffer = threadBuffer())
+            {
+                buffer->write("Frame", timestamp, 0, makeMeta(ProfileEventType::FrameMark, 0));
+            }
+        }
+    }
+
+    uint64_t Profiler::frameCount()
+    {
+        return g_frameCount.load(std::memory_order_relaxed);
+    }
+
+    uint64_t Profiler::lastFrameDurationNs()
+    {
+        const uint64_t previous = g_previousFrameNs.load(std::memory_order_relaxed);
+        const uint64_t last = g_lastFrameNs.load(std::memory_order_relaxed);
+        return previous != 0 && last > previous ? last - previous : 0;
+    }
+
+    uint32_t Profiler::forEachEvent(EventCallback callback, void* userData, uint64_t fromNs, uint64_t toNs)
+    {
+        uint32_t visited = 0;
+        for (ThreadBuffer* buffer = g_buffers.load(std::memory_order_acquire); buffer != nullptr;
+             buffer = buffer->next)
+        {
+            buffer->read([&](const ProfileEvent& event) {
+                if (event.beginNs >= fromNs && event.beginNs < toNs)
+                {
+                    callback(event, userData);
+                    ++visited;
+                }
+            });
+        }
+        return visited;
+    }
+
+    uint32_t Profiler::queryLastFrame(ProfileScopeStats* out, uint32_t capacity)
+    {
+        const uint64_t fromNs = g_previousFrameNs.load(std::memory_order_relaxed);
+        const uint64_t toNs = g_lastFrameNs.load(std::memory_order_relaxed);
+        if (out == nullptr || capacity == 0 || fromNs == 0 || toNs <= fromNs)
+        {
+            return 0;
+        }
+
+        struct Query
+        {
+            ProfileScopeStats* out;
+            uint32_t capacity;
+            uint32_t count;
+        } query{out, capacity, 0};
+
+        forEachEvent(
+            [](const ProfileEvent& event, void* userData) {
+                Query& q = *static_cast<Query*>(userData);
+                if (event.type != ProfileEventType::Scope || event.name == nullptr)
+                {
+                    return;
+                }
+
+                ProfileScopeStats* stats = nullptr;
+                for (uint32_t i = 0; i < q.count; ++i)
+                {
+                    if (q.out[i].name == event.name || std::strcmp(q.out[i].name, event.name) == 0)
+                    {
+                        stats = &q.out[i];
+                        break;
+                    }
+                }
+                if (stats == nullptr)
+                {
+                    if (q.count == q.capacity)
+                    {
+                        return;
+                    }
+                    stats = &q.out[q.count++];
+                    *stats = ProfileScopeStats{event.name, 0, 0, ~uint64_t{0}, 0};
+                }
+
+                ++stats->count;
+                stats->totalNs += event.durationNs;
+                stats->minNs = event.durationNs < stats->minNs ? event.durationNs : stats->minNs;
+                stats->maxNs = event.durationNs > stats->maxNs ? event.durationNs : stats->maxNs;
+            },
+            &query, fromNs, toNs);
+
+        return query.count;
+    }
+
+    bool Profiler::writeChromeTrace(const char* path)
+    {
+        FILE* file = std::fopen(path, "wb");
+        if (file == nullptr)
+        {
+            return false;
+        }
+
+        std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", file);
+        bool first = true;
+
+        for (ThreadBuffer* buffer = g_buffers.load(std::memory_order_acquire); buffer != nullptr;
+             buffer = buffer->next)
+        {
+            if (buffer->name[0] != '\0')
+            {
+                std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+                             first ? "" : ",\n", buffer->threadId);
+                writeJsonString(file, buffer->name);
+                std::fputs("}}", file);
+                first = false;
+            }
+
+            buffer->read([&](const ProfileEvent& event) {
+                std::fputs(first ? "" : ",\n", file);
+                first = false;
+
+                std::fputs("{\"name\":", file);
+                writeJsonString(file, event.name);
+                // Chrome trace의 시간 단위는 마이크로초입니다.
+                const double ts = static_cast<double>(event.beginNs) / 1000.0;
+                switch (event.type)
+                {
+                case ProfileEventType::Scope:
+                    std::fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", event.threadId,
+                                 ts, static_cast<double>(event.durationNs) / 1000.0);
+                    break;
+                case ProfileEventType::Instant:
+                    std::fprintf(file, ",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", event.threadId,
+                                 ts);
+                    break;
+                case ProfileEventType::FrameMark:
+                    std::fprintf(file, ",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", event.threadId,
+                                 ts);
+                    break;
+                case ProfileEventType::Counter:
+                    std::fprintf(file, ",\"ph\":\"C\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{\"value\":%llu}}",
+                                 event.threadId, ts, static_cast<unsigned long long>(event.durationNs));
+                    break;
+                }
+            });
+        }
+
+        std::fputs("\n]}\n", file);
+        const bool ok = std::ferror(file) == 0;
+        std::fclose(file);
+        return ok;
+    }
+}
@@ -0,0 +1,72 @@
+#include "axis/utils/RadixSort.h"
+
+#include <cstring>
+
+namespace axis
+{
+    namespace
+    {
+        constexpr uint32_t kDigitBits = 11;
+        constexpr uint32_t kBucketCount = 1u << kDigitBits;
+        constexpr uint32_t kDigitMask = kBucketCount - 1;
+        constexpr uint32_t kPassCount = (64 + kDigitBits - 1) / kDigitBits;
+    }
+
+    void radixSort(SortItem* items, SortItem* scratch, uint32_t count)
+    {
+        if (count < 2)
+        {
+            return;
+        }
+
+        // 6 x 2048 x 4바이트 = 48KB. 스택에 두어 할당을 피합니다.
+        uint32_t histograms[kPassCount][kBucketCount];
+        std::memset(histograms, 0, sizeof(histograms));
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const uint64_t key = items[i].key;
+            for (uint32_t pass = 0; pass < kPassCount; ++pass)
+            {
+                ++histograms[pass][(key >> (pass * kDigitBits)) & kDigitMask];
+            }
+        }
+
+        SortItem* source = items;
+        SortItem* target = scratch;
+        for (uint32_t pass = 0; pass < kPassCount; ++pass)
+        {
+            uint32_t* histogram = histograms[pass];
+            const uint32_t shift = pass * kDigitBits;
+
+            // 한 버킷에 모두 모였다면 이 자릿수는 순서를 바꾸지 않습니다.
+            if (histogram[(source[0].key >> shift) & kDigitMask] == count)
+            {
+                continue;
+            }
+
+            uint32_t offset = 0;
+            for (uint32_t bucket = 0; bucket < kBucketCount; ++bucket)
+            {
+                const uint32_t bucketCount = histogram[bucket];
+                histogram[bucket] = offset;
+                offset += bucketCount;
+            }
+
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const SortItem item = source[i];
+                target[histogram[(item.key >> shift) & kDigitMask]++] = item;
+            }
+
+            SortItem* swap = source;
+            source = target;
+            target = swap;
+        }
+
+        if (source != items)
+        {
+            std::memcpy(items, source, sizeof(SortItem) * count);
+        }
+    }
+}
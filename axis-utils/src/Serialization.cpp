@@ -0,0 +1,522 @@
+#include "axis/utils/Serialization.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace axis
+{
+    namespace
+    {
+        constexpr uint32_t kDeltaMagic = 0x4C445841u; // "AXDL"
+
+        struct DeltaHeader
+        {
+            uint32_t magic;
+            uint32_t reserved;
+            uint64_t baseSize;
+            uint64_t targetSize;
+            uint64_t baseHash;
+        };
+
+        static_assert(sizeof(DeltaHeader) == 32);
+
+        const uint8_t kZeroPadding[kSnapshotAlignment] = {};
+
+        uint64_t layoutRecordSize(const SerialLayout& layout)
+        {
+            return sizeof(SerialLayoutRecord) + sizeof(SerialFieldLayout) * layout.record.fieldCount;
+        }
+
+        // size를 넘는 부분은 0으로 채운 8바이트 단어.
+        uint64_t loadWord(const uint8_t* bytes, uint64_t size, uint64_t index)
+        {
+            const uint64_t offset = index * 8;
+            uint64_t word = 0;
+            if (offset + 8 <= size)
+            {
+                std::memcpy(&word, bytes + offset, 8);
+            }
+            else if (offset < size)
+            {
+                std::memcpy(&word, bytes + offset, static_cast<size_t>(size - offset));
+            }
+            return word;
+        }
+
+        void writeVarint(std::vector<uint8_t>& out, uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                out.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<uint8_t>(value));
+        }
+
+        bool readVarint(const uint8_t*& cursor, const uint8_t* end, uint64_t& value)
+        {
+            value = 0;
+            for (uint32_t shift = 0; shift < 64 && cursor < end; shift += 7)
+            {
+                const uint8_t byte = *cursor++;
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    namespace detail
+    {
+        void finalizeSerialLayout(SerialLayout& layout)
+        {
+            const uint32_t count = layout.record.fieldCount;
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                assert(layout.fields[i].offset + layout.fields[i].size <= layout.record.size);
+                for (uint32_t j = i + 1; j < count; ++j)
+                {
+                    assert(layout.fields[i].nameHash != layout.fields[j].nameHash && "필드 이름이 겹칩니다");
+                }
+            }
+
+            uint64_t hash = xxHash64(&layout.record.size, sizeof(layout.record.size));
+            hash = xxHash64(layout.fields, sizeof(SerialFieldLayout) * count, hash);
+            layout.record.layoutHash = hash;
+        }
+    }
+
+    void SnapshotWriter::clear()
+    {
+        m_sections.clear();
+        m_layouts.clear();
+    }
+
+    bool SnapshotWriter::addSection(uint64_t key, const SerialLayout* layout, const void* data, uint64_t size,
+                                    uint32_t count)
+    {
+        assert(data != nullptr || size == 0);
+
+        // 표는 키 순으로 유지합니다. 데이터도 이 순서로 쓰므로 같은 키 집합이면 배치가 매번 같습니다.
+        auto position = std::lower_bound(m_sections.begin(), m_sections.end(), key,
+                                         [](const PendingSection& section, uint64_t k) { return section.key < k; });
+        if (position != m_sections.end() && position->key == key)
+        {
+            return false;
+        }
+        m_sections.insert(position, PendingSection{key, layout, data, size, count});
+
+        if (layout != nullptr && std::find(m_layouts.begin(), m_layouts.end(), layout) == m_layouts.end())
+        {
+            m_layouts.push_back(layout);
+        }
+        return true;
+    }
+
+    uint64_t SnapshotWriter::size() const
+    {
+        uint64_t layoutBytes = 0;
+        for (const SerialLayout* layout : m_layouts)
+        {
+            layoutBytes += layoutRecordSize(*layout);
+        }
+        const uint64_t sectionsOffset = sizeof(SnapshotHeader) + layoutBytes;
+        uint64_t cursor = alignUp(sectionsOffset + sizeof(SnapshotSection) * m_sections.size(), kSnapshotAlignment);
+        for (const PendingSection& section : m_sections)
+        {
+            cursor = alignUp(cursor, kSnapshotAlignment) + section.size;
+        }
+        return cursor;
+    }
+
+    bool SnapshotWriter::emit(SinkFn sink, void* context) const
+    {
+        uint64_t layoutBytes = 0;
+        for (const SerialLayout* layout : m_layouts)
+        {
+            layoutBytes += layoutRecordSize(*layout);
+        }
+
+        SnapshotHeader header = {};
+        header.magic = kSnapshotMagic;
+        header.version = kSnapshotVersion;
+        header.layoutCount = static_cast<uint32_t>(m_layouts.size());
+        header.sectionCount = static_cast<uint32_t>(m_sections.size());
+        header.layoutsOffset = sizeof(SnapshotHeader);
+        header.sectionsOffset = header.layoutsOffset + layoutBytes;
+        header.dataOffset =
+            alignUp(header.sectionsOffset + sizeof(SnapshotSection) * m_sections.size(), kSnapshotAlignment);
+        header.totalSize = size();
+        if (!sink(context, &header, sizeof(header)))
+        {
+            return false;
+        }
+
+        for (const SerialLayout* layout : m_layouts)
+        {
+            if (!sink(context, &layout->record, sizeof(layout->record)) ||
+                !sink(context, layout->fields, sizeof(SerialFieldLayout) * layout->record.fieldCount))
+            {
+                return false;
+            }
+        }
+
+        uint64_t cursor = header.dataOffset;
+        for (const PendingSection& pending : m_sections)
+        {
+            SnapshotSection section = {};
+            section.key = pending.key;
+            section.offset = alignUp(cursor, kSnapshotAlignment);
+            section.size = pending.size;
+            section.count = pending.count;
+            section.layout = kSnapshotRawSection;
+            if (pending.layout != nullptr)
+            {
+                uint64_t layoutOffset = header.layoutsOffset;
+                for (const SerialLayout* layout : m_layouts)
+                {
+                    if (layout == pending.layout)
+                    {
+                        break;
+                    }
+                    layoutOffset += layoutRecordSize(*layout);
+                }
+                section.layout = static_cast<uint32_t>(layoutOffset);
+            }
+            if (!sink(context, &section, sizeof(section)))
+            {
+                return false;
+            }
+            cursor = section.offset + section.size;
+        }
+
+        cursor = header.sectionsOffset + sizeof(SnapshotSection) * m_sections.size();
+        for (const PendingSection& pending : m_sections)
+        {
+            const uint64_t padding = alignUp(cursor, kSnapshotAlignment) - cursor;
+            if ((padding != 0 && !sink(context, kZeroPadding, static_cast<size_t>(padding))) ||
+                (pending.size != 0 && !sink(context, pending.data, static_cast<size_t>(pending.size))))
+            {
+                return false;
+            }
+            cursor += padding + pending.size;
+        }
+
+        // 구역이 없어도 dataOffset까지는 채웁니다.
+        if (cursor < header.totalSize)
+        {
+            return sink(context, kZeroPadding, static_cast<size_t>(header.totalSize - cursor));
+        }
+        return true;
+    }
+
+    void SnapshotWriter::finish(std::vector<uint8_t>& out) const
+    {
+        out.clear();
+        out.reserve(static_cast<size_t>(size()));
+        emit(
+            [](void* context, const void* data, size_t size) {
+                auto* buffer = static_cast<std::vector<uint8_t>*>(context);
+                const uint8_t* bytes = static_cast<const uint8_t*>(data);
+                buffer->insert(buffer->end(), bytes, bytes + size);
+                return true;
+            },
+            &out);
+    }
+
+    bool SnapshotWriter::write(const char* path) const
+    {
+        std::FILE* file = std::fopen(path, "wb");
+        if (file == nullptr)
+        {
+            return false;
+        }
+        const bool written = emit(
+            [](void* context, const void* data, size_t size) {
+                return std::fwrite(data, 1, size, static_cast<std::FILE*>(context)) == size;
+            },
+            file);
+        return std::fclose(file) == 0 && written;
+    }
+
+    bool SnapshotReader::open(const void* data, uint64_t size)
+    {
+        m_header = nullptr;
+        m_sections = nullptr;
+        m_data = static_cast<const uint8_t*>(data);
+        m_size = size;
+        if (data == nullptr || size < sizeof(SnapshotHeader) ||
+            reinterpret_cast<uintptr_t>(data) % alignof(SnapshotHeader) != 0)
+        {
+            return false;
+        }
+
+        const SnapshotHeader* header = reinterpret_cast<const SnapshotHeader*>(m_data);
+        if (header->magic != kSnapshotMagic || header->version != kSnapshotVersion || header->totalSize > size ||
+            header->layoutsOffset > header->sectionsOffset || header->sectionsOffset > size ||
+            (size - header->sectionsOffset) / sizeof(SnapshotSection) < header->sectionCount ||
+            header->sectionsOffset % alignof(SnapshotSection) != 0)
+        {
+            return false;
+        }
+
+        // 표의 범위를 여기서 한 번 확인해 두면 read는 포인터 계산만 합니다.
+        const SnapshotSection* sections = reinterpret_cast<const SnapshotSection*>(m_data + header->sectionsOffset);
+        for (uint32_t i = 0; i < header->sectionCount; ++i)
+        {
+            const SnapshotSection& section = sections[i];
+            if (section.offset > size || section.size > size - section.offset ||
+                (i != 0 && sections[i - 1].key >= section.key))
+            {
+                return false;
+            }
+            if (section.layout == kSnapshotRawSection)
+            {
+                continue;
+            }
+
+            if (section.layout < header->layoutsOffset || section.layout % alignof(SerialLayoutRecord) != 0 ||
+                section.layout + sizeof(SerialLayoutRecord) > header->sectionsOffset)
+            {
+                return false;
+            }
+            const auto* record = reinterpret_cast<const SerialLayoutRecord*>(m_data + section.layout);
+            if (record->fieldCount > kMaxSerialFields ||
+                section.layout + sizeof(SerialLayoutRecord) + sizeof(SerialFieldLayout) * record->fieldCount >
+                    header->sectionsOffset ||
+                static_cast<uint64_t>(record->size) * section.count != section.size)
+            {
+                return false;
+            }
+            const auto* fields = reinterpret_cast<const SerialFieldLayout*>(record + 1);
+            for (uint32_t f = 0; f < record->fieldCount; ++f)
+            {
+                if (static_cast<uint64_t>(fields[f].offset) + fields[f].size > record->size)
+                {
+                    return false;
+                }
+            }
+        }
+
+        m_header = header;
+        m_sections = sections;
+        return true;
+    }
+
+    bool SnapshotReader::openFile(const char* path)
+    {
+        close();
+        if (!m_file.open(path))
+        {
+            return false;
+        }
+        if (!open(m_file.data(), m_file.size()))
+        {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void SnapshotReader::close()
+    {
+        m_header = nullptr;
+        m_sections = nullptr;
+        m_data = nullptr;
+        m_size = 0;
+        m_file.close();
+    }
+
+    const SnapshotSection* SnapshotReader::findSection(uint64_t key) const
+    {
+        if (m_header == nullptr)
+        {
+            return nullptr;
+        }
+        const SnapshotSection* end = m_sections + m_header->sectionCount;
+        const SnapshotSection* found = std::lower_bound(
+            m_sections, end, key, [](const SnapshotSection& section, uint64_t k) { return section.key < k; });
+        return found != end && found->key == key ? found : nullptr;
+    }
+
+    const SerialLayoutRecord* SnapshotReader::layoutOf(const SnapshotSection& section) const
+    {
+        if (section.layout == kSnapshotRawSection)
+        {
+            return nullptr;
+        }
+        return reinterpret_cast<const SerialLayoutRecord*>(m_data + section.layout);
+    }
+
+    const void* SnapshotReader::blob(uint64_t key, uint64_t& size) const
+    {
+        const SnapshotSection* section = findSection(key);
+        if (section == nullptr || section->layout != kSnapshotRawSection)
+        {
+            size = 0;
+            return nullptr;
+        }
+        size = section->size;
+        return m_data + section->offset;
+    }
+
+    void SnapshotReader::convertRecords(const SerialLayoutRecord& stored, const uint8_t* src, uint32_t count,
+                                        const SerialLayout& current, uint8_t* dst)
+    {
+        // 이름과 크기가 모두 같은 필드만 옮깁니다. 크기가 바뀐 필드는 새 필드로 보고 기본값을 둡니다.
+        struct Copy
+        {
+            uint32_t srcOffset;
+            uint32_t dstOffset;
+            uint32_t size;
+        };
+        Copy copies[kMaxSerialFields];
+        uint32_t copyCount = 0;
+
+        const auto* storedFields = reinterpret_cast<const SerialFieldLayout*>(&stored + 1);
+        for (uint32_t i = 0; i < current.record.fieldCount; ++i)
+        {
+            const SerialFieldLayout& field = current.fields[i];
+            for (uint32_t j = 0; j < stored.fieldCount; ++j)
+            {
+                if (storedFields[j].nameHash == field.nameHash && storedFields[j].size == field.size)
+                {
+                    copies[copyCount++] = Copy{storedFields[j].offset, field.offset, field.size};
+                    break;
+                }
+            }
+        }
+
+        for (uint32_t r = 0; r < count; ++r)
+        {
+            const uint8_t* record = src + static_cast<size_t>(r) * stored.size;
+            uint8_t* target = dst + static_cast<size_t>(r) * current.record.size;
+            for (uint32_t c = 0; c < copyCount; ++c)
+            {
+                std::memcpy(target + copies[c].dstOffset, record + copies[c].srcOffset, copies[c].size);
+            }
+        }
+    }
+
+    void encodeDelta(const void* base, uint64_t baseSize, const void* target, uint64_t targetSize,
+                     std::vector<uint8_t>& out)
+    {
+        const uint8_t* baseBytes = static_cast<const uint8_t*>(base);
+        const uint8_t* targetBytes = static_cast<const uint8_t*>(target);
+
+        out.clear();
+        DeltaHeader header = {};
+        header.magic = kDeltaMagic;
+        header.baseSize = baseSize;
+        header.targetSize = targetSize;
+        header.baseHash = xxHash64(base, static_cast<size_t>(baseSize));
+        out.insert(out.end(), reinterpret_cast<const uint8_t*>(&header),
+                   reinterpret_cast<const uint8_t*>(&header) + sizeof(header));
+
+        // [건너뛸 단어 수][바꿀 단어 수][XOR 단어...]의 반복. 끝에 남은 같은 단어는 기록하지 않습니다.
+        // base보다 늘어난 단어는 0이어도 리터럴로 남겨, applyDelta가 targetSize를 델타 크기로 검증할 수 있게 합니다.
+        const uint64_t wordCount = (targetSize + 7) / 8;
+        const uint64_t baseWords = (baseSize + 7) / 8;
+        auto differs = [&](uint64_t w) {
+            return w >= baseWords || loadWord(targetBytes, targetSize, w) != loadWord(baseBytes, baseSize, w);
+        };
+        uint64_t index = 0;
+        while (index < wordCount)
+        {
+            const uint64_t skipBegin = index;
+            while (index < wordCount && !differs(index))
+            {
+                ++index;
+            }
+            if (index == wordCount)
+            {
+                break;
+            }
+
+            const uint64_t literalBegin = index;
+            while (index < wordCount && differs(index))
+            {
+                ++index;
+            }
+
+            writeVarint(out, literalBegin - skipBegin);
+            writeVarint(out, index - literalBegin);
+            const size_t literalOffset = out.size();
+            out.resize(literalOffset + static_cast<size_t>(index - literalBegin) * 8);
+            for (uint64_t w = literalBegin; w < index; ++w)
+            {
+                const uint64_t word = loadWord(targetBytes, targetSize, w) ^ loadWord(baseBytes, baseSize, w);
+                std::memcpy(out.data() + literalOffset + (w - literalBegin) * 8, &word, 8);
+            }
+        }
+    }
+
+    bool applyDelta(const void* base, uint64_t baseSize, const void* delta, uint64_t deltaSize,
+                    std::vector<uint8_t>& out)
+    {
+        if (deltaSize < sizeof(DeltaHeader))
+        {
+            return false;
+        }
+        DeltaHeader header;
+        std::memcpy(&header, delta, sizeof(header));
+        if (header.magic != kDeltaMagic || header.baseSize != baseSize ||
+            header.baseHash != xxHash64(base, static_cast<size_t>(baseSize)))
+        {
+            return false;
+        }
+
+        // base보다 늘어난 단어는 모두 리터럴이므로 targetSize는 base와 리터럴 크기를 넘지 못합니다.
+        // 믿을 수 없는 헤더가 큰 할당을 요구하지 못하게 여기서 거부합니다.
+        const uint64_t baseWords = (baseSize + 7) / 8;
+        const uint64_t literalWords = (deltaSize - sizeof(DeltaHeader)) / 8;
+        if (header.targetSize > (baseWords + literalWords) * 8)
+        {
+            return false;
+        }
+
+        // 단어 단위로 다루도록 끝을 8바이트로 늘려 두었다가 마지막에 줄입니다. base 바깥은 0입니다.
+        const uint64_t wordCount = (header.targetSize + 7) / 8;
+        out.assign(static_cast<size_t>(wordCount * 8), 0);
+        const uint64_t copied = std::min(baseSize, header.targetSize);
+        if (copied != 0)
+        {
+            std::memcpy(out.data(), base, static_cast<size_t>(copied));
+        }
+
+        const uint8_t* cursor = static_cast<const uint8_t*>(delta) + sizeof(DeltaHeader);
+        const uint8_t* end = static_cast<const uint8_t*>(delta) + deltaSize;
+        uint64_t index = 0;
+        while (cursor < end)
+        {
+            uint64_t skip = 0;
+            uint64_t literals = 0;
+            if (!readVarint(cursor, end, skip) || !readVarint(cursor, end, literals))
+            {
+                return false;
+            }
+            index += skip;
+            if (index > wordCount || literals > wordCount - index ||
+                static_cast<uint64_t>(end - cursor) < literals * 8)
+            {
+                return false;
+            }
+            for (uint64_t w = 0; w < literals; ++w, ++index)
+            {
+                uint64_t word = 0;
+                uint64_t change = 0;
+                std::memcpy(&word, out.data() + index * 8, 8);
+                std::memcpy(&change, cursor + w * 8, 8);
+                word ^= change;
+                std::memcpy(out.data() + index * 8, &word, 8);
+            }
+            cursor += literals * 8;
+        }
+
+        out.resize(static_cast<size_t>(header.targetSize));
+        return true;
+    }
+}
@@ -0,0 +1,431 @@
+#include "axis/utils/StreamingManager.h"
+
+#include "ArchiveCompression.h"
+
+#include <algorithm>
+#include <cassert>
+#include <thread>
+
+namespace axis
+{
+    namespace
+    {
+        constexpr uint32_t kStaleTier = 0;   // 이번 프레임에 요청되지 않은 리소스
+        constexpr uint32_t kSurplusTier = 1; // 요청보다 정밀하게 들고 있는 단계
+        constexpr uint32_t kLowerTier = 2;   // 요청자보다 우선순위가 낮은 리소스
+
+        uint8_t rank(IoPriority priority)
+        {
+            return static_cast<uint8_t>(priority);
+        }
+    }
+
+    StreamingManager::StreamingManager(AsyncIo& io, AsyncFileId file, const AssetArchive& archive,
+                                       const StreamingDesc& desc, Allocator* allocator)
+        : m_io(io)
+        , m_file(file)
+        , m_archive(archive)
+        , m_desc(desc)
+        , m_tag(MemoryBudget::registerTag("utils.streaming", MemoryAxis::Data, desc.budgetBytes))
+        , m_systemAllocator(m_tag)
+        , m_allocator(allocator != nullptr ? *allocator : m_systemAllocator)
+        , m_loadPool(std::max(desc.maxInFlightLoads, 1u), m_tag)
+    {
+        assert(file != kInvalidAsyncFile && archive.isOpen());
+        MemoryBudget::setLimit(m_tag, desc.budgetBytes);
+        m_inFlight.reserve(m_desc.maxInFlightLoads);
+    }
+
+    StreamingManager::~StreamingManager()
+    {
+        // 읽는 중인 버퍼를 해제하지 않도록 남은 로드가 끝날 때까지 기다립니다.
+        for (LoadRequest* load : m_inFlight)
+        {
+            while (!load->io.isDone())
+            {
+                std::this_thread::yield();
+            }
+            finishLoad(*load);
+        }
+        m_inFlight.clear();
+
+        for (Resource& resource : m_resources)
+        {
+            while (resource.residentLevel < resource.levelCount)
+            {
+                evictLevel(resource);
+            }
+        }
+    }
+
+    StreamResourceId StreamingManager::addResource(const uint64_t* levelNames, uint32_t levelCount)
+    {
+        if (levelCount == 0)
+        {
+            return kInvalidStreamResource;
+        }
+
+        const uint32_t firstLevel = static_cast<uint32_t>(m_levels.size());
+        for (uint32_t i = 0; i < levelCount; ++i)
+        {
+            const ArchiveEntry* entry = m_archive.find(levelNames[i]);
+            if (entry == nullptr || entry->size == 0)
+            {
+                m_levels.resize(firstLevel);
+                return kInvalidStreamResource;
+            }
+            Level level;
+            level.entry = entry;
+            m_levels.push_back(level);
+        }
+
+        Resource resource;
+        resource.firstLevel = firstLevel;
+        resource.levelCount = levelCount;
+        resource.residentLevel = levelCount;
+        resource.desiredLevel = levelCount;
+        m_resources.push_back(resource);
+        return static_cast<StreamResourceId>(m_resources.size() - 1);
+    }
+
+    void StreamingManager::request(StreamResourceId id, uint32_t level, IoPriority priority)
+    {
+        assert(id < m_resources.size() && "등록되지 않은 리소스입니다");
+        Resource& resource = m_resources[id];
+        level = std::min(level, resource.levelCount - 1);
+        if (resource.lastRequestFrame != m_frame)
+        {
+            resource.lastRequestFrame = m_frame;
+            resource.desiredLevel = level;
+            resource.priority = priority;
+            m_requested.push_back(id);
+            return;
+        }
+        resource.desiredLevel = std::min(resource.desiredLevel, level);
+        resource.priority = rank(priority) < rank(resource.priority) ? priority : resource.priority;
+    }
+
+    void StreamingManager::update()
+    {
+        pollCompletions();
+
+        m_candidates.clear();
+        m_candidatesBuilt = false;
+
+        // setBudget으로 예산이 줄었다면 요청되지 않은 것과 남는 단계부터 내려 맞춥니다.
+        if (usedBytes() > m_desc.budgetBytes)
+        {
+            makeRoom(0, IoPriority::Low, kInvalidStreamResource);
+        }
+
+        // 급한 요청부터 예산을 가져갑니다. 같은 우선순위 안에서는 요청한 순서를 지킵니다.
+        std::stable_sort(m_requested.begin(), m_requested.end(), [this](StreamResourceId a, StreamResourceId b) {
+            return rank(m_resources[a].priority) < rank(m_resources[b].priority);
+        });
+
+        uint32_t issued = 0;
+        for (StreamResourceId id : m_requested)
+        {
+            const Resource& resource = m_resources[id];
+            if (resource.loading || resource.residentLevel <= resource.desiredLevel)
+            {
+                continue;
+            }
+            if (m_inFlight.size() >= m_desc.maxInFlightLoads || issued >= m_desc.maxLoadsPerUpdate)
+            {
+                break;
+            }
+            if (!issueLoad(id))
+            {
+                ++m_stats.budgetDeferrals;
+                break;
+            }
+            issued += resource.loading ? 1 : 0;
+        }
+
+        m_requested.clear();
+        ++m_frame;
+    }
+
+    const void* StreamingManager::levelData(StreamResourceId id, uint32_t index) const
+    {
+        const Resource& resource = m_resources[id];
+        if (index < resource.residentLevel || index >= resource.levelCount)
+        {
+            return nullptr;
+        }
+        return level(resource, index).data;
+    }
+
+    uint64_t StreamingManager::levelSize(StreamResourceId id, uint32_t index) const
+    {
+        const Resource& resource = m_resources[id];
+        return index < resource.levelCount ? level(resource, index).entry->size : 0;
+    }
+
+    void StreamingManager::setBudget(uint64_t budgetBytes)
+    {
+        m_desc.budgetBytes = budgetBytes;
+        MemoryBudget::setLimit(m_tag, budgetBytes);
+
+        // 예산이 모자라 포기했던 단계는 새 예산으로 다음 update에서 다시 시도합니다.
+        for (Level& target : m_levels)
+        {
+            if (target.state == LevelState::OverBudget)
+            {
+                target.state = LevelState::Unloaded;
+            }
+        }
+    }
+
+    void StreamingManager::pollCompletions()
+    {
+        for (size_t i = 0; i < m_inFlight.size();)
+        {
+            LoadRequest* load = m_inFlight[i];
+            if (!load->io.isDone())
+            {
+                ++i;
+                continue;
+            }
+            finishLoad(*load);
+            m_inFlight[i] = m_inFlight.back();
+            m_inFlight.pop_back();
+        }
+    }
+
+    void StreamingManager::finishLoad(LoadRequest& load)
+    {
+        Resource& resource = m_resources[load.resource];
+        Level& target = level(resource, load.level);
+        const ArchiveEntry& entry = *load.entry;
+        const bool compressed = AssetArchive::isCompressed(entry);
+
+        m_stats.inFlightBytes -= loadCost(entry);
+        if (load.staging != nullptr)
+        {
+            m_allocator.deallocate(load.staging, entry.storedSize);
+        }
+
+        const bool succeeded = load.io.result == IoStatus::Completed &&
+                               (compressed ? load.decoded : load.io.bytesRead == entry.size);
+        if (succeeded)
+        {
+            assert(load.level + 1 == resource.residentLevel && "단계가 거친 쪽부터 채워지지 않았습니다");
+            target.state = LevelState::Resident;
+            resource.residentLevel = load.level;
+            m_stats.residentBytes += entry.size;
+            ++m_stats.loadsCompleted;
+        }
+        else
+        {
+            // 실패한 단계는 다시 시도하지 않습니다. 리소스는 그보다 거친 단계에 머뭅니다.
+            m_allocator.deallocate(target.data, entry.size);
+            target.data = nullptr;
+            target.state = LevelState::Failed;
+            ++m_stats.loadsFailed;
+        }
+
+        resource.loading = false;
+        m_loadPool.destroy(&load);
+    }
+
+    bool StreamingManager::issueLoad(StreamResourceId id)
+    {
+        Resource& resource = m_resources[id];
+        const uint32_t index = resource.residentLevel - 1;
+        Level& target = level(resource, index);
+        if (target.state == LevelState::Failed || target.state == LevelState::OverBudget)
+        {
+            return true;
+        }
+
+        const ArchiveEntry& entry = *target.entry;
+        const bool compressed = AssetArchive::isCompressed(entry);
+        const uint64_t cost = loadCost(entry);
+        const uint64_t readSize = compressed ? entry.storedSize : entry.size;
+        if (cost > m_desc.budgetBytes || readSize > 0xFFFFFFFFull)
+        {
+            // 예산 전체로도 담을 수 없는 단계입니다. 뒤의 요청을 막지 않도록 실패로 두며,
+            // 예산 때문이면 setBudget이 다시 시도할 수 있게 따로 표시합니다.
+            target.state = readSize > 0xFFFFFFFFull ? LevelState::Failed : LevelState::OverBudget;
+            ++m_stats.loadsFailed;
+            return true;
+        }
+        if (!makeRoom(cost, resource.priority, id))
+        {
+            return false;
+        }
+
+        void* data = m_allocator.allocate(entry.size, kArchiveAlignment);
+        void* staging = compressed ? m_allocator.allocate(entry.storedSize, kArchiveAlignment) : nullptr;
+        LoadRequest* load = (data != nullptr && (!compressed || staging != nullptr)) ? m_loadPool.create() : nullptr;
+        if (load == nullptr)
+        {
+            if (data != nullptr)
+            {
+                m_allocator.deallocate(data, entry.size);
+            }
+            if (staging != nullptr)
+            {
+                m_allocator.deallocate(staging, entry.storedSize);
+            }
+            return false;
+        }
+
+        load->owner = this;
+        load->entry = &entry;
+        load->resource = id;
+        load->level = index;
+        load->data = data;
+        load->staging = staging;
+        load->io.file = m_file;
+        load->io.offset = entry.offset;
+        load->io.size = static_cast<uint32_t>(readSize);
+        load->io.buffer = compressed ? staging : data;
+        load->io.priority = resource.priority;
+        load->io.callback = compressed ? &StreamingManager::decodeCompressed : nullptr;
+        load->io.userData = load;
+
+        target.data = data;
+        target.state = LevelState::Loading;
+        resource.loading = true;
+
+        m_stats.inFlightBytes += cost;
+        m_stats.peakBytes = std::max(m_stats.peakBytes, usedBytes());
+        ++m_stats.loadsIssued;
+
+        m_inFlight.push_back(load);
+        m_io.submit(load->io);
+        return true;
+    }
+
+    void StreamingManager::decodeCompressed(IoRequest& request)
+    {
+        // I/O 스레드 또는 완료 실행기에서 불립니다. 요청에 딸린 버퍼만 건드립니다.
+        LoadRequest& load = *static_cast<LoadRequest*>(request.userData);
+        const ArchiveEntry& entry = *load.entry;
+        load.decoded = false;
+        if (request.result != IoStatus::Completed || request.bytesRead != entry.storedSize)
+        {
+            return;
+        }
+
+        const uint8_t* staging = static_cast<const uint8_t*>(load.staging);
+        uint8_t* out = static_cast<uint8_t*>(load.data);
+        uint64_t written = 0;
+        for (uint32_t i = 0; i < entry.chunkCount; ++i)
+        {
+            const ArchiveChunk& info = load.owner->m_archive.chunk(entry, i);
+            const uint64_t offset = info.offset - entry.offset;
+            if (info.offset < entry.offset || offset + info.storedSize > entry.storedSize ||
+                written + info.size > entry.size)
+            {
+                return;
+            }
+            if (!detail::decompressChunk(info.compression, staging + offset, info.storedSize, out + written, info.size))
+            {
+                return;
+            }
+            written += info.size;
+        }
+        load.decoded = written == entry.size;
+    }
+
+    bool StreamingManager::makeRoom(uint64_t bytes, IoPriority priority, StreamResourceId requester)
+    {
+        if (usedBytes() + bytes <= m_desc.budgetBytes)
+        {
+            return true;
+        }
+        if (!m_candidatesBuilt)
+        {
+            buildCandidates();
+        }
+
+        // 요청마다 처음부터 훑습니다. 앞 요청이 남긴 후보(예: 그 요청자보다 급했던 리소스)도 뒤 요청자는 내릴 수 있습니다.
+        size_t cursor = 0;
+        while (cursor < m_candidates.size())
+        {
+            const EvictionCandidate& candidate = m_candidates[cursor];
+            Resource& resource = m_resources[candidate.resource];
+
+            // 이 단계 이상은 남깁니다.
+            uint32_t floor = resource.levelCount;
+            if (candidate.tier == kSurplusTier)
+            {
+                floor = resource.desiredLevel;
+            }
+            else if (candidate.tier == kLowerTier)
+            {
+                floor = rank(resource.priority) > rank(priority) ? resource.levelCount - 1 : 0;
+            }
+
+            if (candidate.resource == requester || resource.loading || resource.residentLevel >= floor)
+            {
+                ++cursor;
+                continue;
+            }
+
+            evictLevel(resource);
+            if (usedBytes() + bytes <= m_desc.budgetBytes)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void StreamingManager::buildCandidates()
+    {
+        m_candidates.clear();
+        for (StreamResourceId id = 0; id < m_resources.size(); ++id)
+        {
+            const Resource& resource = m_resources[id];
+            if (resource.residentLevel >= resource.levelCount || resource.loading)
+            {
+                continue;
+            }
+
+            uint32_t tier = kStaleTier;
+            if (resource.lastRequestFrame == m_frame)
+            {
+                tier = resource.residentLevel < resource.desiredLevel ? kSurplusTier : kLowerTier;
+                if (tier == kLowerTier && resource.residentLevel + 1 >= resource.levelCount)
+                {
+                    continue;
+                }
+            }
+            m_candidates.push_back(EvictionCandidate{tier, resource.priority, resource.lastRequestFrame, id});
+        }
+
+        // 같은 tier 안에서는 우선순위가 낮은 것(IoPriority 값이 큰 것), 그다음 오래 요청되지 않은 것부터 내립니다.
+        std::sort(m_candidates.begin(), m_candidates.end(),
+                  [](const EvictionCandidate& a, const EvictionCandidate& b) {
+                      if (a.tier != b.tier)
+                      {
+                          return a.tier < b.tier;
+                      }
+                      if (a.priority != b.priority)
+                      {
+                          return rank(a.priority) > rank(b.priority);
+                      }
+                      return a.lastRequestFrame < b.lastRequestFrame;
+                  });
+        m_candidatesBuilt = true;
+    }
+
+    void StreamingManager::evictLevel(Resource& resource)
+    {
+        Level& target = level(resource, resource.residentLevel);
+        const uint64_t size = target.entry->size;
+        m_allocator.deallocate(target.data, size);
+        target.data = nullptr;
+        target.state = LevelState::Unloaded;
+        ++resource.residentLevel;
+
+        m_stats.residentBytes -= size;
+        m_stats.evictedBytes += size;
+        ++m_stats.evictedLevels;
+    }
+}
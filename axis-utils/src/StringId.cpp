@@ -0,0 +1,314 @@
+#include "axis/utils/StringId.h"
+
+#include "axis/utils/Allocator.h"
+#include "axis/utils/MemoryBudget.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <thread>
+
+namespace axis
+{
+    namespace
+    {
+        // 열린 주소 해시 표. 슬롯은 지우지 않으므로 삽입과 조회 모두 잠금이 필요 없습니다.
+        // 표가 3/4 넘게 차면 두 배 크기의 새 표를 앞에 달고 그 뒤로는 새 표에만 넣습니다. 이전 표는 그대로 두고
+        // 조회가 새 표부터 차례로 훑으므로, 표를 옮기지 않고도 이름을 버리지 않습니다.
+        constexpr uint32_t kInitialCapacity = 1u << 16;
+        constexpr size_t kBlockSize = 64 * 1024;
+
+        struct Slot
+        {
+            std::atomic<uint64_t> hash{0};
+            std::atomic<const char*> text{nullptr};
+        };
+
+        struct Table
+        {
+            Table* previous = nullptr;
+            uint32_t capacity = 0;
+            std::atomic<uint32_t> used{0};
+
+            Slot* slots() { return reinterpret_cast<Slot*>(this + 1); }
+            const Slot* slots() const { return reinterpret_cast<const Slot*>(this + 1); }
+        };
+
+        // 문자열 저장 블록. 원자적 증가로 공간을 나누며, 블록은 프로세스가 끝날 때까지 해제하지 않습니다.
+        struct Block
+        {
+            Block* previous = nullptr;
+            size_t capacity = 0;
+            std::atomic<size_t> used{0};
+
+            char* bytes() { return reinterpret_cast<char*>(this + 1); }
+        };
+
+        // 문자열 공간을 얻지 못한 슬롯이 가리키는 자리. 충돌 검사에서 제외합니다.
+        const char kLostText[] = "";
+
+        std::atomic<Table*> g_table{nullptr};
+        std::atomic<Block*> g_block{nullptr};
+        std::atomic<uint32_t> g_count{0};
+        std::atomic<uint64_t> g_stringBytes{0};
+        std::atomic<uint32_t> g_collisions{0};
+        std::atomic<uint32_t> g_dropped{0};
+
+        BudgetTag stringTag()
+        {
+            static const BudgetTag s_tag = MemoryBudget::registerTag("utils.strings", MemoryAxis::Data);
+            return s_tag;
+        }
+
+        Block* createBlock(size_t capacity, Block* previous)
+        {
+            const size_t bytes = sizeof(Block) + capacity;
+            void* memory = defaultAllocator().allocate(bytes, alignof(Block));
+            if (memory == nullptr)
+            {
+                return nullptr;
+            }
+            MemoryBudget::onReserve(stringTag(), bytes);
+            Block* block = new (memory) Block();
+            block->previous = previous;
+            block->capacity = capacity;
+            return block;
+        }
+
+        // 널 종료 문자를 포함한 size바이트를 잡습니다.
+        char* allocateText(size_t size)
+        {
+            // 블록의 1/4을 넘는 긴 문자열은 따로 잡아 블록 끝이 낭비되지 않게 합니다.
+            if (size > kBlockSize / 4)
+            {
+                Block* block = createBlock(size, nullptr);
+                return block != nullptr ? block->bytes() : nullptr;
+            }
+
+            for (;;)
+            {
+                Block* block = g_block.load(std::memory_order_acquire);
+                if (block != nullptr)
+                {
+                    const size_t offset = block->used.fetch_add(size, std::memory_order_relaxed);
+                    if (offset + size <= block->capacity)
+                    {
+                        return block->bytes() + offset;
+                    }
+                }
+
+                // 블록이 찼습니다. 먼저 교체에 성공한 스레드의 블록을 모두가 씁니다.
+                Block* fresh = createBlock(kBlockSize, block);
+                if (fresh == nullptr)
+                {
+                    return nullptr;
+                }
+                if (!g_block.compare_exchange_strong(block, fresh, std::memory_order_acq_rel))
+                {
+                    fresh->~Block();
+                    defaultAllocator().deallocate(fresh, sizeof(Block) + kBlockSize);
+                    MemoryBudget::onRelease(stringTag(), sizeof(Block) + kBlockSize);
+                }
+            }
+        }
+
+        Table* createTable(uint32_t capacity, Table* previous)
+        {
+            const size_t bytes = sizeof(Table) + sizeof(Slot) * capacity;
+            void* memory = defaultAllocator().allocate(bytes, alignof(Table));
+            if (memory == nullptr)
+            {
+                return nullptr;
+            }
+            MemoryBudget::onReserve(stringTag(), bytes);
+            Table* table = new (memory) Table();
+            table->previous = previous;
+            table->capacity = capacity;
+            new (table->slots()) Slot[capacity];
+            return table;
+        }
+
+        // 가장 새 표를 돌려줍니다. current가 nullptr이 아니면 current가 아직 가장 새 표일 때 두 배 크기로 키웁니다.
+        // 먼저 교체에 성공한 스레드의 표를 모두가 씁니다. 새 표를 얻지 못하면 nullptr입니다.
+        Table* growTable(Table* current)
+        {
+            Table* fresh = createTable(current != nullptr ? current->capacity * 2 : kInitialCapacity, current);
+            if (fresh == nullptr)
+            {
+                return nullptr;
+            }
+            Table* expected = current;
+            if (g_table.compare_exchange_strong(expected, fresh, std::memory_order_acq_rel))
+            {
+                return fresh;
+            }
+            const size_t bytes = sizeof(Table) + sizeof(Slot) * fresh->capacity;
+            fresh->~Table();
+            defaultAllocator().deallocate(fresh, bytes);
+            MemoryBudget::onRelease(stringTag(), bytes);
+            return expected;
+        }
+
+        bool sameText(const char* stored, std::string_view text)
+        {
+            return std::strlen(stored) == text.size() && std::memcmp(stored, text.data(), text.size()) == 0;
+        }
+
+        const Slot* findIn(const Table& table, uint64_t hash)
+        {
+            const uint32_t mask = table.capacity - 1;
+            for (uint32_t probe = 0; probe < table.capacity; ++probe)
+            {
+                const Slot& slot = table.slots()[(static_cast<uint32_t>(hash) + probe) & mask];
+                const uint64_t stored = slot.hash.load(std::memory_order_acquire);
+                if (stored == hash)
+                {
+                    return &slot;
+                }
+                if (stored == 0)
+                {
+                    return nullptr;
+                }
+            }
+            return nullptr;
+        }
+
+        const Slot* findSlot(uint64_t hash, const Table* newest)
+        {
+            for (const Table* table = newest; table != nullptr; table = table->previous)
+            {
+                if (const Slot* slot = findIn(*table, hash))
+                {
+                    return slot;
+                }
+            }
+            return nullptr;
+        }
+
+        // 같은 해시가 이미 있는 슬롯의 문자열을 비교해 충돌을 셉니다.
+        void checkExisting(const Slot& slot, std::string_view text)
+        {
+            // 같은 해시를 넣는 중인 스레드가 문자열을 공개할 때까지 잠깐 기다립니다.
+            const char* existing;
+            while ((existing = slot.text.load(std::memory_order_acquire)) == nullptr)
+            {
+                std::this_thread::yield();
+            }
+            if (existing != kLostText && !sameText(existing, text))
+            {
+                g_collisions.fetch_add(1, std::memory_order_relaxed);
+                assert(false && "StringId 해시 충돌입니다");
+            }
+        }
+
+        void insert(uint64_t hash, std::string_view text)
+        {
+            if (hash == 0)
+            {
+                return;
+            }
+
+            Table* table = g_table.load(std::memory_order_acquire);
+            if (table == nullptr)
+            {
+                table = growTable(nullptr);
+            }
+
+            // 어느 표에든 이미 있으면 충돌만 검사합니다. 표가 커지는 순간 두 스레드가 같은 해시를 이전 표와 새 표에
+            // 하나씩 넣을 수는 있지만, 조회는 새 표의 것을 먼저 찾으므로 결과는 같습니다.
+            if (const Slot* slot = findSlot(hash, table))
+            {
+                checkExisting(*slot, text);
+                return;
+            }
+
+            while (table != nullptr)
+            {
+                if (table->used.load(std::memory_order_relaxed) >= table->capacity / 4 * 3)
+                {
+                    table = growTable(table);
+                    continue;
+                }
+
+                const uint32_t mask = table->capacity - 1;
+                for (uint32_t probe = 0; probe < table->capacity; ++probe)
+                {
+                    Slot& slot = table->slots()[(static_cast<uint32_t>(hash) + probe) & mask];
+                    uint64_t stored = slot.hash.load(std::memory_order_acquire);
+                    if (stored == 0)
+                    {
+                        if (slot.hash.compare_exchange_strong(stored, hash, std::memory_order_acq_rel))
+                        {
+                            // 슬롯을 차지했습니다. 문자열을 복사한 뒤 공개합니다.
+                            table->used.fetch_add(1, std::memory_order_relaxed);
+                            char* copy = allocateText(text.size() + 1);
+                            if (copy != nullptr)
+                            {
+                                std::memcpy(copy, text.data(), text.size());
+                                copy[text.size()] = '\0';
+                                g_stringBytes.fetch_add(text.size() + 1, std::memory_order_relaxed);
+                            }
+                            else
+                            {
+                                g_dropped.fetch_add(1, std::memory_order_relaxed);
+                            }
+                            slot.text.store(copy != nullptr ? copy : kLostText, std::memory_order_release);
+                            g_count.fetch_add(1, std::memory_order_relaxed);
+                            return;
+                        }
+                        // 다른 스레드가 먼저 차지했습니다. 같은 해시인지 다시 봅니다.
+                    }
+
+                    if (stored == hash)
+                    {
+                        checkExisting(slot, text);
+                        return;
+                    }
+                }
+                // 3/4 제한 안에서는 빈 슬롯이 남으므로 여기에 오지 않지만, 오면 다음 바퀴에서 키웁니다.
+                table->used.store(table->capacity, std::memory_order_relaxed);
+            }
+
+            // 새 표를 잡을 메모리가 없습니다. 조용히 버리지 않고 통계에 남깁니다.
+            g_dropped.fetch_add(1, std::memory_order_relaxed);
+            assert(false && "StringId 인턴 표를 키우지 못했습니다");
+        }
+    }
+
+    StringId StringId::intern(std::string_view text)
+    {
+        const uint64_t hash = fnv1a64(text);
+        insert(hash, text);
+        return StringId(hash);
+    }
+
+    void StringId::record(uint64_t value, std::string_view text)
+    {
+        // 이미 있으면 문자열을 비교해 충돌만 검사합니다.
+        insert(value, text);
+    }
+
+    const char* StringId::str() const
+    {
+        const Slot* slot = findSlot(m_value, g_table.load(std::memory_order_acquire));
+        if (slot == nullptr)
+        {
+            return nullptr;
+        }
+        const char* text = slot->text.load(std::memory_order_acquire);
+        return text != kLostText ? text : nullptr;
+    }
+
+    StringTableStats stringTableStats()
+    {
+        StringTableStats stats;
+        stats.count = g_count.load(std::memory_order_relaxed);
+        const Table* table = g_table.load(std::memory_order_acquire);
+        stats.capacity = table != nullptr ? table->capacity : 0;
+        stats.stringBytes = g_stringBytes.load(std::memory_order_relaxed);
+        stats.collisions = g_collisions.load(std::memory_order_relaxed);
+        stats.dropped = g_dropped.load(std::memory_order_relaxed);
+        return stats;
+    }
+}
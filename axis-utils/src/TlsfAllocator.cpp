@@ -0,0 +1,398 @@
+#include "axis/utils/TlsfAllocator.h"
+
+#include "axis/utils/MemoryTracker.h"
+
+#include <bit>
+#include <cassert>
+#include <mutex>
+
+namespace axis
+{
+    // 모든 블록 앞의 헤더. 빈 블록은 페이로드 앞 16바이트에 free list 링크를 저장합니다.
+    struct TlsfAllocator::Block
+    {
+        static constexpr size_t kFreeBit = 1;
+
+        Block* prevPhysical;
+        size_t sizeAndFlags;
+        Block* nextFree;
+        Block* prevFree;
+
+        size_t size() const { return sizeAndFlags & ~(kAlignSize - 1); }
+        void setSize(size_t size) { sizeAndFlags = size | (sizeAndFlags & kFreeBit); }
+        bool isFree() const { return (sizeAndFlags & kFreeBit) != 0; }
+        void setFree(bool free) { sizeAndFlags = free ? (sizeAndFlags | kFreeBit) : (sizeAndFlags & ~kFreeBit); }
+
+        uint8_t* payload() { return reinterpret_cast<uint8_t*>(this) + kHeaderSize; }
+        Block* next() { return reinterpret_cast<Block*>(payload() + size()); }
+
+        static Block* fromPayload(const void* ptr)
+        {
+            return reinterpret_cast<Block*>(const_cast<uint8_t*>(static_cast<const uint8_t*>(ptr)) - kHeaderSize);
+        }
+
+        static constexpr size_t kHeaderSize = sizeof(Block*) + sizeof(size_t);
+        static constexpr size_t kMinSize = sizeof(Block*) * 2;
+    };
+
+    struct TlsfAllocator::PoolHeader
+    {
+        PoolHeader* next;
+        size_t size;
+    };
+
+    namespace
+    {
+        static_assert(sizeof(void*) == 8, "TlsfAllocator는 64비트 레이아웃을 전제로 합니다");
+
+        constexpr size_t kPoolHeaderSize = 16;
+    }
+
+    TlsfAllocator::TlsfAllocator(size_t poolSize, BudgetTag tag, Allocator* parent, size_t growSize)
+        : Allocator(tag)
+        , m_parent(parent != nullptr ? parent : &defaultAllocator())
+        , m_growSize(growSize)
+    {
+        addPool(poolSize);
+    }
+
+    TlsfAllocator::~TlsfAllocator()
+    {
+        PoolHeader* pool = m_pools;
+        while (pool != nullptr)
+        {
+            PoolHeader* next = pool->next;
+            MemoryBudget::onRelease(tag(), pool->size);
+            m_parent->deallocate(pool, pool->size);
+            pool = next;
+        }
+    }
+
+    void* TlsfAllocator::allocate(size_t size, size_t alignment)
+    {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+        size_t adjusted = alignUp(size, kAlignSize);
+        if (adjusted < Block::kMinSize)
+        {
+            adjusted = Block::kMinSize;
+        }
+        if (adjusted >= kMaxBlockSize)
+        {
+            return nullptr;
+        }
+
+        // 기본 정렬보다 큰 정렬은 앞쪽 여유 공간을 잘라 내야 하므로 그만큼 더 큰 블록을 찾습니다.
+        const size_t searchSize = alignment > kAlignSize ? adjusted + alignment + Block::kHeaderSize : adjusted;
+
+        std::lock_guard<SpinLock> lock(m_lock);
+        Block* block = findFree(searchSize);
+        if (block == nullptr && m_growSize != 0)
+        {
+            // findFree는 요청을 다음 2단계 구간 경계까지 올림해 찾으므로 새 풀도 올림한 크기로 잡습니다.
+            size_t rounded = searchSize;
+            if (rounded >= kSmallBlockSize)
+            {
+                rounded += size_t{1} << (static_cast<uint32_t>(std::bit_width(rounded)) - 1 - kSlLog2);
+            }
+            const size_t needed = rounded + kPoolHeaderSize + Block::kHeaderSize * 2;
+            if (addPool(needed > m_growSize ? alignUp(needed, 64 * 1024) : m_growSize))
+            {
+                block = findFree(searchSize);
+                if (block == nullptr)
+                {
+                    // 구간 검색이 놓치더라도 새 풀의 블록이 충분히 크면 그대로 씁니다. 빈 풀이 남지 않게 합니다.
+                    Block* fresh = reinterpret_cast<Block*>(reinterpret_cast<uint8_t*>(m_pools) + kPoolHeaderSize);
+                    if (fresh->size() >= searchSize)
+                    {
+                        block = fresh;
+                    }
+                    else
+                    {
+                        removeFree(fresh);
+                        PoolHeader* pool = m_pools;
+                        m_pools = pool->next;
+                        MemoryBudget::onRelease(tag(), pool->size);
+                        m_parent->deallocate(pool, pool->size);
+                    }
+                }
+            }
+        }
+        if (block == nullptr)
+        {
+            return nullptr;
+        }
+        removeFree(block);
+
+        if (alignment > kAlignSize)
+        {
+            const uintptr_t payload = reinterpret_cast<uintptr_t>(block->payload());
+            uintptr_t aligned = alignUp(payload, alignment);
+            if (aligned != payload && aligned - payload < Block::kHeaderSize + Block::kMinSize)
+            {
+                aligned = alignUp(payload + Block::kHeaderSize + Block::kMinSize, alignment);
+            }
+
+            const size_t gap = aligned - payload;
+            if (gap != 0)
+            {
+                Block* alignedBlock = Block::fromPayload(reinterpret_cast<void*>(aligned));
+                alignedBlock->sizeAndFlags = 0;
+                alignedBlock->setSize(block->size() - gap);
+                alignedBlock->prevPhysical = block;
+                alignedBlock->next()->prevPhysical = alignedBlock;
+
+                block->setSize(gap - Block::kHeaderSize);
+                insertFree(block);
+                block = alignedBlock;
+            }
+        }
+
+        // 원래 빈 블록의 다음 블록은 사용 중이므로(즉시 병합 불변식) 잘라 낸 뒤쪽은 병합 없이 넣습니다.
+        if (Block* rest = split(block, adjusted))
+        {
+            insertFree(rest);
+        }
+
+        block->setFree(false);
+        MemoryBudget::onAllocate(tag(), block->size());
+        AXIS_MEMORY_TRACK_ALLOC(tag(), block->payload(), block->size());
+        return block->payload();
+    }
+
+    void TlsfAllocator::deallocate(void* ptr, size_t)
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard<SpinLock> lock(m_lock);
+        Block* block = Block::fromPayload(ptr);
+        assert(!block->isFree() && "이미 해제된 블록입니다");
+        MemoryBudget::onFree(tag(), block->size());
+        AXIS_MEMORY_TRACK_FREE(ptr);
+        block->setFree(true);
+
+        Block* prev = block->prevPhysical;
+        if (prev != nullptr && prev->isFree())
+        {
+            removeFree(prev);
+            prev->setSize(prev->size() + Block::kHeaderSize + block->size());
+            prev->next()->prevPhysical = prev;
+            block = prev;
+        }
+
+        Block* next = block->next();
+        if (next->isFree())
+        {
+            removeFree(next);
+            block->setSize(block->size() + Block::kHeaderSize + next->size());
+            block->next()->prevPhysical = block;
+        }
+
+        insertFree(block);
+    }
+
+    size_t TlsfAllocator::blockSize(const void* ptr) const
+    {
+        return ptr != nullptr ? Block::fromPayload(ptr)->size() : 0;
+    }
+
+    TlsfAllocator::Stats TlsfAllocator::stats()
+    {
+        std::lock_guard<SpinLock> lock(m_lock);
+
+        Stats result;
+        for (PoolHeader* pool = m_pools; pool != nullptr; pool = pool->next)
+        {
+            ++result.poolCount;
+            result.poolBytes += pool->size;
+
+            Block* block = reinterpret_cast<Block*>(reinterpret_cast<uint8_t*>(pool) + kPoolHeaderSize);
+            while (block->size() != 0)
+            {
+                if (block->isFree())
+                {
+                    ++result.freeBlocks;
+                    result.freeBytes += block->size();
+                    if (block->size() > result.largestFreeBlock)
+                    {
+                        result.largestFreeBlock = block->size();
+                    }
+                }
+                else
+                {
+                    ++result.usedBlocks;
+                    result.usedBytes += block->size();
+                }
+                block = block->next();
+            }
+        }
+        return result;
+    }
+
+    bool TlsfAllocator::queryFragmentation(FragmentationStats& out)
+    {
+        const Stats current = stats();
+        out.reservedBytes = current.poolBytes;
+        out.usedBytes = current.usedBytes;
+        out.freeBytes = current.freeBytes;
+        out.largestFreeBlock = current.largestFreeBlock;
+        out.freeBlocks = current.freeBlocks;
+        return true;
+    }
+
+    bool TlsfAllocator::addPool(size_t bytes)
+    {
+        // [PoolHeader][Block ... ][sentinel header]
+        const size_t overhead = kPoolHeaderSize + Block::kHeaderSize * 2;
+        if (bytes < overhead + Block::kMinSize)
+        {
+            return false;
+        }
+
+        void* memory = m_parent->allocate(bytes, 64);
+        if (memory == nullptr)
+        {
+            return false;
+        }
+        MemoryBudget::onReserve(tag(), bytes);
+        AXIS_MEMORY_TRACK_RESERVE(memory);
+
+        PoolHeader* pool = static_cast<PoolHeader*>(memory);
+        pool->next = m_pools;
+        pool->size = bytes;
+        m_pools = pool;
+
+        size_t blockSize = (bytes - overhead) & ~(kAlignSize - 1);
+        if (blockSize >= kMaxBlockSize)
+        {
+            blockSize = kMaxBlockSize - kAlignSize;
+        }
+
+        Block* block = reinterpret_cast<Block*>(static_cast<uint8_t*>(memory) + kPoolHeaderSize);
+        block->prevPhysical = nullptr;
+        block->sizeAndFlags = 0;
+        block->setSize(blockSize);
+        block->setFree(true);
+
+        // 크기 0의 사용 중 블록이 풀의 끝을 표시해 병합이 풀 밖으로 나가지 않게 합니다.
+        Block* sentinel = block->next();
+        sentinel->prevPhysical = block;
+        sentinel->sizeAndFlags = 0;
+
+        insertFree(block);
+        return true;
+    }
+
+    void TlsfAllocator::mapping(size_t size, uint32_t& fl, uint32_t& sl)
+    {
+        if (size < kSmallBlockSize)
+        {
+            fl = 0;
+            sl = static_cast<uint32_t>(size / (kSmallBlockSize / kSlCount));
+            return;
+        }
+
+        const uint32_t highBit = static_cast<uint32_t>(std::bit_width(size)) - 1;
+        sl = static_cast<uint32_t>(size >> (highBit - kSlLog2)) ^ kSlCount;
+        fl = highBit - (kFlShift - 1);
+    }
+
+    TlsfAllocator::Block* TlsfAllocator::findFree(size_t size)
+    {
+        // 찾은 구간의 어떤 블록이든 요청 크기 이상이 되도록 다음 구간 경계까지 올림합니다.
+        if (size >= kSmallBlockSize)
+        {
+            const uint32_t highBit = static_cast<uint32_t>(std::bit_width(size)) - 1;
+            size += (size_t{1} << (highBit - kSlLog2)) - 1;
+        }
+
+        uint32_t fl = 0;
+        uint32_t sl = 0;
+        mapping(size, fl, sl);
+        if (fl >= kFlCount)
+        {
+            return nullptr;
+        }
+
+        uint32_t slMap = m_slBitmap[fl] & (~0u << sl);
+        if (slMap == 0)
+        {
+            const uint32_t flMap = fl + 1 < 32 ? m_flBitmap & (~0u << (fl + 1)) : 0;
+            if (flMap == 0)
+            {
+                return nullptr;
+            }
+            fl = static_cast<uint32_t>(std::countr_zero(flMap));
+            slMap = m_slBitmap[fl];
+        }
+        sl = static_cast<uint32_t>(std::countr_zero(slMap));
+        return m_freeLists[fl][sl];
+    }
+
+    void TlsfAllocator::insertFree(Block* block)
+    {
+        uint32_t fl = 0;
+        uint32_t sl = 0;
+        mapping(block->size(), fl, sl);
+
+        block->setFree(true);
+        Block* head = m_freeLists[fl][sl];
+        block->nextFree = head;
+        block->prevFree = nullptr;
+        if (head != nullptr)
+        {
+            head->prevFree = block;
+        }
+        m_freeLists[fl][sl] = block;
+        m_flBitmap |= 1u << fl;
+        m_slBitmap[fl] |= 1u << sl;
+    }
+
+    void TlsfAllocator::removeFree(Block* block)
+    {
+        uint32_t fl = 0;
+        uint32_t sl = 0;
+        mapping(block->size(), fl, sl);
+
+        if (block->prevFree != nullptr)
+        {
+            block->prevFree->nextFree = block->nextFree;
+        }
+        if (block->nextFree != nullptr)
+        {
+            block->nextFree->prevFree = block->prevFree;
+        }
+        if (m_freeLists[fl][sl] == block)
+        {
+            m_freeLists[fl][sl] = block->nextFree;
+            if (block->nextFree == nullptr)
+            {
+                m_slBitmap[fl] &= ~(1u << sl);
+                if (m_slBitmap[fl] == 0)
+                {
+                    m_flBitmap &= ~(1u << fl);
+                }
+            }
+        }
+        block->setFree(false);
+    }
+
+    TlsfAllocator::Block* TlsfAllocator::split(Block* block, size_t size)
+    {
+        if (block->size() < size + Block::kHeaderSize + Block::kMinSize)
+        {
+            return nullptr;
+        }
+
+        Block* rest = reinterpret_cast<Block*>(block->payload() + size);
+        rest->sizeAndFlags = 0;
+        rest->setSize(block->size() - size - Block::kHeaderSize);
+        rest->prevPhysical = block;
+        rest->next()->prevPhysical = rest;
+        block->setSize(size);
+        return rest;
+    }
+}